@@ -648,6 +648,10 @@ bool BestPractices::PreCallValidateAllocateDescriptorSets(VkDevice device, const
                                                           VkDescriptorSet* pDescriptorSets, void* ads_state_data) const {
     bool skip = false;
     skip |= ValidationStateTracker::PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, ads_state_data);
+    // The chassis always calls this, since the state tracker part prepares the state recorded for the new sets
+    if (ValidationThrottled()) {
+        return skip;
+    }
 
     if (!skip) {
         const auto pool_state = Get<bp_state::DescriptorPool>(pAllocateInfo->descriptorPool);
@@ -1101,7 +1105,8 @@ bool BestPractices::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
                                                            void* cgpl_state_data) const {
     bool skip = StateTracker::PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                      pAllocator, pPipelines, cgpl_state_data);
-    if (skip) {
+    // The chassis always calls this, since the state tracker part creates the pipeline state that is recorded
+    if (skip || ValidationThrottled()) {
         return skip;
     }
     create_graphics_pipeline_api_state* cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state*>(cgpl_state_data);
@@ -1250,6 +1255,9 @@ bool BestPractices::PreCallValidateCreateComputePipelines(VkDevice device, VkPip
                                                           void* ccpl_state_data) const {
     bool skip = StateTracker::PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                     pAllocator, pPipelines, ccpl_state_data);
+    if (ValidationThrottled()) {
+        return skip;
+    }
 
     if ((createInfoCount > 1) && (!pipelineCache)) {
         skip |= LogPerformanceWarning(
@@ -1328,8 +1336,7 @@ bool BestPractices::ValidateCreateComputePipelineArm(const VkComputePipelineCrea
                                       kThreadGroupDispatchCountAlignmentArm);
     }
 
-    auto accessible_ids = module_state->MarkAccessibleIds(entrypoint_optional);
-    auto descriptor_uses = module_state->CollectInterfaceByDescriptorSlot(accessible_ids);
+    const auto &descriptor_uses = module_state->GetDescriptorUses(entrypoint_optional);
 
     unsigned dimensions = 0;
     if (x > 1) dimensions++;
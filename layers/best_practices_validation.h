@@ -376,7 +376,10 @@ class BestPractices : public ValidationStateTracker {
   public:
     using StateTracker = ValidationStateTracker;
 
-    BestPractices() { container_type = LayerObjectTypeBestPractices; }
+    BestPractices() {
+        container_type = LayerObjectTypeBestPractices;
+        validation_throttle_level = ValidationGovernor::kBestPracticesLevel;
+    }
 
     ReadLockGuard ReadLock() override;
     WriteLockGuard WriteLock() override;
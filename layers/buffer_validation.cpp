@@ -40,6 +40,7 @@
 #include "core_error_location.h"
 #include "shader_validation.h"
 #include "descriptor_sets.h"
+#include "layer_profiler.h"
 #include "buffer_validation.h"
 #include "sync_utils.h"
 #include "sync_vuid_maps.h"
@@ -4751,6 +4752,7 @@ struct GlobalLayoutUpdater {
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
 bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFER_STATE *pCB,
                                             GlobalImageLayoutMap &overlayLayoutMap) const {
+    VVL_PROFILE_SCOPE("CoreChecks::ValidateCmdBufImageLayouts");
     if (disabled[image_layout_validation]) return false;
     bool skip = false;
     // Iterate over the layout maps for each referenced image
@@ -4767,6 +4769,16 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
         assert(global_map);
         auto global_map_guard = global_map->ReadLock();
 
+        // Without earlier command buffers of this submission changing the image, the result only depends on the global layouts
+        const bool cacheable = overlay_map->empty();
+        const uint64_t global_version = global_map->Version();
+        if (cacheable && subres_map->IsValidatedAgainst(global_version)) {
+            sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            continue;
+        }
+        const bool prior_skip = skip;
+        skip = false;
+
         // Note: don't know if it would matter
         // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
 
@@ -4820,6 +4832,10 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 }
             }
         }
+        if (cacheable && !skip) {
+            subres_map->SetValidatedAgainst(global_version);
+        }
+        skip |= prior_skip;
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
     }
@@ -4832,7 +4848,9 @@ void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
         const auto *image_state = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
         auto guard = image_state->layout_range_map->WriteLock();
-        sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+        if (sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+            image_state->layout_range_map->IncrementVersion();
+        }
     }
 }
 
@@ -6640,19 +6658,23 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(const BUFFER_STATE *src_buffer_stat
                              ") minus pRegions[%d].dstOffset (%" PRIuLEAST64 ").",
                              func_name, i, region.size, dst_buffer_size, i, region.dstOffset);
         }
+    }
 
-        // The union of the source regions, and the union of the destination regions, must not overlap in memory
-        if (!skip && !are_buffers_sparse) {
-            auto src_region = sparse_container::range<VkDeviceSize>{region.srcOffset, region.srcOffset + region.size};
-            for (uint32_t j = 0; j < regionCount; j++) {
-                auto dst_region =
-                    sparse_container::range<VkDeviceSize>{pRegions[j].dstOffset, pRegions[j].dstOffset + pRegions[j].size};
-                if (src_buffer_state->DoesResourceMemoryOverlap(src_region, dst_buffer_state, dst_region)) {
-                    vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
-                    skip |= LogError(src_buffer_state->buffer(), vuid,
-                                     "%s: Detected overlap between source and dest regions in memory.", func_name);
-                }
-            }
+    // The union of the source regions, and the union of the destination regions, must not overlap in memory
+    if (!skip && !are_buffers_sparse) {
+        std::vector<sparse_container::range<VkDeviceSize>> src_ranges;
+        std::vector<sparse_container::range<VkDeviceSize>> dst_ranges;
+        src_ranges.reserve(regionCount);
+        dst_ranges.reserve(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            const RegionType &region = pRegions[i];
+            src_ranges.emplace_back(region.srcOffset, region.srcOffset + region.size);
+            dst_ranges.emplace_back(region.dstOffset, region.dstOffset + region.size);
+        }
+        if (src_buffer_state->DoResourceMemoryRangesOverlap(src_ranges, dst_buffer_state, dst_ranges)) {
+            vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-00117" : "VUID-vkCmdCopyBuffer-pRegions-00117";
+            skip |= LogError(src_buffer_state->buffer(), vuid, "%s: Detected overlap between source and dest regions in memory.",
+                             func_name);
         }
     }
 
@@ -6725,6 +6747,8 @@ void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer src
 
         std::vector<sparse_container::range<VkDeviceSize>> src_ranges;
         std::vector<sparse_container::range<VkDeviceSize>> dst_ranges;
+        src_ranges.reserve(regionCount);
+        dst_ranges.reserve(regionCount);
 
         for (uint32_t i = 0u; i < regionCount; ++i) {
             const RegionType &region = pRegions[i];
@@ -6736,13 +6760,9 @@ void CoreChecks::RecordCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer src
                                            const ValidationStateTracker &device_data, const class QUEUE_STATE &queue_state,
                                            const CMD_BUFFER_STATE &cb_state) -> bool {
             bool skip = false;
-            for (const auto &src : src_ranges) {
-                for (const auto &dst : dst_ranges) {
-                    if (src_buffer_state->DoesResourceMemoryOverlap(src, dst_buffer_state.get(), dst)) {
-                        skip |= this->LogError(src_buffer_state->buffer(), vuid,
-                                               "%s: Detected overlap between source and dest regions in memory.", func_name);
-                    }
-                }
+            if (src_buffer_state->DoResourceMemoryRangesOverlap(src_ranges, dst_buffer_state.get(), dst_ranges)) {
+                skip |= this->LogError(src_buffer_state->buffer(), vuid,
+                                       "%s: Detected overlap between source and dest regions in memory.", func_name);
             }
 
             return skip;
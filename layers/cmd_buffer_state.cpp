@@ -207,6 +207,7 @@ void CMD_BUFFER_STATE::Reset() {
     // Clean up the label data
     debug_label.Reset();
     validate_descriptorsets_in_queuesubmit.clear();
+    queue_submit_draw_info_index.clear();
 
     // Best practices info
     small_indexed_draw_call_count = 0;
@@ -369,28 +370,25 @@ ImageSubresourceLayoutMap *CMD_BUFFER_STATE::GetImageSubresourceLayoutMap(const
     return layout_map.get();
 }
 
-static bool SetQueryState(QueryObject object, QueryState value, QueryMap *localQueryToStateMap) {
-    (*localQueryToStateMap)[object] = value;
-    return false;
+void CMD_BUFFER_STATE::CmdDrawDispatchInfo::AddBinding(const BindingReqMap::value_type *binding_info) {
+    auto it = std::lower_bound(
+        binding_infos.begin(), binding_infos.end(), binding_info,
+        [](const BindingReqMap::value_type *a, const BindingReqMap::value_type *b) { return a->first < b->first; });
+    if (it == binding_infos.end() || (*it)->first != binding_info->first) {
+        binding_infos.insert(it, binding_info);
+    }
 }
 
 void CMD_BUFFER_STATE::BeginQuery(const QueryObject &query_obj) {
     activeQueries.insert(query_obj);
     startedQueries.insert(query_obj);
-    queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_RUNNING, localQueryToStateMap);
-        return false;
-    });
+    queryUpdates.emplace_back(QueryUpdate::SetState(query_obj, 1, QUERYSTATE_RUNNING));
     updatedQueries.insert(query_obj);
 }
 
 void CMD_BUFFER_STATE::EndQuery(const QueryObject &query_obj) {
     activeQueries.erase(query_obj);
-    queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                          uint32_t perfQueryPass, QueryMap *localQueryToStateMap) {
-        return SetQueryState(QueryObject(query_obj, perfQueryPass), QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    queryUpdates.emplace_back(QueryUpdate::SetState(query_obj, 1, QUERYSTATE_ENDED));
     updatedQueries.insert(query_obj);
 }
 
@@ -407,26 +405,13 @@ bool CMD_BUFFER_STATE::UpdatesQuery(const QueryObject &query_obj) const {
     return updatedQueries.find(key) != updatedQueries.end();
 }
 
-static bool SetQueryStateMulti(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, uint32_t perfPass, QueryState value,
-                               QueryMap *localQueryToStateMap) {
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject object = QueryObject(QueryObject(queryPool, firstQuery + i), perfPass);
-        (*localQueryToStateMap)[object] = value;
-    }
-    return false;
-}
-
 void CMD_BUFFER_STATE::EndQueries(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     for (uint32_t slot = firstQuery; slot < (firstQuery + queryCount); slot++) {
         QueryObject query = {queryPool, slot};
         activeQueries.erase(query);
         updatedQueries.insert(query);
     }
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_ENDED, localQueryToStateMap);
-    });
+    queryUpdates.emplace_back(QueryUpdate::SetState(QueryObject(queryPool, firstQuery), queryCount, QUERYSTATE_ENDED));
 }
 
 void CMD_BUFFER_STATE::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
@@ -436,11 +421,7 @@ void CMD_BUFFER_STATE::ResetQueryPool(VkQueryPool queryPool, uint32_t firstQuery
         updatedQueries.insert(query);
     }
 
-    queryUpdates.emplace_back([queryPool, firstQuery, queryCount](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                                  VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                                  QueryMap *localQueryToStateMap) {
-        return SetQueryStateMulti(queryPool, firstQuery, queryCount, perfQueryPass, QUERYSTATE_RESET, localQueryToStateMap);
-    });
+    queryUpdates.emplace_back(QueryUpdate::SetState(QueryObject(queryPool, firstQuery), queryCount, QUERYSTATE_RESET));
 }
 
 void UpdateSubpassAttachments(const safe_VkSubpassDescription2 &subpass, std::vector<SUBPASS_INFO> &subpasses) {
@@ -769,20 +750,9 @@ void CMD_BUFFER_STATE::ExecuteCommands(uint32_t commandBuffersCount, const VkCom
         AddChild(sub_cb_state);
         // Add a query update that runs all the query updates that happen in the sub command buffer.
         // This avoids locking ambiguity because primary command buffers are locked when these
-        // callbacks run, but secondary command buffers are not.
-        queryUpdates.push_back([sub_command_buffer](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                    VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                                    QueryMap *localQueryToStateMap) {
-            bool skip = false;
-            auto sub_cb_state_arg = cb_state_arg.dev_data->GetWrite<CMD_BUFFER_STATE>(sub_command_buffer);
-            for (auto &function : sub_cb_state_arg->queryUpdates) {
-                skip |= function(*sub_cb_state_arg, do_validate, firstPerfQueryPool, perfQueryPass, localQueryToStateMap);
-            }
-            return skip;
-        });
-        for (auto &function : sub_cb_state->eventUpdates) {
-            eventUpdates.push_back(function);
-        }
+        // updates run, but secondary command buffers are not.
+        queryUpdates.emplace_back(QueryUpdate::ExecuteCommands(sub_command_buffer));
+        eventUpdates.insert(eventUpdates.end(), sub_cb_state->eventUpdates.begin(), sub_cb_state->eventUpdates.end());
         for (auto &function : sub_cb_state->queue_submit_functions) {
             queue_submit_functions.push_back(function);
         }
@@ -870,7 +840,8 @@ void CMD_BUFFER_STATE::UpdatePipelineState(CMD_TYPE cmd_type, const VkPipelineBi
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &state = lastBound[lv_bind_point];
     PIPELINE_STATE *pipe = state.pipeline_state;
-    if (VK_NULL_HANDLE != state.pipeline_layout) {
+    // Descriptor sets can be bound without a pipeline, which is reported by validation, but the call may still be made
+    if (pipe && VK_NULL_HANDLE != state.pipeline_layout) {
         for (const auto &set_binding_pair : pipe->active_slots) {
             uint32_t set_index = set_binding_pair.first;
             if (set_index >= state.per_set.size()) {
@@ -889,7 +860,9 @@ void CMD_BUFFER_STATE::UpdatePipelineState(CMD_TYPE cmd_type, const VkPipelineBi
             cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
             const auto &binding_req_map = reduced_map.FilteredMap(*this, *pipe);
 
-            if (reduced_map.IsManyDescriptors()) {
+            // The cache is shared by the bind points, so it is not updated for the commands that draw validation sampling did not
+            // validate, which would let the next validated command of another bind point skip their descriptors
+            if (reduced_map.IsManyDescriptors() && !state.draw_state_unvalidated) {
                 // Only update validate binding tags if we meet the "many" criteria in the Prefilter class
                 descriptor_set->UpdateValidationCache(*this, *pipe, binding_req_map);
             }
@@ -922,9 +895,9 @@ void CMD_BUFFER_STATE::UpdatePipelineState(CMD_TYPE cmd_type, const VkPipelineBi
                                         state.per_set[set_index].validated_set_binding_req_map.begin(),
                                         state.per_set[set_index].validated_set_binding_req_map.end(),
                                         layer_data::insert_iterator<BindingReqMap>(delta_reqs, delta_reqs.begin()));
-                    descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, delta_reqs);
+                    descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, set_binding_pair.second, delta_reqs);
                 } else {
-                    descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, binding_req_map);
+                    descriptor_set->UpdateDrawState(dev_data, this, cmd_type, pipe, set_binding_pair.second, binding_req_map);
                 }
 
                 state.per_set[set_index].validated_set = descriptor_set.get();
@@ -1130,11 +1103,6 @@ void CMD_BUFFER_STATE::RecordTransferCmd(CMD_TYPE cmd_type, std::shared_ptr<BIND
     }
 }
 
-static bool SetEventStageMask(VkEvent event, VkPipelineStageFlags2KHR stageMask, EventToStageMap *localEventToStageMap) {
-    (*localEventToStageMap)[event] = stageMask;
-    return false;
-}
-
 void CMD_BUFFER_STATE::RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
     RecordCmd(cmd_type);
     if (!dev_data->disabled[command_buffer_state]) {
@@ -1147,9 +1115,7 @@ void CMD_BUFFER_STATE::RecordSetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipeli
     if (!waitedEvents.count(event)) {
         writeEventsBeforeWait.push_back(event);
     }
-    eventUpdates.emplace_back([event, stageMask](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, stageMask, localEventToStageMap);
-    });
+    eventUpdates.emplace_back(EventUpdate::SetStageMask(event, stageMask));
 }
 
 void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipelineStageFlags2KHR stageMask) {
@@ -1165,9 +1131,7 @@ void CMD_BUFFER_STATE::RecordResetEvent(CMD_TYPE cmd_type, VkEvent event, VkPipe
         writeEventsBeforeWait.push_back(event);
     }
 
-    eventUpdates.emplace_back([event](CMD_BUFFER_STATE &, bool do_validate, EventToStageMap *localEventToStageMap) {
-        return SetEventStageMask(event, VkPipelineStageFlags2KHR(0), localEventToStageMap);
-    });
+    eventUpdates.emplace_back(EventUpdate::SetStageMask(event, VkPipelineStageFlags2KHR(0)));
 }
 
 void CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent *pEvents,
@@ -1234,22 +1198,68 @@ void CMD_BUFFER_STATE::RecordWriteTimestamp(CMD_TYPE cmd_type, VkPipelineStageFl
     EndQuery(query);
 }
 
+bool CMD_BUFFER_STATE::ReplayEventUpdates(bool do_validate, EventToStageMap *localEventToStageMap) {
+    bool skip = false;
+    for (const auto &update : eventUpdates) {
+        switch (update.type) {
+            case EventUpdate::kSetStageMask:
+                (*localEventToStageMap)[update.event] = update.stage_mask;
+                break;
+            default:
+                if (do_validate) {
+                    skip |= ValidateEventUpdate(update, localEventToStageMap);
+                }
+                break;
+        }
+    }
+    return skip;
+}
+
+bool CMD_BUFFER_STATE::ReplayQueryUpdates(bool do_validate, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                                          QueryMap *localQueryToStateMap) {
+    bool skip = false;
+    // Invalid commands are recorded too, so the ranges are clamped to the size of the pool. Pools that no longer exist have
+    // no queries left to update.
+    VkQueryPool last_pool = VK_NULL_HANDLE;
+    uint32_t last_pool_query_count = 0;
+    for (const auto &update : queryUpdates) {
+        switch (update.type) {
+            case QueryUpdate::kSetState:
+                if (update.query.pool != last_pool) {
+                    auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(update.query.pool);
+                    last_pool = update.query.pool;
+                    last_pool_query_count = query_pool_state ? query_pool_state->createInfo.queryCount : 0;
+                }
+                localQueryToStateMap->SetState(update.query.pool, perfQueryPass, update.query.query, update.count,
+                                               last_pool_query_count, update.state);
+                break;
+            case QueryUpdate::kExecuteCommands: {
+                auto sub_cb_state = dev_data->GetWrite<CMD_BUFFER_STATE>(update.secondary);
+                skip |= sub_cb_state->ReplayQueryUpdates(do_validate, firstPerfQueryPool, perfQueryPass, localQueryToStateMap);
+                break;
+            }
+            default:
+                if (do_validate) {
+                    skip |= ValidateQueryUpdate(update, firstPerfQueryPool, perfQueryPass, localQueryToStateMap);
+                }
+                break;
+        }
+    }
+    return skip;
+}
+
 void CMD_BUFFER_STATE::Submit(uint32_t perf_submit_pass) {
     VkQueryPool first_pool = VK_NULL_HANDLE;
     EventToStageMap local_event_to_stage_map;
     QueryMap local_query_to_state_map;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
+    ReplayQueryUpdates(/*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
 
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_state_pair.first.pool);
-        query_pool_state->SetQueryState(query_state_pair.first.query, query_state_pair.first.perf_pass, query_state_pair.second);
+    for (const auto &pool_states : local_query_to_state_map) {
+        auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(pool_states.first.first);
+        query_pool_state->MergeQueryStates(pool_states.second.first, pool_states.first.second, pool_states.second.states);
     }
 
-    for (const auto &function : eventUpdates) {
-        function(*this, /*do_validate*/ false, &local_event_to_stage_map);
-    }
+    ReplayEventUpdates(/*do_validate*/ false, &local_event_to_stage_map);
 
     for (const auto &eventStagePair : local_event_to_stage_map) {
         auto event_state = dev_data->Get<EVENT_STATE>(eventStagePair.first);
@@ -1267,14 +1277,19 @@ void CMD_BUFFER_STATE::Retire(uint32_t perf_submit_pass, const std::function<boo
     }
     QueryMap local_query_to_state_map;
     VkQueryPool first_pool = VK_NULL_HANDLE;
-    for (auto &function : queryUpdates) {
-        function(*this, /*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
-    }
-
-    for (const auto &query_state_pair : local_query_to_state_map) {
-        if (query_state_pair.second == QUERYSTATE_ENDED && !is_query_updated_after(query_state_pair.first)) {
-            auto query_pool_state = dev_data->Get<QUERY_POOL_STATE>(query_state_pair.first.pool);
-            query_pool_state->SetQueryState(query_state_pair.first.query, query_state_pair.first.perf_pass, QUERYSTATE_AVAILABLE);
+    ReplayQueryUpdates(/*do_validate*/ false, first_pool, perf_submit_pass, &local_query_to_state_map);
+
+    for (const auto &pool_states : local_query_to_state_map) {
+        const VkQueryPool pool = pool_states.first.first;
+        const uint32_t perf_pass = pool_states.first.second;
+        std::shared_ptr<QUERY_POOL_STATE> query_pool_state;
+        for (size_t i = 0; i < pool_states.second.states.size(); ++i) {
+            if (pool_states.second.states[i] != QUERYSTATE_ENDED) continue;
+            const uint32_t query = pool_states.second.first + static_cast<uint32_t>(i);
+            if (!is_query_updated_after(QueryObject(QueryObject(pool, query), perf_pass))) {
+                if (!query_pool_state) query_pool_state = dev_data->Get<QUERY_POOL_STATE>(pool);
+                query_pool_state->SetQueryState(query, perf_pass, QUERYSTATE_AVAILABLE);
+            }
         }
     }
 }
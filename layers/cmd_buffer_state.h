@@ -35,6 +35,7 @@
 #include "device_state.h"
 #include "descriptor_sets.h"
 #include "qfo_transfer.h"
+#include "flat_hash_map.h"
 
 struct SUBPASS_INFO;
 class FRAMEBUFFER_STATE;
@@ -83,6 +84,77 @@ constexpr static auto kInvalidLayout = image_layout_map::kInvalidLayout;
 using ImageSubresourceLayoutMap = image_layout_map::ImageSubresourceLayoutMap;
 typedef layer_data::unordered_map<VkEvent, VkPipelineStageFlags2KHR> EventToStageMap;
 
+// Query operations deferred until queue submit (and retire) time. Command buffers record these by value and replay them in
+// order with a switch, so recording a query command doesn't allocate a closure. The Verify* types only carry the parameters
+// of a check, the check itself is implemented by the CMD_BUFFER_STATE subclass of the validation object that recorded it.
+struct QueryUpdate {
+    enum Type : uint8_t {
+        kSetState,         // Set queries [query.query, query.query + count) of query.pool to state
+        kExecuteCommands,  // Replay the query updates of the secondary command buffer
+        kVerifyBegin,      // Begin of query
+        kVerifyEnd,        // End of query
+        kVerifyReset,      // Queries [query.query, query.query + count) must be reset
+        kCopyResults,      // Copy of the results of queries [query.query, query.query + count)
+    };
+
+    Type type;
+    QueryState state;
+    CMD_TYPE cmd_type;
+    uint32_t count;
+    VkQueryResultFlags flags;
+    VkCommandBuffer secondary;
+    QueryObject query;
+
+    QueryUpdate(Type type_, const QueryObject &query_, uint32_t count_ = 1)
+        : type(type_),
+          state(QUERYSTATE_UNKNOWN),
+          cmd_type(CMD_NONE),
+          count(count_),
+          flags(0),
+          secondary(VK_NULL_HANDLE),
+          query(query_) {}
+
+    static QueryUpdate SetState(const QueryObject &query, uint32_t count, QueryState state) {
+        QueryUpdate update(kSetState, query, count);
+        update.state = state;
+        return update;
+    }
+    static QueryUpdate ExecuteCommands(VkCommandBuffer secondary) {
+        QueryUpdate update(kExecuteCommands, QueryObject(VK_NULL_HANDLE, 0), 0);
+        update.secondary = secondary;
+        return update;
+    }
+    static QueryUpdate Verify(Type type, const QueryObject &query, uint32_t count, CMD_TYPE cmd_type,
+                              VkQueryResultFlags flags = 0) {
+        QueryUpdate update(type, query, count);
+        update.cmd_type = cmd_type;
+        update.flags = flags;
+        return update;
+    }
+};
+
+// Event operations deferred until queue submit time, recorded and replayed like QueryUpdate.
+struct EventUpdate {
+    enum Type : uint8_t {
+        kSetStageMask,  // Set the stage mask of event to stage_mask
+        kVerifyWait,    // Wait on events [first_event_index, first_event_index + event_count) with src stage_mask
+    };
+
+    Type type;
+    VkEvent event;
+    VkPipelineStageFlags2KHR stage_mask;
+    // kVerifyWait: the range of CMD_BUFFER_STATE::events waited on
+    size_t first_event_index;
+    size_t event_count;
+
+    static EventUpdate SetStageMask(VkEvent event, VkPipelineStageFlags2KHR stage_mask) {
+        return {kSetStageMask, event, stage_mask, 0, 0};
+    }
+    static EventUpdate VerifyWait(size_t first_event_index, size_t event_count, VkPipelineStageFlags2KHR src_stage_mask) {
+        return {kVerifyWait, VK_NULL_HANDLE, src_stage_mask, first_event_index, event_count};
+    }
+};
+
 // Track command pools and their command buffers
 class COMMAND_POOL_STATE : public BASE_NODE {
   public:
@@ -173,6 +245,9 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     CB_STATE state;         // Track cmd buffer update state
     uint64_t commandCount;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
     uint64_t submitCount;   // Number of times CB has been submitted
+    // Number of draws and dispatches considered for draw validation sampling. It is not reset with the command buffer, so that
+    // a command buffer recorded again with the same commands has a different subset of them validated.
+    mutable std::atomic<uint64_t> draw_validation_count{0};
     bool pipeline_bound = false;  // True if CmdBindPipeline has been called on this command buffer, false otherwise
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
@@ -191,15 +266,45 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     std::shared_ptr<const CMD_BUFFER_STATE> shared_from_this() const { return SharedFromThisImpl(this); }
     std::shared_ptr<CMD_BUFFER_STATE> shared_from_this() { return SharedFromThisImpl(this); }
 
+    // Descriptor bindings validated at queue submit time. Draws and dispatches that use a set with the same pipeline in the same
+    // render pass instance share one record, so each binding is validated once per submit rather than once per command.
     struct CmdDrawDispatchInfo {
         CMD_TYPE cmd_type;
-        std::vector<std::pair<const uint32_t, DescriptorRequirement>> binding_infos;
+        // Sorted by binding number. Points into pipeline->active_slots, so the requirements aren't copied per command.
+        std::vector<const BindingReqMap::value_type *> binding_infos;
+        std::shared_ptr<const PIPELINE_STATE> pipeline;
         VkFramebuffer framebuffer;
         std::shared_ptr<std::vector<SUBPASS_INFO>> subpasses;
         std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> attachments;
+
+        void AddBinding(const BindingReqMap::value_type *binding_info);
     };
     layer_data::unordered_map<VkDescriptorSet, std::vector<CmdDrawDispatchInfo>> validate_descriptorsets_in_queuesubmit;
 
+    // The set and command state shared by the commands of one CmdDrawDispatchInfo. The pointers can't be reused for other
+    // objects while the record holds them.
+    struct CmdDrawDispatchKey {
+        VkDescriptorSet set;
+        CMD_TYPE cmd_type;
+        const PIPELINE_STATE *pipeline;
+        VkFramebuffer framebuffer;
+        const std::vector<SUBPASS_INFO> *subpasses;
+        const std::vector<IMAGE_VIEW_STATE *> *attachments;
+
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << set << cmd_type << pipeline << framebuffer << subpasses << attachments;
+            return hc.Value();
+        }
+        bool operator==(const CmdDrawDispatchKey &rhs) const {
+            return set == rhs.set && cmd_type == rhs.cmd_type && pipeline == rhs.pipeline && framebuffer == rhs.framebuffer &&
+                   subpasses == rhs.subpasses && attachments == rhs.attachments;
+        }
+    };
+    using CmdDrawDispatchKeyHash = hash_util::HasHashMember<CmdDrawDispatchKey>;
+    // Index of each record in validate_descriptorsets_in_queuesubmit[key.set]
+    layer_data::unordered_map<CmdDrawDispatchKey, size_t, CmdDrawDispatchKeyHash> queue_submit_draw_info_index;
+
     // If VK_NV_inherited_viewport_scissor is enabled and VkCommandBufferInheritanceViewportScissorInfoNV::viewportScissor2D is
     // true, then is the nonempty list of viewports passed in pViewportDepths. Otherwise, this is empty.
     std::vector<VkViewport> inheritedViewportDepths;
@@ -253,16 +358,16 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     layer_data::unordered_set<std::shared_ptr<FRAMEBUFFER_STATE>> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    layer_data::unordered_set<std::shared_ptr<BASE_NODE>> object_bindings;
+    layer_data::flat_unordered_set<std::shared_ptr<BASE_NODE>> object_bindings;
     layer_data::unordered_map<VulkanTypedHandle, LogObjectList> broken_bindings;
 
     QFOTransferBarrierSets<QFOBufferTransferBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<QFOImageTransferBarrier> qfo_transfer_image_barriers;
 
-    layer_data::unordered_set<VkEvent> waitedEvents;
+    layer_data::flat_unordered_set<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    layer_data::unordered_set<QueryObject> activeQueries;
+    layer_data::flat_unordered_set<QueryObject> activeQueries;
     layer_data::unordered_set<QueryObject> startedQueries;
     layer_data::unordered_set<QueryObject> resetQueries;
     layer_data::unordered_set<QueryObject> updatedQueries;
@@ -284,10 +389,10 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     // Validation functions run when secondary CB is executed in primary
     std::vector<std::function<bool(const CMD_BUFFER_STATE &secondary, const CMD_BUFFER_STATE *primary, const FRAMEBUFFER_STATE *)>>
         cmd_execute_commands_functions;
-    std::vector<std::function<bool(CMD_BUFFER_STATE &cb, bool do_validate, EventToStageMap *localEventToStageMap)>> eventUpdates;
-    std::vector<std::function<bool(CMD_BUFFER_STATE &cb, bool do_validate, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
-                                   QueryMap *localQueryToStateMap)>>
-        queryUpdates;
+    // Deferred event and query operations, replayed by ReplayEventUpdates() and ReplayQueryUpdates(). Reset() clears these
+    // without releasing their storage, so re-recording a command buffer doesn't allocate here.
+    std::vector<EventUpdate> eventUpdates;
+    std::vector<QueryUpdate> queryUpdates;
     layer_data::unordered_map<const cvdescriptorset::DescriptorSet *, cvdescriptorset::DescriptorSet::CachedValidation>
         descriptorset_cache;
     IndexBufferBinding index_buffer_binding;
@@ -454,6 +559,16 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     void SetImageInitialLayout(const IMAGE_STATE &image_state, const VkImageSubresourceRange &range, VkImageLayout layout);
     void SetImageInitialLayout(const IMAGE_STATE &image_state, const VkImageSubresourceLayers &layers, VkImageLayout layout);
 
+    bool ReplayEventUpdates(bool do_validate, EventToStageMap *localEventToStageMap);
+    bool ReplayQueryUpdates(bool do_validate, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                            QueryMap *localQueryToStateMap);
+    // Submit time checks for the Verify* deferred updates, implemented by validation objects that record them.
+    virtual bool ValidateEventUpdate(const EventUpdate &update, EventToStageMap *localEventToStageMap) { return false; }
+    virtual bool ValidateQueryUpdate(const QueryUpdate &update, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                                     QueryMap *localQueryToStateMap) {
+        return false;
+    }
+
     void Submit(uint32_t perf_submit_pass);
     void Retire(uint32_t perf_submit_pass, const std::function<bool(const QueryObject &)> &is_query_updated_after);
 
@@ -73,6 +73,7 @@
 #include "sync_utils.h"
 #include "sync_vuid_maps.h"
 #include "stateless_validation.h"
+#include "thread_pool.h"
 
 // these templates are defined in buffer_validation.cpp so we need to pull in the explicit instantiations from there
 extern template void CoreChecks::TransitionImageLayouts(CMD_BUFFER_STATE *cb_state, uint32_t barrier_count,
@@ -672,6 +673,11 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
                                                  const char *error_code) const {
     bool skip = false;
 
+    // Compatible render passes share a canonical id, the detailed comparison below is only needed to report the differences
+    if (rp1_state->compatibility_id == rp2_state->compatibility_id) {
+        return skip;
+    }
+
     // createInfo flags must be identical for the renderpasses to be compatible.
     if (rp1_state->createInfo.flags != rp2_state->createInfo.flags) {
         LogObjectList objlist(rp1_state->renderPass());
@@ -1591,6 +1597,22 @@ static const char *GetPipelineTypeName(VkPipelineBindPoint pipelineBindPoint) {
 }
 
 // Validate overall state at the time of a draw call
+// Checks that a pipeline, and for indexed draws an index buffer, are bound. Draw validation sampling never skips these checks.
+bool CoreChecks::ValidateCmdBufBoundState(const CMD_BUFFER_STATE &cb_state, CMD_TYPE cmd_type, bool indexed,
+                                          VkPipelineBindPoint bind_point) const {
+    const auto &state = cb_state.lastBound[ConvertToLvlBindPoint(bind_point)];
+    if (nullptr == state.pipeline_state) {
+        return LogError(cb_state.commandBuffer(), GetDrawDispatchVuid(cmd_type).pipeline_bound,
+                        "Must not call %s on this command buffer while there is no %s pipeline bound.",
+                        CommandTypeString(cmd_type), GetPipelineTypeName(bind_point));
+    }
+    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point && indexed && !cb_state.index_buffer_binding.bound()) {
+        return LogError(cb_state.commandBuffer(), GetDrawDispatchVuid(cmd_type).index_binding,
+                        "%s: Index buffer object has not been bound to this command buffer.", CommandTypeString(cmd_type));
+    }
+    return false;
+}
+
 bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TYPE cmd_type, const bool indexed,
                                          const VkPipelineBindPoint bind_point) const {
     const DrawDispatchVuid vuid = GetDrawDispatchVuid(cmd_type);
@@ -1600,9 +1622,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
     const auto *pipe = state.pipeline_state;
 
     if (nullptr == pipe) {
-        return LogError(cb_node->commandBuffer(), vuid.pipeline_bound,
-                        "Must not call %s on this command buffer while there is no %s pipeline bound.", function,
-                        GetPipelineTypeName(bind_point));
+        return ValidateCmdBufBoundState(*cb_node, cmd_type, indexed, bind_point);
     }
 
     bool result = false;
@@ -1612,8 +1632,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
         result |= ValidateDrawStateFlags(cb_node, pipe, vuid.dynamic_state);
 
         if (indexed && !cb_node->index_buffer_binding.bound()) {
-            return LogError(cb_node->commandBuffer(), vuid.index_binding,
-                            "%s: Index buffer object has not been bound to this command buffer.", function);
+            return ValidateCmdBufBoundState(*cb_node, cmd_type, indexed, bind_point);
         }
 
         if (cb_node->activeRenderPass && cb_node->activeFramebuffer) {
@@ -1754,6 +1773,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
             // Here, the currently bound pipeline determines whether an image validation check is redundant...
             // for images are the "req" portion of the binding_req is indirectly (but tightly) coupled to the pipeline.
             cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
+            // Skipped draws and dispatches do not update the per command buffer cache used by the filter, see UpdatePipelineState()
             const auto &binding_req_map = reduced_map.FilteredMap(*cb_node, *pipe);
 
             // We can skip validating the descriptor set if "nothing" has changed since the last validation.
@@ -1762,7 +1782,8 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
             // apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
             // binding_req_map which could potentially be expensive.
             bool descriptor_set_changed =
-                !reduced_map.IsManyDescriptors() ||
+                // The sets used by skipped draws and dispatches of this bind point were recorded as validated
+                !reduced_map.IsManyDescriptors() || state.draw_state_unvalidated ||
                 // Revalidate each time if the set has dynamic offsets
                 state.per_set[set_index].dynamicOffsets.size() > 0 ||
                 // Revalidate if descriptor set (or contents) has changed
@@ -3795,9 +3816,10 @@ bool CoreChecks::ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> c
         };
         struct GPLValidInfo {
             GPLValidInfo() = default;
-            GPLValidInfo(GPLInitInfo ii, const PIPELINE_LAYOUT_STATE *pls) : init_type(ii), layout_state(pls) {}
+            GPLValidInfo(GPLInitInfo ii, std::shared_ptr<const PIPELINE_LAYOUT_STATE> pls)
+                : init_type(ii), layout_state(std::move(pls)) {}
             GPLInitInfo init_type = GPLInitInfo::uninitialized;
-            const PIPELINE_LAYOUT_STATE *layout_state = nullptr;
+            std::shared_ptr<const PIPELINE_LAYOUT_STATE> layout_state;
         };
         std::pair<VkPipelineLayoutCreateFlags, GPLValidInfo> pre_raster_flags = std::make_pair(
                                                                  VK_PIPELINE_LAYOUT_CREATE_FLAG_BITS_MAX_ENUM, GPLValidInfo{}),
@@ -3819,13 +3841,13 @@ bool CoreChecks::ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> c
                 !(gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)) {
                 pre_raster_flags.first =
                     (pipeline->pre_raster_state->pipeline_layout) ? pipeline->pre_raster_state->pipeline_layout->CreateFlags() : 0;
-                pre_raster_flags.second = {GPLInitInfo::from_gpl_info, pipeline->PreRasterPipelineLayoutState().get()};
+                pre_raster_flags.second = {GPLInitInfo::from_gpl_info, pipeline->PreRasterPipelineLayoutState()};
             } else if ((gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) &&
                        !(gpl_info->flags & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT)) {
                 fs_flags.first = (pipeline->fragment_shader_state->pipeline_layout)
                                      ? pipeline->fragment_shader_state->pipeline_layout->CreateFlags()
                                      : 0;
-                fs_flags.second = {GPLInitInfo::from_gpl_info, pipeline->FragmentShaderPipelineLayoutState().get()};
+                fs_flags.second = {GPLInitInfo::from_gpl_info, pipeline->FragmentShaderPipelineLayoutState()};
             }
         }
 
@@ -3840,10 +3862,10 @@ bool CoreChecks::ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> c
                 if (lib) {
                     if (lib->graphics_lib_type == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT) {
                         pre_raster_flags.first = lib->PipelineLayoutState()->CreateFlags();
-                        pre_raster_flags.second = {GPLInitInfo::from_link_info, lib->PipelineLayoutState().get()};
+                        pre_raster_flags.second = {GPLInitInfo::from_link_info, lib->PipelineLayoutState()};
                     } else if (lib->graphics_lib_type == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT) {
                         fs_flags.first = lib->PipelineLayoutState()->CreateFlags();
-                        fs_flags.second = {GPLInitInfo::from_link_info, lib->PipelineLayoutState().get()};
+                        fs_flags.second = {GPLInitInfo::from_link_info, lib->PipelineLayoutState()};
                     }
 
                     const bool lib_has_retain_link_time_opt =
@@ -3988,13 +4010,19 @@ bool CoreChecks::ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> c
             }
 
             // vuid != null => pre-raster and fragemnt shader state is defined by some combination of this library and pLibraries
-            if (vuid) {
+            // When both layouts come from linked libraries, a pair that passed these checks before cannot fail them now
+            const bool layouts_from_libs = only_libs && pre_raster_flags.second.layout_state && fs_flags.second.layout_state;
+            if (vuid && !(layouts_from_libs && linked_layout_compat_cache.Contains(pre_raster_flags.second.layout_state,
+                                                                                    fs_flags.second.layout_state))) {
+                // Set for every incompatibility found, whether or not the debug callbacks ask to skip the call
+                bool layout_mismatch = false;
                 // Check for consistent independent sets across libraries
                 const auto pre_raster_indset = (pre_raster_flags.first & VK_PIPELINE_LAYOUT_CREATE_INDEPENDENT_SETS_BIT_EXT);
                 const auto fs_indset = (fs_flags.first & VK_PIPELINE_LAYOUT_CREATE_INDEPENDENT_SETS_BIT_EXT);
                 if (pre_raster_indset ^ fs_indset) {
                     const char *pre_raster_str = (pre_raster_indset != 0) ? "defined with" : "not defined with";
                     const char *fs_str = (fs_indset != 0) ? "defined with" : "not defined with";
+                    layout_mismatch = true;
                     skip |= LogError(
                         device, vuid,
                         "vkCreateGraphicsPipelines(): pCreateInfos[%" PRIu32
@@ -4114,9 +4142,13 @@ bool CoreChecks::ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> c
                         }
                     }
                     if (vuid_tmp) {
+                        layout_mismatch = true;
                         skip |= LogError(device, vuid_tmp, "%s", msg.str().c_str());
                     }
                 }
+                if (layouts_from_libs && !layout_mismatch) {
+                    linked_layout_compat_cache.Insert(pre_raster_flags.second.layout_state, fs_flags.second.layout_state);
+                }
             }
         }
 
@@ -4752,6 +4784,23 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 
+    if (draw_validation_sample_period > 1 || validation_governor) {
+        const uint64_t sampled = draw_validation_sampled_count.load();
+        const uint64_t skipped = draw_validation_skipped_count.load();
+        LogInfo(device, kVUID_Core_DrawValidation_SamplingStats,
+                "Draw validation sampling (1 in %" PRIu32 "%s): the state of %" PRIu64 " of %" PRIu64
+                " draws and dispatches was validated, %" PRIu64 " were skipped.",
+                draw_validation_sample_period, draw_validation_sample_random ? ", random" : "", sampled, sampled + skipped,
+                skipped);
+    }
+    if (validation_governor) {
+        const auto stats = ValidationGovernor::GetStats();
+        LogInfo(device, kVUID_Core_ValidationGovernor_Stats,
+                "Validation frame budget: %" PRIu64 " of %" PRIu64
+                " frames were over budget, the highest throttle level was %" PRIu32 " of %" PRIu32 ".",
+                stats.frames_over_budget, stats.frames, stats.max_level, ValidationGovernor::kMaxLevel);
+    }
+
     if (core_validation_cache) {
         size_t validation_cache_size = 0;
         void *validation_cache_data = nullptr;
@@ -5375,13 +5424,12 @@ struct CommandBufferSubmitState {
                                                       dynamic_offsets,
                                                       checked_layouts};
 
-                for (const auto &binding_info : cmd_info.binding_infos) {
-                    std::string error;
+                for (const auto *binding_info : cmd_info.binding_infos) {
                     if (set_node->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
                         context.checked_layouts.emplace();
                     }
-                    const auto *binding = set_node->GetBinding(binding_info.first);
-                    skip |= core->ValidateDescriptorSetBindingData(context, binding_info, *binding);
+                    const auto *binding = set_node->GetBinding(binding_info->first);
+                    skip |= core->ValidateDescriptorSetBindingData(context, *binding_info, *binding);
                 }
             }
         }
@@ -5395,14 +5443,11 @@ struct CommandBufferSubmitState {
         for (auto &function : cb_node.queue_submit_functions) {
             skip |= function(*core, *queue_state, cb_node);
         }
-        for (auto &function : cb_node.eventUpdates) {
-            skip |= function(const_cast<CMD_BUFFER_STATE &>(cb_node), /*do_validate*/ true, &local_event_to_stage_map);
-        }
+        auto &mutable_cb_node = const_cast<CMD_BUFFER_STATE &>(cb_node);
+        skip |= mutable_cb_node.ReplayEventUpdates(/*do_validate*/ true, &local_event_to_stage_map);
         VkQueryPool first_perf_query_pool = VK_NULL_HANDLE;
-        for (auto &function : cb_node.queryUpdates) {
-            skip |= function(const_cast<CMD_BUFFER_STATE &>(cb_node), /*do_validate*/ true, first_perf_query_pool, perf_pass,
-                             &local_query_to_state_map);
-        }
+        skip |= mutable_cb_node.ReplayQueryUpdates(/*do_validate*/ true, first_perf_query_pool, perf_pass,
+                                                   &local_query_to_state_map);
         return skip;
     }
 };
@@ -7371,6 +7416,21 @@ bool CoreChecks::PreCallValidateCreatePipelineCache(VkDevice device, const VkPip
     return skip;
 }
 
+// Below this many pipelines per thread, handing them to a worker costs more than validating them on the calling thread
+static constexpr uint32_t kMinPipelinesPerValidationThread = 8;
+
+// The create infos of one vkCreateGraphicsPipelines call are validated independently of each other, so large batches are split
+// across the ThreadPool workers.
+bool CoreChecks::ValidateGraphicsPipelines(std::vector<std::shared_ptr<PIPELINE_STATE>> const &pipelines, uint32_t count) const {
+    std::atomic<bool> skip{false};
+    ThreadPool::ParallelFor(count, kMinPipelinesPerValidationThread, [this, &pipelines, &skip](uint32_t i) {
+        if (ValidatePipeline(pipelines, static_cast<int>(i))) {
+            skip.store(true, std::memory_order_relaxed);
+        }
+    });
+    return skip.load();
+}
+
 bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                         const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
@@ -7379,9 +7439,7 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                                      pPipelines, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
 
-    for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipeline(cgpl_state->pipe_state, i);
-    }
+    skip |= ValidateGraphicsPipelines(cgpl_state->pipe_state, count);
 
     if (IsExtEnabled(device_extensions.vk_ext_vertex_attribute_divisor)) {
         skip |= ValidatePipelineVertexDivisors(cgpl_state->pipe_state, count, pCreateInfos);
@@ -11562,12 +11620,44 @@ void CORE_CMD_BUFFER_STATE::RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCo
     auto first_event_index = events.size();
     CMD_BUFFER_STATE::RecordWaitEvents(cmd_type, eventCount, pEvents, srcStageMask);
     auto event_added_count = events.size() - first_event_index;
-    eventUpdates.emplace_back([event_added_count, first_event_index, srcStageMask](CMD_BUFFER_STATE &cb, bool do_validate,
-                                                                                   EventToStageMap *localEventToStageMap) {
-        if (!do_validate) return false;
-        return CoreChecks::ValidateEventStageMask(cb.dev_data, &cb, event_added_count, first_event_index, srcStageMask,
-                                                  localEventToStageMap);
-    });
+    eventUpdates.emplace_back(EventUpdate::VerifyWait(first_event_index, event_added_count, srcStageMask));
+}
+
+bool CORE_CMD_BUFFER_STATE::ValidateEventUpdate(const EventUpdate &update, EventToStageMap *localEventToStageMap) {
+    assert(update.type == EventUpdate::kVerifyWait);
+    return CoreChecks::ValidateEventStageMask(dev_data, this, update.event_count, update.first_event_index, update.stage_mask,
+                                              localEventToStageMap);
+}
+
+bool CORE_CMD_BUFFER_STATE::ValidateQueryUpdate(const QueryUpdate &update, VkQueryPool &firstPerfQueryPool, uint32_t perfQueryPass,
+                                                QueryMap *localQueryToStateMap) {
+    bool skip = false;
+    switch (update.type) {
+        case QueryUpdate::kVerifyBegin:
+            skip |= CoreChecks::ValidatePerformanceQuery(*this, update.query, update.cmd_type, firstPerfQueryPool, perfQueryPass,
+                                                         localQueryToStateMap);
+            skip |= CoreChecks::VerifyQueryIsReset(*this, update.query, update.cmd_type, firstPerfQueryPool, perfQueryPass,
+                                                   localQueryToStateMap);
+            break;
+        case QueryUpdate::kVerifyEnd:
+            skip |= CoreChecks::ValidateEndQuery(*this, update.query);
+            break;
+        case QueryUpdate::kVerifyReset:
+            for (uint32_t i = 0; i < update.count; i++) {
+                QueryObject query = {{update.query.pool, update.query.query + i}, perfQueryPass};
+                skip |= CoreChecks::VerifyQueryIsReset(*this, query, update.cmd_type, firstPerfQueryPool, perfQueryPass,
+                                                       localQueryToStateMap);
+            }
+            break;
+        case QueryUpdate::kCopyResults:
+            skip |= CoreChecks::ValidateCopyQueryPoolResults(*this, update.query.pool, update.query.query, update.count,
+                                                             perfQueryPass, update.flags, localQueryToStateMap);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+    return skip;
 }
 
 void CoreChecks::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents,
@@ -11965,12 +12055,7 @@ bool CoreChecks::PreCallValidateCmdBeginQuery(VkCommandBuffer commandBuffer, VkQ
 
 static QueryState GetLocalQueryState(const QueryMap *localQueryToStateMap, VkQueryPool queryPool, uint32_t queryIndex,
                                      uint32_t perfPass) {
-    QueryObject query = QueryObject(QueryObject(queryPool, queryIndex), perfPass);
-
-    auto iter = localQueryToStateMap->find(query);
-    if (iter != localQueryToStateMap->end()) return iter->second;
-
-    return QUERYSTATE_UNKNOWN;
+    return localQueryToStateMap->GetState(queryPool, perfPass, queryIndex);
 }
 
 bool CoreChecks::VerifyQueryIsReset(CMD_BUFFER_STATE &cb_state, QueryObject query_obj, const CMD_TYPE cmd_type,
@@ -12063,15 +12148,7 @@ void CoreChecks::EnqueueVerifyBeginQuery(VkCommandBuffer command_buffer, const Q
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(command_buffer);
 
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state->queryUpdates.emplace_back([query_obj, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                              VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                              QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        skip |= ValidatePerformanceQuery(cb_state_arg, query_obj, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        skip |= VerifyQueryIsReset(cb_state_arg, query_obj, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        return skip;
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyBegin, query_obj, 1, cmd_type));
 }
 
 void CoreChecks::PreCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
@@ -12082,23 +12159,22 @@ void CoreChecks::PreCallRecordCmdBeginQuery(VkCommandBuffer commandBuffer, VkQue
 
 void CoreChecks::EnqueueVerifyEndQuery(CMD_BUFFER_STATE &cb_state, const QueryObject &query_obj) {
     // Enqueue the submit time validation here, ahead of the submit time state update in the StateTracker's PostCallRecord
-    cb_state.queryUpdates.emplace_back([query_obj](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                   VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                   QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        auto device_data = cb_state_arg.dev_data;
-        auto query_pool_state = device_data->Get<QUERY_POOL_STATE>(query_obj.pool);
-        if (query_pool_state->has_perf_scope_command_buffer && (cb_state_arg.commandCount - 1) != query_obj.endCommandIndex) {
-            skip |= device_data->LogError(cb_state_arg.Handle(), "VUID-vkCmdEndQuery-queryPool-03227",
-                                          "vkCmdEndQuery: Query pool %s was created with a counter of scope"
-                                          "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
-                                          "command in the command buffer %s.",
-                                          device_data->report_data->FormatHandle(query_obj.pool).c_str(),
-                                          device_data->report_data->FormatHandle(cb_state_arg.Handle()).c_str());
-        }
-        return skip;
-    });
+    cb_state.queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyEnd, query_obj, 1, CMD_NONE));
+}
+
+bool CoreChecks::ValidateEndQuery(const CMD_BUFFER_STATE &cb_state, const QueryObject &query_obj) {
+    bool skip = false;
+    auto device_data = cb_state.dev_data;
+    auto query_pool_state = device_data->Get<QUERY_POOL_STATE>(query_obj.pool);
+    if (query_pool_state->has_perf_scope_command_buffer && (cb_state.commandCount - 1) != query_obj.endCommandIndex) {
+        skip |= device_data->LogError(cb_state.Handle(), "VUID-vkCmdEndQuery-queryPool-03227",
+                                      "vkCmdEndQuery: Query pool %s was created with a counter of scope"
+                                      "VK_QUERY_SCOPE_COMMAND_BUFFER_KHR but the end of the query is not the last "
+                                      "command in the command buffer %s.",
+                                      device_data->report_data->FormatHandle(query_obj.pool).c_str(),
+                                      device_data->report_data->FormatHandle(cb_state.Handle()).c_str());
+    }
+    return skip;
 }
 
 bool CoreChecks::ValidateCmdEndQuery(const CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj, uint32_t index, CMD_TYPE cmd,
@@ -12318,12 +12394,8 @@ void CoreChecks::PreCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBuf
                                                       VkDeviceSize stride, VkQueryResultFlags flags) {
     if (disabled[query_validation]) return;
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
-    cb_state->queryUpdates.emplace_back([queryPool, firstQuery, queryCount, flags](
-                                            CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                            uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return ValidateCopyQueryPoolResults(cb_state_arg, queryPool, firstQuery, queryCount, perfPass, flags, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kCopyResults, QueryObject(queryPool, firstQuery),
+                                                            queryCount, CMD_COPYQUERYPOOLRESULTS, flags));
 }
 
 bool CoreChecks::PreCallValidateCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
@@ -12471,12 +12543,7 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, V
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     QueryObject query = {queryPool, slot};
     CMD_TYPE cmd_type = CMD_WRITETIMESTAMP;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyReset, query, 1, cmd_type));
 }
 
 void CoreChecks::PreCallRecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2KHR pipelineStage,
@@ -12486,12 +12553,7 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp2KHR(VkCommandBuffer commandBuffe
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     QueryObject query = {queryPool, slot};
     CMD_TYPE cmd_type = CMD_WRITETIMESTAMP2KHR;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyReset, query, 1, cmd_type));
 }
 
 void CoreChecks::PreCallRecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 pipelineStage,
@@ -12501,12 +12563,7 @@ void CoreChecks::PreCallRecordCmdWriteTimestamp2(VkCommandBuffer commandBuffer,
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     QueryObject query = {queryPool, slot};
     CMD_TYPE cmd_type = CMD_WRITETIMESTAMP2;
-    cb_state->queryUpdates.emplace_back([query, cmd_type](CMD_BUFFER_STATE &cb_state_arg, bool do_validate,
-                                                          VkQueryPool &firstPerfQueryPool, uint32_t perfPass,
-                                                          QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        return VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyReset, query, 1, cmd_type));
 }
 
 void CoreChecks::PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer,
@@ -12518,17 +12575,8 @@ void CoreChecks::PreCallRecordCmdWriteAccelerationStructuresPropertiesKHR(VkComm
     // Enqueue the submit time validation check here, before the submit time state update in StateTracker::PostCall...
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     CMD_TYPE cmd_type = CMD_WRITEACCELERATIONSTRUCTURESPROPERTIESKHR;
-    cb_state->queryUpdates.emplace_back([accelerationStructureCount, firstQuery, queryPool, cmd_type](
-                                            CMD_BUFFER_STATE &cb_state_arg, bool do_validate, VkQueryPool &firstPerfQueryPool,
-                                            uint32_t perfPass, QueryMap *localQueryToStateMap) {
-        if (!do_validate) return false;
-        bool skip = false;
-        for (uint32_t i = 0; i < accelerationStructureCount; i++) {
-            QueryObject query = {{queryPool, firstQuery + i}, perfPass};
-            skip |= VerifyQueryIsReset(cb_state_arg, query, cmd_type, firstPerfQueryPool, perfPass, localQueryToStateMap);
-        }
-        return skip;
-    });
+    cb_state->queryUpdates.emplace_back(QueryUpdate::Verify(QueryUpdate::kVerifyReset, QueryObject(queryPool, firstQuery),
+                                                            accelerationStructureCount, cmd_type));
 }
 
 bool CoreChecks::MatchUsage(uint32_t count, const VkAttachmentReference2 *attachments, const VkFramebufferCreateInfo *fbci,
@@ -21708,9 +21756,7 @@ void CoreChecks::PostCallRecordGetQueryPoolResults(VkDevice device, VkQueryPool
     }
     auto query_pool_state = Get<QUERY_POOL_STATE>(queryPool);
     if ((flags & VK_QUERY_RESULT_PARTIAL_BIT) == 0) {
-        for (uint32_t i = firstQuery; i < queryCount; ++i) {
-            query_pool_state->SetQueryState(i, 0, QUERYSTATE_AVAILABLE);
-        }
+        query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_AVAILABLE);
     }
 }
 
@@ -171,6 +171,9 @@ class CORE_CMD_BUFFER_STATE : public CMD_BUFFER_STATE {
 
     void RecordWaitEvents(CMD_TYPE cmd_type, uint32_t eventCount, const VkEvent* pEvents,
                           VkPipelineStageFlags2KHR src_stage_mask) override;
+    bool ValidateEventUpdate(const EventUpdate& update, EventToStageMap* localEventToStageMap) override;
+    bool ValidateQueryUpdate(const QueryUpdate& update, VkQueryPool& firstPerfQueryPool, uint32_t perfQueryPass,
+                             QueryMap* localQueryToStateMap) override;
 };
 
 class CoreChecks : public ValidationStateTracker {
@@ -186,6 +189,13 @@ class CoreChecks : public ValidationStateTracker {
     VkValidationCacheEXT core_validation_cache = VK_NULL_HANDLE;
     std::string validation_cache_path;
 
+    // Pairs of graphics library sub-states and layouts that already passed their link-time checks
+    mutable LinkedStateCache<PreRasterState, FragmentShaderState> linked_shader_interface_cache;
+    mutable LinkedStateCache<const PIPELINE_LAYOUT_STATE, const PIPELINE_LAYOUT_STATE> linked_layout_compat_cache;
+    // Draws and dispatches whose state was validated or skipped by draw validation sampling
+    mutable std::atomic<uint64_t> draw_validation_sampled_count{0};
+    mutable std::atomic<uint64_t> draw_validation_skipped_count{0};
+
     CoreChecks() { container_type = LayerObjectTypeCoreValidation; }
 
     ReadLockGuard ReadLock() override;
@@ -213,6 +223,7 @@ class CoreChecks : public ValidationStateTracker {
                                       const VkPipelineRenderingCreateInfo* rendering_struct, uint32_t pipe_index, int lib_index,
                                       const char* vuid) const;
     bool ValidatePipeline(std::vector<std::shared_ptr<PIPELINE_STATE>> const& pipelines, int pipe_index) const;
+    bool ValidateGraphicsPipelines(std::vector<std::shared_ptr<PIPELINE_STATE>> const& pipelines, uint32_t count) const;
     bool ValidImageBufferQueue(const CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& object, uint32_t queueFamilyIndex,
                                uint32_t count, const uint32_t* indices) const;
     bool ValidateFenceForSubmit(const FENCE_STATE* pFence, const char* inflight_vuid, const char* retired_vuid,
@@ -366,6 +377,7 @@ class CoreChecks : public ValidationStateTracker {
                                    VkQueryPool& firstPerfQueryPool, uint32_t perfPass, QueryMap* localQueryToStateMap);
     static bool ValidatePerformanceQuery(CMD_BUFFER_STATE& cb_state, QueryObject query_obj, const CMD_TYPE cmd_type,
                                          VkQueryPool& firstPerfQueryPool, uint32_t perfPass, QueryMap* localQueryToStateMap);
+    static bool ValidateEndQuery(const CMD_BUFFER_STATE& cb_state, const QueryObject& query_obj);
     bool ValidateBeginQuery(const CMD_BUFFER_STATE* cb_state, const QueryObject& query_obj, VkFlags flags, uint32_t index,
                             CMD_TYPE cmd, const ValidateBeginQueryVuids* vuids) const;
     bool ValidateCmdEndQuery(const CMD_BUFFER_STATE* cb_state, const QueryObject& query_obj, uint32_t index, CMD_TYPE cmd,
@@ -378,6 +390,7 @@ class CoreChecks : public ValidationStateTracker {
                                  CMD_TYPE cmd_type) const;
     bool ValidateCmdDrawType(const CMD_BUFFER_STATE& cb_state, bool indexed, VkPipelineBindPoint bind_point,
                              CMD_TYPE cmd_type) const;
+    bool SampleDrawValidation(const CMD_BUFFER_STATE& cb_state) const;
     bool ValidateCmdNextSubpass(RenderPassCreateVersion rp_version, VkCommandBuffer commandBuffer, CMD_TYPE cmd_type) const;
     bool ValidateInsertMemoryRange(const VulkanTypedHandle& typed_handle, const DEVICE_MEMORY_STATE* mem_info,
                                    VkDeviceSize memoryOffset, const char* api_name) const;
@@ -492,6 +505,8 @@ class CoreChecks : public ValidationStateTracker {
                                            QFOTransferCBScoreboards<QFOBufferTransferBarrier>* qfo_buffer_scoreboards) const;
     bool ValidatePipelineDrawtimeState(const LAST_BOUND_STATE& state, const CMD_BUFFER_STATE* pCB, CMD_TYPE cmd_type,
                                        const PIPELINE_STATE* pPipeline) const;
+    bool ValidateCmdBufBoundState(const CMD_BUFFER_STATE& cb_state, CMD_TYPE cmd_type, bool indexed,
+                                  VkPipelineBindPoint bind_point) const;
     bool ValidateCmdBufDrawState(const CMD_BUFFER_STATE* cb_node, CMD_TYPE cmd_type, const bool indexed,
                                  const VkPipelineBindPoint bind_point) const;
     bool ValidateCmdRayQueryState(const CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) const;
@@ -659,8 +674,8 @@ class CoreChecks : public ValidationStateTracker {
                         const char* vuid) const;
     bool ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE& producer, const Instruction& producer_entrypoint,
                                         shader_stage_attributes const* producer_stage, const SHADER_MODULE_STATE& consumer,
-                                        const Instruction& consumer_entrypoint,
-                                        shader_stage_attributes const* consumer_stage) const;
+                                        const Instruction& consumer_entrypoint, shader_stage_attributes const* consumer_stage,
+                                        bool& mismatch) const;
     bool ValidateDecorations(const SHADER_MODULE_STATE& module_state) const;
     bool ValidateVariables(const SHADER_MODULE_STATE& module_state) const;
     bool ValidateTransformFeedback(const SHADER_MODULE_STATE& module_state) const;
@@ -100,6 +100,10 @@ static const char DECORATE_UNUSED *kVUID_Core_CmdBuildAccelNV_NoUpdateMemReqQuer
 static const char DECORATE_UNUSED *kVUID_Core_CreatInstance_Status = "UNASSIGNED-khronos-validation-createinstance-status-message";
 static const char DECORATE_UNUSED *kVUID_Core_CreateInstance_Debug_Warning = "UNASSIGNED-khronos-Validation-debug-build-warning-message";
 static const char DECORATE_UNUSED *kVUID_Core_CreateInstance_Locking_Warning = "UNASSIGNED-khronos-Validation-fine-grained-locking-warning-message";
+static const char DECORATE_UNUSED *kVUID_Core_CreateInstance_Sampling_Warning = "UNASSIGNED-khronos-Validation-draw-validation-sampling-warning-message";
+static const char DECORATE_UNUSED *kVUID_Core_CreateInstance_Profiler_Warning = "UNASSIGNED-khronos-Validation-profiler-warning-message";
+static const char DECORATE_UNUSED *kVUID_Core_DrawValidation_SamplingStats = "UNASSIGNED-khronos-Validation-draw-validation-sampling-statistics";
+static const char DECORATE_UNUSED *kVUID_Core_ValidationGovernor_Stats = "UNASSIGNED-khronos-Validation-frame-budget-statistics";
 
 static const char DECORATE_UNUSED *kVUID_Core_ImageMemoryBarrier_SharingModeExclusiveSameFamily = "UNASSIGNED-CoreValidation-VkImageMemoryBarrier-sharing-mode-exclusive-same-family";
 static const char DECORATE_UNUSED *kVUID_Core_ImageMemoryBarrier2_SharingModeExclusiveSameFamily = "UNASSIGNED-CoreValidation-VkImageMemoryBarrier2KHR-sharing-mode-exclusive-same-family";
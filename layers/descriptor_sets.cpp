@@ -572,6 +572,34 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
     }
 }
 
+// Find or create the submit time validation record of set for the current command state of cb_node
+static CMD_BUFFER_STATE::CmdDrawDispatchInfo *GetQueueSubmitDrawInfo(CMD_BUFFER_STATE *cb_node, VkDescriptorSet set,
+                                                                     CMD_TYPE cmd_type, const PIPELINE_STATE *pipe) {
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    std::shared_ptr<std::vector<SUBPASS_INFO>> subpasses;
+    std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> attachments;
+    if (cb_node->activeFramebuffer) {
+        framebuffer = cb_node->activeFramebuffer->framebuffer();
+        attachments = cb_node->active_attachments;
+        subpasses = cb_node->active_subpasses;
+    }
+
+    auto &cmd_infos = cb_node->validate_descriptorsets_in_queuesubmit[set];
+    const CMD_BUFFER_STATE::CmdDrawDispatchKey key{set, cmd_type, pipe, framebuffer, subpasses.get(), attachments.get()};
+    const auto index = cb_node->queue_submit_draw_info_index.emplace(key, cmd_infos.size());
+    if (!index.second) {
+        return &cmd_infos[index.first->second];
+    }
+    cmd_infos.emplace_back();
+    auto &cmd_info = cmd_infos.back();
+    cmd_info.cmd_type = cmd_type;
+    cmd_info.pipeline = pipe->shared_from_this();
+    cmd_info.framebuffer = framebuffer;
+    cmd_info.subpasses = std::move(subpasses);
+    cmd_info.attachments = std::move(attachments);
+    return &cmd_info;
+}
+
 // Update the drawing state for the affected descriptors.
 // Set cb_node to this set and this set to cb_node.
 // Add the bindings of the descriptor
@@ -581,7 +609,7 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(ValidationStateTracker *d
 //   to be used in a draw by the given cb_node
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
                                                      CMD_TYPE cmd_type, const PIPELINE_STATE *pipe,
-                                                     const BindingReqMap &binding_req_map) {
+                                                     const BindingReqMap &pipeline_req_map, const BindingReqMap &binding_req_map) {
     // Descriptor UpdateDrawState only call image layout validation callbacks. If it is disabled, skip the entire loop.
     if (device_data->disabled[image_layout_validation]) {
         return;
@@ -589,7 +617,7 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
 
     // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
     // resources
-    CMD_BUFFER_STATE::CmdDrawDispatchInfo cmd_info = {};
+    CMD_BUFFER_STATE::CmdDrawDispatchInfo *cmd_info = nullptr;
     for (const auto &binding_req_pair : binding_req_map) {
         auto binding = GetBinding(binding_req_pair.first);
         assert(binding);
@@ -597,7 +625,13 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
         // We aren't validating descriptors created with PARTIALLY_BOUND or UPDATE_AFTER_BIND, so don't record state
         if (binding->IsBindless()) {
             if (!(binding->binding_flags & VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT)) {
-                cmd_info.binding_infos.emplace_back(binding_req_pair);
+                if (!cmd_info) {
+                    cmd_info = GetQueueSubmitDrawInfo(cb_node, GetSet(), cmd_type, pipe);
+                }
+                // binding_req_map may be a filtered copy, the pipeline's entry lives as long as the record's pipeline
+                const auto pipeline_req = pipeline_req_map.find(binding_req_pair.first);
+                assert(pipeline_req != pipeline_req_map.end());
+                cmd_info->AddBinding(&(*pipeline_req));
             }
             continue;
         }
@@ -627,16 +661,6 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
                 break;
         }
     }
-
-    if (cmd_info.binding_infos.size() > 0) {
-        cmd_info.cmd_type = cmd_type;
-        if (cb_node->activeFramebuffer) {
-            cmd_info.framebuffer = cb_node->activeFramebuffer->framebuffer();
-            cmd_info.attachments = cb_node->active_attachments;
-            cmd_info.subpasses = cb_node->active_subpasses;
-        }
-        cb_node->validate_descriptorsets_in_queuesubmit[GetSet()].emplace_back(cmd_info);
-    }
 }
 
 void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::value_type &binding_req_pair, BindingReqMap *out_req,
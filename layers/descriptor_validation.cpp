@@ -24,6 +24,7 @@
 #include "core_validation_error_enums.h"
 #include "core_validation.h"
 #include "descriptor_sets.h"
+#include "layer_profiler.h"
 
 using DescriptorSet = cvdescriptorset::DescriptorSet;
 using DescriptorSetLayout = cvdescriptorset::DescriptorSetLayout;
@@ -703,6 +704,7 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const Bi
                                    const std::vector<uint32_t> &dynamic_offsets, const CMD_BUFFER_STATE *cb_node,
                                    const std::vector<IMAGE_VIEW_STATE *> *attachments, const std::vector<SUBPASS_INFO> *subpasses,
                                    const char *caller, const DrawDispatchVuid &vuids) const {
+    VVL_PROFILE_SCOPE("CoreChecks::ValidateDrawState");
     layer_data::optional<layer_data::unordered_map<VkImageView, VkImageLayout>> checked_layouts;
     if (descriptor_set->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
         checked_layouts.emplace();
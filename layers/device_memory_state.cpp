@@ -130,3 +130,63 @@ BindableMemoryTracker::BoundMemoryRange BindableLinearMemoryTracker::GetBoundMem
                                                                                               binding_.memory_offset + range.end}}}}
                : BoundMemoryRange{};
 }
+
+BindableMemoryTracker::BoundMemoryRange BindableLinearMemoryTracker::GetBoundMemoryRanges(
+    const std::vector<MemoryRange> &ranges) const {
+    BoundMemoryRange mem_ranges;
+    if (binding_.memory_state) {
+        auto &bound_ranges = mem_ranges[binding_.memory_state->mem()];
+        bound_ranges.reserve(ranges.size());
+        for (const auto &range : ranges) {
+            bound_ranges.emplace_back(binding_.memory_offset + range.begin, binding_.memory_offset + range.end);
+        }
+    }
+    return mem_ranges;
+}
+
+// Sorts both sets of ranges by their start and walks them in order, keeping the furthest end seen so far on each side.
+// Whenever a range starts before the furthest end of the other side, the two sides intersect. Empty ranges never overlap.
+static bool SortedMemoryRangesIntersect(std::vector<BindableMemoryTracker::MemoryRange> &ranges,
+                                        std::vector<BindableMemoryTracker::MemoryRange> &other_ranges) {
+    using MemoryRange = BindableMemoryTracker::MemoryRange;
+    const auto by_begin = [](const MemoryRange &lhs, const MemoryRange &rhs) { return lhs.begin < rhs.begin; };
+    std::sort(ranges.begin(), ranges.end(), by_begin);
+    std::sort(other_ranges.begin(), other_ranges.end(), by_begin);
+
+    VkDeviceSize end = 0;
+    VkDeviceSize other_end = 0;
+    auto it = ranges.cbegin();
+    auto other_it = other_ranges.cbegin();
+    while (it != ranges.cend() || other_it != other_ranges.cend()) {
+        const bool take_first = (other_it == other_ranges.cend()) || (it != ranges.cend() && it->begin <= other_it->begin);
+        const MemoryRange &range = take_first ? *it++ : *other_it++;
+        if (range.empty()) continue;
+        if (take_first) {
+            if (range.begin < other_end) return true;
+            end = std::max(end, range.end);
+        } else {
+            if (range.begin < end) return true;
+            other_end = std::max(other_end, range.end);
+        }
+    }
+    return false;
+}
+
+bool BINDABLE::DoResourceMemoryRangesOverlap(const std::vector<sparse_container::range<VkDeviceSize>> &memory_regions,
+                                             const BINDABLE *other_resource,
+                                             const std::vector<sparse_container::range<VkDeviceSize>> &other_memory_regions) const {
+    if (!other_resource) return false;
+
+    auto ranges = GetBoundMemoryRanges(memory_regions);
+    auto other_ranges = other_resource->GetBoundMemoryRanges(other_memory_regions);
+
+    for (auto &value_pair : ranges) {
+        // Only ranges bound to the same VkDeviceMemory can overlap
+        auto it = other_ranges.find(value_pair.first);
+        if (it != other_ranges.end() && SortedMemoryRangesIntersect(value_pair.second, it->second)) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -99,7 +99,8 @@ struct MEM_BINDING {
 
 class BindableMemoryTracker {
   public:
-    using BoundMemoryRange = std::map<VkDeviceMemory, std::vector<sparse_container::range<VkDeviceSize>>>;
+    using MemoryRange = sparse_container::range<VkDeviceSize>;
+    using BoundMemoryRange = std::map<VkDeviceMemory, std::vector<MemoryRange>>;
     using DeviceMemoryState = layer_data::unordered_set<std::shared_ptr<DEVICE_MEMORY_STATE>>;
 };
 
@@ -123,6 +124,7 @@ class BindableNoMemoryTracker : public BindableMemoryTracker {
     void BindMemory(BASE_NODE *, std::shared_ptr<DEVICE_MEMORY_STATE> &, VkDeviceSize, VkDeviceSize, VkDeviceSize) {}
 
     BoundMemoryRange GetBoundMemoryRange(const sparse_container::range<VkDeviceSize> &) const { return BoundMemoryRange{}; }
+    BoundMemoryRange GetBoundMemoryRanges(const std::vector<MemoryRange> &) const { return BoundMemoryRange{}; }
     DeviceMemoryState GetBoundMemoryStates() const { return DeviceMemoryState{}; }
 };
 
@@ -149,6 +151,7 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
                     VkDeviceSize resource_offset, VkDeviceSize size);
 
     BoundMemoryRange GetBoundMemoryRange(const sparse_container::range<VkDeviceSize> &range) const;
+    BoundMemoryRange GetBoundMemoryRanges(const std::vector<MemoryRange> &ranges) const;
     DeviceMemoryState GetBoundMemoryStates() const;
 
   private:
@@ -223,17 +226,17 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
         BoundMemoryRange mem_ranges;
         {
             auto guard = ReadLockGuard{binding_lock_};
-            auto range_bounds = binding_map_.bounds(range);
-
-            for (auto it = range_bounds.begin; it != range_bounds.end; ++it) {
-                const auto &binding = *it;
-                if (binding.second.memory_state && binding.second.memory_state->mem() != VK_NULL_HANDLE) {
-                    VkDeviceSize range_start = binding.first.begin - binding.second.resource_offset;
-                    VkDeviceSize range_end = binding.first.end - binding.second.resource_offset;
-                    range_start += binding.second.memory_offset;
-                    range_end += binding.second.memory_offset;
-                    mem_ranges[binding.second.memory_state->mem()].emplace_back(range_start, range_end);
-                }
+            AddBoundMemoryRange(range, mem_ranges);
+        }
+        return mem_ranges;
+    }
+
+    BoundMemoryRange GetBoundMemoryRanges(const std::vector<MemoryRange> &ranges) const {
+        BoundMemoryRange mem_ranges;
+        {
+            auto guard = ReadLockGuard{binding_lock_};
+            for (const auto &range : ranges) {
+                AddBoundMemoryRange(range, mem_ranges);
             }
         }
         return mem_ranges;
@@ -253,6 +256,22 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     }
 
   private:
+    // binding_lock_ must be held by the caller
+    void AddBoundMemoryRange(const MemoryRange &range, BoundMemoryRange &mem_ranges) const {
+        auto range_bounds = binding_map_.bounds(range);
+
+        for (auto it = range_bounds.begin; it != range_bounds.end; ++it) {
+            const auto &binding = *it;
+            if (binding.second.memory_state && binding.second.memory_state->mem() != VK_NULL_HANDLE) {
+                VkDeviceSize range_start = binding.first.begin - binding.second.resource_offset;
+                VkDeviceSize range_end = binding.first.end - binding.second.resource_offset;
+                range_start += binding.second.memory_offset;
+                range_end += binding.second.memory_offset;
+                mem_ranges[binding.second.memory_state->mem()].emplace_back(range_start, range_end);
+            }
+        }
+    }
+
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MEM_BINDING>;
     BindingMap binding_map_;
@@ -312,17 +331,15 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
     // To access plane 2 range must be [plane_size_[1], plane_size_[2])
     BoundMemoryRange GetBoundMemoryRange(const sparse_container::range<VkDeviceSize> &range) const {
         BoundMemoryRange mem_ranges;
-        VkDeviceSize start_offset = 0u;
-        for (unsigned i = 0u; i < TRACKING_COUNT; ++i) {
-            sparse_container::range<VkDeviceSize> plane_range{start_offset, start_offset + plane_size_[i]};
-            if (bindings_[i].memory_state && range.intersects(plane_range)) {
-                VkDeviceSize range_end = range.end > plane_range.end ? plane_range.end : range.end;
-                mem_ranges[bindings_[i].memory_state->mem()].emplace_back(sparse_container::range<VkDeviceSize>{
-                    bindings_[i].memory_offset + range.begin, bindings_[i].memory_offset + range_end});
-            }
-            start_offset += plane_size_[i];
-        }
+        AddBoundMemoryRange(range, mem_ranges);
+        return mem_ranges;
+    }
 
+    BoundMemoryRange GetBoundMemoryRanges(const std::vector<MemoryRange> &ranges) const {
+        BoundMemoryRange mem_ranges;
+        for (const auto &range : ranges) {
+            AddBoundMemoryRange(range, mem_ranges);
+        }
         return mem_ranges;
     }
 
@@ -339,6 +356,19 @@ class BindableMultiplanarMemoryTracker : public BindableMemoryTracker {
     }
 
   private:
+    void AddBoundMemoryRange(const MemoryRange &range, BoundMemoryRange &mem_ranges) const {
+        VkDeviceSize start_offset = 0u;
+        for (unsigned i = 0u; i < TRACKING_COUNT; ++i) {
+            sparse_container::range<VkDeviceSize> plane_range{start_offset, start_offset + plane_size_[i]};
+            if (bindings_[i].memory_state && range.intersects(plane_range)) {
+                VkDeviceSize range_end = range.end > plane_range.end ? plane_range.end : range.end;
+                mem_ranges[bindings_[i].memory_state->mem()].emplace_back(sparse_container::range<VkDeviceSize>{
+                    bindings_[i].memory_offset + range.begin, bindings_[i].memory_offset + range_end});
+            }
+            start_offset += plane_size_[i];
+        }
+    }
+
     MEM_BINDING bindings_[TRACKING_COUNT];
     VkDeviceSize plane_size_[TRACKING_COUNT];
 };
@@ -400,7 +430,16 @@ class BINDABLE : public BASE_NODE {
                                            const sparse_container::range<VkDeviceSize> &other_memory_region) const = 0;
     virtual BindableMemoryTracker::BoundMemoryRange GetBoundMemoryRange(
         const sparse_container::range<VkDeviceSize> &range) const = 0;
+    // Resolves a whole batch of resource ranges against the bound memory in one pass
+    virtual BindableMemoryTracker::BoundMemoryRange GetBoundMemoryRanges(
+        const std::vector<sparse_container::range<VkDeviceSize>> &ranges) const = 0;
     virtual BindableMemoryTracker::DeviceMemoryState GetBoundMemoryStates() const = 0;
+    // Returns true if any of memory_regions and any of other_memory_regions are bound to overlapping device memory.
+    // Each resource resolves its bound memory once for the batch, and the resulting memory ranges are compared with a
+    // sweep over the sorted ranges instead of testing every pair of regions.
+    bool DoResourceMemoryRangesOverlap(const std::vector<sparse_container::range<VkDeviceSize>> &memory_regions,
+                                       const BINDABLE *other_resource,
+                                       const std::vector<sparse_container::range<VkDeviceSize>> &other_memory_regions) const;
     // Kept for compatibility
     virtual const MEM_BINDING *Binding() const = 0;
     virtual unsigned CountDeviceMemory(VkDeviceMemory memory) const = 0;
@@ -472,6 +511,11 @@ class MEMORY_TRACKED_RESOURCE_STATE : public BaseClass {
         return memory_tracker_.GetBoundMemoryRange(range);
     }
 
+    BindableMemoryTracker::BoundMemoryRange GetBoundMemoryRanges(
+        const std::vector<sparse_container::range<VkDeviceSize>> &ranges) const override {
+        return memory_tracker_.GetBoundMemoryRanges(ranges);
+    }
+
     BindableMemoryTracker::DeviceMemoryState GetBoundMemoryStates() const override {
         return memory_tracker_.GetBoundMemoryStates();
     }
@@ -41,6 +41,7 @@
 
 #include "chassis.h"
 #include "core_validation.h"
+#include "layer_profiler.h"
 
 // clang-format off
 struct DispatchVuidsCmdDraw : DrawDispatchVuid {
@@ -1210,13 +1211,44 @@ const DrawDispatchVuid &CoreChecks::GetDrawDispatchVuid(CMD_TYPE cmd_type) const
 // Generic function to handle validation for all CmdDraw* type functions
 bool CoreChecks::ValidateCmdDrawType(const CMD_BUFFER_STATE &cb_state, bool indexed, VkPipelineBindPoint bind_point,
                                      CMD_TYPE cmd_type) const {
+    VVL_PROFILE_SCOPE("CoreChecks::ValidateCmdDrawType");
     bool skip = false;
     skip |= ValidateCmd(&cb_state, cmd_type);
-    skip |= ValidateCmdBufDrawState(&cb_state, cmd_type, indexed, bind_point);
-    skip |= ValidateCmdRayQueryState(&cb_state, cmd_type, bind_point);
+    const auto &last_bound = cb_state.lastBound[ConvertToLvlBindPoint(bind_point)];
+    if (SampleDrawValidation(cb_state)) {
+        skip |= ValidateCmdBufDrawState(&cb_state, cmd_type, indexed, bind_point);
+        skip |= ValidateCmdRayQueryState(&cb_state, cmd_type, bind_point);
+        last_bound.draw_state_unvalidated = false;
+    } else {
+        skip |= ValidateCmdBufBoundState(cb_state, cmd_type, indexed, bind_point);
+        last_bound.draw_state_unvalidated = true;
+    }
     return skip;
 }
 
+// With draw_validation_sample_period N > 1, only one in N draws and dispatches of each command buffer has its bound state
+// (pipeline, dynamic state, descriptors) validated, either every Nth one or, with draw_validation_sample_random, each one with a
+// probability of 1 / N. The ValidationGovernor raises N when the frame budget is exceeded. Recording is not sampled, so the
+// state tracked for later commands and submits stays complete.
+bool CoreChecks::SampleDrawValidation(const CMD_BUFFER_STATE &cb_state) const {
+    const uint32_t sample_period = ValidationGovernor::DrawValidationSamplePeriod(draw_validation_sample_period);
+    if (sample_period <= 1) {
+        return true;
+    }
+    uint64_t draw_index = cb_state.draw_validation_count.fetch_add(1, std::memory_order_relaxed);
+    if (draw_validation_sample_random) {
+        // splitmix64 of the draw index, seeded by the command buffer so that command buffers sample different draws
+        draw_index += HandleToUint64(cb_state.commandBuffer()) * 0x9E3779B97F4A7C15ull;
+        draw_index = (draw_index ^ (draw_index >> 30)) * 0xBF58476D1CE4E5B9ull;
+        draw_index = (draw_index ^ (draw_index >> 27)) * 0x94D049BB133111EBull;
+        draw_index ^= draw_index >> 31;
+    }
+    const bool sampled = (draw_index % sample_period) == 0;
+    auto &count = sampled ? draw_validation_sampled_count : draw_validation_skipped_count;
+    count.fetch_add(1, std::memory_order_relaxed);
+    return sampled;
+}
+
 bool CoreChecks::ValidateCmdDrawInstance(const CMD_BUFFER_STATE &cb_node, uint32_t instanceCount, uint32_t firstInstance,
                                          CMD_TYPE cmd_type) const {
     bool skip = false;
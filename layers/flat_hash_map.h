@@ -0,0 +1,543 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#pragma once
+
+#ifndef FLAT_HASH_MAP_H_
+#define FLAT_HASH_MAP_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FLAT_HASH_MAP_USE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "vk_layer_data.h"
+
+namespace layer_data {
+
+// Open addressed ("SwissTable" style) hash containers for small, frequently rebuilt sets and maps.
+//
+// Each slot has a one byte control value holding either 7 bits of the key's hash or an empty/deleted marker.  Lookups scan
+// the control bytes a group of 16 at a time (with SSE2 where available), so most misses and hits touch a single group and
+// compare at most one key.  Elements are stored in place -- there is no per-element allocation -- and the first N slots are
+// stored inside the container itself, so a table that never grows past N * 7/8 elements never allocates at all.  clear()
+// keeps allocated storage for reuse, unless it is more than four times larger than the cleared elements needed, so that a
+// single large fill does not make every later clear() pay for its capacity.
+//
+// NOTE: Unlike layer_data::unordered_map, any insertion may invalidate iterators and references (as with robin_hood).
+//       Erasure invalidates only iterators and references to the erased element.
+namespace flat_hash_detail {
+
+using ctrl_t = int8_t;
+// Full slots store the low 7 bits of the hash, so all non-full states are negative
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+constexpr size_t kGroupWidth = 16;
+
+static inline uint32_t LowestBitIndex(uint32_t mask) {
+    assert(mask != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+// The control bytes of kGroupWidth consecutive slots. Match* return a bitmask with bit i set for each matching slot i.
+class Group {
+  public:
+#ifdef FLAT_HASH_MAP_USE_SSE2
+    explicit Group(const ctrl_t *ctrl) : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+    uint32_t Match(ctrl_t h2) const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+    }
+    uint32_t MatchEmptyOrDeleted() const { return static_cast<uint32_t>(_mm_movemask_epi8(ctrl_)); }
+
+  private:
+    __m128i ctrl_;
+#else
+    explicit Group(const ctrl_t *ctrl) { std::memcpy(ctrl_, ctrl, kGroupWidth); }
+    uint32_t Match(ctrl_t h2) const {
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < kGroupWidth; ++i) {
+            mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+        }
+        return mask;
+    }
+    uint32_t MatchEmptyOrDeleted() const {
+        uint32_t mask = 0;
+        for (uint32_t i = 0; i < kGroupWidth; ++i) {
+            mask |= static_cast<uint32_t>(ctrl_[i] < 0) << i;
+        }
+        return mask;
+    }
+
+  private:
+    ctrl_t ctrl_[kGroupWidth];
+#endif
+  public:
+    uint32_t MatchEmpty() const { return Match(kEmpty); }
+};
+
+// Handles and pointers frequently hash to themselves (std::hash), leaving the low bits with little entropy.  Spread the
+// hash over all 64 bits before splitting it into the probe start (H1) and the control byte (H2).
+static inline uint64_t MixHash(size_t hash) {
+    const uint64_t product = static_cast<uint64_t>(hash) * UINT64_C(0x9E3779B97F4A7C15);
+    return product ^ (product >> 32);
+}
+static inline size_t H1(uint64_t hash) { return static_cast<size_t>(hash >> 7); }
+static inline ctrl_t H2(uint64_t hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+template <typename Key>
+struct SetPolicy {
+    using key_type = Key;
+    using value_type = Key;
+    static const bool kMutableValues = false;
+    static const key_type &GetKey(const value_type &value) { return value; }
+};
+
+template <typename Key, typename T>
+struct MapPolicy {
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    static const bool kMutableValues = true;
+    static const key_type &GetKey(const value_type &value) { return value.first; }
+};
+
+template <typename Policy, size_t N, typename Hash, typename KeyEqual>
+class Table {
+  public:
+    using key_type = typename Policy::key_type;
+    using value_type = typename Policy::value_type;
+    using size_type = size_t;
+    using difference_type = ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+
+    static const size_t kInlineCapacity = N;
+    static_assert((N >= kGroupWidth) && ((N & (N - 1)) == 0), "inline capacity must be a power of two of at least one group");
+
+    template <bool IsConst>
+    class IteratorImpl {
+      public:
+        using TablePointer = typename std::conditional<IsConst, const Table *, Table *>::type;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Table::value_type;
+        using difference_type = ptrdiff_t;
+        using reference = typename std::conditional<IsConst || !Policy::kMutableValues, const value_type &, value_type &>::type;
+        using pointer = typename std::conditional<IsConst || !Policy::kMutableValues, const value_type *, value_type *>::type;
+
+        IteratorImpl() : table_(nullptr), index_(0) {}
+        IteratorImpl(TablePointer table, size_t index) : table_(table), index_(index) {}
+        // Allow iterator -> const_iterator conversion
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        IteratorImpl(const IteratorImpl<OtherConst> &other) : table_(other.table_), index_(other.index_) {}
+
+        reference operator*() const { return table_->slots_[index_].value; }
+        pointer operator->() const { return &table_->slots_[index_].value; }
+        IteratorImpl &operator++() {
+            index_ = table_->NextFull(index_ + 1);
+            return *this;
+        }
+        IteratorImpl operator++(int) {
+            IteratorImpl current = *this;
+            ++(*this);
+            return current;
+        }
+        bool operator==(const IteratorImpl &rhs) const { return (index_ == rhs.index_) && (table_ == rhs.table_); }
+        bool operator!=(const IteratorImpl &rhs) const { return !(*this == rhs); }
+
+      private:
+        friend class Table;
+        friend class IteratorImpl<!IsConst>;
+        TablePointer table_;
+        size_t index_;
+    };
+    using iterator = IteratorImpl<false>;
+    using const_iterator = IteratorImpl<true>;
+
+    Table() { InitInline(); }
+    Table(std::initializer_list<value_type> init) {
+        InitInline();
+        insert(init);
+    }
+    Table(const Table &other) {
+        InitInline();
+        CopyFrom(other);
+    }
+    Table(Table &&other) {
+        InitInline();
+        MoveFrom(other);
+    }
+    ~Table() {
+        DestroyAll();
+        ReleaseStorage();
+    }
+
+    Table &operator=(const Table &other) {
+        if (this != &other) {
+            DestroyAll();
+            ReleaseStorage();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+    Table &operator=(Table &&other) {
+        if (this != &other) {
+            DestroyAll();
+            ReleaseStorage();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    iterator begin() { return iterator(this, NextFull(0)); }
+    const_iterator begin() const { return const_iterator(this, NextFull(0)); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, capacity_); }
+    const_iterator end() const { return const_iterator(this, capacity_); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+
+    // Destroys all elements. The allocated storage is kept for reuse if the elements used at least a quarter of it, otherwise
+    // it is shrunk to fit as many elements, which bounds the cost of clear() by the number of elements cleared.
+    void clear() {
+        const size_t cleared = size_;
+        DestroyAll();
+        if (!IsInline() && (cleared < capacity_ / 4)) {
+            ReleaseStorage();
+            reserve(cleared);
+            return;
+        }
+        std::memset(ctrl_, kEmpty, capacity_);
+        size_ = 0;
+        growth_left_ = MaxLoad(capacity_);
+    }
+
+    void reserve(size_type count) {
+        size_t new_capacity = capacity_;
+        while (MaxLoad(new_capacity) < count) {
+            new_capacity *= 2;
+        }
+        if (new_capacity > capacity_) {
+            Resize(new_capacity);
+        }
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value) { return EmplaceUnique(Policy::GetKey(value), value); }
+    std::pair<iterator, bool> insert(value_type &&value) { return EmplaceUnique(Policy::GetKey(value), std::move(value)); }
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+    void insert(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args &&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    iterator find(const key_type &key) { return iterator(this, FindIndex(key, HashOf(key))); }
+    const_iterator find(const key_type &key) const { return const_iterator(this, FindIndex(key, HashOf(key))); }
+    size_type count(const key_type &key) const { return (FindIndex(key, HashOf(key)) != capacity_) ? 1 : 0; }
+    bool contains(const key_type &key) const { return FindIndex(key, HashOf(key)) != capacity_; }
+
+    size_type erase(const key_type &key) {
+        const size_t index = FindIndex(key, HashOf(key));
+        if (index == capacity_) return 0;
+        EraseIndex(index);
+        return 1;
+    }
+    iterator erase(const_iterator pos) {
+        assert(pos.table_ == this && pos.index_ < capacity_);
+        EraseIndex(pos.index_);
+        return iterator(this, NextFull(pos.index_ + 1));
+    }
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+  protected:
+    // Inserts value_type(args...) if key isn't present. key must not refer into the table, and must remain valid until the
+    // new value is constructed.
+    template <typename... Args>
+    std::pair<iterator, bool> EmplaceUnique(const key_type &key, Args &&... args) {
+        const uint64_t hash = HashOf(key);
+        size_t index = FindIndex(key, hash);
+        if (index != capacity_) {
+            return std::make_pair(iterator(this, index), false);
+        }
+        index = FindInsertIndex(hash);
+        if ((growth_left_ == 0) && (ctrl_[index] == kEmpty)) {
+            Grow();
+            index = FindInsertIndex(hash);
+        }
+        new (&slots_[index].value) value_type(std::forward<Args>(args)...);
+        if (ctrl_[index] == kEmpty) {
+            --growth_left_;
+        }
+        ctrl_[index] = H2(hash);
+        ++size_;
+        return std::make_pair(iterator(this, index), true);
+    }
+
+  private:
+    union Slot {
+        Slot() {}
+        ~Slot() {}
+        value_type value;
+    };
+
+    // Keep at least one slot in eight free so every probe sequence ends at an empty slot
+    static size_t MaxLoad(size_t capacity) { return capacity - capacity / 8; }
+
+    uint64_t HashOf(const key_type &key) const { return MixHash(hash_(key)); }
+
+    bool IsInline() const { return slots_ == inline_slots_; }
+
+    void InitInline() {
+        slots_ = inline_slots_;
+        ctrl_ = inline_ctrl_;
+        capacity_ = N;
+        size_ = 0;
+        growth_left_ = MaxLoad(N);
+        std::memset(inline_ctrl_, kEmpty, N);
+    }
+
+    // Probing visits whole, group aligned, groups in triangular order, which covers every group of a power of two table
+    size_t FindIndex(const key_type &key, uint64_t hash) const {
+        const ctrl_t h2 = H2(hash);
+        const size_t group_mask = capacity_ / kGroupWidth - 1;
+        size_t group = H1(hash) & group_mask;
+        for (size_t probe = 1;; ++probe) {
+            const size_t offset = group * kGroupWidth;
+            const Group ctrl_group(ctrl_ + offset);
+            for (uint32_t match = ctrl_group.Match(h2); match; match &= match - 1) {
+                const size_t index = offset + LowestBitIndex(match);
+                if (equal_(Policy::GetKey(slots_[index].value), key)) return index;
+            }
+            // Nothing has ever been inserted past a group with an empty slot (see EraseIndex)
+            if (ctrl_group.MatchEmpty()) return capacity_;
+            group = (group + probe) & group_mask;
+        }
+    }
+
+    size_t FindInsertIndex(uint64_t hash) const {
+        const size_t group_mask = capacity_ / kGroupWidth - 1;
+        size_t group = H1(hash) & group_mask;
+        for (size_t probe = 1;; ++probe) {
+            const size_t offset = group * kGroupWidth;
+            const uint32_t available = Group(ctrl_ + offset).MatchEmptyOrDeleted();
+            if (available) return offset + LowestBitIndex(available);
+            group = (group + probe) & group_mask;
+        }
+    }
+
+    size_t NextFull(size_t index) const {
+        while ((index < capacity_) && (ctrl_[index] < 0)) {
+            ++index;
+        }
+        return index;
+    }
+
+    void EraseIndex(size_t index) {
+        slots_[index].value.~value_type();
+        --size_;
+        // If the group still has an empty slot, no probe sequence can have continued past it, so the slot can be reused
+        // as empty. Otherwise a tombstone is needed to keep later lookups probing.
+        const size_t offset = index & ~(kGroupWidth - 1);
+        if (Group(ctrl_ + offset).MatchEmpty()) {
+            ctrl_[index] = kEmpty;
+            ++growth_left_;
+        } else {
+            ctrl_[index] = kDeleted;
+        }
+    }
+
+    void Grow() {
+        // Mostly tombstones: rehash at the same size to reclaim them, otherwise double
+        if (!IsInline() && (size_ <= MaxLoad(capacity_) / 2)) {
+            Resize(capacity_);
+        } else {
+            Resize(capacity_ * 2);
+        }
+    }
+
+    // Rehashes into newly allocated storage of new_capacity slots
+    void Resize(size_t new_capacity) {
+        std::unique_ptr<Slot[]> old_large_slots(std::move(large_slots_));
+        std::unique_ptr<ctrl_t[]> old_large_ctrl(std::move(large_ctrl_));
+        Slot *old_slots = slots_;
+        const ctrl_t *old_ctrl = ctrl_;
+        const size_t old_capacity = capacity_;
+
+        large_slots_.reset(new Slot[new_capacity]);
+        large_ctrl_.reset(new ctrl_t[new_capacity]);
+        std::memset(large_ctrl_.get(), kEmpty, new_capacity);
+        slots_ = large_slots_.get();
+        ctrl_ = large_ctrl_.get();
+        capacity_ = new_capacity;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] >= 0) {
+                value_type &value = old_slots[i].value;
+                const uint64_t hash = HashOf(Policy::GetKey(value));
+                const size_t index = FindInsertIndex(hash);
+                new (&slots_[index].value) value_type(std::move(value));
+                value.~value_type();
+                ctrl_[index] = H2(hash);
+            }
+        }
+        growth_left_ = MaxLoad(capacity_) - size_;
+        if (old_slots == inline_slots_) {
+            std::memset(inline_ctrl_, kEmpty, N);
+        }
+    }
+
+    void DestroyAll() {
+        if (!std::is_trivially_destructible<value_type>::value) {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (ctrl_[i] >= 0) slots_[i].value.~value_type();
+            }
+        }
+    }
+
+    // Requires all elements have been destroyed
+    void ReleaseStorage() {
+        large_slots_.reset();
+        large_ctrl_.reset();
+        InitInline();
+    }
+
+    // Requires *this be empty and inline.  Copies preserve slot positions, so no rehashing is needed.
+    void CopyFrom(const Table &other) {
+        if (!other.IsInline()) {
+            large_slots_.reset(new Slot[other.capacity_]);
+            large_ctrl_.reset(new ctrl_t[other.capacity_]);
+            slots_ = large_slots_.get();
+            ctrl_ = large_ctrl_.get();
+            capacity_ = other.capacity_;
+        }
+        std::memcpy(ctrl_, other.ctrl_, capacity_);
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] >= 0) new (&slots_[i].value) value_type(other.slots_[i].value);
+        }
+        size_ = other.size_;
+        growth_left_ = other.growth_left_;
+    }
+
+    // Requires *this be empty and inline.  Leaves other empty and inline.
+    void MoveFrom(Table &other) {
+        if (other.IsInline()) {
+            std::memcpy(ctrl_, other.ctrl_, N);
+            for (size_t i = 0; i < N; ++i) {
+                if (ctrl_[i] >= 0) {
+                    new (&slots_[i].value) value_type(std::move(other.slots_[i].value));
+                    other.slots_[i].value.~value_type();
+                }
+            }
+        } else {
+            large_slots_ = std::move(other.large_slots_);
+            large_ctrl_ = std::move(other.large_ctrl_);
+            slots_ = large_slots_.get();
+            ctrl_ = large_ctrl_.get();
+            capacity_ = other.capacity_;
+        }
+        size_ = other.size_;
+        growth_left_ = other.growth_left_;
+        other.InitInline();
+    }
+
+    Slot *slots_;
+    ctrl_t *ctrl_;
+    size_t capacity_;
+    size_t size_;
+    size_t growth_left_;
+    Hash hash_;
+    KeyEqual equal_;
+    std::unique_ptr<Slot[]> large_slots_;
+    std::unique_ptr<ctrl_t[]> large_ctrl_;
+    Slot inline_slots_[N];
+    ctrl_t inline_ctrl_[N];
+};
+
+}  // namespace flat_hash_detail
+
+template <typename Key, size_t N = flat_hash_detail::kGroupWidth, typename Hash = layer_data::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using flat_unordered_set = flat_hash_detail::Table<flat_hash_detail::SetPolicy<Key>, N, Hash, KeyEqual>;
+
+template <typename Key, typename T, size_t N = flat_hash_detail::kGroupWidth, typename Hash = layer_data::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class flat_unordered_map : public flat_hash_detail::Table<flat_hash_detail::MapPolicy<Key, T>, N, Hash, KeyEqual> {
+    using Base = flat_hash_detail::Table<flat_hash_detail::MapPolicy<Key, T>, N, Hash, KeyEqual>;
+
+  public:
+    using mapped_type = T;
+    using typename Base::iterator;
+    using typename Base::key_type;
+
+    flat_unordered_map() = default;
+    flat_unordered_map(std::initializer_list<typename Base::value_type> init) : Base(init) {}
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type &key, Args &&... args) {
+        return this->EmplaceUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                   std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    mapped_type &operator[](const key_type &key) { return try_emplace(key).first->second; }
+
+    mapped_type &at(const key_type &key) {
+        auto it = this->find(key);
+        assert(it != this->end());
+        return it->second;
+    }
+    const mapped_type &at(const key_type &key) const {
+        auto it = this->find(key);
+        assert(it != this->end());
+        return it->second;
+    }
+};
+
+}  // namespace layer_data
+
+#endif  // FLAT_HASH_MAP_H_
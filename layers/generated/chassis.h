@@ -49,6 +49,8 @@
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "layer_profiler.h"
+#include "validation_governor.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -3857,6 +3859,19 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        bool profiling{false};
+        bool check_stats{false};
+        // Per-draw state validation runs on one in draw_validation_sample_period draws and dispatches of each command buffer
+        uint32_t draw_validation_sample_period{1};
+        bool draw_validation_sample_random{false};
+        bool validation_governor{false};
+        // Validation of this object is skipped from this ValidationGovernor level, 0 if it is never skipped. The intercepts whose
+        // validation step also prepares state for the record step still call it, and the object checks ValidationThrottled().
+        uint32_t validation_throttle_level{0};
+
+        bool ValidationThrottled() const {
+            return validation_throttle_level != 0 && ValidationGovernor::Level() >= validation_throttle_level;
+        }
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -3901,6 +3916,9 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            draw_validation_sample_period = framework->draw_validation_sample_period;
+            draw_validation_sample_random = framework->draw_validation_sample_random;
+            validation_governor = framework->validation_governor;
             instance = inst;
         }
 
@@ -3916,6 +3934,9 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                draw_validation_sample_period = inst_obj->draw_validation_sample_period;
+                draw_validation_sample_random = inst_obj->draw_validation_sample_random;
+                validation_governor = inst_obj->validation_governor;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -3933,6 +3954,7 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
@@ -3951,6 +3973,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
@@ -3970,6 +3993,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -3988,6 +4012,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -4006,6 +4031,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -4024,6 +4050,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -4042,6 +4069,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
@@ -4060,6 +4088,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
@@ -239,9 +239,6 @@ static const SyncStageAccessFlags SYNC_HOST_HOST_WRITE_BIT = (SyncStageAccessFla
 static const SyncStageAccessFlags SYNC_IMAGE_LAYOUT_TRANSITION_BIT = (SyncStageAccessFlags(1) << SYNC_IMAGE_LAYOUT_TRANSITION);
 static const SyncStageAccessFlags SYNC_QUEUE_FAMILY_OWNERSHIP_TRANSFER_BIT = (SyncStageAccessFlags(1) << SYNC_QUEUE_FAMILY_OWNERSHIP_TRANSFER);
 
-// Map of the StageAccessIndices from the StageAccess Bit
-extern const layer_data::unordered_map<SyncStageAccessFlags, SyncStageAccessIndex> syncStageAccessIndexByStageAccessBit;
-
 struct SyncStageAccessInfoType {
     const char *name;
     VkPipelineStageFlags2 stage_mask;
@@ -361,9 +358,6 @@ extern const std::map<VkPipelineStageFlags2, SyncStageAccessFlags> syncStageAcce
 // Bit order mask of stage_access bit for each access
 extern const std::map<VkAccessFlags2, SyncStageAccessFlags> syncStageAccessMaskByAccessBit;
 
-// stage_access index for each stage and access
-extern const std::map<VkPipelineStageFlags2, std::map<VkAccessFlags2, SyncStageAccessIndex>> syncStageAccessIndexByStageAndAccess;
-
 // Direct VkPipelineStageFlags to valid VkAccessFlags lookup table
 extern const std::map<VkPipelineStageFlags2, VkAccessFlags2> syncDirectStageToAccessMask;
 
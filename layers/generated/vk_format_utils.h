@@ -36,7 +36,7 @@ extern "C" {
 static constexpr uint32_t FORMAT_MAX_PLANES = 3;
 static constexpr uint32_t FORMAT_MAX_COMPONENTS = 4;
 
-enum class FORMAT_NUMERICAL_TYPE {
+enum class FORMAT_NUMERICAL_TYPE : uint8_t {
     NONE = 0,
     SFLOAT,
     SINT,
@@ -49,7 +49,7 @@ enum class FORMAT_NUMERICAL_TYPE {
     USCALED
 };
 
-enum class FORMAT_COMPATIBILITY_CLASS {
+enum class FORMAT_COMPATIBILITY_CLASS : uint8_t {
     NONE = 0,
     _10BIT_2PLANE_420,
     _10BIT_2PLANE_422,
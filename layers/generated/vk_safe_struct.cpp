@@ -36,8 +36,10 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 #include <vulkan/vk_layer.h>
@@ -59,6 +61,110 @@ struct ASGeomKHRExtraData {
 };
 vl_concurrent_unordered_map<const safe_VkAccelerationStructureGeometryKHR*, ASGeomKHRExtraData*, 4> as_geom_khr_host_alloc;
 
+namespace {
+constexpr std::size_t kSafeStructAlignment = alignof(std::max_align_t);
+constexpr std::size_t kMinScratchChunkSize = 16 * 1024;
+
+// Memory that the measuring pass of SafeStructArena::Freeze() copies into. Chunks are kept and reused, so a thread
+// only allocates scratch space while the largest struct it has frozen keeps growing.
+class SafeStructScratch {
+  public:
+    void Reset() {
+        chunk_ = 0;
+        offset_ = 0;
+    }
+    void *Allocate(std::size_t size) {
+        while (chunk_ < chunks_.size() && chunks_[chunk_].size - offset_ < size) {
+            ++chunk_;
+            offset_ = 0;
+        }
+        if (chunk_ == chunks_.size()) {
+            chunks_.emplace_back(std::max(size, chunks_.empty() ? kMinScratchChunkSize : 2 * chunks_.back().size));
+        }
+        void *ptr = chunks_[chunk_].data.get() + offset_;
+        offset_ += size;
+        return ptr;
+    }
+
+  private:
+    struct Chunk {
+        explicit Chunk(std::size_t bytes) : data(new unsigned char[bytes]), size(bytes) {}
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size;
+    };
+    std::vector<Chunk> chunks_;
+    std::size_t chunk_ = 0;
+    std::size_t offset_ = 0;
+};
+
+thread_local SafeStructScratch safe_struct_scratch;
+thread_local SafeStructArena *bound_safe_struct_arena = nullptr;
+}  // namespace
+
+void SafeStructArena::BeginMeasure() {
+    assert(!frozen_ && !block_);
+    prev_ = bound_safe_struct_arena;
+    bound_safe_struct_arena = this;
+    measuring_ = true;
+    size_ = 0;
+    safe_struct_scratch.Reset();
+}
+
+void SafeStructArena::BeginCopy() {
+    measuring_ = false;
+    used_ = 0;
+    if (size_) {
+        block_ = static_cast<unsigned char *>(::operator new(size_));
+    }
+}
+
+void SafeStructArena::End() {
+    assert(used_ == size_);
+    bound_safe_struct_arena = prev_;
+    prev_ = nullptr;
+    frozen_ = true;
+}
+
+bool SafeStructArena::Bound() { return bound_safe_struct_arena != nullptr; }
+
+void *SafeStructArena::Allocate(std::size_t size) {
+    SafeStructArena *arena = bound_safe_struct_arena;
+    if (!arena) return nullptr;
+    // Zero sized requests still need a distinct address
+    size = (std::max<std::size_t>(size, 1) + kSafeStructAlignment - 1) & ~(kSafeStructAlignment - 1);
+    if (arena->measuring_) {
+        arena->size_ += size;
+        return safe_struct_scratch.Allocate(size);
+    }
+    if (arena->used_ + size > arena->size_) {
+        // The copy did not repeat the allocations seen while measuring, use the heap rather than overrun the block
+        assert(false);
+        return nullptr;
+    }
+    void *ptr = arena->block_ + arena->used_;
+    arena->used_ += size;
+    return ptr;
+}
+
+void *operator new(std::size_t size, const SafeStructAllocTag &) {
+    void *ptr = SafeStructArena::Allocate(size);
+    return ptr ? ptr : ::operator new(size);
+}
+
+void *operator new[](std::size_t size, const SafeStructAllocTag &) {
+    void *ptr = SafeStructArena::Allocate(size);
+    return ptr ? ptr : ::operator new[](size);
+}
+
+// Only used when a constructor throws, arena memory is released with the arena
+void operator delete(void *ptr, const SafeStructAllocTag &) noexcept {
+    if (!SafeStructArena::Bound()) ::operator delete(ptr);
+}
+
+void operator delete[](void *ptr, const SafeStructAllocTag &) noexcept {
+    if (!SafeStructArena::Bound()) ::operator delete[](ptr);
+}
+
 
 safe_VkBufferMemoryBarrier::safe_VkBufferMemoryBarrier(const VkBufferMemoryBarrier* in_struct) :
     sType(in_struct->sType),
@@ -474,18 +580,18 @@ safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(const VkInstanceCreateInfo*
     enabledExtensionCount(in_struct->enabledExtensionCount)
 {
     pNext = SafePnextCopy(in_struct->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[in_struct->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[in_struct->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(in_struct->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[in_struct->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[in_struct->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(in_struct->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (in_struct->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(in_struct->pApplicationInfo);
+        pApplicationInfo = new (kSafeStructAlloc) safe_VkApplicationInfo(in_struct->pApplicationInfo);
 }
 
 safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo() :
@@ -507,18 +613,18 @@ safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(const safe_VkInstanceCreate
     enabledLayerCount = copy_src.enabledLayerCount;
     enabledExtensionCount = copy_src.enabledExtensionCount;
     pNext = SafePnextCopy(copy_src.pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src.enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src.enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src.ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src.enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src.enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src.ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (copy_src.pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*copy_src.pApplicationInfo);
+        pApplicationInfo = new (kSafeStructAlloc) safe_VkApplicationInfo(*copy_src.pApplicationInfo);
 }
 
 safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(const safe_VkInstanceCreateInfo& copy_src)
@@ -548,18 +654,18 @@ safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(const safe_VkIns
     enabledLayerCount = copy_src.enabledLayerCount;
     enabledExtensionCount = copy_src.enabledExtensionCount;
     pNext = SafePnextCopy(copy_src.pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src.enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src.enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src.ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src.enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src.enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src.ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (copy_src.pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*copy_src.pApplicationInfo);
+        pApplicationInfo = new (kSafeStructAlloc) safe_VkApplicationInfo(*copy_src.pApplicationInfo);
 
     return *this;
 }
@@ -608,18 +714,18 @@ void safe_VkInstanceCreateInfo::initialize(const VkInstanceCreateInfo* in_struct
     enabledLayerCount = in_struct->enabledLayerCount;
     enabledExtensionCount = in_struct->enabledExtensionCount;
     pNext = SafePnextCopy(in_struct->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[in_struct->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[in_struct->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(in_struct->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[in_struct->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[in_struct->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(in_struct->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (in_struct->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(in_struct->pApplicationInfo);
+        pApplicationInfo = new (kSafeStructAlloc) safe_VkApplicationInfo(in_struct->pApplicationInfo);
 }
 
 void safe_VkInstanceCreateInfo::initialize(const safe_VkInstanceCreateInfo* copy_src)
@@ -630,18 +736,18 @@ void safe_VkInstanceCreateInfo::initialize(const safe_VkInstanceCreateInfo* copy
     enabledLayerCount = copy_src->enabledLayerCount;
     enabledExtensionCount = copy_src->enabledExtensionCount;
     pNext = SafePnextCopy(copy_src->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (copy_src->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*copy_src->pApplicationInfo);
+        pApplicationInfo = new (kSafeStructAlloc) safe_VkApplicationInfo(*copy_src->pApplicationInfo);
 }
 
 safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(const VkDeviceQueueCreateInfo* in_struct) :
@@ -653,7 +759,7 @@ safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(const VkDeviceQueueCr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pQueuePriorities) {
-        pQueuePriorities = new float[in_struct->queueCount];
+        pQueuePriorities = new (kSafeStructAlloc) float[in_struct->queueCount];
         memcpy ((void *)pQueuePriorities, (void *)in_struct->pQueuePriorities, sizeof(float)*in_struct->queueCount);
     }
 }
@@ -676,7 +782,7 @@ safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(const safe_VkDeviceQu
     pQueuePriorities = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pQueuePriorities) {
-        pQueuePriorities = new float[copy_src.queueCount];
+        pQueuePriorities = new (kSafeStructAlloc) float[copy_src.queueCount];
         memcpy ((void *)pQueuePriorities, (void *)copy_src.pQueuePriorities, sizeof(float)*copy_src.queueCount);
     }
 }
@@ -697,7 +803,7 @@ safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(const safe
     pQueuePriorities = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pQueuePriorities) {
-        pQueuePriorities = new float[copy_src.queueCount];
+        pQueuePriorities = new (kSafeStructAlloc) float[copy_src.queueCount];
         memcpy ((void *)pQueuePriorities, (void *)copy_src.pQueuePriorities, sizeof(float)*copy_src.queueCount);
     }
 
@@ -725,7 +831,7 @@ void safe_VkDeviceQueueCreateInfo::initialize(const VkDeviceQueueCreateInfo* in_
     pQueuePriorities = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pQueuePriorities) {
-        pQueuePriorities = new float[in_struct->queueCount];
+        pQueuePriorities = new (kSafeStructAlloc) float[in_struct->queueCount];
         memcpy ((void *)pQueuePriorities, (void *)in_struct->pQueuePriorities, sizeof(float)*in_struct->queueCount);
     }
 }
@@ -739,7 +845,7 @@ void safe_VkDeviceQueueCreateInfo::initialize(const safe_VkDeviceQueueCreateInfo
     pQueuePriorities = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pQueuePriorities) {
-        pQueuePriorities = new float[copy_src->queueCount];
+        pQueuePriorities = new (kSafeStructAlloc) float[copy_src->queueCount];
         memcpy ((void *)pQueuePriorities, (void *)copy_src->pQueuePriorities, sizeof(float)*copy_src->queueCount);
     }
 }
@@ -754,24 +860,24 @@ safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(const VkDeviceCreateInfo* in_st
     pEnabledFeatures(nullptr)
 {
     pNext = SafePnextCopy(in_struct->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[in_struct->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[in_struct->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(in_struct->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[in_struct->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[in_struct->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(in_struct->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (queueCreateInfoCount && in_struct->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = new (kSafeStructAlloc) safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
         for (uint32_t i = 0; i < queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&in_struct->pQueueCreateInfos[i]);
         }
     }
     if (in_struct->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
+        pEnabledFeatures = new (kSafeStructAlloc) VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
     }
 }
 
@@ -798,24 +904,24 @@ safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(const safe_VkDeviceCreateInfo&
     enabledExtensionCount = copy_src.enabledExtensionCount;
     pEnabledFeatures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src.enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src.enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src.ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src.enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src.enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src.ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (queueCreateInfoCount && copy_src.pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = new (kSafeStructAlloc) safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
         for (uint32_t i = 0; i < queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&copy_src.pQueueCreateInfos[i]);
         }
     }
     if (copy_src.pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*copy_src.pEnabledFeatures);
+        pEnabledFeatures = new (kSafeStructAlloc) VkPhysicalDeviceFeatures(*copy_src.pEnabledFeatures);
     }
 }
 
@@ -850,24 +956,24 @@ safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(const safe_VkDeviceC
     enabledExtensionCount = copy_src.enabledExtensionCount;
     pEnabledFeatures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src.enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src.enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src.ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src.enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src.enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src.ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (queueCreateInfoCount && copy_src.pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = new (kSafeStructAlloc) safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
         for (uint32_t i = 0; i < queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&copy_src.pQueueCreateInfos[i]);
         }
     }
     if (copy_src.pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*copy_src.pEnabledFeatures);
+        pEnabledFeatures = new (kSafeStructAlloc) VkPhysicalDeviceFeatures(*copy_src.pEnabledFeatures);
     }
 
     return *this;
@@ -923,24 +1029,24 @@ void safe_VkDeviceCreateInfo::initialize(const VkDeviceCreateInfo* in_struct)
     enabledExtensionCount = in_struct->enabledExtensionCount;
     pEnabledFeatures = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[in_struct->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[in_struct->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(in_struct->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[in_struct->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[in_struct->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(in_struct->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (queueCreateInfoCount && in_struct->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = new (kSafeStructAlloc) safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
         for (uint32_t i = 0; i < queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&in_struct->pQueueCreateInfos[i]);
         }
     }
     if (in_struct->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
+        pEnabledFeatures = new (kSafeStructAlloc) VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
     }
 }
 
@@ -954,24 +1060,24 @@ void safe_VkDeviceCreateInfo::initialize(const safe_VkDeviceCreateInfo* copy_src
     enabledExtensionCount = copy_src->enabledExtensionCount;
     pEnabledFeatures = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
-    char **tmp_ppEnabledLayerNames = new char *[copy_src->enabledLayerCount];
+    char **tmp_ppEnabledLayerNames = new (kSafeStructAlloc) char *[copy_src->enabledLayerCount];
     for (uint32_t i = 0; i < enabledLayerCount; ++i) {
         tmp_ppEnabledLayerNames[i] = SafeStringCopy(copy_src->ppEnabledLayerNames[i]);
     }
     ppEnabledLayerNames = tmp_ppEnabledLayerNames;
-    char **tmp_ppEnabledExtensionNames = new char *[copy_src->enabledExtensionCount];
+    char **tmp_ppEnabledExtensionNames = new (kSafeStructAlloc) char *[copy_src->enabledExtensionCount];
     for (uint32_t i = 0; i < enabledExtensionCount; ++i) {
         tmp_ppEnabledExtensionNames[i] = SafeStringCopy(copy_src->ppEnabledExtensionNames[i]);
     }
     ppEnabledExtensionNames = tmp_ppEnabledExtensionNames;
     if (queueCreateInfoCount && copy_src->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = new (kSafeStructAlloc) safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
         for (uint32_t i = 0; i < queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&copy_src->pQueueCreateInfos[i]);
         }
     }
     if (copy_src->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*copy_src->pEnabledFeatures);
+        pEnabledFeatures = new (kSafeStructAlloc) VkPhysicalDeviceFeatures(*copy_src->pEnabledFeatures);
     }
 }
 
@@ -987,21 +1093,21 @@ safe_VkSubmitInfo::safe_VkSubmitInfo(const VkSubmitInfo* in_struct) :
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (in_struct->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[in_struct->waitSemaphoreCount];
+        pWaitDstStageMask = new (kSafeStructAlloc) VkPipelineStageFlags[in_struct->waitSemaphoreCount];
         memcpy ((void *)pWaitDstStageMask, (void *)in_struct->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[in_struct->commandBufferCount];
+        pCommandBuffers = new (kSafeStructAlloc) VkCommandBuffer[in_struct->commandBufferCount];
         memcpy ((void *)pCommandBuffers, (void *)in_struct->pCommandBuffers, sizeof(VkCommandBuffer)*in_struct->commandBufferCount);
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
         }
@@ -1032,21 +1138,21 @@ safe_VkSubmitInfo::safe_VkSubmitInfo(const safe_VkSubmitInfo& copy_src)
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (copy_src.pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[copy_src.waitSemaphoreCount];
+        pWaitDstStageMask = new (kSafeStructAlloc) VkPipelineStageFlags[copy_src.waitSemaphoreCount];
         memcpy ((void *)pWaitDstStageMask, (void *)copy_src.pWaitDstStageMask, sizeof(VkPipelineStageFlags)*copy_src.waitSemaphoreCount);
     }
     if (copy_src.pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[copy_src.commandBufferCount];
+        pCommandBuffers = new (kSafeStructAlloc) VkCommandBuffer[copy_src.commandBufferCount];
         memcpy ((void *)pCommandBuffers, (void *)copy_src.pCommandBuffers, sizeof(VkCommandBuffer)*copy_src.commandBufferCount);
     }
     if (signalSemaphoreCount && copy_src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src.pSignalSemaphores[i];
         }
@@ -1078,21 +1184,21 @@ safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(const safe_VkSubmitInfo& copy_sr
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (copy_src.pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[copy_src.waitSemaphoreCount];
+        pWaitDstStageMask = new (kSafeStructAlloc) VkPipelineStageFlags[copy_src.waitSemaphoreCount];
         memcpy ((void *)pWaitDstStageMask, (void *)copy_src.pWaitDstStageMask, sizeof(VkPipelineStageFlags)*copy_src.waitSemaphoreCount);
     }
     if (copy_src.pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[copy_src.commandBufferCount];
+        pCommandBuffers = new (kSafeStructAlloc) VkCommandBuffer[copy_src.commandBufferCount];
         memcpy ((void *)pCommandBuffers, (void *)copy_src.pCommandBuffers, sizeof(VkCommandBuffer)*copy_src.commandBufferCount);
     }
     if (signalSemaphoreCount && copy_src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src.pSignalSemaphores[i];
         }
@@ -1137,21 +1243,21 @@ void safe_VkSubmitInfo::initialize(const VkSubmitInfo* in_struct)
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (in_struct->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[in_struct->waitSemaphoreCount];
+        pWaitDstStageMask = new (kSafeStructAlloc) VkPipelineStageFlags[in_struct->waitSemaphoreCount];
         memcpy ((void *)pWaitDstStageMask, (void *)in_struct->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[in_struct->commandBufferCount];
+        pCommandBuffers = new (kSafeStructAlloc) VkCommandBuffer[in_struct->commandBufferCount];
         memcpy ((void *)pCommandBuffers, (void *)in_struct->pCommandBuffers, sizeof(VkCommandBuffer)*in_struct->commandBufferCount);
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
         }
@@ -1170,21 +1276,21 @@ void safe_VkSubmitInfo::initialize(const safe_VkSubmitInfo* copy_src)
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (waitSemaphoreCount && copy_src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src->pWaitSemaphores[i];
         }
     }
     if (copy_src->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[copy_src->waitSemaphoreCount];
+        pWaitDstStageMask = new (kSafeStructAlloc) VkPipelineStageFlags[copy_src->waitSemaphoreCount];
         memcpy ((void *)pWaitDstStageMask, (void *)copy_src->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*copy_src->waitSemaphoreCount);
     }
     if (copy_src->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[copy_src->commandBufferCount];
+        pCommandBuffers = new (kSafeStructAlloc) VkCommandBuffer[copy_src->commandBufferCount];
         memcpy ((void *)pCommandBuffers, (void *)copy_src->pCommandBuffers, sizeof(VkCommandBuffer)*copy_src->commandBufferCount);
     }
     if (signalSemaphoreCount && copy_src->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src->pSignalSemaphores[i];
         }
@@ -1327,7 +1433,7 @@ safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(const VkSpa
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1346,7 +1452,7 @@ safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(const safe_
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1364,7 +1470,7 @@ safe_VkSparseBufferMemoryBindInfo& safe_VkSparseBufferMemoryBindInfo::operator=(
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1387,7 +1493,7 @@ void safe_VkSparseBufferMemoryBindInfo::initialize(const VkSparseBufferMemoryBin
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1400,7 +1506,7 @@ void safe_VkSparseBufferMemoryBindInfo::initialize(const safe_VkSparseBufferMemo
     bindCount = copy_src->bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src->pBinds[i];
         }
@@ -1413,7 +1519,7 @@ safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(c
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1432,7 +1538,7 @@ safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(c
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1450,7 +1556,7 @@ safe_VkSparseImageOpaqueMemoryBindInfo& safe_VkSparseImageOpaqueMemoryBindInfo::
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1473,7 +1579,7 @@ void safe_VkSparseImageOpaqueMemoryBindInfo::initialize(const VkSparseImageOpaqu
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1486,7 +1592,7 @@ void safe_VkSparseImageOpaqueMemoryBindInfo::initialize(const safe_VkSparseImage
     bindCount = copy_src->bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src->pBinds[i];
         }
@@ -1499,7 +1605,7 @@ safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(const VkSpars
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseImageMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1518,7 +1624,7 @@ safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(const safe_Vk
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseImageMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1536,7 +1642,7 @@ safe_VkSparseImageMemoryBindInfo& safe_VkSparseImageMemoryBindInfo::operator=(co
     bindCount = copy_src.bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src.pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseImageMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src.pBinds[i];
         }
@@ -1559,7 +1665,7 @@ void safe_VkSparseImageMemoryBindInfo::initialize(const VkSparseImageMemoryBindI
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseImageMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = in_struct->pBinds[i];
         }
@@ -1572,7 +1678,7 @@ void safe_VkSparseImageMemoryBindInfo::initialize(const safe_VkSparseImageMemory
     bindCount = copy_src->bindCount;
     pBinds = nullptr;
     if (bindCount && copy_src->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
+        pBinds = new (kSafeStructAlloc) VkSparseImageMemoryBind[bindCount];
         for (uint32_t i = 0; i < bindCount; ++i) {
             pBinds[i] = copy_src->pBinds[i];
         }
@@ -1594,31 +1700,31 @@ safe_VkBindSparseInfo::safe_VkBindSparseInfo(const VkBindSparseInfo* in_struct)
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (bufferBindCount && in_struct->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = new (kSafeStructAlloc) safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
         for (uint32_t i = 0; i < bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&in_struct->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && in_struct->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = new (kSafeStructAlloc) safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
         for (uint32_t i = 0; i < imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&in_struct->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && in_struct->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = new (kSafeStructAlloc) safe_VkSparseImageMemoryBindInfo[imageBindCount];
         for (uint32_t i = 0; i < imageBindCount; ++i) {
             pImageBinds[i].initialize(&in_struct->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
         }
@@ -1655,31 +1761,31 @@ safe_VkBindSparseInfo::safe_VkBindSparseInfo(const safe_VkBindSparseInfo& copy_s
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (bufferBindCount && copy_src.pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = new (kSafeStructAlloc) safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
         for (uint32_t i = 0; i < bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&copy_src.pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && copy_src.pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = new (kSafeStructAlloc) safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
         for (uint32_t i = 0; i < imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&copy_src.pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && copy_src.pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = new (kSafeStructAlloc) safe_VkSparseImageMemoryBindInfo[imageBindCount];
         for (uint32_t i = 0; i < imageBindCount; ++i) {
             pImageBinds[i].initialize(&copy_src.pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && copy_src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src.pSignalSemaphores[i];
         }
@@ -1716,31 +1822,31 @@ safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(const safe_VkBindSparseI
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (bufferBindCount && copy_src.pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = new (kSafeStructAlloc) safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
         for (uint32_t i = 0; i < bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&copy_src.pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && copy_src.pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = new (kSafeStructAlloc) safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
         for (uint32_t i = 0; i < imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&copy_src.pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && copy_src.pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = new (kSafeStructAlloc) safe_VkSparseImageMemoryBindInfo[imageBindCount];
         for (uint32_t i = 0; i < imageBindCount; ++i) {
             pImageBinds[i].initialize(&copy_src.pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && copy_src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src.pSignalSemaphores[i];
         }
@@ -1792,31 +1898,31 @@ void safe_VkBindSparseInfo::initialize(const VkBindSparseInfo* in_struct)
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (bufferBindCount && in_struct->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = new (kSafeStructAlloc) safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
         for (uint32_t i = 0; i < bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&in_struct->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && in_struct->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = new (kSafeStructAlloc) safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
         for (uint32_t i = 0; i < imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&in_struct->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && in_struct->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = new (kSafeStructAlloc) safe_VkSparseImageMemoryBindInfo[imageBindCount];
         for (uint32_t i = 0; i < imageBindCount; ++i) {
             pImageBinds[i].initialize(&in_struct->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
         }
@@ -1838,31 +1944,31 @@ void safe_VkBindSparseInfo::initialize(const safe_VkBindSparseInfo* copy_src)
     pSignalSemaphores = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (waitSemaphoreCount && copy_src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src->pWaitSemaphores[i];
         }
     }
     if (bufferBindCount && copy_src->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = new (kSafeStructAlloc) safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
         for (uint32_t i = 0; i < bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&copy_src->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && copy_src->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = new (kSafeStructAlloc) safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
         for (uint32_t i = 0; i < imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&copy_src->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && copy_src->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = new (kSafeStructAlloc) safe_VkSparseImageMemoryBindInfo[imageBindCount];
         for (uint32_t i = 0; i < imageBindCount; ++i) {
             pImageBinds[i].initialize(&copy_src->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && copy_src->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
+        pSignalSemaphores = new (kSafeStructAlloc) VkSemaphore[signalSemaphoreCount];
         for (uint32_t i = 0; i < signalSemaphoreCount; ++i) {
             pSignalSemaphores[i] = copy_src->pSignalSemaphores[i];
         }
@@ -2122,7 +2228,7 @@ safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(const VkBufferCreateInfo* in_st
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -2151,7 +2257,7 @@ safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(const safe_VkBufferCreateInfo&
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -2176,7 +2282,7 @@ safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(const safe_VkBufferC
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -2208,7 +2314,7 @@ void safe_VkBufferCreateInfo::initialize(const VkBufferCreateInfo* in_struct)
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -2226,7 +2332,7 @@ void safe_VkBufferCreateInfo::initialize(const safe_VkBufferCreateInfo* copy_src
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if ((copy_src->sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src->pQueueFamilyIndices, sizeof(uint32_t)*copy_src->queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src->queueFamilyIndexCount;
     } else {
@@ -2332,7 +2438,7 @@ safe_VkImageCreateInfo::safe_VkImageCreateInfo(const VkImageCreateInfo* in_struc
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -2375,7 +2481,7 @@ safe_VkImageCreateInfo::safe_VkImageCreateInfo(const safe_VkImageCreateInfo& cop
     initialLayout = copy_src.initialLayout;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -2407,7 +2513,7 @@ safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(const safe_VkImageCrea
     initialLayout = copy_src.initialLayout;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -2446,7 +2552,7 @@ void safe_VkImageCreateInfo::initialize(const VkImageCreateInfo* in_struct)
     initialLayout = in_struct->initialLayout;
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -2471,7 +2577,7 @@ void safe_VkImageCreateInfo::initialize(const safe_VkImageCreateInfo* copy_src)
     initialLayout = copy_src->initialLayout;
     pNext = SafePnextCopy(copy_src->pNext);
     if ((copy_src->sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src->pQueueFamilyIndices, sizeof(uint32_t)*copy_src->queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src->queueFamilyIndexCount;
     } else {
@@ -2573,7 +2679,7 @@ safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(const VkShaderModul
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);
         memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);
     }
 }
@@ -2594,7 +2700,7 @@ safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(const safe_VkShader
     pCode = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);
         memcpy((void *)pCode, (void *)copy_src.pCode, codeSize);
     }
 }
@@ -2614,7 +2720,7 @@ safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(const sa
     pCode = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);
         memcpy((void *)pCode, (void *)copy_src.pCode, codeSize);
     }
 
@@ -2641,7 +2747,7 @@ void safe_VkShaderModuleCreateInfo::initialize(const VkShaderModuleCreateInfo* i
     pCode = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);
         memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);
     }
 }
@@ -2654,7 +2760,7 @@ void safe_VkShaderModuleCreateInfo::initialize(const safe_VkShaderModuleCreateIn
     pCode = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);
         memcpy((void *)pCode, (void *)copy_src->pCode, codeSize);
     }
 }
@@ -2734,7 +2840,7 @@ safe_VkSpecializationInfo::safe_VkSpecializationInfo(const VkSpecializationInfo*
     pData(in_struct->pData)
 {
     if (in_struct->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[in_struct->mapEntryCount];
+        pMapEntries = new (kSafeStructAlloc) VkSpecializationMapEntry[in_struct->mapEntryCount];
         memcpy ((void *)pMapEntries, (void *)in_struct->pMapEntries, sizeof(VkSpecializationMapEntry)*in_struct->mapEntryCount);
     }
 }
@@ -2753,7 +2859,7 @@ safe_VkSpecializationInfo::safe_VkSpecializationInfo(const safe_VkSpecialization
     dataSize = copy_src.dataSize;
     pData = copy_src.pData;
     if (copy_src.pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[copy_src.mapEntryCount];
+        pMapEntries = new (kSafeStructAlloc) VkSpecializationMapEntry[copy_src.mapEntryCount];
         memcpy ((void *)pMapEntries, (void *)copy_src.pMapEntries, sizeof(VkSpecializationMapEntry)*copy_src.mapEntryCount);
     }
 }
@@ -2770,7 +2876,7 @@ safe_VkSpecializationInfo& safe_VkSpecializationInfo::operator=(const safe_VkSpe
     dataSize = copy_src.dataSize;
     pData = copy_src.pData;
     if (copy_src.pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[copy_src.mapEntryCount];
+        pMapEntries = new (kSafeStructAlloc) VkSpecializationMapEntry[copy_src.mapEntryCount];
         memcpy ((void *)pMapEntries, (void *)copy_src.pMapEntries, sizeof(VkSpecializationMapEntry)*copy_src.mapEntryCount);
     }
 
@@ -2792,7 +2898,7 @@ void safe_VkSpecializationInfo::initialize(const VkSpecializationInfo* in_struct
     dataSize = in_struct->dataSize;
     pData = in_struct->pData;
     if (in_struct->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[in_struct->mapEntryCount];
+        pMapEntries = new (kSafeStructAlloc) VkSpecializationMapEntry[in_struct->mapEntryCount];
         memcpy ((void *)pMapEntries, (void *)in_struct->pMapEntries, sizeof(VkSpecializationMapEntry)*in_struct->mapEntryCount);
     }
 }
@@ -2804,7 +2910,7 @@ void safe_VkSpecializationInfo::initialize(const safe_VkSpecializationInfo* copy
     dataSize = copy_src->dataSize;
     pData = copy_src->pData;
     if (copy_src->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[copy_src->mapEntryCount];
+        pMapEntries = new (kSafeStructAlloc) VkSpecializationMapEntry[copy_src->mapEntryCount];
         memcpy ((void *)pMapEntries, (void *)copy_src->pMapEntries, sizeof(VkSpecializationMapEntry)*copy_src->mapEntryCount);
     }
 }
@@ -2819,7 +2925,7 @@ safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(const
     pNext = SafePnextCopy(in_struct->pNext);
     pName = SafeStringCopy(in_struct->pName);
     if (in_struct->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
+        pSpecializationInfo = new (kSafeStructAlloc) safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
 }
 
 safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo() :
@@ -2842,7 +2948,7 @@ safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(const
     pNext = SafePnextCopy(copy_src.pNext);
     pName = SafeStringCopy(copy_src.pName);
     if (copy_src.pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*copy_src.pSpecializationInfo);
+        pSpecializationInfo = new (kSafeStructAlloc) safe_VkSpecializationInfo(*copy_src.pSpecializationInfo);
 }
 
 safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::operator=(const safe_VkPipelineShaderStageCreateInfo& copy_src)
@@ -2863,7 +2969,7 @@ safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::oper
     pNext = SafePnextCopy(copy_src.pNext);
     pName = SafeStringCopy(copy_src.pName);
     if (copy_src.pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*copy_src.pSpecializationInfo);
+        pSpecializationInfo = new (kSafeStructAlloc) safe_VkSpecializationInfo(*copy_src.pSpecializationInfo);
 
     return *this;
 }
@@ -2892,7 +2998,7 @@ void safe_VkPipelineShaderStageCreateInfo::initialize(const VkPipelineShaderStag
     pNext = SafePnextCopy(in_struct->pNext);
     pName = SafeStringCopy(in_struct->pName);
     if (in_struct->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
+        pSpecializationInfo = new (kSafeStructAlloc) safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
 }
 
 void safe_VkPipelineShaderStageCreateInfo::initialize(const safe_VkPipelineShaderStageCreateInfo* copy_src)
@@ -2905,7 +3011,7 @@ void safe_VkPipelineShaderStageCreateInfo::initialize(const safe_VkPipelineShade
     pNext = SafePnextCopy(copy_src->pNext);
     pName = SafeStringCopy(copy_src->pName);
     if (copy_src->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*copy_src->pSpecializationInfo);
+        pSpecializationInfo = new (kSafeStructAlloc) safe_VkSpecializationInfo(*copy_src->pSpecializationInfo);
 }
 
 safe_VkComputePipelineCreateInfo::safe_VkComputePipelineCreateInfo(const VkComputePipelineCreateInfo* in_struct) :
@@ -2997,11 +3103,11 @@ safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreate
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = new (kSafeStructAlloc) VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
         memcpy ((void *)pVertexBindingDescriptions, (void *)in_struct->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*in_struct->vertexBindingDescriptionCount);
     }
     if (in_struct->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = new (kSafeStructAlloc) VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
         memcpy ((void *)pVertexAttributeDescriptions, (void *)in_struct->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*in_struct->vertexAttributeDescriptionCount);
     }
 }
@@ -3026,11 +3132,11 @@ safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreate
     pVertexAttributeDescriptions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[copy_src.vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = new (kSafeStructAlloc) VkVertexInputBindingDescription[copy_src.vertexBindingDescriptionCount];
         memcpy ((void *)pVertexBindingDescriptions, (void *)copy_src.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*copy_src.vertexBindingDescriptionCount);
     }
     if (copy_src.pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[copy_src.vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = new (kSafeStructAlloc) VkVertexInputAttributeDescription[copy_src.vertexAttributeDescriptionCount];
         memcpy ((void *)pVertexAttributeDescriptions, (void *)copy_src.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*copy_src.vertexAttributeDescriptionCount);
     }
 }
@@ -3054,11 +3160,11 @@ safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreate
     pVertexAttributeDescriptions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[copy_src.vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = new (kSafeStructAlloc) VkVertexInputBindingDescription[copy_src.vertexBindingDescriptionCount];
         memcpy ((void *)pVertexBindingDescriptions, (void *)copy_src.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*copy_src.vertexBindingDescriptionCount);
     }
     if (copy_src.pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[copy_src.vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = new (kSafeStructAlloc) VkVertexInputAttributeDescription[copy_src.vertexAttributeDescriptionCount];
         memcpy ((void *)pVertexAttributeDescriptions, (void *)copy_src.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*copy_src.vertexAttributeDescriptionCount);
     }
 
@@ -3091,11 +3197,11 @@ void safe_VkPipelineVertexInputStateCreateInfo::initialize(const VkPipelineVerte
     pVertexAttributeDescriptions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = new (kSafeStructAlloc) VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
         memcpy ((void *)pVertexBindingDescriptions, (void *)in_struct->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*in_struct->vertexBindingDescriptionCount);
     }
     if (in_struct->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = new (kSafeStructAlloc) VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
         memcpy ((void *)pVertexAttributeDescriptions, (void *)in_struct->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*in_struct->vertexAttributeDescriptionCount);
     }
 }
@@ -3110,11 +3216,11 @@ void safe_VkPipelineVertexInputStateCreateInfo::initialize(const safe_VkPipeline
     pVertexAttributeDescriptions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[copy_src->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = new (kSafeStructAlloc) VkVertexInputBindingDescription[copy_src->vertexBindingDescriptionCount];
         memcpy ((void *)pVertexBindingDescriptions, (void *)copy_src->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*copy_src->vertexBindingDescriptionCount);
     }
     if (copy_src->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[copy_src->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = new (kSafeStructAlloc) VkVertexInputAttributeDescription[copy_src->vertexAttributeDescriptionCount];
         memcpy ((void *)pVertexAttributeDescriptions, (void *)copy_src->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*copy_src->vertexAttributeDescriptionCount);
     }
 }
@@ -3259,13 +3365,13 @@ safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewports && !is_dynamic_viewports) {
-        pViewports = new VkViewport[in_struct->viewportCount];
+        pViewports = new (kSafeStructAlloc) VkViewport[in_struct->viewportCount];
         memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);
     }
     else
         pViewports = NULL;
     if (in_struct->pScissors && !is_dynamic_scissors) {
-        pScissors = new VkRect2D[in_struct->scissorCount];
+        pScissors = new (kSafeStructAlloc) VkRect2D[in_struct->scissorCount];
         memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);
     }
     else
@@ -3292,13 +3398,13 @@ safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(c
     pScissors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewports) {
-        pViewports = new VkViewport[copy_src.viewportCount];
+        pViewports = new (kSafeStructAlloc) VkViewport[copy_src.viewportCount];
         memcpy ((void *)pViewports, (void *)copy_src.pViewports, sizeof(VkViewport)*copy_src.viewportCount);
     }
     else
         pViewports = NULL;
     if (copy_src.pScissors) {
-        pScissors = new VkRect2D[copy_src.scissorCount];
+        pScissors = new (kSafeStructAlloc) VkRect2D[copy_src.scissorCount];
         memcpy ((void *)pScissors, (void *)copy_src.pScissors, sizeof(VkRect2D)*copy_src.scissorCount);
     }
     else
@@ -3324,13 +3430,13 @@ safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::
     pScissors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewports) {
-        pViewports = new VkViewport[copy_src.viewportCount];
+        pViewports = new (kSafeStructAlloc) VkViewport[copy_src.viewportCount];
         memcpy ((void *)pViewports, (void *)copy_src.pViewports, sizeof(VkViewport)*copy_src.viewportCount);
     }
     else
         pViewports = NULL;
     if (copy_src.pScissors) {
-        pScissors = new VkRect2D[copy_src.scissorCount];
+        pScissors = new (kSafeStructAlloc) VkRect2D[copy_src.scissorCount];
         memcpy ((void *)pScissors, (void *)copy_src.pScissors, sizeof(VkRect2D)*copy_src.scissorCount);
     }
     else
@@ -3365,13 +3471,13 @@ void safe_VkPipelineViewportStateCreateInfo::initialize(const VkPipelineViewport
     pScissors = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewports && !is_dynamic_viewports) {
-        pViewports = new VkViewport[in_struct->viewportCount];
+        pViewports = new (kSafeStructAlloc) VkViewport[in_struct->viewportCount];
         memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);
     }
     else
         pViewports = NULL;
     if (in_struct->pScissors && !is_dynamic_scissors) {
-        pScissors = new VkRect2D[in_struct->scissorCount];
+        pScissors = new (kSafeStructAlloc) VkRect2D[in_struct->scissorCount];
         memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);
     }
     else
@@ -3388,13 +3494,13 @@ void safe_VkPipelineViewportStateCreateInfo::initialize(const safe_VkPipelineVie
     pScissors = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewports) {
-        pViewports = new VkViewport[copy_src->viewportCount];
+        pViewports = new (kSafeStructAlloc) VkViewport[copy_src->viewportCount];
         memcpy ((void *)pViewports, (void *)copy_src->pViewports, sizeof(VkViewport)*copy_src->viewportCount);
     }
     else
         pViewports = NULL;
     if (copy_src->pScissors) {
-        pScissors = new VkRect2D[copy_src->scissorCount];
+        pScissors = new (kSafeStructAlloc) VkRect2D[copy_src->scissorCount];
         memcpy ((void *)pScissors, (void *)copy_src->pScissors, sizeof(VkRect2D)*copy_src->scissorCount);
     }
     else
@@ -3529,7 +3635,7 @@ safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreate
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSampleMask) {
-        pSampleMask = new VkSampleMask(*in_struct->pSampleMask);
+        pSampleMask = new (kSafeStructAlloc) VkSampleMask(*in_struct->pSampleMask);
     }
 }
 
@@ -3557,7 +3663,7 @@ safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreate
     alphaToOneEnable = copy_src.alphaToOneEnable;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSampleMask) {
-        pSampleMask = new VkSampleMask(*copy_src.pSampleMask);
+        pSampleMask = new (kSafeStructAlloc) VkSampleMask(*copy_src.pSampleMask);
     }
 }
 
@@ -3580,7 +3686,7 @@ safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreate
     alphaToOneEnable = copy_src.alphaToOneEnable;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSampleMask) {
-        pSampleMask = new VkSampleMask(*copy_src.pSampleMask);
+        pSampleMask = new (kSafeStructAlloc) VkSampleMask(*copy_src.pSampleMask);
     }
 
     return *this;
@@ -3610,7 +3716,7 @@ void safe_VkPipelineMultisampleStateCreateInfo::initialize(const VkPipelineMulti
     alphaToOneEnable = in_struct->alphaToOneEnable;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSampleMask) {
-        pSampleMask = new VkSampleMask(*in_struct->pSampleMask);
+        pSampleMask = new (kSafeStructAlloc) VkSampleMask(*in_struct->pSampleMask);
     }
 }
 
@@ -3626,7 +3732,7 @@ void safe_VkPipelineMultisampleStateCreateInfo::initialize(const safe_VkPipeline
     alphaToOneEnable = copy_src->alphaToOneEnable;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pSampleMask) {
-        pSampleMask = new VkSampleMask(*copy_src->pSampleMask);
+        pSampleMask = new (kSafeStructAlloc) VkSampleMask(*copy_src->pSampleMask);
     }
 }
 
@@ -3750,7 +3856,7 @@ safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateIn
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*in_struct->attachmentCount);
     }
     for (uint32_t i = 0; i < 4; ++i) {
@@ -3778,7 +3884,7 @@ safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateIn
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[copy_src.attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkPipelineColorBlendAttachmentState[copy_src.attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src.pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*copy_src.attachmentCount);
     }
     for (uint32_t i = 0; i < 4; ++i) {
@@ -3803,7 +3909,7 @@ safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateIn
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[copy_src.attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkPipelineColorBlendAttachmentState[copy_src.attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src.pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*copy_src.attachmentCount);
     }
     for (uint32_t i = 0; i < 4; ++i) {
@@ -3835,7 +3941,7 @@ void safe_VkPipelineColorBlendStateCreateInfo::initialize(const VkPipelineColorB
     pAttachments = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*in_struct->attachmentCount);
     }
     for (uint32_t i = 0; i < 4; ++i) {
@@ -3853,7 +3959,7 @@ void safe_VkPipelineColorBlendStateCreateInfo::initialize(const safe_VkPipelineC
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[copy_src->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkPipelineColorBlendAttachmentState[copy_src->attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*copy_src->attachmentCount);
     }
     for (uint32_t i = 0; i < 4; ++i) {
@@ -3869,7 +3975,7 @@ safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[in_struct->dynamicStateCount];
+        pDynamicStates = new (kSafeStructAlloc) VkDynamicState[in_struct->dynamicStateCount];
         memcpy ((void *)pDynamicStates, (void *)in_struct->pDynamicStates, sizeof(VkDynamicState)*in_struct->dynamicStateCount);
     }
 }
@@ -3890,7 +3996,7 @@ safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(con
     pDynamicStates = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDynamicStates) {
-        pDynamicStates = new VkDynamicState[copy_src.dynamicStateCount];
+        pDynamicStates = new (kSafeStructAlloc) VkDynamicState[copy_src.dynamicStateCount];
         memcpy ((void *)pDynamicStates, (void *)copy_src.pDynamicStates, sizeof(VkDynamicState)*copy_src.dynamicStateCount);
     }
 }
@@ -3910,7 +4016,7 @@ safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::op
     pDynamicStates = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDynamicStates) {
-        pDynamicStates = new VkDynamicState[copy_src.dynamicStateCount];
+        pDynamicStates = new (kSafeStructAlloc) VkDynamicState[copy_src.dynamicStateCount];
         memcpy ((void *)pDynamicStates, (void *)copy_src.pDynamicStates, sizeof(VkDynamicState)*copy_src.dynamicStateCount);
     }
 
@@ -3937,7 +4043,7 @@ void safe_VkPipelineDynamicStateCreateInfo::initialize(const VkPipelineDynamicSt
     pDynamicStates = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[in_struct->dynamicStateCount];
+        pDynamicStates = new (kSafeStructAlloc) VkDynamicState[in_struct->dynamicStateCount];
         memcpy ((void *)pDynamicStates, (void *)in_struct->pDynamicStates, sizeof(VkDynamicState)*in_struct->dynamicStateCount);
     }
 }
@@ -3950,7 +4056,7 @@ void safe_VkPipelineDynamicStateCreateInfo::initialize(const safe_VkPipelineDyna
     pDynamicStates = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[copy_src->dynamicStateCount];
+        pDynamicStates = new (kSafeStructAlloc) VkDynamicState[copy_src->dynamicStateCount];
         memcpy ((void *)pDynamicStates, (void *)copy_src->pDynamicStates, sizeof(VkDynamicState)*copy_src->dynamicStateCount);
     }
 }
@@ -3978,17 +4084,17 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
     pNext = SafePnextCopy(in_struct->pNext);
     bool is_graphics_library = LvlFindInChain<VkGraphicsPipelineLibraryCreateInfoEXT>(in_struct->pNext) != nullptr;
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (in_struct->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
+        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3997,7 +4103,7 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (in_struct->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool is_dynamic_has_rasterization = false;
@@ -4018,29 +4124,29 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
                 if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)
                     is_dynamic_scissors = true;
         }
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
+        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (in_struct->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
+        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (in_struct->pMultisampleState && (renderPass != VK_NULL_HANDLE || has_rasterization || is_graphics_library))
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
+        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     // needs a tracked subpass state uses_depthstencil_attachment
     if (in_struct->pDepthStencilState && ((has_rasterization && uses_depthstencil_attachment) || is_graphics_library))
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
+        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     // needs a tracked subpass state usesColorAttachment
     if (in_struct->pColorBlendState && ((has_rasterization && uses_color_attachment) || is_graphics_library))
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
+        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -4089,17 +4195,17 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const safe_
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (copy_src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
     else
         pVertexInputState = NULL;
     if (copy_src.pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);
+        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -4108,7 +4214,7 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const safe_
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (copy_src.pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool is_dynamic_has_rasterization = false;
@@ -4119,27 +4225,27 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const safe_
     }
     bool has_rasterization = copy_src.pRasterizationState ? (is_dynamic_has_rasterization || !copy_src.pRasterizationState->rasterizerDiscardEnable) : false;
     if (copy_src.pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);
+        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (copy_src.pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);
+        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);
     else
         pRasterizationState = NULL;
     if (copy_src.pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);
+        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (copy_src.pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);
+        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (copy_src.pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);
+        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (copy_src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -4191,17 +4297,17 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (copy_src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
     else
         pVertexInputState = NULL;
     if (copy_src.pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);
+        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -4210,7 +4316,7 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (copy_src.pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool is_dynamic_has_rasterization = false;
@@ -4221,27 +4327,27 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
     }
     bool has_rasterization = copy_src.pRasterizationState ? (is_dynamic_has_rasterization || !copy_src.pRasterizationState->rasterizerDiscardEnable) : false;
     if (copy_src.pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);
+        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (copy_src.pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);
+        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);
     else
         pRasterizationState = NULL;
     if (copy_src.pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);
+        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (copy_src.pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);
+        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (copy_src.pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);
+        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (copy_src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
     else
         pDynamicState = NULL;
 
@@ -4319,17 +4425,17 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
     pNext = SafePnextCopy(in_struct->pNext);
     bool is_graphics_library = LvlFindInChain<VkGraphicsPipelineLibraryCreateInfoEXT>(in_struct->pNext) != nullptr;
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (in_struct->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
+        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -4338,7 +4444,7 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (in_struct->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool is_dynamic_has_rasterization = false;
@@ -4359,29 +4465,29 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
                 if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)
                     is_dynamic_scissors = true;
         }
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
+        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (in_struct->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
+        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (in_struct->pMultisampleState && (renderPass != VK_NULL_HANDLE || has_rasterization || is_graphics_library))
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
+        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     // needs a tracked subpass state uses_depthstencil_attachment
     if (in_struct->pDepthStencilState && ((has_rasterization && uses_depthstencil_attachment) || is_graphics_library))
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
+        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     // needs a tracked subpass state usesColorAttachment
     if (in_struct->pColorBlendState && ((has_rasterization && uses_color_attachment) || is_graphics_library))
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
+        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -4408,17 +4514,17 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const safe_VkGraphicsPipeline
     basePipelineIndex = copy_src->basePipelineIndex;
     pNext = SafePnextCopy(copy_src->pNext);
     if (stageCount && copy_src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src->pStages[i]);
         }
     }
     if (copy_src->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (copy_src->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src->pInputAssemblyState);
+        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -4427,7 +4533,7 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const safe_VkGraphicsPipeline
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (copy_src->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool is_dynamic_has_rasterization = false;
@@ -4438,27 +4544,27 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const safe_VkGraphicsPipeline
     }
     bool has_rasterization = copy_src->pRasterizationState ? (is_dynamic_has_rasterization || !copy_src->pRasterizationState->rasterizerDiscardEnable) : false;
     if (copy_src->pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*copy_src->pViewportState);
+        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(*copy_src->pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (copy_src->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*copy_src->pRasterizationState);
+        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(*copy_src->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (copy_src->pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*copy_src->pMultisampleState);
+        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(*copy_src->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (copy_src->pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*copy_src->pDepthStencilState);
+        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(*copy_src->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (copy_src->pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*copy_src->pColorBlendState);
+        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(*copy_src->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (copy_src->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -4473,13 +4579,13 @@ safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(const VkPipelin
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (setLayoutCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[setLayoutCount];
         for (uint32_t i = 0; i < setLayoutCount; ++i) {
             pSetLayouts[i] = in_struct->pSetLayouts[i];
         }
     }
     if (in_struct->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[in_struct->pushConstantRangeCount];
+        pPushConstantRanges = new (kSafeStructAlloc) VkPushConstantRange[in_struct->pushConstantRangeCount];
         memcpy ((void *)pPushConstantRanges, (void *)in_struct->pPushConstantRanges, sizeof(VkPushConstantRange)*in_struct->pushConstantRangeCount);
     }
 }
@@ -4504,13 +4610,13 @@ safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(const safe_VkPi
     pPushConstantRanges = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (setLayoutCount && copy_src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[setLayoutCount];
         for (uint32_t i = 0; i < setLayoutCount; ++i) {
             pSetLayouts[i] = copy_src.pSetLayouts[i];
         }
     }
     if (copy_src.pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[copy_src.pushConstantRangeCount];
+        pPushConstantRanges = new (kSafeStructAlloc) VkPushConstantRange[copy_src.pushConstantRangeCount];
         memcpy ((void *)pPushConstantRanges, (void *)copy_src.pPushConstantRanges, sizeof(VkPushConstantRange)*copy_src.pushConstantRangeCount);
     }
 }
@@ -4534,13 +4640,13 @@ safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(cons
     pPushConstantRanges = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (setLayoutCount && copy_src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[setLayoutCount];
         for (uint32_t i = 0; i < setLayoutCount; ++i) {
             pSetLayouts[i] = copy_src.pSetLayouts[i];
         }
     }
     if (copy_src.pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[copy_src.pushConstantRangeCount];
+        pPushConstantRanges = new (kSafeStructAlloc) VkPushConstantRange[copy_src.pushConstantRangeCount];
         memcpy ((void *)pPushConstantRanges, (void *)copy_src.pPushConstantRanges, sizeof(VkPushConstantRange)*copy_src.pushConstantRangeCount);
     }
 
@@ -4573,13 +4679,13 @@ void safe_VkPipelineLayoutCreateInfo::initialize(const VkPipelineLayoutCreateInf
     pPushConstantRanges = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (setLayoutCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[setLayoutCount];
         for (uint32_t i = 0; i < setLayoutCount; ++i) {
             pSetLayouts[i] = in_struct->pSetLayouts[i];
         }
     }
     if (in_struct->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[in_struct->pushConstantRangeCount];
+        pPushConstantRanges = new (kSafeStructAlloc) VkPushConstantRange[in_struct->pushConstantRangeCount];
         memcpy ((void *)pPushConstantRanges, (void *)in_struct->pPushConstantRanges, sizeof(VkPushConstantRange)*in_struct->pushConstantRangeCount);
     }
 }
@@ -4594,13 +4700,13 @@ void safe_VkPipelineLayoutCreateInfo::initialize(const safe_VkPipelineLayoutCrea
     pPushConstantRanges = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (setLayoutCount && copy_src->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[setLayoutCount];
         for (uint32_t i = 0; i < setLayoutCount; ++i) {
             pSetLayouts[i] = copy_src->pSetLayouts[i];
         }
     }
     if (copy_src->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[copy_src->pushConstantRangeCount];
+        pPushConstantRanges = new (kSafeStructAlloc) VkPushConstantRange[copy_src->pushConstantRangeCount];
         memcpy ((void *)pPushConstantRanges, (void *)copy_src->pPushConstantRanges, sizeof(VkPushConstantRange)*copy_src->pushConstantRangeCount);
     }
 }
@@ -4852,7 +4958,7 @@ safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(const VkDescrip
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[in_struct->poolSizeCount];
+        pPoolSizes = new (kSafeStructAlloc) VkDescriptorPoolSize[in_struct->poolSizeCount];
         memcpy ((void *)pPoolSizes, (void *)in_struct->pPoolSizes, sizeof(VkDescriptorPoolSize)*in_struct->poolSizeCount);
     }
 }
@@ -4875,7 +4981,7 @@ safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(const safe_VkDe
     pPoolSizes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[copy_src.poolSizeCount];
+        pPoolSizes = new (kSafeStructAlloc) VkDescriptorPoolSize[copy_src.poolSizeCount];
         memcpy ((void *)pPoolSizes, (void *)copy_src.pPoolSizes, sizeof(VkDescriptorPoolSize)*copy_src.poolSizeCount);
     }
 }
@@ -4896,7 +5002,7 @@ safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(cons
     pPoolSizes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[copy_src.poolSizeCount];
+        pPoolSizes = new (kSafeStructAlloc) VkDescriptorPoolSize[copy_src.poolSizeCount];
         memcpy ((void *)pPoolSizes, (void *)copy_src.pPoolSizes, sizeof(VkDescriptorPoolSize)*copy_src.poolSizeCount);
     }
 
@@ -4924,7 +5030,7 @@ void safe_VkDescriptorPoolCreateInfo::initialize(const VkDescriptorPoolCreateInf
     pPoolSizes = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[in_struct->poolSizeCount];
+        pPoolSizes = new (kSafeStructAlloc) VkDescriptorPoolSize[in_struct->poolSizeCount];
         memcpy ((void *)pPoolSizes, (void *)in_struct->pPoolSizes, sizeof(VkDescriptorPoolSize)*in_struct->poolSizeCount);
     }
 }
@@ -4938,7 +5044,7 @@ void safe_VkDescriptorPoolCreateInfo::initialize(const safe_VkDescriptorPoolCrea
     pPoolSizes = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[copy_src->poolSizeCount];
+        pPoolSizes = new (kSafeStructAlloc) VkDescriptorPoolSize[copy_src->poolSizeCount];
         memcpy ((void *)pPoolSizes, (void *)copy_src->pPoolSizes, sizeof(VkDescriptorPoolSize)*copy_src->poolSizeCount);
     }
 }
@@ -4951,7 +5057,7 @@ safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(const VkDescr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (descriptorSetCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[descriptorSetCount];
         for (uint32_t i = 0; i < descriptorSetCount; ++i) {
             pSetLayouts[i] = in_struct->pSetLayouts[i];
         }
@@ -4974,7 +5080,7 @@ safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(const safe_Vk
     pSetLayouts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (descriptorSetCount && copy_src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[descriptorSetCount];
         for (uint32_t i = 0; i < descriptorSetCount; ++i) {
             pSetLayouts[i] = copy_src.pSetLayouts[i];
         }
@@ -4996,7 +5102,7 @@ safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(co
     pSetLayouts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (descriptorSetCount && copy_src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[descriptorSetCount];
         for (uint32_t i = 0; i < descriptorSetCount; ++i) {
             pSetLayouts[i] = copy_src.pSetLayouts[i];
         }
@@ -5025,7 +5131,7 @@ void safe_VkDescriptorSetAllocateInfo::initialize(const VkDescriptorSetAllocateI
     pSetLayouts = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (descriptorSetCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[descriptorSetCount];
         for (uint32_t i = 0; i < descriptorSetCount; ++i) {
             pSetLayouts[i] = in_struct->pSetLayouts[i];
         }
@@ -5040,7 +5146,7 @@ void safe_VkDescriptorSetAllocateInfo::initialize(const safe_VkDescriptorSetAllo
     pSetLayouts = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (descriptorSetCount && copy_src->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
+        pSetLayouts = new (kSafeStructAlloc) VkDescriptorSetLayout[descriptorSetCount];
         for (uint32_t i = 0; i < descriptorSetCount; ++i) {
             pSetLayouts[i] = copy_src->pSetLayouts[i];
         }
@@ -5056,7 +5162,7 @@ safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(const VkDes
 {
     const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
+        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];
         for (uint32_t i = 0; i < descriptorCount; ++i) {
             pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];
         }
@@ -5080,7 +5186,7 @@ safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(const safe_
     pImmutableSamplers = nullptr;
     const bool sampler_type = copy_src.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || copy_src.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && copy_src.pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
+        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];
         for (uint32_t i = 0; i < descriptorCount; ++i) {
             pImmutableSamplers[i] = copy_src.pImmutableSamplers[i];
         }
@@ -5101,7 +5207,7 @@ safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(
     pImmutableSamplers = nullptr;
     const bool sampler_type = copy_src.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || copy_src.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && copy_src.pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
+        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];
         for (uint32_t i = 0; i < descriptorCount; ++i) {
             pImmutableSamplers[i] = copy_src.pImmutableSamplers[i];
         }
@@ -5127,7 +5233,7 @@ void safe_VkDescriptorSetLayoutBinding::initialize(const VkDescriptorSetLayoutBi
     pImmutableSamplers = nullptr;
     const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
+        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];
         for (uint32_t i = 0; i < descriptorCount; ++i) {
             pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];
         }
@@ -5143,7 +5249,7 @@ void safe_VkDescriptorSetLayoutBinding::initialize(const safe_VkDescriptorSetLay
     pImmutableSamplers = nullptr;
     const bool sampler_type = copy_src->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || copy_src->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && copy_src->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
+        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];
         for (uint32_t i = 0; i < descriptorCount; ++i) {
             pImmutableSamplers[i] = copy_src->pImmutableSamplers[i];
         }
@@ -5158,7 +5264,7 @@ safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (bindingCount && in_struct->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBinding[bindingCount];
         for (uint32_t i = 0; i < bindingCount; ++i) {
             pBindings[i].initialize(&in_struct->pBindings[i]);
         }
@@ -5181,7 +5287,7 @@ safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(const
     pBindings = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (bindingCount && copy_src.pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBinding[bindingCount];
         for (uint32_t i = 0; i < bindingCount; ++i) {
             pBindings[i].initialize(&copy_src.pBindings[i]);
         }
@@ -5203,7 +5309,7 @@ safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::oper
     pBindings = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (bindingCount && copy_src.pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBinding[bindingCount];
         for (uint32_t i = 0; i < bindingCount; ++i) {
             pBindings[i].initialize(&copy_src.pBindings[i]);
         }
@@ -5232,7 +5338,7 @@ void safe_VkDescriptorSetLayoutCreateInfo::initialize(const VkDescriptorSetLayou
     pBindings = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (bindingCount && in_struct->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBinding[bindingCount];
         for (uint32_t i = 0; i < bindingCount; ++i) {
             pBindings[i].initialize(&in_struct->pBindings[i]);
         }
@@ -5247,7 +5353,7 @@ void safe_VkDescriptorSetLayoutCreateInfo::initialize(const safe_VkDescriptorSet
     pBindings = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (bindingCount && copy_src->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBinding[bindingCount];
         for (uint32_t i = 0; i < bindingCount; ++i) {
             pBindings[i].initialize(&copy_src->pBindings[i]);
         }
@@ -5273,7 +5379,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const VkWriteDescriptorSet*
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && in_struct->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
+            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pImageInfo[i] = in_struct->pImageInfo[i];
             }
@@ -5284,7 +5390,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const VkWriteDescriptorSet*
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && in_struct->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
+            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pBufferInfo[i] = in_struct->pBufferInfo[i];
             }
@@ -5293,7 +5399,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const VkWriteDescriptorSet*
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && in_struct->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
+            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pTexelBufferView[i] = in_struct->pTexelBufferView[i];
             }
@@ -5336,7 +5442,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const safe_VkWriteDescripto
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && copy_src.pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
+            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pImageInfo[i] = copy_src.pImageInfo[i];
             }
@@ -5347,7 +5453,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const safe_VkWriteDescripto
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && copy_src.pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
+            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pBufferInfo[i] = copy_src.pBufferInfo[i];
             }
@@ -5356,7 +5462,7 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const safe_VkWriteDescripto
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && copy_src.pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
+            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pTexelBufferView[i] = copy_src.pTexelBufferView[i];
             }
@@ -5397,7 +5503,7 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && copy_src.pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
+            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pImageInfo[i] = copy_src.pImageInfo[i];
             }
@@ -5408,7 +5514,7 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && copy_src.pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
+            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pBufferInfo[i] = copy_src.pBufferInfo[i];
             }
@@ -5417,7 +5523,7 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && copy_src.pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
+            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pTexelBufferView[i] = copy_src.pTexelBufferView[i];
             }
@@ -5469,7 +5575,7 @@ void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && in_struct->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
+            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pImageInfo[i] = in_struct->pImageInfo[i];
             }
@@ -5480,7 +5586,7 @@ void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && in_struct->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
+            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pBufferInfo[i] = in_struct->pBufferInfo[i];
             }
@@ -5489,7 +5595,7 @@ void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && in_struct->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
+            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pTexelBufferView[i] = in_struct->pTexelBufferView[i];
             }
@@ -5519,7 +5625,7 @@ void safe_VkWriteDescriptorSet::initialize(const safe_VkWriteDescriptorSet* copy
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && copy_src->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
+            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pImageInfo[i] = copy_src->pImageInfo[i];
             }
@@ -5530,7 +5636,7 @@ void safe_VkWriteDescriptorSet::initialize(const safe_VkWriteDescriptorSet* copy
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && copy_src->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
+            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pBufferInfo[i] = copy_src->pBufferInfo[i];
             }
@@ -5539,7 +5645,7 @@ void safe_VkWriteDescriptorSet::initialize(const safe_VkWriteDescriptorSet* copy
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && copy_src->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
+            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];
             for (uint32_t i = 0; i < descriptorCount; ++i) {
                 pTexelBufferView[i] = copy_src->pTexelBufferView[i];
             }
@@ -5562,7 +5668,7 @@ safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(const VkFramebufferCr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = in_struct->pAttachments[i];
         }
@@ -5593,7 +5699,7 @@ safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(const safe_VkFramebuf
     layers = copy_src.layers;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src.pAttachments[i];
         }
@@ -5619,7 +5725,7 @@ safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(const safe
     layers = copy_src.layers;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src.pAttachments[i];
         }
@@ -5652,7 +5758,7 @@ void safe_VkFramebufferCreateInfo::initialize(const VkFramebufferCreateInfo* in_
     layers = in_struct->layers;
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = in_struct->pAttachments[i];
         }
@@ -5671,7 +5777,7 @@ void safe_VkFramebufferCreateInfo::initialize(const safe_VkFramebufferCreateInfo
     layers = copy_src->layers;
     pNext = SafePnextCopy(copy_src->pNext);
     if (attachmentCount && copy_src->pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src->pAttachments[i];
         }
@@ -5691,22 +5797,22 @@ safe_VkSubpassDescription::safe_VkSubpassDescription(const VkSubpassDescription*
     pPreserveAttachments(nullptr)
 {
     if (in_struct->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[in_struct->inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->inputAttachmentCount];
         memcpy ((void *)pInputAttachments, (void *)in_struct->pInputAttachments, sizeof(VkAttachmentReference)*in_struct->inputAttachmentCount);
     }
     if (in_struct->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachments, (void *)in_struct->pColorAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->colorAttachmentCount];
         memcpy ((void *)pResolveAttachments, (void *)in_struct->pResolveAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) VkAttachmentReference(*in_struct->pDepthStencilAttachment);
     }
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[in_struct->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -5737,22 +5843,22 @@ safe_VkSubpassDescription::safe_VkSubpassDescription(const safe_VkSubpassDescrip
     preserveAttachmentCount = copy_src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (copy_src.pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[copy_src.inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.inputAttachmentCount];
         memcpy ((void *)pInputAttachments, (void *)copy_src.pInputAttachments, sizeof(VkAttachmentReference)*copy_src.inputAttachmentCount);
     }
     if (copy_src.pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[copy_src.colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachments, (void *)copy_src.pColorAttachments, sizeof(VkAttachmentReference)*copy_src.colorAttachmentCount);
     }
     if (copy_src.pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[copy_src.colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.colorAttachmentCount];
         memcpy ((void *)pResolveAttachments, (void *)copy_src.pResolveAttachments, sizeof(VkAttachmentReference)*copy_src.colorAttachmentCount);
     }
     if (copy_src.pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*copy_src.pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) VkAttachmentReference(*copy_src.pDepthStencilAttachment);
     }
     if (copy_src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src.preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src.preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src.pPreserveAttachments, sizeof(uint32_t)*copy_src.preserveAttachmentCount);
     }
 }
@@ -5783,22 +5889,22 @@ safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(const safe_VkSub
     preserveAttachmentCount = copy_src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (copy_src.pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[copy_src.inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.inputAttachmentCount];
         memcpy ((void *)pInputAttachments, (void *)copy_src.pInputAttachments, sizeof(VkAttachmentReference)*copy_src.inputAttachmentCount);
     }
     if (copy_src.pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[copy_src.colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachments, (void *)copy_src.pColorAttachments, sizeof(VkAttachmentReference)*copy_src.colorAttachmentCount);
     }
     if (copy_src.pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[copy_src.colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src.colorAttachmentCount];
         memcpy ((void *)pResolveAttachments, (void *)copy_src.pResolveAttachments, sizeof(VkAttachmentReference)*copy_src.colorAttachmentCount);
     }
     if (copy_src.pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*copy_src.pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) VkAttachmentReference(*copy_src.pDepthStencilAttachment);
     }
     if (copy_src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src.preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src.preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src.pPreserveAttachments, sizeof(uint32_t)*copy_src.preserveAttachmentCount);
     }
 
@@ -5842,22 +5948,22 @@ void safe_VkSubpassDescription::initialize(const VkSubpassDescription* in_struct
     preserveAttachmentCount = in_struct->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (in_struct->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[in_struct->inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->inputAttachmentCount];
         memcpy ((void *)pInputAttachments, (void *)in_struct->pInputAttachments, sizeof(VkAttachmentReference)*in_struct->inputAttachmentCount);
     }
     if (in_struct->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachments, (void *)in_struct->pColorAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) VkAttachmentReference[in_struct->colorAttachmentCount];
         memcpy ((void *)pResolveAttachments, (void *)in_struct->pResolveAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) VkAttachmentReference(*in_struct->pDepthStencilAttachment);
     }
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[in_struct->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -5875,22 +5981,22 @@ void safe_VkSubpassDescription::initialize(const safe_VkSubpassDescription* copy
     preserveAttachmentCount = copy_src->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (copy_src->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[copy_src->inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src->inputAttachmentCount];
         memcpy ((void *)pInputAttachments, (void *)copy_src->pInputAttachments, sizeof(VkAttachmentReference)*copy_src->inputAttachmentCount);
     }
     if (copy_src->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[copy_src->colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src->colorAttachmentCount];
         memcpy ((void *)pColorAttachments, (void *)copy_src->pColorAttachments, sizeof(VkAttachmentReference)*copy_src->colorAttachmentCount);
     }
     if (copy_src->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[copy_src->colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) VkAttachmentReference[copy_src->colorAttachmentCount];
         memcpy ((void *)pResolveAttachments, (void *)copy_src->pResolveAttachments, sizeof(VkAttachmentReference)*copy_src->colorAttachmentCount);
     }
     if (copy_src->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*copy_src->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) VkAttachmentReference(*copy_src->pDepthStencilAttachment);
     }
     if (copy_src->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src->pPreserveAttachments, sizeof(uint32_t)*copy_src->preserveAttachmentCount);
     }
 }
@@ -5907,17 +6013,17 @@ safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(const VkRenderPassCreat
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachments) {
-        pAttachments = new VkAttachmentDescription[in_struct->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkAttachmentDescription[in_struct->attachmentCount];
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkAttachmentDescription)*in_struct->attachmentCount);
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (in_struct->pDependencies) {
-        pDependencies = new VkSubpassDependency[in_struct->dependencyCount];
+        pDependencies = new (kSafeStructAlloc) VkSubpassDependency[in_struct->dependencyCount];
         memcpy ((void *)pDependencies, (void *)in_struct->pDependencies, sizeof(VkSubpassDependency)*in_struct->dependencyCount);
     }
 }
@@ -5946,17 +6052,17 @@ safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(const safe_VkRenderPass
     pDependencies = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachments) {
-        pAttachments = new VkAttachmentDescription[copy_src.attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkAttachmentDescription[copy_src.attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src.pAttachments, sizeof(VkAttachmentDescription)*copy_src.attachmentCount);
     }
     if (subpassCount && copy_src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src.pSubpasses[i]);
         }
     }
     if (copy_src.pDependencies) {
-        pDependencies = new VkSubpassDependency[copy_src.dependencyCount];
+        pDependencies = new (kSafeStructAlloc) VkSubpassDependency[copy_src.dependencyCount];
         memcpy ((void *)pDependencies, (void *)copy_src.pDependencies, sizeof(VkSubpassDependency)*copy_src.dependencyCount);
     }
 }
@@ -5984,17 +6090,17 @@ safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(const safe_V
     pDependencies = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachments) {
-        pAttachments = new VkAttachmentDescription[copy_src.attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkAttachmentDescription[copy_src.attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src.pAttachments, sizeof(VkAttachmentDescription)*copy_src.attachmentCount);
     }
     if (subpassCount && copy_src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src.pSubpasses[i]);
         }
     }
     if (copy_src.pDependencies) {
-        pDependencies = new VkSubpassDependency[copy_src.dependencyCount];
+        pDependencies = new (kSafeStructAlloc) VkSubpassDependency[copy_src.dependencyCount];
         memcpy ((void *)pDependencies, (void *)copy_src.pDependencies, sizeof(VkSubpassDependency)*copy_src.dependencyCount);
     }
 
@@ -6033,17 +6139,17 @@ void safe_VkRenderPassCreateInfo::initialize(const VkRenderPassCreateInfo* in_st
     pDependencies = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachments) {
-        pAttachments = new VkAttachmentDescription[in_struct->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkAttachmentDescription[in_struct->attachmentCount];
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkAttachmentDescription)*in_struct->attachmentCount);
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (in_struct->pDependencies) {
-        pDependencies = new VkSubpassDependency[in_struct->dependencyCount];
+        pDependencies = new (kSafeStructAlloc) VkSubpassDependency[in_struct->dependencyCount];
         memcpy ((void *)pDependencies, (void *)in_struct->pDependencies, sizeof(VkSubpassDependency)*in_struct->dependencyCount);
     }
 }
@@ -6060,17 +6166,17 @@ void safe_VkRenderPassCreateInfo::initialize(const safe_VkRenderPassCreateInfo*
     pDependencies = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttachments) {
-        pAttachments = new VkAttachmentDescription[copy_src->attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkAttachmentDescription[copy_src->attachmentCount];
         memcpy ((void *)pAttachments, (void *)copy_src->pAttachments, sizeof(VkAttachmentDescription)*copy_src->attachmentCount);
     }
     if (subpassCount && copy_src->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src->pSubpasses[i]);
         }
     }
     if (copy_src->pDependencies) {
-        pDependencies = new VkSubpassDependency[copy_src->dependencyCount];
+        pDependencies = new (kSafeStructAlloc) VkSubpassDependency[copy_src->dependencyCount];
         memcpy ((void *)pDependencies, (void *)copy_src->pDependencies, sizeof(VkSubpassDependency)*copy_src->dependencyCount);
     }
 }
@@ -6298,7 +6404,7 @@ safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(const VkCommandBuff
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
+        pInheritanceInfo = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
 }
 
 safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo() :
@@ -6315,7 +6421,7 @@ safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(const safe_VkComman
     pInheritanceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*copy_src.pInheritanceInfo);
+        pInheritanceInfo = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceInfo(*copy_src.pInheritanceInfo);
 }
 
 safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(const safe_VkCommandBufferBeginInfo& copy_src)
@@ -6332,7 +6438,7 @@ safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(const sa
     pInheritanceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*copy_src.pInheritanceInfo);
+        pInheritanceInfo = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceInfo(*copy_src.pInheritanceInfo);
 
     return *this;
 }
@@ -6356,7 +6462,7 @@ void safe_VkCommandBufferBeginInfo::initialize(const VkCommandBufferBeginInfo* i
     pInheritanceInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
+        pInheritanceInfo = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
 }
 
 void safe_VkCommandBufferBeginInfo::initialize(const safe_VkCommandBufferBeginInfo* copy_src)
@@ -6366,7 +6472,7 @@ void safe_VkCommandBufferBeginInfo::initialize(const safe_VkCommandBufferBeginIn
     pInheritanceInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*copy_src->pInheritanceInfo);
+        pInheritanceInfo = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceInfo(*copy_src->pInheritanceInfo);
 }
 
 safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(const VkRenderPassBeginInfo* in_struct) :
@@ -6379,7 +6485,7 @@ safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(const VkRenderPassBeginIn
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pClearValues) {
-        pClearValues = new VkClearValue[in_struct->clearValueCount];
+        pClearValues = new (kSafeStructAlloc) VkClearValue[in_struct->clearValueCount];
         memcpy ((void *)pClearValues, (void *)in_struct->pClearValues, sizeof(VkClearValue)*in_struct->clearValueCount);
     }
 }
@@ -6404,7 +6510,7 @@ safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(const safe_VkRenderPassBe
     pClearValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pClearValues) {
-        pClearValues = new VkClearValue[copy_src.clearValueCount];
+        pClearValues = new (kSafeStructAlloc) VkClearValue[copy_src.clearValueCount];
         memcpy ((void *)pClearValues, (void *)copy_src.pClearValues, sizeof(VkClearValue)*copy_src.clearValueCount);
     }
 }
@@ -6426,7 +6532,7 @@ safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(const safe_VkR
     pClearValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pClearValues) {
-        pClearValues = new VkClearValue[copy_src.clearValueCount];
+        pClearValues = new (kSafeStructAlloc) VkClearValue[copy_src.clearValueCount];
         memcpy ((void *)pClearValues, (void *)copy_src.pClearValues, sizeof(VkClearValue)*copy_src.clearValueCount);
     }
 
@@ -6455,7 +6561,7 @@ void safe_VkRenderPassBeginInfo::initialize(const VkRenderPassBeginInfo* in_stru
     pClearValues = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pClearValues) {
-        pClearValues = new VkClearValue[in_struct->clearValueCount];
+        pClearValues = new (kSafeStructAlloc) VkClearValue[in_struct->clearValueCount];
         memcpy ((void *)pClearValues, (void *)in_struct->pClearValues, sizeof(VkClearValue)*in_struct->clearValueCount);
     }
 }
@@ -6470,7 +6576,7 @@ void safe_VkRenderPassBeginInfo::initialize(const safe_VkRenderPassBeginInfo* co
     pClearValues = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pClearValues) {
-        pClearValues = new VkClearValue[copy_src->clearValueCount];
+        pClearValues = new (kSafeStructAlloc) VkClearValue[copy_src->clearValueCount];
         memcpy ((void *)pClearValues, (void *)copy_src->pClearValues, sizeof(VkClearValue)*copy_src->clearValueCount);
     }
 }
@@ -6953,7 +7059,7 @@ safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[in_struct->deviceRenderAreaCount];
+        pDeviceRenderAreas = new (kSafeStructAlloc) VkRect2D[in_struct->deviceRenderAreaCount];
         memcpy ((void *)pDeviceRenderAreas, (void *)in_struct->pDeviceRenderAreas, sizeof(VkRect2D)*in_struct->deviceRenderAreaCount);
     }
 }
@@ -6974,7 +7080,7 @@ safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(con
     pDeviceRenderAreas = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[copy_src.deviceRenderAreaCount];
+        pDeviceRenderAreas = new (kSafeStructAlloc) VkRect2D[copy_src.deviceRenderAreaCount];
         memcpy ((void *)pDeviceRenderAreas, (void *)copy_src.pDeviceRenderAreas, sizeof(VkRect2D)*copy_src.deviceRenderAreaCount);
     }
 }
@@ -6994,7 +7100,7 @@ safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::op
     pDeviceRenderAreas = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[copy_src.deviceRenderAreaCount];
+        pDeviceRenderAreas = new (kSafeStructAlloc) VkRect2D[copy_src.deviceRenderAreaCount];
         memcpy ((void *)pDeviceRenderAreas, (void *)copy_src.pDeviceRenderAreas, sizeof(VkRect2D)*copy_src.deviceRenderAreaCount);
     }
 
@@ -7021,7 +7127,7 @@ void safe_VkDeviceGroupRenderPassBeginInfo::initialize(const VkDeviceGroupRender
     pDeviceRenderAreas = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[in_struct->deviceRenderAreaCount];
+        pDeviceRenderAreas = new (kSafeStructAlloc) VkRect2D[in_struct->deviceRenderAreaCount];
         memcpy ((void *)pDeviceRenderAreas, (void *)in_struct->pDeviceRenderAreas, sizeof(VkRect2D)*in_struct->deviceRenderAreaCount);
     }
 }
@@ -7034,7 +7140,7 @@ void safe_VkDeviceGroupRenderPassBeginInfo::initialize(const safe_VkDeviceGroupR
     pDeviceRenderAreas = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[copy_src->deviceRenderAreaCount];
+        pDeviceRenderAreas = new (kSafeStructAlloc) VkRect2D[copy_src->deviceRenderAreaCount];
         memcpy ((void *)pDeviceRenderAreas, (void *)copy_src->pDeviceRenderAreas, sizeof(VkRect2D)*copy_src->deviceRenderAreaCount);
     }
 }
@@ -7106,15 +7212,15 @@ safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(const VkDeviceGroupSu
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[in_struct->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->waitSemaphoreCount];
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)in_struct->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[in_struct->commandBufferCount];
+        pCommandBufferDeviceMasks = new (kSafeStructAlloc) uint32_t[in_struct->commandBufferCount];
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)in_struct->pCommandBufferDeviceMasks, sizeof(uint32_t)*in_struct->commandBufferCount);
     }
     if (in_struct->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[in_struct->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->signalSemaphoreCount];
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)in_struct->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->signalSemaphoreCount);
     }
 }
@@ -7141,15 +7247,15 @@ safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(const safe_VkDeviceGr
     pSignalSemaphoreDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[copy_src.waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.waitSemaphoreCount];
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)copy_src.pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src.waitSemaphoreCount);
     }
     if (copy_src.pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[copy_src.commandBufferCount];
+        pCommandBufferDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src.commandBufferCount];
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)copy_src.pCommandBufferDeviceMasks, sizeof(uint32_t)*copy_src.commandBufferCount);
     }
     if (copy_src.pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[copy_src.signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.signalSemaphoreCount];
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)copy_src.pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src.signalSemaphoreCount);
     }
 }
@@ -7176,15 +7282,15 @@ safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(const safe
     pSignalSemaphoreDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[copy_src.waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.waitSemaphoreCount];
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)copy_src.pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src.waitSemaphoreCount);
     }
     if (copy_src.pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[copy_src.commandBufferCount];
+        pCommandBufferDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src.commandBufferCount];
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)copy_src.pCommandBufferDeviceMasks, sizeof(uint32_t)*copy_src.commandBufferCount);
     }
     if (copy_src.pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[copy_src.signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.signalSemaphoreCount];
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)copy_src.pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src.signalSemaphoreCount);
     }
 
@@ -7222,15 +7328,15 @@ void safe_VkDeviceGroupSubmitInfo::initialize(const VkDeviceGroupSubmitInfo* in_
     pSignalSemaphoreDeviceIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[in_struct->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->waitSemaphoreCount];
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)in_struct->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[in_struct->commandBufferCount];
+        pCommandBufferDeviceMasks = new (kSafeStructAlloc) uint32_t[in_struct->commandBufferCount];
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)in_struct->pCommandBufferDeviceMasks, sizeof(uint32_t)*in_struct->commandBufferCount);
     }
     if (in_struct->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[in_struct->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->signalSemaphoreCount];
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)in_struct->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->signalSemaphoreCount);
     }
 }
@@ -7246,15 +7352,15 @@ void safe_VkDeviceGroupSubmitInfo::initialize(const safe_VkDeviceGroupSubmitInfo
     pSignalSemaphoreDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[copy_src->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src->waitSemaphoreCount];
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)copy_src->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src->waitSemaphoreCount);
     }
     if (copy_src->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[copy_src->commandBufferCount];
+        pCommandBufferDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src->commandBufferCount];
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)copy_src->pCommandBufferDeviceMasks, sizeof(uint32_t)*copy_src->commandBufferCount);
     }
     if (copy_src->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[copy_src->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src->signalSemaphoreCount];
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)copy_src->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*copy_src->signalSemaphoreCount);
     }
 }
@@ -7328,7 +7434,7 @@ safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -7347,7 +7453,7 @@ safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(c
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
 }
@@ -7366,7 +7472,7 @@ safe_VkBindBufferMemoryDeviceGroupInfo& safe_VkBindBufferMemoryDeviceGroupInfo::
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
 
@@ -7392,7 +7498,7 @@ void safe_VkBindBufferMemoryDeviceGroupInfo::initialize(const VkBindBufferMemory
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -7404,7 +7510,7 @@ void safe_VkBindBufferMemoryDeviceGroupInfo::initialize(const safe_VkBindBufferM
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src->pDeviceIndices, sizeof(uint32_t)*copy_src->deviceIndexCount);
     }
 }
@@ -7418,11 +7524,11 @@ safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
     if (in_struct->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[in_struct->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = new (kSafeStructAlloc) VkRect2D[in_struct->splitInstanceBindRegionCount];
         memcpy ((void *)pSplitInstanceBindRegions, (void *)in_struct->pSplitInstanceBindRegions, sizeof(VkRect2D)*in_struct->splitInstanceBindRegionCount);
     }
 }
@@ -7445,11 +7551,11 @@ safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(con
     pSplitInstanceBindRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
     if (copy_src.pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[copy_src.splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = new (kSafeStructAlloc) VkRect2D[copy_src.splitInstanceBindRegionCount];
         memcpy ((void *)pSplitInstanceBindRegions, (void *)copy_src.pSplitInstanceBindRegions, sizeof(VkRect2D)*copy_src.splitInstanceBindRegionCount);
     }
 }
@@ -7472,11 +7578,11 @@ safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::op
     pSplitInstanceBindRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
     if (copy_src.pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[copy_src.splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = new (kSafeStructAlloc) VkRect2D[copy_src.splitInstanceBindRegionCount];
         memcpy ((void *)pSplitInstanceBindRegions, (void *)copy_src.pSplitInstanceBindRegions, sizeof(VkRect2D)*copy_src.splitInstanceBindRegionCount);
     }
 
@@ -7508,11 +7614,11 @@ void safe_VkBindImageMemoryDeviceGroupInfo::initialize(const VkBindImageMemoryDe
     pSplitInstanceBindRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
     if (in_struct->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[in_struct->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = new (kSafeStructAlloc) VkRect2D[in_struct->splitInstanceBindRegionCount];
         memcpy ((void *)pSplitInstanceBindRegions, (void *)in_struct->pSplitInstanceBindRegions, sizeof(VkRect2D)*in_struct->splitInstanceBindRegionCount);
     }
 }
@@ -7526,11 +7632,11 @@ void safe_VkBindImageMemoryDeviceGroupInfo::initialize(const safe_VkBindImageMem
     pSplitInstanceBindRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src->pDeviceIndices, sizeof(uint32_t)*copy_src->deviceIndexCount);
     }
     if (copy_src->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[copy_src->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = new (kSafeStructAlloc) VkRect2D[copy_src->splitInstanceBindRegionCount];
         memcpy ((void *)pSplitInstanceBindRegions, (void *)copy_src->pSplitInstanceBindRegions, sizeof(VkRect2D)*copy_src->splitInstanceBindRegionCount);
     }
 }
@@ -7619,7 +7725,7 @@ safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(const VkD
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[in_struct->physicalDeviceCount];
+        pPhysicalDevices = new (kSafeStructAlloc) VkPhysicalDevice[in_struct->physicalDeviceCount];
         memcpy ((void *)pPhysicalDevices, (void *)in_struct->pPhysicalDevices, sizeof(VkPhysicalDevice)*in_struct->physicalDeviceCount);
     }
 }
@@ -7638,7 +7744,7 @@ safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(const saf
     pPhysicalDevices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[copy_src.physicalDeviceCount];
+        pPhysicalDevices = new (kSafeStructAlloc) VkPhysicalDevice[copy_src.physicalDeviceCount];
         memcpy ((void *)pPhysicalDevices, (void *)copy_src.pPhysicalDevices, sizeof(VkPhysicalDevice)*copy_src.physicalDeviceCount);
     }
 }
@@ -7657,7 +7763,7 @@ safe_VkDeviceGroupDeviceCreateInfo& safe_VkDeviceGroupDeviceCreateInfo::operator
     pPhysicalDevices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[copy_src.physicalDeviceCount];
+        pPhysicalDevices = new (kSafeStructAlloc) VkPhysicalDevice[copy_src.physicalDeviceCount];
         memcpy ((void *)pPhysicalDevices, (void *)copy_src.pPhysicalDevices, sizeof(VkPhysicalDevice)*copy_src.physicalDeviceCount);
     }
 
@@ -7683,7 +7789,7 @@ void safe_VkDeviceGroupDeviceCreateInfo::initialize(const VkDeviceGroupDeviceCre
     pPhysicalDevices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[in_struct->physicalDeviceCount];
+        pPhysicalDevices = new (kSafeStructAlloc) VkPhysicalDevice[in_struct->physicalDeviceCount];
         memcpy ((void *)pPhysicalDevices, (void *)in_struct->pPhysicalDevices, sizeof(VkPhysicalDevice)*in_struct->physicalDeviceCount);
     }
 }
@@ -7695,7 +7801,7 @@ void safe_VkDeviceGroupDeviceCreateInfo::initialize(const safe_VkDeviceGroupDevi
     pPhysicalDevices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[copy_src->physicalDeviceCount];
+        pPhysicalDevices = new (kSafeStructAlloc) VkPhysicalDevice[copy_src->physicalDeviceCount];
         memcpy ((void *)pPhysicalDevices, (void *)copy_src->pPhysicalDevices, sizeof(VkPhysicalDevice)*copy_src->physicalDeviceCount);
     }
 }
@@ -8595,7 +8701,7 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachme
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
+        pAspectReferences = new (kSafeStructAlloc) VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
         memcpy ((void *)pAspectReferences, (void *)in_struct->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*in_struct->aspectReferenceCount);
     }
 }
@@ -8614,7 +8720,7 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachme
     pAspectReferences = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[copy_src.aspectReferenceCount];
+        pAspectReferences = new (kSafeStructAlloc) VkInputAttachmentAspectReference[copy_src.aspectReferenceCount];
         memcpy ((void *)pAspectReferences, (void *)copy_src.pAspectReferences, sizeof(VkInputAttachmentAspectReference)*copy_src.aspectReferenceCount);
     }
 }
@@ -8633,7 +8739,7 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo& safe_VkRenderPassInputAttachme
     pAspectReferences = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[copy_src.aspectReferenceCount];
+        pAspectReferences = new (kSafeStructAlloc) VkInputAttachmentAspectReference[copy_src.aspectReferenceCount];
         memcpy ((void *)pAspectReferences, (void *)copy_src.pAspectReferences, sizeof(VkInputAttachmentAspectReference)*copy_src.aspectReferenceCount);
     }
 
@@ -8659,7 +8765,7 @@ void safe_VkRenderPassInputAttachmentAspectCreateInfo::initialize(const VkRender
     pAspectReferences = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
+        pAspectReferences = new (kSafeStructAlloc) VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
         memcpy ((void *)pAspectReferences, (void *)in_struct->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*in_struct->aspectReferenceCount);
     }
 }
@@ -8671,7 +8777,7 @@ void safe_VkRenderPassInputAttachmentAspectCreateInfo::initialize(const safe_VkR
     pAspectReferences = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[copy_src->aspectReferenceCount];
+        pAspectReferences = new (kSafeStructAlloc) VkInputAttachmentAspectReference[copy_src->aspectReferenceCount];
         memcpy ((void *)pAspectReferences, (void *)copy_src->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*copy_src->aspectReferenceCount);
     }
 }
@@ -8799,15 +8905,15 @@ safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewMasks) {
-        pViewMasks = new uint32_t[in_struct->subpassCount];
+        pViewMasks = new (kSafeStructAlloc) uint32_t[in_struct->subpassCount];
         memcpy ((void *)pViewMasks, (void *)in_struct->pViewMasks, sizeof(uint32_t)*in_struct->subpassCount);
     }
     if (in_struct->pViewOffsets) {
-        pViewOffsets = new int32_t[in_struct->dependencyCount];
+        pViewOffsets = new (kSafeStructAlloc) int32_t[in_struct->dependencyCount];
         memcpy ((void *)pViewOffsets, (void *)in_struct->pViewOffsets, sizeof(int32_t)*in_struct->dependencyCount);
     }
     if (in_struct->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[in_struct->correlationMaskCount];
+        pCorrelationMasks = new (kSafeStructAlloc) uint32_t[in_struct->correlationMaskCount];
         memcpy ((void *)pCorrelationMasks, (void *)in_struct->pCorrelationMasks, sizeof(uint32_t)*in_struct->correlationMaskCount);
     }
 }
@@ -8834,15 +8940,15 @@ safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(const
     pCorrelationMasks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewMasks) {
-        pViewMasks = new uint32_t[copy_src.subpassCount];
+        pViewMasks = new (kSafeStructAlloc) uint32_t[copy_src.subpassCount];
         memcpy ((void *)pViewMasks, (void *)copy_src.pViewMasks, sizeof(uint32_t)*copy_src.subpassCount);
     }
     if (copy_src.pViewOffsets) {
-        pViewOffsets = new int32_t[copy_src.dependencyCount];
+        pViewOffsets = new (kSafeStructAlloc) int32_t[copy_src.dependencyCount];
         memcpy ((void *)pViewOffsets, (void *)copy_src.pViewOffsets, sizeof(int32_t)*copy_src.dependencyCount);
     }
     if (copy_src.pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[copy_src.correlationMaskCount];
+        pCorrelationMasks = new (kSafeStructAlloc) uint32_t[copy_src.correlationMaskCount];
         memcpy ((void *)pCorrelationMasks, (void *)copy_src.pCorrelationMasks, sizeof(uint32_t)*copy_src.correlationMaskCount);
     }
 }
@@ -8869,15 +8975,15 @@ safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::oper
     pCorrelationMasks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewMasks) {
-        pViewMasks = new uint32_t[copy_src.subpassCount];
+        pViewMasks = new (kSafeStructAlloc) uint32_t[copy_src.subpassCount];
         memcpy ((void *)pViewMasks, (void *)copy_src.pViewMasks, sizeof(uint32_t)*copy_src.subpassCount);
     }
     if (copy_src.pViewOffsets) {
-        pViewOffsets = new int32_t[copy_src.dependencyCount];
+        pViewOffsets = new (kSafeStructAlloc) int32_t[copy_src.dependencyCount];
         memcpy ((void *)pViewOffsets, (void *)copy_src.pViewOffsets, sizeof(int32_t)*copy_src.dependencyCount);
     }
     if (copy_src.pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[copy_src.correlationMaskCount];
+        pCorrelationMasks = new (kSafeStructAlloc) uint32_t[copy_src.correlationMaskCount];
         memcpy ((void *)pCorrelationMasks, (void *)copy_src.pCorrelationMasks, sizeof(uint32_t)*copy_src.correlationMaskCount);
     }
 
@@ -8915,15 +9021,15 @@ void safe_VkRenderPassMultiviewCreateInfo::initialize(const VkRenderPassMultivie
     pCorrelationMasks = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewMasks) {
-        pViewMasks = new uint32_t[in_struct->subpassCount];
+        pViewMasks = new (kSafeStructAlloc) uint32_t[in_struct->subpassCount];
         memcpy ((void *)pViewMasks, (void *)in_struct->pViewMasks, sizeof(uint32_t)*in_struct->subpassCount);
     }
     if (in_struct->pViewOffsets) {
-        pViewOffsets = new int32_t[in_struct->dependencyCount];
+        pViewOffsets = new (kSafeStructAlloc) int32_t[in_struct->dependencyCount];
         memcpy ((void *)pViewOffsets, (void *)in_struct->pViewOffsets, sizeof(int32_t)*in_struct->dependencyCount);
     }
     if (in_struct->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[in_struct->correlationMaskCount];
+        pCorrelationMasks = new (kSafeStructAlloc) uint32_t[in_struct->correlationMaskCount];
         memcpy ((void *)pCorrelationMasks, (void *)in_struct->pCorrelationMasks, sizeof(uint32_t)*in_struct->correlationMaskCount);
     }
 }
@@ -8939,15 +9045,15 @@ void safe_VkRenderPassMultiviewCreateInfo::initialize(const safe_VkRenderPassMul
     pCorrelationMasks = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewMasks) {
-        pViewMasks = new uint32_t[copy_src->subpassCount];
+        pViewMasks = new (kSafeStructAlloc) uint32_t[copy_src->subpassCount];
         memcpy ((void *)pViewMasks, (void *)copy_src->pViewMasks, sizeof(uint32_t)*copy_src->subpassCount);
     }
     if (copy_src->pViewOffsets) {
-        pViewOffsets = new int32_t[copy_src->dependencyCount];
+        pViewOffsets = new (kSafeStructAlloc) int32_t[copy_src->dependencyCount];
         memcpy ((void *)pViewOffsets, (void *)copy_src->pViewOffsets, sizeof(int32_t)*copy_src->dependencyCount);
     }
     if (copy_src->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[copy_src->correlationMaskCount];
+        pCorrelationMasks = new (kSafeStructAlloc) uint32_t[copy_src->correlationMaskCount];
         memcpy ((void *)pCorrelationMasks, (void *)copy_src->pCorrelationMasks, sizeof(uint32_t)*copy_src->correlationMaskCount);
     }
 }
@@ -9771,7 +9877,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreate
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = new (kSafeStructAlloc) VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
         memcpy ((void *)pDescriptorUpdateEntries, (void *)in_struct->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*in_struct->descriptorUpdateEntryCount);
     }
 }
@@ -9802,7 +9908,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreate
     set = copy_src.set;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[copy_src.descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = new (kSafeStructAlloc) VkDescriptorUpdateTemplateEntry[copy_src.descriptorUpdateEntryCount];
         memcpy ((void *)pDescriptorUpdateEntries, (void *)copy_src.pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*copy_src.descriptorUpdateEntryCount);
     }
 }
@@ -9827,7 +9933,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreate
     set = copy_src.set;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[copy_src.descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = new (kSafeStructAlloc) VkDescriptorUpdateTemplateEntry[copy_src.descriptorUpdateEntryCount];
         memcpy ((void *)pDescriptorUpdateEntries, (void *)copy_src.pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*copy_src.descriptorUpdateEntryCount);
     }
 
@@ -9859,7 +9965,7 @@ void safe_VkDescriptorUpdateTemplateCreateInfo::initialize(const VkDescriptorUpd
     set = in_struct->set;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = new (kSafeStructAlloc) VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
         memcpy ((void *)pDescriptorUpdateEntries, (void *)in_struct->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*in_struct->descriptorUpdateEntryCount);
     }
 }
@@ -9877,7 +9983,7 @@ void safe_VkDescriptorUpdateTemplateCreateInfo::initialize(const safe_VkDescript
     set = copy_src->set;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[copy_src->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = new (kSafeStructAlloc) VkDescriptorUpdateTemplateEntry[copy_src->descriptorUpdateEntryCount];
         memcpy ((void *)pDescriptorUpdateEntries, (void *)copy_src->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*copy_src->descriptorUpdateEntryCount);
     }
 }
@@ -11935,7 +12041,7 @@ safe_VkImageFormatListCreateInfo::safe_VkImageFormatListCreateInfo(const VkImage
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[in_struct->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -11954,7 +12060,7 @@ safe_VkImageFormatListCreateInfo::safe_VkImageFormatListCreateInfo(const safe_Vk
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewFormats) {
-        pViewFormats = new VkFormat[copy_src.viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src.viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src.pViewFormats, sizeof(VkFormat)*copy_src.viewFormatCount);
     }
 }
@@ -11973,7 +12079,7 @@ safe_VkImageFormatListCreateInfo& safe_VkImageFormatListCreateInfo::operator=(co
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewFormats) {
-        pViewFormats = new VkFormat[copy_src.viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src.viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src.pViewFormats, sizeof(VkFormat)*copy_src.viewFormatCount);
     }
 
@@ -11999,7 +12105,7 @@ void safe_VkImageFormatListCreateInfo::initialize(const VkImageFormatListCreateI
     pViewFormats = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[in_struct->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -12011,7 +12117,7 @@ void safe_VkImageFormatListCreateInfo::initialize(const safe_VkImageFormatListCr
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewFormats) {
-        pViewFormats = new VkFormat[copy_src->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src->pViewFormats, sizeof(VkFormat)*copy_src->viewFormatCount);
     }
 }
@@ -12204,27 +12310,27 @@ safe_VkSubpassDescription2::safe_VkSubpassDescription2(const VkSubpassDescriptio
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (inputAttachmentCount && in_struct->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2[inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[inputAttachmentCount];
         for (uint32_t i = 0; i < inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&in_struct->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&in_struct->pResolveAttachments[i]);
         }
     }
     if (in_struct->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2(in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pDepthStencilAttachment);
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[in_struct->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -12261,27 +12367,27 @@ safe_VkSubpassDescription2::safe_VkSubpassDescription2(const safe_VkSubpassDescr
     pPreserveAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (inputAttachmentCount && copy_src.pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2[inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[inputAttachmentCount];
         for (uint32_t i = 0; i < inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&copy_src.pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src.pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src.pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src.pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&copy_src.pResolveAttachments[i]);
         }
     }
     if (copy_src.pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2(*copy_src.pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pDepthStencilAttachment);
     if (copy_src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src.preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src.preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src.pPreserveAttachments, sizeof(uint32_t)*copy_src.preserveAttachmentCount);
     }
 }
@@ -12317,27 +12423,27 @@ safe_VkSubpassDescription2& safe_VkSubpassDescription2::operator=(const safe_VkS
     pPreserveAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (inputAttachmentCount && copy_src.pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2[inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[inputAttachmentCount];
         for (uint32_t i = 0; i < inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&copy_src.pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src.pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src.pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src.pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&copy_src.pResolveAttachments[i]);
         }
     }
     if (copy_src.pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2(*copy_src.pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pDepthStencilAttachment);
     if (copy_src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src.preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src.preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src.pPreserveAttachments, sizeof(uint32_t)*copy_src.preserveAttachmentCount);
     }
 
@@ -12388,27 +12494,27 @@ void safe_VkSubpassDescription2::initialize(const VkSubpassDescription2* in_stru
     pPreserveAttachments = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (inputAttachmentCount && in_struct->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2[inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[inputAttachmentCount];
         for (uint32_t i = 0; i < inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&in_struct->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&in_struct->pResolveAttachments[i]);
         }
     }
     if (in_struct->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2(in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pDepthStencilAttachment);
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[in_struct->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -12429,27 +12535,27 @@ void safe_VkSubpassDescription2::initialize(const safe_VkSubpassDescription2* co
     pPreserveAttachments = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (inputAttachmentCount && copy_src->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2[inputAttachmentCount];
+        pInputAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[inputAttachmentCount];
         for (uint32_t i = 0; i < inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&copy_src->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && copy_src->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2[colorAttachmentCount];
+        pResolveAttachments = new (kSafeStructAlloc) safe_VkAttachmentReference2[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&copy_src->pResolveAttachments[i]);
         }
     }
     if (copy_src->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2(*copy_src->pDepthStencilAttachment);
+        pDepthStencilAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src->pDepthStencilAttachment);
     if (copy_src->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[copy_src->preserveAttachmentCount];
+        pPreserveAttachments = new (kSafeStructAlloc) uint32_t[copy_src->preserveAttachmentCount];
         memcpy ((void *)pPreserveAttachments, (void *)copy_src->pPreserveAttachments, sizeof(uint32_t)*copy_src->preserveAttachmentCount);
     }
 }
@@ -12566,25 +12672,25 @@ safe_VkRenderPassCreateInfo2::safe_VkRenderPassCreateInfo2(const VkRenderPassCre
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) safe_VkAttachmentDescription2[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i].initialize(&in_struct->pAttachments[i]);
         }
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription2[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (dependencyCount && in_struct->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2[dependencyCount];
+        pDependencies = new (kSafeStructAlloc) safe_VkSubpassDependency2[dependencyCount];
         for (uint32_t i = 0; i < dependencyCount; ++i) {
             pDependencies[i].initialize(&in_struct->pDependencies[i]);
         }
     }
     if (in_struct->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[in_struct->correlatedViewMaskCount];
+        pCorrelatedViewMasks = new (kSafeStructAlloc) uint32_t[in_struct->correlatedViewMaskCount];
         memcpy ((void *)pCorrelatedViewMasks, (void *)in_struct->pCorrelatedViewMasks, sizeof(uint32_t)*in_struct->correlatedViewMaskCount);
     }
 }
@@ -12617,25 +12723,25 @@ safe_VkRenderPassCreateInfo2::safe_VkRenderPassCreateInfo2(const safe_VkRenderPa
     pCorrelatedViewMasks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) safe_VkAttachmentDescription2[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i].initialize(&copy_src.pAttachments[i]);
         }
     }
     if (subpassCount && copy_src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription2[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src.pSubpasses[i]);
         }
     }
     if (dependencyCount && copy_src.pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2[dependencyCount];
+        pDependencies = new (kSafeStructAlloc) safe_VkSubpassDependency2[dependencyCount];
         for (uint32_t i = 0; i < dependencyCount; ++i) {
             pDependencies[i].initialize(&copy_src.pDependencies[i]);
         }
     }
     if (copy_src.pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[copy_src.correlatedViewMaskCount];
+        pCorrelatedViewMasks = new (kSafeStructAlloc) uint32_t[copy_src.correlatedViewMaskCount];
         memcpy ((void *)pCorrelatedViewMasks, (void *)copy_src.pCorrelatedViewMasks, sizeof(uint32_t)*copy_src.correlatedViewMaskCount);
     }
 }
@@ -12667,25 +12773,25 @@ safe_VkRenderPassCreateInfo2& safe_VkRenderPassCreateInfo2::operator=(const safe
     pCorrelatedViewMasks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) safe_VkAttachmentDescription2[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i].initialize(&copy_src.pAttachments[i]);
         }
     }
     if (subpassCount && copy_src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription2[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src.pSubpasses[i]);
         }
     }
     if (dependencyCount && copy_src.pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2[dependencyCount];
+        pDependencies = new (kSafeStructAlloc) safe_VkSubpassDependency2[dependencyCount];
         for (uint32_t i = 0; i < dependencyCount; ++i) {
             pDependencies[i].initialize(&copy_src.pDependencies[i]);
         }
     }
     if (copy_src.pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[copy_src.correlatedViewMaskCount];
+        pCorrelatedViewMasks = new (kSafeStructAlloc) uint32_t[copy_src.correlatedViewMaskCount];
         memcpy ((void *)pCorrelatedViewMasks, (void *)copy_src.pCorrelatedViewMasks, sizeof(uint32_t)*copy_src.correlatedViewMaskCount);
     }
 
@@ -12730,25 +12836,25 @@ void safe_VkRenderPassCreateInfo2::initialize(const VkRenderPassCreateInfo2* in_
     pCorrelatedViewMasks = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) safe_VkAttachmentDescription2[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i].initialize(&in_struct->pAttachments[i]);
         }
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription2[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (dependencyCount && in_struct->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2[dependencyCount];
+        pDependencies = new (kSafeStructAlloc) safe_VkSubpassDependency2[dependencyCount];
         for (uint32_t i = 0; i < dependencyCount; ++i) {
             pDependencies[i].initialize(&in_struct->pDependencies[i]);
         }
     }
     if (in_struct->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[in_struct->correlatedViewMaskCount];
+        pCorrelatedViewMasks = new (kSafeStructAlloc) uint32_t[in_struct->correlatedViewMaskCount];
         memcpy ((void *)pCorrelatedViewMasks, (void *)in_struct->pCorrelatedViewMasks, sizeof(uint32_t)*in_struct->correlatedViewMaskCount);
     }
 }
@@ -12767,25 +12873,25 @@ void safe_VkRenderPassCreateInfo2::initialize(const safe_VkRenderPassCreateInfo2
     pCorrelatedViewMasks = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (attachmentCount && copy_src->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) safe_VkAttachmentDescription2[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i].initialize(&copy_src->pAttachments[i]);
         }
     }
     if (subpassCount && copy_src->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2[subpassCount];
+        pSubpasses = new (kSafeStructAlloc) safe_VkSubpassDescription2[subpassCount];
         for (uint32_t i = 0; i < subpassCount; ++i) {
             pSubpasses[i].initialize(&copy_src->pSubpasses[i]);
         }
     }
     if (dependencyCount && copy_src->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2[dependencyCount];
+        pDependencies = new (kSafeStructAlloc) safe_VkSubpassDependency2[dependencyCount];
         for (uint32_t i = 0; i < dependencyCount; ++i) {
             pDependencies[i].initialize(&copy_src->pDependencies[i]);
         }
     }
     if (copy_src->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[copy_src->correlatedViewMaskCount];
+        pCorrelatedViewMasks = new (kSafeStructAlloc) uint32_t[copy_src->correlatedViewMaskCount];
         memcpy ((void *)pCorrelatedViewMasks, (void *)copy_src->pCorrelatedViewMasks, sizeof(uint32_t)*copy_src->correlatedViewMaskCount);
     }
 }
@@ -13339,7 +13445,7 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::safe_VkDescriptorSetLayoutBind
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlags[in_struct->bindingCount];
+        pBindingFlags = new (kSafeStructAlloc) VkDescriptorBindingFlags[in_struct->bindingCount];
         memcpy ((void *)pBindingFlags, (void *)in_struct->pBindingFlags, sizeof(VkDescriptorBindingFlags)*in_struct->bindingCount);
     }
 }
@@ -13358,7 +13464,7 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::safe_VkDescriptorSetLayoutBind
     pBindingFlags = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlags[copy_src.bindingCount];
+        pBindingFlags = new (kSafeStructAlloc) VkDescriptorBindingFlags[copy_src.bindingCount];
         memcpy ((void *)pBindingFlags, (void *)copy_src.pBindingFlags, sizeof(VkDescriptorBindingFlags)*copy_src.bindingCount);
     }
 }
@@ -13377,7 +13483,7 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfo& safe_VkDescriptorSetLayoutBind
     pBindingFlags = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlags[copy_src.bindingCount];
+        pBindingFlags = new (kSafeStructAlloc) VkDescriptorBindingFlags[copy_src.bindingCount];
         memcpy ((void *)pBindingFlags, (void *)copy_src.pBindingFlags, sizeof(VkDescriptorBindingFlags)*copy_src.bindingCount);
     }
 
@@ -13403,7 +13509,7 @@ void safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::initialize(const VkDescri
     pBindingFlags = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlags[in_struct->bindingCount];
+        pBindingFlags = new (kSafeStructAlloc) VkDescriptorBindingFlags[in_struct->bindingCount];
         memcpy ((void *)pBindingFlags, (void *)in_struct->pBindingFlags, sizeof(VkDescriptorBindingFlags)*in_struct->bindingCount);
     }
 }
@@ -13415,7 +13521,7 @@ void safe_VkDescriptorSetLayoutBindingFlagsCreateInfo::initialize(const safe_VkD
     pBindingFlags = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlags[copy_src->bindingCount];
+        pBindingFlags = new (kSafeStructAlloc) VkDescriptorBindingFlags[copy_src->bindingCount];
         memcpy ((void *)pBindingFlags, (void *)copy_src->pBindingFlags, sizeof(VkDescriptorBindingFlags)*copy_src->bindingCount);
     }
 }
@@ -13785,7 +13891,7 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::safe_VkDescriptorSetVar
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[in_struct->descriptorSetCount];
+        pDescriptorCounts = new (kSafeStructAlloc) uint32_t[in_struct->descriptorSetCount];
         memcpy ((void *)pDescriptorCounts, (void *)in_struct->pDescriptorCounts, sizeof(uint32_t)*in_struct->descriptorSetCount);
     }
 }
@@ -13804,7 +13910,7 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::safe_VkDescriptorSetVar
     pDescriptorCounts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[copy_src.descriptorSetCount];
+        pDescriptorCounts = new (kSafeStructAlloc) uint32_t[copy_src.descriptorSetCount];
         memcpy ((void *)pDescriptorCounts, (void *)copy_src.pDescriptorCounts, sizeof(uint32_t)*copy_src.descriptorSetCount);
     }
 }
@@ -13823,7 +13929,7 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfo& safe_VkDescriptorSetVar
     pDescriptorCounts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[copy_src.descriptorSetCount];
+        pDescriptorCounts = new (kSafeStructAlloc) uint32_t[copy_src.descriptorSetCount];
         memcpy ((void *)pDescriptorCounts, (void *)copy_src.pDescriptorCounts, sizeof(uint32_t)*copy_src.descriptorSetCount);
     }
 
@@ -13849,7 +13955,7 @@ void safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::initialize(const V
     pDescriptorCounts = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[in_struct->descriptorSetCount];
+        pDescriptorCounts = new (kSafeStructAlloc) uint32_t[in_struct->descriptorSetCount];
         memcpy ((void *)pDescriptorCounts, (void *)in_struct->pDescriptorCounts, sizeof(uint32_t)*in_struct->descriptorSetCount);
     }
 }
@@ -13861,7 +13967,7 @@ void safe_VkDescriptorSetVariableDescriptorCountAllocateInfo::initialize(const s
     pDescriptorCounts = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[copy_src->descriptorSetCount];
+        pDescriptorCounts = new (kSafeStructAlloc) uint32_t[copy_src->descriptorSetCount];
         memcpy ((void *)pDescriptorCounts, (void *)copy_src->pDescriptorCounts, sizeof(uint32_t)*copy_src->descriptorSetCount);
     }
 }
@@ -13930,7 +14036,7 @@ safe_VkSubpassDescriptionDepthStencilResolve::safe_VkSubpassDescriptionDepthSten
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2(in_struct->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pDepthStencilResolveAttachment);
 }
 
 safe_VkSubpassDescriptionDepthStencilResolve::safe_VkSubpassDescriptionDepthStencilResolve() :
@@ -13949,7 +14055,7 @@ safe_VkSubpassDescriptionDepthStencilResolve::safe_VkSubpassDescriptionDepthSten
     pDepthStencilResolveAttachment = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2(*copy_src.pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pDepthStencilResolveAttachment);
 }
 
 safe_VkSubpassDescriptionDepthStencilResolve& safe_VkSubpassDescriptionDepthStencilResolve::operator=(const safe_VkSubpassDescriptionDepthStencilResolve& copy_src)
@@ -13967,7 +14073,7 @@ safe_VkSubpassDescriptionDepthStencilResolve& safe_VkSubpassDescriptionDepthSten
     pDepthStencilResolveAttachment = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2(*copy_src.pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pDepthStencilResolveAttachment);
 
     return *this;
 }
@@ -13992,7 +14098,7 @@ void safe_VkSubpassDescriptionDepthStencilResolve::initialize(const VkSubpassDes
     pDepthStencilResolveAttachment = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2(in_struct->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pDepthStencilResolveAttachment);
 }
 
 void safe_VkSubpassDescriptionDepthStencilResolve::initialize(const safe_VkSubpassDescriptionDepthStencilResolve* copy_src)
@@ -14003,7 +14109,7 @@ void safe_VkSubpassDescriptionDepthStencilResolve::initialize(const safe_VkSubpa
     pDepthStencilResolveAttachment = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2(*copy_src->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src->pDepthStencilResolveAttachment);
 }
 
 safe_VkPhysicalDeviceDepthStencilResolveProperties::safe_VkPhysicalDeviceDepthStencilResolveProperties(const VkPhysicalDeviceDepthStencilResolveProperties* in_struct) :
@@ -14446,7 +14552,7 @@ safe_VkFramebufferAttachmentImageInfo::safe_VkFramebufferAttachmentImageInfo(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[in_struct->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -14475,7 +14581,7 @@ safe_VkFramebufferAttachmentImageInfo::safe_VkFramebufferAttachmentImageInfo(con
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewFormats) {
-        pViewFormats = new VkFormat[copy_src.viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src.viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src.pViewFormats, sizeof(VkFormat)*copy_src.viewFormatCount);
     }
 }
@@ -14499,7 +14605,7 @@ safe_VkFramebufferAttachmentImageInfo& safe_VkFramebufferAttachmentImageInfo::op
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewFormats) {
-        pViewFormats = new VkFormat[copy_src.viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src.viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src.pViewFormats, sizeof(VkFormat)*copy_src.viewFormatCount);
     }
 
@@ -14530,7 +14636,7 @@ void safe_VkFramebufferAttachmentImageInfo::initialize(const VkFramebufferAttach
     pViewFormats = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[in_struct->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -14547,7 +14653,7 @@ void safe_VkFramebufferAttachmentImageInfo::initialize(const safe_VkFramebufferA
     pViewFormats = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewFormats) {
-        pViewFormats = new VkFormat[copy_src->viewFormatCount];
+        pViewFormats = new (kSafeStructAlloc) VkFormat[copy_src->viewFormatCount];
         memcpy ((void *)pViewFormats, (void *)copy_src->pViewFormats, sizeof(VkFormat)*copy_src->viewFormatCount);
     }
 }
@@ -14559,7 +14665,7 @@ safe_VkFramebufferAttachmentsCreateInfo::safe_VkFramebufferAttachmentsCreateInfo
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentImageInfoCount && in_struct->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
+        pAttachmentImageInfos = new (kSafeStructAlloc) safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
         for (uint32_t i = 0; i < attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&in_struct->pAttachmentImageInfos[i]);
         }
@@ -14580,7 +14686,7 @@ safe_VkFramebufferAttachmentsCreateInfo::safe_VkFramebufferAttachmentsCreateInfo
     pAttachmentImageInfos = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentImageInfoCount && copy_src.pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
+        pAttachmentImageInfos = new (kSafeStructAlloc) safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
         for (uint32_t i = 0; i < attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&copy_src.pAttachmentImageInfos[i]);
         }
@@ -14601,7 +14707,7 @@ safe_VkFramebufferAttachmentsCreateInfo& safe_VkFramebufferAttachmentsCreateInfo
     pAttachmentImageInfos = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentImageInfoCount && copy_src.pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
+        pAttachmentImageInfos = new (kSafeStructAlloc) safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
         for (uint32_t i = 0; i < attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&copy_src.pAttachmentImageInfos[i]);
         }
@@ -14629,7 +14735,7 @@ void safe_VkFramebufferAttachmentsCreateInfo::initialize(const VkFramebufferAtta
     pAttachmentImageInfos = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentImageInfoCount && in_struct->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
+        pAttachmentImageInfos = new (kSafeStructAlloc) safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
         for (uint32_t i = 0; i < attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&in_struct->pAttachmentImageInfos[i]);
         }
@@ -14643,7 +14749,7 @@ void safe_VkFramebufferAttachmentsCreateInfo::initialize(const safe_VkFramebuffe
     pAttachmentImageInfos = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (attachmentImageInfoCount && copy_src->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
+        pAttachmentImageInfos = new (kSafeStructAlloc) safe_VkFramebufferAttachmentImageInfo[attachmentImageInfoCount];
         for (uint32_t i = 0; i < attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&copy_src->pAttachmentImageInfos[i]);
         }
@@ -14657,7 +14763,7 @@ safe_VkRenderPassAttachmentBeginInfo::safe_VkRenderPassAttachmentBeginInfo(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = in_struct->pAttachments[i];
         }
@@ -14678,7 +14784,7 @@ safe_VkRenderPassAttachmentBeginInfo::safe_VkRenderPassAttachmentBeginInfo(const
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src.pAttachments[i];
         }
@@ -14699,7 +14805,7 @@ safe_VkRenderPassAttachmentBeginInfo& safe_VkRenderPassAttachmentBeginInfo::oper
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (attachmentCount && copy_src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src.pAttachments[i];
         }
@@ -14727,7 +14833,7 @@ void safe_VkRenderPassAttachmentBeginInfo::initialize(const VkRenderPassAttachme
     pAttachments = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = in_struct->pAttachments[i];
         }
@@ -14741,7 +14847,7 @@ void safe_VkRenderPassAttachmentBeginInfo::initialize(const safe_VkRenderPassAtt
     pAttachments = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (attachmentCount && copy_src->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
+        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];
         for (uint32_t i = 0; i < attachmentCount; ++i) {
             pAttachments[i] = copy_src->pAttachments[i];
         }
@@ -15273,11 +15379,11 @@ safe_VkTimelineSemaphoreSubmitInfo::safe_VkTimelineSemaphoreSubmitInfo(const VkT
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValueCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->waitSemaphoreValueCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValueCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValueCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->signalSemaphoreValueCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValueCount);
     }
 }
@@ -15300,11 +15406,11 @@ safe_VkTimelineSemaphoreSubmitInfo::safe_VkTimelineSemaphoreSubmitInfo(const saf
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src.waitSemaphoreValueCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.waitSemaphoreValueCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src.pWaitSemaphoreValues, sizeof(uint64_t)*copy_src.waitSemaphoreValueCount);
     }
     if (copy_src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src.signalSemaphoreValueCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.signalSemaphoreValueCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src.pSignalSemaphoreValues, sizeof(uint64_t)*copy_src.signalSemaphoreValueCount);
     }
 }
@@ -15327,11 +15433,11 @@ safe_VkTimelineSemaphoreSubmitInfo& safe_VkTimelineSemaphoreSubmitInfo::operator
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src.waitSemaphoreValueCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.waitSemaphoreValueCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src.pWaitSemaphoreValues, sizeof(uint64_t)*copy_src.waitSemaphoreValueCount);
     }
     if (copy_src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src.signalSemaphoreValueCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.signalSemaphoreValueCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src.pSignalSemaphoreValues, sizeof(uint64_t)*copy_src.signalSemaphoreValueCount);
     }
 
@@ -15363,11 +15469,11 @@ void safe_VkTimelineSemaphoreSubmitInfo::initialize(const VkTimelineSemaphoreSub
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValueCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->waitSemaphoreValueCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValueCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValueCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->signalSemaphoreValueCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValueCount);
     }
 }
@@ -15381,11 +15487,11 @@ void safe_VkTimelineSemaphoreSubmitInfo::initialize(const safe_VkTimelineSemapho
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src->waitSemaphoreValueCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src->waitSemaphoreValueCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src->pWaitSemaphoreValues, sizeof(uint64_t)*copy_src->waitSemaphoreValueCount);
     }
     if (copy_src->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src->signalSemaphoreValueCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src->signalSemaphoreValueCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src->pSignalSemaphoreValues, sizeof(uint64_t)*copy_src->signalSemaphoreValueCount);
     }
 }
@@ -15399,13 +15505,13 @@ safe_VkSemaphoreWaitInfo::safe_VkSemaphoreWaitInfo(const VkSemaphoreWaitInfo* in
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (semaphoreCount && in_struct->pSemaphores) {
-        pSemaphores = new VkSemaphore[semaphoreCount];
+        pSemaphores = new (kSafeStructAlloc) VkSemaphore[semaphoreCount];
         for (uint32_t i = 0; i < semaphoreCount; ++i) {
             pSemaphores[i] = in_struct->pSemaphores[i];
         }
     }
     if (in_struct->pValues) {
-        pValues = new uint64_t[in_struct->semaphoreCount];
+        pValues = new (kSafeStructAlloc) uint64_t[in_struct->semaphoreCount];
         memcpy ((void *)pValues, (void *)in_struct->pValues, sizeof(uint64_t)*in_struct->semaphoreCount);
     }
 }
@@ -15428,13 +15534,13 @@ safe_VkSemaphoreWaitInfo::safe_VkSemaphoreWaitInfo(const safe_VkSemaphoreWaitInf
     pValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (semaphoreCount && copy_src.pSemaphores) {
-        pSemaphores = new VkSemaphore[semaphoreCount];
+        pSemaphores = new (kSafeStructAlloc) VkSemaphore[semaphoreCount];
         for (uint32_t i = 0; i < semaphoreCount; ++i) {
             pSemaphores[i] = copy_src.pSemaphores[i];
         }
     }
     if (copy_src.pValues) {
-        pValues = new uint64_t[copy_src.semaphoreCount];
+        pValues = new (kSafeStructAlloc) uint64_t[copy_src.semaphoreCount];
         memcpy ((void *)pValues, (void *)copy_src.pValues, sizeof(uint64_t)*copy_src.semaphoreCount);
     }
 }
@@ -15457,13 +15563,13 @@ safe_VkSemaphoreWaitInfo& safe_VkSemaphoreWaitInfo::operator=(const safe_VkSemap
     pValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (semaphoreCount && copy_src.pSemaphores) {
-        pSemaphores = new VkSemaphore[semaphoreCount];
+        pSemaphores = new (kSafeStructAlloc) VkSemaphore[semaphoreCount];
         for (uint32_t i = 0; i < semaphoreCount; ++i) {
             pSemaphores[i] = copy_src.pSemaphores[i];
         }
     }
     if (copy_src.pValues) {
-        pValues = new uint64_t[copy_src.semaphoreCount];
+        pValues = new (kSafeStructAlloc) uint64_t[copy_src.semaphoreCount];
         memcpy ((void *)pValues, (void *)copy_src.pValues, sizeof(uint64_t)*copy_src.semaphoreCount);
     }
 
@@ -15495,13 +15601,13 @@ void safe_VkSemaphoreWaitInfo::initialize(const VkSemaphoreWaitInfo* in_struct)
     pValues = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (semaphoreCount && in_struct->pSemaphores) {
-        pSemaphores = new VkSemaphore[semaphoreCount];
+        pSemaphores = new (kSafeStructAlloc) VkSemaphore[semaphoreCount];
         for (uint32_t i = 0; i < semaphoreCount; ++i) {
             pSemaphores[i] = in_struct->pSemaphores[i];
         }
     }
     if (in_struct->pValues) {
-        pValues = new uint64_t[in_struct->semaphoreCount];
+        pValues = new (kSafeStructAlloc) uint64_t[in_struct->semaphoreCount];
         memcpy ((void *)pValues, (void *)in_struct->pValues, sizeof(uint64_t)*in_struct->semaphoreCount);
     }
 }
@@ -15515,13 +15621,13 @@ void safe_VkSemaphoreWaitInfo::initialize(const safe_VkSemaphoreWaitInfo* copy_s
     pValues = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (semaphoreCount && copy_src->pSemaphores) {
-        pSemaphores = new VkSemaphore[semaphoreCount];
+        pSemaphores = new (kSafeStructAlloc) VkSemaphore[semaphoreCount];
         for (uint32_t i = 0; i < semaphoreCount; ++i) {
             pSemaphores[i] = copy_src->pSemaphores[i];
         }
     }
     if (copy_src->pValues) {
-        pValues = new uint64_t[copy_src->semaphoreCount];
+        pValues = new (kSafeStructAlloc) uint64_t[copy_src->semaphoreCount];
         memcpy ((void *)pValues, (void *)copy_src->pValues, sizeof(uint64_t)*copy_src->semaphoreCount);
     }
 }
@@ -16348,10 +16454,10 @@ safe_VkPipelineCreationFeedbackCreateInfo::safe_VkPipelineCreationFeedbackCreate
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedback(*in_struct->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = new (kSafeStructAlloc) VkPipelineCreationFeedback(*in_struct->pPipelineCreationFeedback);
     }
     if (in_struct->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedback[in_struct->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = new (kSafeStructAlloc) VkPipelineCreationFeedback[in_struct->pipelineStageCreationFeedbackCount];
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)in_struct->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedback)*in_struct->pipelineStageCreationFeedbackCount);
     }
 }
@@ -16372,10 +16478,10 @@ safe_VkPipelineCreationFeedbackCreateInfo::safe_VkPipelineCreationFeedbackCreate
     pPipelineStageCreationFeedbacks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedback(*copy_src.pPipelineCreationFeedback);
+        pPipelineCreationFeedback = new (kSafeStructAlloc) VkPipelineCreationFeedback(*copy_src.pPipelineCreationFeedback);
     }
     if (copy_src.pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedback[copy_src.pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = new (kSafeStructAlloc) VkPipelineCreationFeedback[copy_src.pipelineStageCreationFeedbackCount];
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)copy_src.pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedback)*copy_src.pipelineStageCreationFeedbackCount);
     }
 }
@@ -16397,10 +16503,10 @@ safe_VkPipelineCreationFeedbackCreateInfo& safe_VkPipelineCreationFeedbackCreate
     pPipelineStageCreationFeedbacks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedback(*copy_src.pPipelineCreationFeedback);
+        pPipelineCreationFeedback = new (kSafeStructAlloc) VkPipelineCreationFeedback(*copy_src.pPipelineCreationFeedback);
     }
     if (copy_src.pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedback[copy_src.pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = new (kSafeStructAlloc) VkPipelineCreationFeedback[copy_src.pipelineStageCreationFeedbackCount];
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)copy_src.pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedback)*copy_src.pipelineStageCreationFeedbackCount);
     }
 
@@ -16431,10 +16537,10 @@ void safe_VkPipelineCreationFeedbackCreateInfo::initialize(const VkPipelineCreat
     pPipelineStageCreationFeedbacks = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedback(*in_struct->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = new (kSafeStructAlloc) VkPipelineCreationFeedback(*in_struct->pPipelineCreationFeedback);
     }
     if (in_struct->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedback[in_struct->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = new (kSafeStructAlloc) VkPipelineCreationFeedback[in_struct->pipelineStageCreationFeedbackCount];
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)in_struct->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedback)*in_struct->pipelineStageCreationFeedbackCount);
     }
 }
@@ -16447,10 +16553,10 @@ void safe_VkPipelineCreationFeedbackCreateInfo::initialize(const safe_VkPipeline
     pPipelineStageCreationFeedbacks = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedback(*copy_src->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = new (kSafeStructAlloc) VkPipelineCreationFeedback(*copy_src->pPipelineCreationFeedback);
     }
     if (copy_src->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedback[copy_src->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = new (kSafeStructAlloc) VkPipelineCreationFeedback[copy_src->pipelineStageCreationFeedbackCount];
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)copy_src->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedback)*copy_src->pipelineStageCreationFeedbackCount);
     }
 }
@@ -17207,19 +17313,19 @@ safe_VkDependencyInfo::safe_VkDependencyInfo(const VkDependencyInfo* in_struct)
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (memoryBarrierCount && in_struct->pMemoryBarriers) {
-        pMemoryBarriers = new safe_VkMemoryBarrier2[memoryBarrierCount];
+        pMemoryBarriers = new (kSafeStructAlloc) safe_VkMemoryBarrier2[memoryBarrierCount];
         for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
             pMemoryBarriers[i].initialize(&in_struct->pMemoryBarriers[i]);
         }
     }
     if (bufferMemoryBarrierCount && in_struct->pBufferMemoryBarriers) {
-        pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
+        pBufferMemoryBarriers = new (kSafeStructAlloc) safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
         for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
             pBufferMemoryBarriers[i].initialize(&in_struct->pBufferMemoryBarriers[i]);
         }
     }
     if (imageMemoryBarrierCount && in_struct->pImageMemoryBarriers) {
-        pImageMemoryBarriers = new safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
+        pImageMemoryBarriers = new (kSafeStructAlloc) safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
         for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
             pImageMemoryBarriers[i].initialize(&in_struct->pImageMemoryBarriers[i]);
         }
@@ -17250,19 +17356,19 @@ safe_VkDependencyInfo::safe_VkDependencyInfo(const safe_VkDependencyInfo& copy_s
     pImageMemoryBarriers = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (memoryBarrierCount && copy_src.pMemoryBarriers) {
-        pMemoryBarriers = new safe_VkMemoryBarrier2[memoryBarrierCount];
+        pMemoryBarriers = new (kSafeStructAlloc) safe_VkMemoryBarrier2[memoryBarrierCount];
         for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
             pMemoryBarriers[i].initialize(&copy_src.pMemoryBarriers[i]);
         }
     }
     if (bufferMemoryBarrierCount && copy_src.pBufferMemoryBarriers) {
-        pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
+        pBufferMemoryBarriers = new (kSafeStructAlloc) safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
         for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
             pBufferMemoryBarriers[i].initialize(&copy_src.pBufferMemoryBarriers[i]);
         }
     }
     if (imageMemoryBarrierCount && copy_src.pImageMemoryBarriers) {
-        pImageMemoryBarriers = new safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
+        pImageMemoryBarriers = new (kSafeStructAlloc) safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
         for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
             pImageMemoryBarriers[i].initialize(&copy_src.pImageMemoryBarriers[i]);
         }
@@ -17292,19 +17398,19 @@ safe_VkDependencyInfo& safe_VkDependencyInfo::operator=(const safe_VkDependencyI
     pImageMemoryBarriers = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (memoryBarrierCount && copy_src.pMemoryBarriers) {
-        pMemoryBarriers = new safe_VkMemoryBarrier2[memoryBarrierCount];
+        pMemoryBarriers = new (kSafeStructAlloc) safe_VkMemoryBarrier2[memoryBarrierCount];
         for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
             pMemoryBarriers[i].initialize(&copy_src.pMemoryBarriers[i]);
         }
     }
     if (bufferMemoryBarrierCount && copy_src.pBufferMemoryBarriers) {
-        pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
+        pBufferMemoryBarriers = new (kSafeStructAlloc) safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
         for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
             pBufferMemoryBarriers[i].initialize(&copy_src.pBufferMemoryBarriers[i]);
         }
     }
     if (imageMemoryBarrierCount && copy_src.pImageMemoryBarriers) {
-        pImageMemoryBarriers = new safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
+        pImageMemoryBarriers = new (kSafeStructAlloc) safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
         for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
             pImageMemoryBarriers[i].initialize(&copy_src.pImageMemoryBarriers[i]);
         }
@@ -17345,19 +17451,19 @@ void safe_VkDependencyInfo::initialize(const VkDependencyInfo* in_struct)
     pImageMemoryBarriers = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (memoryBarrierCount && in_struct->pMemoryBarriers) {
-        pMemoryBarriers = new safe_VkMemoryBarrier2[memoryBarrierCount];
+        pMemoryBarriers = new (kSafeStructAlloc) safe_VkMemoryBarrier2[memoryBarrierCount];
         for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
             pMemoryBarriers[i].initialize(&in_struct->pMemoryBarriers[i]);
         }
     }
     if (bufferMemoryBarrierCount && in_struct->pBufferMemoryBarriers) {
-        pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
+        pBufferMemoryBarriers = new (kSafeStructAlloc) safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
         for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
             pBufferMemoryBarriers[i].initialize(&in_struct->pBufferMemoryBarriers[i]);
         }
     }
     if (imageMemoryBarrierCount && in_struct->pImageMemoryBarriers) {
-        pImageMemoryBarriers = new safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
+        pImageMemoryBarriers = new (kSafeStructAlloc) safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
         for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
             pImageMemoryBarriers[i].initialize(&in_struct->pImageMemoryBarriers[i]);
         }
@@ -17376,19 +17482,19 @@ void safe_VkDependencyInfo::initialize(const safe_VkDependencyInfo* copy_src)
     pImageMemoryBarriers = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (memoryBarrierCount && copy_src->pMemoryBarriers) {
-        pMemoryBarriers = new safe_VkMemoryBarrier2[memoryBarrierCount];
+        pMemoryBarriers = new (kSafeStructAlloc) safe_VkMemoryBarrier2[memoryBarrierCount];
         for (uint32_t i = 0; i < memoryBarrierCount; ++i) {
             pMemoryBarriers[i].initialize(&copy_src->pMemoryBarriers[i]);
         }
     }
     if (bufferMemoryBarrierCount && copy_src->pBufferMemoryBarriers) {
-        pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
+        pBufferMemoryBarriers = new (kSafeStructAlloc) safe_VkBufferMemoryBarrier2[bufferMemoryBarrierCount];
         for (uint32_t i = 0; i < bufferMemoryBarrierCount; ++i) {
             pBufferMemoryBarriers[i].initialize(&copy_src->pBufferMemoryBarriers[i]);
         }
     }
     if (imageMemoryBarrierCount && copy_src->pImageMemoryBarriers) {
-        pImageMemoryBarriers = new safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
+        pImageMemoryBarriers = new (kSafeStructAlloc) safe_VkImageMemoryBarrier2[imageMemoryBarrierCount];
         for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
             pImageMemoryBarriers[i].initialize(&copy_src->pImageMemoryBarriers[i]);
         }
@@ -17543,19 +17649,19 @@ safe_VkSubmitInfo2::safe_VkSubmitInfo2(const VkSubmitInfo2* in_struct) :
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreInfoCount && in_struct->pWaitSemaphoreInfos) {
-        pWaitSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
+        pWaitSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
         for (uint32_t i = 0; i < waitSemaphoreInfoCount; ++i) {
             pWaitSemaphoreInfos[i].initialize(&in_struct->pWaitSemaphoreInfos[i]);
         }
     }
     if (commandBufferInfoCount && in_struct->pCommandBufferInfos) {
-        pCommandBufferInfos = new safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
+        pCommandBufferInfos = new (kSafeStructAlloc) safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
         for (uint32_t i = 0; i < commandBufferInfoCount; ++i) {
             pCommandBufferInfos[i].initialize(&in_struct->pCommandBufferInfos[i]);
         }
     }
     if (signalSemaphoreInfoCount && in_struct->pSignalSemaphoreInfos) {
-        pSignalSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
+        pSignalSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
         for (uint32_t i = 0; i < signalSemaphoreInfoCount; ++i) {
             pSignalSemaphoreInfos[i].initialize(&in_struct->pSignalSemaphoreInfos[i]);
         }
@@ -17586,19 +17692,19 @@ safe_VkSubmitInfo2::safe_VkSubmitInfo2(const safe_VkSubmitInfo2& copy_src)
     pSignalSemaphoreInfos = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreInfoCount && copy_src.pWaitSemaphoreInfos) {
-        pWaitSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
+        pWaitSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
         for (uint32_t i = 0; i < waitSemaphoreInfoCount; ++i) {
             pWaitSemaphoreInfos[i].initialize(&copy_src.pWaitSemaphoreInfos[i]);
         }
     }
     if (commandBufferInfoCount && copy_src.pCommandBufferInfos) {
-        pCommandBufferInfos = new safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
+        pCommandBufferInfos = new (kSafeStructAlloc) safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
         for (uint32_t i = 0; i < commandBufferInfoCount; ++i) {
             pCommandBufferInfos[i].initialize(&copy_src.pCommandBufferInfos[i]);
         }
     }
     if (signalSemaphoreInfoCount && copy_src.pSignalSemaphoreInfos) {
-        pSignalSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
+        pSignalSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
         for (uint32_t i = 0; i < signalSemaphoreInfoCount; ++i) {
             pSignalSemaphoreInfos[i].initialize(&copy_src.pSignalSemaphoreInfos[i]);
         }
@@ -17628,19 +17734,19 @@ safe_VkSubmitInfo2& safe_VkSubmitInfo2::operator=(const safe_VkSubmitInfo2& copy
     pSignalSemaphoreInfos = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreInfoCount && copy_src.pWaitSemaphoreInfos) {
-        pWaitSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
+        pWaitSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
         for (uint32_t i = 0; i < waitSemaphoreInfoCount; ++i) {
             pWaitSemaphoreInfos[i].initialize(&copy_src.pWaitSemaphoreInfos[i]);
         }
     }
     if (commandBufferInfoCount && copy_src.pCommandBufferInfos) {
-        pCommandBufferInfos = new safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
+        pCommandBufferInfos = new (kSafeStructAlloc) safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
         for (uint32_t i = 0; i < commandBufferInfoCount; ++i) {
             pCommandBufferInfos[i].initialize(&copy_src.pCommandBufferInfos[i]);
         }
     }
     if (signalSemaphoreInfoCount && copy_src.pSignalSemaphoreInfos) {
-        pSignalSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
+        pSignalSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
         for (uint32_t i = 0; i < signalSemaphoreInfoCount; ++i) {
             pSignalSemaphoreInfos[i].initialize(&copy_src.pSignalSemaphoreInfos[i]);
         }
@@ -17681,19 +17787,19 @@ void safe_VkSubmitInfo2::initialize(const VkSubmitInfo2* in_struct)
     pSignalSemaphoreInfos = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreInfoCount && in_struct->pWaitSemaphoreInfos) {
-        pWaitSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
+        pWaitSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
         for (uint32_t i = 0; i < waitSemaphoreInfoCount; ++i) {
             pWaitSemaphoreInfos[i].initialize(&in_struct->pWaitSemaphoreInfos[i]);
         }
     }
     if (commandBufferInfoCount && in_struct->pCommandBufferInfos) {
-        pCommandBufferInfos = new safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
+        pCommandBufferInfos = new (kSafeStructAlloc) safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
         for (uint32_t i = 0; i < commandBufferInfoCount; ++i) {
             pCommandBufferInfos[i].initialize(&in_struct->pCommandBufferInfos[i]);
         }
     }
     if (signalSemaphoreInfoCount && in_struct->pSignalSemaphoreInfos) {
-        pSignalSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
+        pSignalSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
         for (uint32_t i = 0; i < signalSemaphoreInfoCount; ++i) {
             pSignalSemaphoreInfos[i].initialize(&in_struct->pSignalSemaphoreInfos[i]);
         }
@@ -17712,19 +17818,19 @@ void safe_VkSubmitInfo2::initialize(const safe_VkSubmitInfo2* copy_src)
     pSignalSemaphoreInfos = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (waitSemaphoreInfoCount && copy_src->pWaitSemaphoreInfos) {
-        pWaitSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
+        pWaitSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[waitSemaphoreInfoCount];
         for (uint32_t i = 0; i < waitSemaphoreInfoCount; ++i) {
             pWaitSemaphoreInfos[i].initialize(&copy_src->pWaitSemaphoreInfos[i]);
         }
     }
     if (commandBufferInfoCount && copy_src->pCommandBufferInfos) {
-        pCommandBufferInfos = new safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
+        pCommandBufferInfos = new (kSafeStructAlloc) safe_VkCommandBufferSubmitInfo[commandBufferInfoCount];
         for (uint32_t i = 0; i < commandBufferInfoCount; ++i) {
             pCommandBufferInfos[i].initialize(&copy_src->pCommandBufferInfos[i]);
         }
     }
     if (signalSemaphoreInfoCount && copy_src->pSignalSemaphoreInfos) {
-        pSignalSemaphoreInfos = new safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
+        pSignalSemaphoreInfos = new (kSafeStructAlloc) safe_VkSemaphoreSubmitInfo[signalSemaphoreInfoCount];
         for (uint32_t i = 0; i < signalSemaphoreInfoCount; ++i) {
             pSignalSemaphoreInfos[i].initialize(&copy_src->pSignalSemaphoreInfos[i]);
         }
@@ -17976,7 +18082,7 @@ safe_VkCopyBufferInfo2::safe_VkCopyBufferInfo2(const VkCopyBufferInfo2* in_struc
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18001,7 +18107,7 @@ safe_VkCopyBufferInfo2::safe_VkCopyBufferInfo2(const safe_VkCopyBufferInfo2& cop
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18024,7 +18130,7 @@ safe_VkCopyBufferInfo2& safe_VkCopyBufferInfo2::operator=(const safe_VkCopyBuffe
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18054,7 +18160,7 @@ void safe_VkCopyBufferInfo2::initialize(const VkCopyBufferInfo2* in_struct)
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18070,7 +18176,7 @@ void safe_VkCopyBufferInfo2::initialize(const safe_VkCopyBufferInfo2* copy_src)
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkBufferCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -18168,7 +18274,7 @@ safe_VkCopyImageInfo2::safe_VkCopyImageInfo2(const VkCopyImageInfo2* in_struct)
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18197,7 +18303,7 @@ safe_VkCopyImageInfo2::safe_VkCopyImageInfo2(const safe_VkCopyImageInfo2& copy_s
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18222,7 +18328,7 @@ safe_VkCopyImageInfo2& safe_VkCopyImageInfo2::operator=(const safe_VkCopyImageIn
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18254,7 +18360,7 @@ void safe_VkCopyImageInfo2::initialize(const VkCopyImageInfo2* in_struct)
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18272,7 +18378,7 @@ void safe_VkCopyImageInfo2::initialize(const safe_VkCopyImageInfo2* copy_src)
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -18375,7 +18481,7 @@ safe_VkCopyBufferToImageInfo2::safe_VkCopyBufferToImageInfo2(const VkCopyBufferT
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18402,7 +18508,7 @@ safe_VkCopyBufferToImageInfo2::safe_VkCopyBufferToImageInfo2(const safe_VkCopyBu
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18426,7 +18532,7 @@ safe_VkCopyBufferToImageInfo2& safe_VkCopyBufferToImageInfo2::operator=(const sa
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18457,7 +18563,7 @@ void safe_VkCopyBufferToImageInfo2::initialize(const VkCopyBufferToImageInfo2* i
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18474,7 +18580,7 @@ void safe_VkCopyBufferToImageInfo2::initialize(const safe_VkCopyBufferToImageInf
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -18491,7 +18597,7 @@ safe_VkCopyImageToBufferInfo2::safe_VkCopyImageToBufferInfo2(const VkCopyImageTo
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18518,7 +18624,7 @@ safe_VkCopyImageToBufferInfo2::safe_VkCopyImageToBufferInfo2(const safe_VkCopyIm
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18542,7 +18648,7 @@ safe_VkCopyImageToBufferInfo2& safe_VkCopyImageToBufferInfo2::operator=(const sa
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18573,7 +18679,7 @@ void safe_VkCopyImageToBufferInfo2::initialize(const VkCopyImageToBufferInfo2* i
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18590,7 +18696,7 @@ void safe_VkCopyImageToBufferInfo2::initialize(const safe_VkCopyImageToBufferInf
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkBufferImageCopy2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkBufferImageCopy2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -18701,7 +18807,7 @@ safe_VkBlitImageInfo2::safe_VkBlitImageInfo2(const VkBlitImageInfo2* in_struct)
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageBlit2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageBlit2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18732,7 +18838,7 @@ safe_VkBlitImageInfo2::safe_VkBlitImageInfo2(const safe_VkBlitImageInfo2& copy_s
     filter = copy_src.filter;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageBlit2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageBlit2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18758,7 +18864,7 @@ safe_VkBlitImageInfo2& safe_VkBlitImageInfo2::operator=(const safe_VkBlitImageIn
     filter = copy_src.filter;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageBlit2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageBlit2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18791,7 +18897,7 @@ void safe_VkBlitImageInfo2::initialize(const VkBlitImageInfo2* in_struct)
     filter = in_struct->filter;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageBlit2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageBlit2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18810,7 +18916,7 @@ void safe_VkBlitImageInfo2::initialize(const safe_VkBlitImageInfo2* copy_src)
     filter = copy_src->filter;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkImageBlit2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageBlit2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -18908,7 +19014,7 @@ safe_VkResolveImageInfo2::safe_VkResolveImageInfo2(const VkResolveImageInfo2* in
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageResolve2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageResolve2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -18937,7 +19043,7 @@ safe_VkResolveImageInfo2::safe_VkResolveImageInfo2(const safe_VkResolveImageInfo
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageResolve2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageResolve2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18962,7 +19068,7 @@ safe_VkResolveImageInfo2& safe_VkResolveImageInfo2::operator=(const safe_VkResol
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (regionCount && copy_src.pRegions) {
-        pRegions = new safe_VkImageResolve2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageResolve2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -18994,7 +19100,7 @@ void safe_VkResolveImageInfo2::initialize(const VkResolveImageInfo2* in_struct)
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (regionCount && in_struct->pRegions) {
-        pRegions = new safe_VkImageResolve2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageResolve2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -19012,7 +19118,7 @@ void safe_VkResolveImageInfo2::initialize(const safe_VkResolveImageInfo2* copy_s
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (regionCount && copy_src->pRegions) {
-        pRegions = new safe_VkImageResolve2[regionCount];
+        pRegions = new (kSafeStructAlloc) safe_VkImageResolve2[regionCount];
         for (uint32_t i = 0; i < regionCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -19638,15 +19744,15 @@ safe_VkRenderingInfo::safe_VkRenderingInfo(const VkRenderingInfo* in_struct) :
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkRenderingAttachmentInfo[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (in_struct->pDepthAttachment)
-        pDepthAttachment = new safe_VkRenderingAttachmentInfo(in_struct->pDepthAttachment);
+        pDepthAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(in_struct->pDepthAttachment);
     if (in_struct->pStencilAttachment)
-        pStencilAttachment = new safe_VkRenderingAttachmentInfo(in_struct->pStencilAttachment);
+        pStencilAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(in_struct->pStencilAttachment);
 }
 
 safe_VkRenderingInfo::safe_VkRenderingInfo() :
@@ -19675,15 +19781,15 @@ safe_VkRenderingInfo::safe_VkRenderingInfo(const safe_VkRenderingInfo& copy_src)
     pStencilAttachment = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (colorAttachmentCount && copy_src.pColorAttachments) {
-        pColorAttachments = new safe_VkRenderingAttachmentInfo[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src.pColorAttachments[i]);
         }
     }
     if (copy_src.pDepthAttachment)
-        pDepthAttachment = new safe_VkRenderingAttachmentInfo(*copy_src.pDepthAttachment);
+        pDepthAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src.pDepthAttachment);
     if (copy_src.pStencilAttachment)
-        pStencilAttachment = new safe_VkRenderingAttachmentInfo(*copy_src.pStencilAttachment);
+        pStencilAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src.pStencilAttachment);
 }
 
 safe_VkRenderingInfo& safe_VkRenderingInfo::operator=(const safe_VkRenderingInfo& copy_src)
@@ -19710,15 +19816,15 @@ safe_VkRenderingInfo& safe_VkRenderingInfo::operator=(const safe_VkRenderingInfo
     pStencilAttachment = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (colorAttachmentCount && copy_src.pColorAttachments) {
-        pColorAttachments = new safe_VkRenderingAttachmentInfo[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src.pColorAttachments[i]);
         }
     }
     if (copy_src.pDepthAttachment)
-        pDepthAttachment = new safe_VkRenderingAttachmentInfo(*copy_src.pDepthAttachment);
+        pDepthAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src.pDepthAttachment);
     if (copy_src.pStencilAttachment)
-        pStencilAttachment = new safe_VkRenderingAttachmentInfo(*copy_src.pStencilAttachment);
+        pStencilAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src.pStencilAttachment);
 
     return *this;
 }
@@ -19756,15 +19862,15 @@ void safe_VkRenderingInfo::initialize(const VkRenderingInfo* in_struct)
     pStencilAttachment = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkRenderingAttachmentInfo[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (in_struct->pDepthAttachment)
-        pDepthAttachment = new safe_VkRenderingAttachmentInfo(in_struct->pDepthAttachment);
+        pDepthAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(in_struct->pDepthAttachment);
     if (in_struct->pStencilAttachment)
-        pStencilAttachment = new safe_VkRenderingAttachmentInfo(in_struct->pStencilAttachment);
+        pStencilAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(in_struct->pStencilAttachment);
 }
 
 void safe_VkRenderingInfo::initialize(const safe_VkRenderingInfo* copy_src)
@@ -19780,15 +19886,15 @@ void safe_VkRenderingInfo::initialize(const safe_VkRenderingInfo* copy_src)
     pStencilAttachment = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (colorAttachmentCount && copy_src->pColorAttachments) {
-        pColorAttachments = new safe_VkRenderingAttachmentInfo[colorAttachmentCount];
+        pColorAttachments = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo[colorAttachmentCount];
         for (uint32_t i = 0; i < colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&copy_src->pColorAttachments[i]);
         }
     }
     if (copy_src->pDepthAttachment)
-        pDepthAttachment = new safe_VkRenderingAttachmentInfo(*copy_src->pDepthAttachment);
+        pDepthAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src->pDepthAttachment);
     if (copy_src->pStencilAttachment)
-        pStencilAttachment = new safe_VkRenderingAttachmentInfo(*copy_src->pStencilAttachment);
+        pStencilAttachment = new (kSafeStructAlloc) safe_VkRenderingAttachmentInfo(*copy_src->pStencilAttachment);
 }
 
 safe_VkPipelineRenderingCreateInfo::safe_VkPipelineRenderingCreateInfo(const VkPipelineRenderingCreateInfo* in_struct) :
@@ -19801,7 +19907,7 @@ safe_VkPipelineRenderingCreateInfo::safe_VkPipelineRenderingCreateInfo(const VkP
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[in_struct->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)in_struct->pColorAttachmentFormats, sizeof(VkFormat)*in_struct->colorAttachmentCount);
     }
 }
@@ -19826,7 +19932,7 @@ safe_VkPipelineRenderingCreateInfo::safe_VkPipelineRenderingCreateInfo(const saf
     stencilAttachmentFormat = copy_src.stencilAttachmentFormat;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src.colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src.pColorAttachmentFormats, sizeof(VkFormat)*copy_src.colorAttachmentCount);
     }
 }
@@ -19848,7 +19954,7 @@ safe_VkPipelineRenderingCreateInfo& safe_VkPipelineRenderingCreateInfo::operator
     stencilAttachmentFormat = copy_src.stencilAttachmentFormat;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src.colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src.pColorAttachmentFormats, sizeof(VkFormat)*copy_src.colorAttachmentCount);
     }
 
@@ -19877,7 +19983,7 @@ void safe_VkPipelineRenderingCreateInfo::initialize(const VkPipelineRenderingCre
     stencilAttachmentFormat = in_struct->stencilAttachmentFormat;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[in_struct->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)in_struct->pColorAttachmentFormats, sizeof(VkFormat)*in_struct->colorAttachmentCount);
     }
 }
@@ -19892,7 +19998,7 @@ void safe_VkPipelineRenderingCreateInfo::initialize(const safe_VkPipelineRenderi
     stencilAttachmentFormat = copy_src->stencilAttachmentFormat;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src->pColorAttachmentFormats, sizeof(VkFormat)*copy_src->colorAttachmentCount);
     }
 }
@@ -19965,7 +20071,7 @@ safe_VkCommandBufferInheritanceRenderingInfo::safe_VkCommandBufferInheritanceRen
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[in_struct->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)in_struct->pColorAttachmentFormats, sizeof(VkFormat)*in_struct->colorAttachmentCount);
     }
 }
@@ -19994,7 +20100,7 @@ safe_VkCommandBufferInheritanceRenderingInfo::safe_VkCommandBufferInheritanceRen
     rasterizationSamples = copy_src.rasterizationSamples;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src.colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src.pColorAttachmentFormats, sizeof(VkFormat)*copy_src.colorAttachmentCount);
     }
 }
@@ -20018,7 +20124,7 @@ safe_VkCommandBufferInheritanceRenderingInfo& safe_VkCommandBufferInheritanceRen
     rasterizationSamples = copy_src.rasterizationSamples;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src.colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src.pColorAttachmentFormats, sizeof(VkFormat)*copy_src.colorAttachmentCount);
     }
 
@@ -20049,7 +20155,7 @@ void safe_VkCommandBufferInheritanceRenderingInfo::initialize(const VkCommandBuf
     rasterizationSamples = in_struct->rasterizationSamples;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[in_struct->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)in_struct->pColorAttachmentFormats, sizeof(VkFormat)*in_struct->colorAttachmentCount);
     }
 }
@@ -20066,7 +20172,7 @@ void safe_VkCommandBufferInheritanceRenderingInfo::initialize(const safe_VkComma
     rasterizationSamples = copy_src->rasterizationSamples;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pColorAttachmentFormats) {
-        pColorAttachmentFormats = new VkFormat[copy_src->colorAttachmentCount];
+        pColorAttachmentFormats = new (kSafeStructAlloc) VkFormat[copy_src->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentFormats, (void *)copy_src->pColorAttachmentFormats, sizeof(VkFormat)*copy_src->colorAttachmentCount);
     }
 }
@@ -20617,7 +20723,7 @@ safe_VkDeviceBufferMemoryRequirements::safe_VkDeviceBufferMemoryRequirements(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCreateInfo)
-        pCreateInfo = new safe_VkBufferCreateInfo(in_struct->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkBufferCreateInfo(in_struct->pCreateInfo);
 }
 
 safe_VkDeviceBufferMemoryRequirements::safe_VkDeviceBufferMemoryRequirements() :
@@ -20632,7 +20738,7 @@ safe_VkDeviceBufferMemoryRequirements::safe_VkDeviceBufferMemoryRequirements(con
     pCreateInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCreateInfo)
-        pCreateInfo = new safe_VkBufferCreateInfo(*copy_src.pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkBufferCreateInfo(*copy_src.pCreateInfo);
 }
 
 safe_VkDeviceBufferMemoryRequirements& safe_VkDeviceBufferMemoryRequirements::operator=(const safe_VkDeviceBufferMemoryRequirements& copy_src)
@@ -20648,7 +20754,7 @@ safe_VkDeviceBufferMemoryRequirements& safe_VkDeviceBufferMemoryRequirements::op
     pCreateInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCreateInfo)
-        pCreateInfo = new safe_VkBufferCreateInfo(*copy_src.pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkBufferCreateInfo(*copy_src.pCreateInfo);
 
     return *this;
 }
@@ -20671,7 +20777,7 @@ void safe_VkDeviceBufferMemoryRequirements::initialize(const VkDeviceBufferMemor
     pCreateInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCreateInfo)
-        pCreateInfo = new safe_VkBufferCreateInfo(in_struct->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkBufferCreateInfo(in_struct->pCreateInfo);
 }
 
 void safe_VkDeviceBufferMemoryRequirements::initialize(const safe_VkDeviceBufferMemoryRequirements* copy_src)
@@ -20680,7 +20786,7 @@ void safe_VkDeviceBufferMemoryRequirements::initialize(const safe_VkDeviceBuffer
     pCreateInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pCreateInfo)
-        pCreateInfo = new safe_VkBufferCreateInfo(*copy_src->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkBufferCreateInfo(*copy_src->pCreateInfo);
 }
 
 safe_VkDeviceImageMemoryRequirements::safe_VkDeviceImageMemoryRequirements(const VkDeviceImageMemoryRequirements* in_struct) :
@@ -20690,7 +20796,7 @@ safe_VkDeviceImageMemoryRequirements::safe_VkDeviceImageMemoryRequirements(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCreateInfo)
-        pCreateInfo = new safe_VkImageCreateInfo(in_struct->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkImageCreateInfo(in_struct->pCreateInfo);
 }
 
 safe_VkDeviceImageMemoryRequirements::safe_VkDeviceImageMemoryRequirements() :
@@ -20707,7 +20813,7 @@ safe_VkDeviceImageMemoryRequirements::safe_VkDeviceImageMemoryRequirements(const
     planeAspect = copy_src.planeAspect;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCreateInfo)
-        pCreateInfo = new safe_VkImageCreateInfo(*copy_src.pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkImageCreateInfo(*copy_src.pCreateInfo);
 }
 
 safe_VkDeviceImageMemoryRequirements& safe_VkDeviceImageMemoryRequirements::operator=(const safe_VkDeviceImageMemoryRequirements& copy_src)
@@ -20724,7 +20830,7 @@ safe_VkDeviceImageMemoryRequirements& safe_VkDeviceImageMemoryRequirements::oper
     planeAspect = copy_src.planeAspect;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCreateInfo)
-        pCreateInfo = new safe_VkImageCreateInfo(*copy_src.pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkImageCreateInfo(*copy_src.pCreateInfo);
 
     return *this;
 }
@@ -20748,7 +20854,7 @@ void safe_VkDeviceImageMemoryRequirements::initialize(const VkDeviceImageMemoryR
     planeAspect = in_struct->planeAspect;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCreateInfo)
-        pCreateInfo = new safe_VkImageCreateInfo(in_struct->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkImageCreateInfo(in_struct->pCreateInfo);
 }
 
 void safe_VkDeviceImageMemoryRequirements::initialize(const safe_VkDeviceImageMemoryRequirements* copy_src)
@@ -20758,7 +20864,7 @@ void safe_VkDeviceImageMemoryRequirements::initialize(const safe_VkDeviceImageMe
     planeAspect = copy_src->planeAspect;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pCreateInfo)
-        pCreateInfo = new safe_VkImageCreateInfo(*copy_src->pCreateInfo);
+        pCreateInfo = new (kSafeStructAlloc) safe_VkImageCreateInfo(*copy_src->pCreateInfo);
 }
 
 safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(const VkSwapchainCreateInfoKHR* in_struct) :
@@ -20782,7 +20888,7 @@ safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(const VkSwapchainCr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->imageSharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -20831,7 +20937,7 @@ safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(const safe_VkSwapch
     oldSwapchain = copy_src.oldSwapchain;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.imageSharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -20866,7 +20972,7 @@ safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(const sa
     oldSwapchain = copy_src.oldSwapchain;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.imageSharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -20908,7 +21014,7 @@ void safe_VkSwapchainCreateInfoKHR::initialize(const VkSwapchainCreateInfoKHR* i
     oldSwapchain = in_struct->oldSwapchain;
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->imageSharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -20936,7 +21042,7 @@ void safe_VkSwapchainCreateInfoKHR::initialize(const safe_VkSwapchainCreateInfoK
     oldSwapchain = copy_src->oldSwapchain;
     pNext = SafePnextCopy(copy_src->pNext);
     if ((copy_src->imageSharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src->pQueueFamilyIndices, sizeof(uint32_t)*copy_src->queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src->queueFamilyIndexCount;
     } else {
@@ -20955,23 +21061,23 @@ safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(const VkPresentInfoKHR* in_struct)
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (swapchainCount && in_struct->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
+        pSwapchains = new (kSafeStructAlloc) VkSwapchainKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pSwapchains[i] = in_struct->pSwapchains[i];
         }
     }
     if (in_struct->pImageIndices) {
-        pImageIndices = new uint32_t[in_struct->swapchainCount];
+        pImageIndices = new (kSafeStructAlloc) uint32_t[in_struct->swapchainCount];
         memcpy ((void *)pImageIndices, (void *)in_struct->pImageIndices, sizeof(uint32_t)*in_struct->swapchainCount);
     }
     if (in_struct->pResults) {
-        pResults = new VkResult[in_struct->swapchainCount];
+        pResults = new (kSafeStructAlloc) VkResult[in_struct->swapchainCount];
         memcpy ((void *)pResults, (void *)in_struct->pResults, sizeof(VkResult)*in_struct->swapchainCount);
     }
 }
@@ -20998,23 +21104,23 @@ safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(const safe_VkPresentInfoKHR& copy_s
     pResults = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (swapchainCount && copy_src.pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
+        pSwapchains = new (kSafeStructAlloc) VkSwapchainKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pSwapchains[i] = copy_src.pSwapchains[i];
         }
     }
     if (copy_src.pImageIndices) {
-        pImageIndices = new uint32_t[copy_src.swapchainCount];
+        pImageIndices = new (kSafeStructAlloc) uint32_t[copy_src.swapchainCount];
         memcpy ((void *)pImageIndices, (void *)copy_src.pImageIndices, sizeof(uint32_t)*copy_src.swapchainCount);
     }
     if (copy_src.pResults) {
-        pResults = new VkResult[copy_src.swapchainCount];
+        pResults = new (kSafeStructAlloc) VkResult[copy_src.swapchainCount];
         memcpy ((void *)pResults, (void *)copy_src.pResults, sizeof(VkResult)*copy_src.swapchainCount);
     }
 }
@@ -21043,23 +21149,23 @@ safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(const safe_VkPresentInfo
     pResults = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (waitSemaphoreCount && copy_src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src.pWaitSemaphores[i];
         }
     }
     if (swapchainCount && copy_src.pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
+        pSwapchains = new (kSafeStructAlloc) VkSwapchainKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pSwapchains[i] = copy_src.pSwapchains[i];
         }
     }
     if (copy_src.pImageIndices) {
-        pImageIndices = new uint32_t[copy_src.swapchainCount];
+        pImageIndices = new (kSafeStructAlloc) uint32_t[copy_src.swapchainCount];
         memcpy ((void *)pImageIndices, (void *)copy_src.pImageIndices, sizeof(uint32_t)*copy_src.swapchainCount);
     }
     if (copy_src.pResults) {
-        pResults = new VkResult[copy_src.swapchainCount];
+        pResults = new (kSafeStructAlloc) VkResult[copy_src.swapchainCount];
         memcpy ((void *)pResults, (void *)copy_src.pResults, sizeof(VkResult)*copy_src.swapchainCount);
     }
 
@@ -21101,23 +21207,23 @@ void safe_VkPresentInfoKHR::initialize(const VkPresentInfoKHR* in_struct)
     pResults = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
         }
     }
     if (swapchainCount && in_struct->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
+        pSwapchains = new (kSafeStructAlloc) VkSwapchainKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pSwapchains[i] = in_struct->pSwapchains[i];
         }
     }
     if (in_struct->pImageIndices) {
-        pImageIndices = new uint32_t[in_struct->swapchainCount];
+        pImageIndices = new (kSafeStructAlloc) uint32_t[in_struct->swapchainCount];
         memcpy ((void *)pImageIndices, (void *)in_struct->pImageIndices, sizeof(uint32_t)*in_struct->swapchainCount);
     }
     if (in_struct->pResults) {
-        pResults = new VkResult[in_struct->swapchainCount];
+        pResults = new (kSafeStructAlloc) VkResult[in_struct->swapchainCount];
         memcpy ((void *)pResults, (void *)in_struct->pResults, sizeof(VkResult)*in_struct->swapchainCount);
     }
 }
@@ -21133,23 +21239,23 @@ void safe_VkPresentInfoKHR::initialize(const safe_VkPresentInfoKHR* copy_src)
     pResults = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (waitSemaphoreCount && copy_src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
+        pWaitSemaphores = new (kSafeStructAlloc) VkSemaphore[waitSemaphoreCount];
         for (uint32_t i = 0; i < waitSemaphoreCount; ++i) {
             pWaitSemaphores[i] = copy_src->pWaitSemaphores[i];
         }
     }
     if (swapchainCount && copy_src->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
+        pSwapchains = new (kSafeStructAlloc) VkSwapchainKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pSwapchains[i] = copy_src->pSwapchains[i];
         }
     }
     if (copy_src->pImageIndices) {
-        pImageIndices = new uint32_t[copy_src->swapchainCount];
+        pImageIndices = new (kSafeStructAlloc) uint32_t[copy_src->swapchainCount];
         memcpy ((void *)pImageIndices, (void *)copy_src->pImageIndices, sizeof(uint32_t)*copy_src->swapchainCount);
     }
     if (copy_src->pResults) {
-        pResults = new VkResult[copy_src->swapchainCount];
+        pResults = new (kSafeStructAlloc) VkResult[copy_src->swapchainCount];
         memcpy ((void *)pResults, (void *)copy_src->pResults, sizeof(VkResult)*copy_src->swapchainCount);
     }
 }
@@ -21431,7 +21537,7 @@ safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(const VkDevic
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[in_struct->swapchainCount];
+        pDeviceMasks = new (kSafeStructAlloc) uint32_t[in_struct->swapchainCount];
         memcpy ((void *)pDeviceMasks, (void *)in_struct->pDeviceMasks, sizeof(uint32_t)*in_struct->swapchainCount);
     }
 }
@@ -21452,7 +21558,7 @@ safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(const safe_Vk
     mode = copy_src.mode;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceMasks) {
-        pDeviceMasks = new uint32_t[copy_src.swapchainCount];
+        pDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src.swapchainCount];
         memcpy ((void *)pDeviceMasks, (void *)copy_src.pDeviceMasks, sizeof(uint32_t)*copy_src.swapchainCount);
     }
 }
@@ -21472,7 +21578,7 @@ safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(co
     mode = copy_src.mode;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceMasks) {
-        pDeviceMasks = new uint32_t[copy_src.swapchainCount];
+        pDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src.swapchainCount];
         memcpy ((void *)pDeviceMasks, (void *)copy_src.pDeviceMasks, sizeof(uint32_t)*copy_src.swapchainCount);
     }
 
@@ -21499,7 +21605,7 @@ void safe_VkDeviceGroupPresentInfoKHR::initialize(const VkDeviceGroupPresentInfo
     mode = in_struct->mode;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[in_struct->swapchainCount];
+        pDeviceMasks = new (kSafeStructAlloc) uint32_t[in_struct->swapchainCount];
         memcpy ((void *)pDeviceMasks, (void *)in_struct->pDeviceMasks, sizeof(uint32_t)*in_struct->swapchainCount);
     }
 }
@@ -21512,7 +21618,7 @@ void safe_VkDeviceGroupPresentInfoKHR::initialize(const safe_VkDeviceGroupPresen
     mode = copy_src->mode;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[copy_src->swapchainCount];
+        pDeviceMasks = new (kSafeStructAlloc) uint32_t[copy_src->swapchainCount];
         memcpy ((void *)pDeviceMasks, (void *)copy_src->pDeviceMasks, sizeof(uint32_t)*copy_src->swapchainCount);
     }
 }
@@ -22085,7 +22191,7 @@ safe_VkVideoProfileListInfoKHR::safe_VkVideoProfileListInfoKHR(const VkVideoProf
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (profileCount && in_struct->pProfiles) {
-        pProfiles = new safe_VkVideoProfileInfoKHR[profileCount];
+        pProfiles = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR[profileCount];
         for (uint32_t i = 0; i < profileCount; ++i) {
             pProfiles[i].initialize(&in_struct->pProfiles[i]);
         }
@@ -22106,7 +22212,7 @@ safe_VkVideoProfileListInfoKHR::safe_VkVideoProfileListInfoKHR(const safe_VkVide
     pProfiles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (profileCount && copy_src.pProfiles) {
-        pProfiles = new safe_VkVideoProfileInfoKHR[profileCount];
+        pProfiles = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR[profileCount];
         for (uint32_t i = 0; i < profileCount; ++i) {
             pProfiles[i].initialize(&copy_src.pProfiles[i]);
         }
@@ -22127,7 +22233,7 @@ safe_VkVideoProfileListInfoKHR& safe_VkVideoProfileListInfoKHR::operator=(const
     pProfiles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (profileCount && copy_src.pProfiles) {
-        pProfiles = new safe_VkVideoProfileInfoKHR[profileCount];
+        pProfiles = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR[profileCount];
         for (uint32_t i = 0; i < profileCount; ++i) {
             pProfiles[i].initialize(&copy_src.pProfiles[i]);
         }
@@ -22155,7 +22261,7 @@ void safe_VkVideoProfileListInfoKHR::initialize(const VkVideoProfileListInfoKHR*
     pProfiles = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (profileCount && in_struct->pProfiles) {
-        pProfiles = new safe_VkVideoProfileInfoKHR[profileCount];
+        pProfiles = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR[profileCount];
         for (uint32_t i = 0; i < profileCount; ++i) {
             pProfiles[i].initialize(&in_struct->pProfiles[i]);
         }
@@ -22169,7 +22275,7 @@ void safe_VkVideoProfileListInfoKHR::initialize(const safe_VkVideoProfileListInf
     pProfiles = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (profileCount && copy_src->pProfiles) {
-        pProfiles = new safe_VkVideoProfileInfoKHR[profileCount];
+        pProfiles = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR[profileCount];
         for (uint32_t i = 0; i < profileCount; ++i) {
             pProfiles[i].initialize(&copy_src->pProfiles[i]);
         }
@@ -22523,7 +22629,7 @@ safe_VkVideoReferenceSlotInfoKHR::safe_VkVideoReferenceSlotInfoKHR(const VkVideo
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPictureResource)
-        pPictureResource = new safe_VkVideoPictureResourceInfoKHR(in_struct->pPictureResource);
+        pPictureResource = new (kSafeStructAlloc) safe_VkVideoPictureResourceInfoKHR(in_struct->pPictureResource);
 }
 
 safe_VkVideoReferenceSlotInfoKHR::safe_VkVideoReferenceSlotInfoKHR() :
@@ -22540,7 +22646,7 @@ safe_VkVideoReferenceSlotInfoKHR::safe_VkVideoReferenceSlotInfoKHR(const safe_Vk
     pPictureResource = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPictureResource)
-        pPictureResource = new safe_VkVideoPictureResourceInfoKHR(*copy_src.pPictureResource);
+        pPictureResource = new (kSafeStructAlloc) safe_VkVideoPictureResourceInfoKHR(*copy_src.pPictureResource);
 }
 
 safe_VkVideoReferenceSlotInfoKHR& safe_VkVideoReferenceSlotInfoKHR::operator=(const safe_VkVideoReferenceSlotInfoKHR& copy_src)
@@ -22557,7 +22663,7 @@ safe_VkVideoReferenceSlotInfoKHR& safe_VkVideoReferenceSlotInfoKHR::operator=(co
     pPictureResource = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPictureResource)
-        pPictureResource = new safe_VkVideoPictureResourceInfoKHR(*copy_src.pPictureResource);
+        pPictureResource = new (kSafeStructAlloc) safe_VkVideoPictureResourceInfoKHR(*copy_src.pPictureResource);
 
     return *this;
 }
@@ -22581,7 +22687,7 @@ void safe_VkVideoReferenceSlotInfoKHR::initialize(const VkVideoReferenceSlotInfo
     pPictureResource = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPictureResource)
-        pPictureResource = new safe_VkVideoPictureResourceInfoKHR(in_struct->pPictureResource);
+        pPictureResource = new (kSafeStructAlloc) safe_VkVideoPictureResourceInfoKHR(in_struct->pPictureResource);
 }
 
 void safe_VkVideoReferenceSlotInfoKHR::initialize(const safe_VkVideoReferenceSlotInfoKHR* copy_src)
@@ -22591,7 +22697,7 @@ void safe_VkVideoReferenceSlotInfoKHR::initialize(const safe_VkVideoReferenceSlo
     pPictureResource = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPictureResource)
-        pPictureResource = new safe_VkVideoPictureResourceInfoKHR(*copy_src->pPictureResource);
+        pPictureResource = new (kSafeStructAlloc) safe_VkVideoPictureResourceInfoKHR(*copy_src->pPictureResource);
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -22756,9 +22862,9 @@ safe_VkVideoSessionCreateInfoKHR::safe_VkVideoSessionCreateInfoKHR(const VkVideo
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVideoProfile)
-        pVideoProfile = new safe_VkVideoProfileInfoKHR(in_struct->pVideoProfile);
+        pVideoProfile = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(in_struct->pVideoProfile);
     if (in_struct->pStdHeaderVersion) {
-        pStdHeaderVersion = new VkExtensionProperties(*in_struct->pStdHeaderVersion);
+        pStdHeaderVersion = new (kSafeStructAlloc) VkExtensionProperties(*in_struct->pStdHeaderVersion);
     }
 }
 
@@ -22790,9 +22896,9 @@ safe_VkVideoSessionCreateInfoKHR::safe_VkVideoSessionCreateInfoKHR(const safe_Vk
     pStdHeaderVersion = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVideoProfile)
-        pVideoProfile = new safe_VkVideoProfileInfoKHR(*copy_src.pVideoProfile);
+        pVideoProfile = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(*copy_src.pVideoProfile);
     if (copy_src.pStdHeaderVersion) {
-        pStdHeaderVersion = new VkExtensionProperties(*copy_src.pStdHeaderVersion);
+        pStdHeaderVersion = new (kSafeStructAlloc) VkExtensionProperties(*copy_src.pStdHeaderVersion);
     }
 }
 
@@ -22819,9 +22925,9 @@ safe_VkVideoSessionCreateInfoKHR& safe_VkVideoSessionCreateInfoKHR::operator=(co
     pStdHeaderVersion = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVideoProfile)
-        pVideoProfile = new safe_VkVideoProfileInfoKHR(*copy_src.pVideoProfile);
+        pVideoProfile = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(*copy_src.pVideoProfile);
     if (copy_src.pStdHeaderVersion) {
-        pStdHeaderVersion = new VkExtensionProperties(*copy_src.pStdHeaderVersion);
+        pStdHeaderVersion = new (kSafeStructAlloc) VkExtensionProperties(*copy_src.pStdHeaderVersion);
     }
 
     return *this;
@@ -22857,9 +22963,9 @@ void safe_VkVideoSessionCreateInfoKHR::initialize(const VkVideoSessionCreateInfo
     pStdHeaderVersion = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVideoProfile)
-        pVideoProfile = new safe_VkVideoProfileInfoKHR(in_struct->pVideoProfile);
+        pVideoProfile = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(in_struct->pVideoProfile);
     if (in_struct->pStdHeaderVersion) {
-        pStdHeaderVersion = new VkExtensionProperties(*in_struct->pStdHeaderVersion);
+        pStdHeaderVersion = new (kSafeStructAlloc) VkExtensionProperties(*in_struct->pStdHeaderVersion);
     }
 }
 
@@ -22877,9 +22983,9 @@ void safe_VkVideoSessionCreateInfoKHR::initialize(const safe_VkVideoSessionCreat
     pStdHeaderVersion = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pVideoProfile)
-        pVideoProfile = new safe_VkVideoProfileInfoKHR(*copy_src->pVideoProfile);
+        pVideoProfile = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(*copy_src->pVideoProfile);
     if (copy_src->pStdHeaderVersion) {
-        pStdHeaderVersion = new VkExtensionProperties(*copy_src->pStdHeaderVersion);
+        pStdHeaderVersion = new (kSafeStructAlloc) VkExtensionProperties(*copy_src->pStdHeaderVersion);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -23029,7 +23135,7 @@ safe_VkVideoBeginCodingInfoKHR::safe_VkVideoBeginCodingInfoKHR(const VkVideoBegi
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -23056,7 +23162,7 @@ safe_VkVideoBeginCodingInfoKHR::safe_VkVideoBeginCodingInfoKHR(const safe_VkVide
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -23080,7 +23186,7 @@ safe_VkVideoBeginCodingInfoKHR& safe_VkVideoBeginCodingInfoKHR::operator=(const
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -23111,7 +23217,7 @@ void safe_VkVideoBeginCodingInfoKHR::initialize(const VkVideoBeginCodingInfoKHR*
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -23128,7 +23234,7 @@ void safe_VkVideoBeginCodingInfoKHR::initialize(const safe_VkVideoBeginCodingInf
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (referenceSlotCount && copy_src->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src->pReferenceSlots[i]);
         }
@@ -23392,9 +23498,9 @@ safe_VkVideoDecodeInfoKHR::safe_VkVideoDecodeInfoKHR(const VkVideoDecodeInfoKHR*
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -23426,9 +23532,9 @@ safe_VkVideoDecodeInfoKHR::safe_VkVideoDecodeInfoKHR(const safe_VkVideoDecodeInf
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -23457,9 +23563,9 @@ safe_VkVideoDecodeInfoKHR& safe_VkVideoDecodeInfoKHR::operator=(const safe_VkVid
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -23497,9 +23603,9 @@ void safe_VkVideoDecodeInfoKHR::initialize(const VkVideoDecodeInfoKHR* in_struct
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -23519,9 +23625,9 @@ void safe_VkVideoDecodeInfoKHR::initialize(const safe_VkVideoDecodeInfoKHR* copy
     pReferenceSlots = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src->pSetupReferenceSlot);
     if (referenceSlotCount && copy_src->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src->pReferenceSlots[i]);
         }
@@ -23668,7 +23774,7 @@ safe_VkAttachmentSampleCountInfoAMD::safe_VkAttachmentSampleCountInfoAMD(const V
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentSamples) {
-        pColorAttachmentSamples = new VkSampleCountFlagBits[in_struct->colorAttachmentCount];
+        pColorAttachmentSamples = new (kSafeStructAlloc) VkSampleCountFlagBits[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentSamples, (void *)in_struct->pColorAttachmentSamples, sizeof(VkSampleCountFlagBits)*in_struct->colorAttachmentCount);
     }
 }
@@ -23689,7 +23795,7 @@ safe_VkAttachmentSampleCountInfoAMD::safe_VkAttachmentSampleCountInfoAMD(const s
     depthStencilAttachmentSamples = copy_src.depthStencilAttachmentSamples;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentSamples) {
-        pColorAttachmentSamples = new VkSampleCountFlagBits[copy_src.colorAttachmentCount];
+        pColorAttachmentSamples = new (kSafeStructAlloc) VkSampleCountFlagBits[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentSamples, (void *)copy_src.pColorAttachmentSamples, sizeof(VkSampleCountFlagBits)*copy_src.colorAttachmentCount);
     }
 }
@@ -23709,7 +23815,7 @@ safe_VkAttachmentSampleCountInfoAMD& safe_VkAttachmentSampleCountInfoAMD::operat
     depthStencilAttachmentSamples = copy_src.depthStencilAttachmentSamples;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorAttachmentSamples) {
-        pColorAttachmentSamples = new VkSampleCountFlagBits[copy_src.colorAttachmentCount];
+        pColorAttachmentSamples = new (kSafeStructAlloc) VkSampleCountFlagBits[copy_src.colorAttachmentCount];
         memcpy ((void *)pColorAttachmentSamples, (void *)copy_src.pColorAttachmentSamples, sizeof(VkSampleCountFlagBits)*copy_src.colorAttachmentCount);
     }
 
@@ -23736,7 +23842,7 @@ void safe_VkAttachmentSampleCountInfoAMD::initialize(const VkAttachmentSampleCou
     depthStencilAttachmentSamples = in_struct->depthStencilAttachmentSamples;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorAttachmentSamples) {
-        pColorAttachmentSamples = new VkSampleCountFlagBits[in_struct->colorAttachmentCount];
+        pColorAttachmentSamples = new (kSafeStructAlloc) VkSampleCountFlagBits[in_struct->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentSamples, (void *)in_struct->pColorAttachmentSamples, sizeof(VkSampleCountFlagBits)*in_struct->colorAttachmentCount);
     }
 }
@@ -23749,7 +23855,7 @@ void safe_VkAttachmentSampleCountInfoAMD::initialize(const safe_VkAttachmentSamp
     depthStencilAttachmentSamples = copy_src->depthStencilAttachmentSamples;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pColorAttachmentSamples) {
-        pColorAttachmentSamples = new VkSampleCountFlagBits[copy_src->colorAttachmentCount];
+        pColorAttachmentSamples = new (kSafeStructAlloc) VkSampleCountFlagBits[copy_src->colorAttachmentCount];
         memcpy ((void *)pColorAttachmentSamples, (void *)copy_src->pColorAttachmentSamples, sizeof(VkSampleCountFlagBits)*copy_src->colorAttachmentCount);
     }
 }
@@ -23898,7 +24004,7 @@ safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -23918,7 +24024,7 @@ safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(con
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 }
 
@@ -23937,7 +24043,7 @@ safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::op
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 
     return *this;
@@ -23963,7 +24069,7 @@ void safe_VkExportMemoryWin32HandleInfoKHR::initialize(const VkExportMemoryWin32
     name = in_struct->name;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -23975,7 +24081,7 @@ void safe_VkExportMemoryWin32HandleInfoKHR::initialize(const safe_VkExportMemory
     name = copy_src->name;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -24301,27 +24407,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleas
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
         }
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeouts = new (kSafeStructAlloc) uint32_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireTimeouts, (void *)in_struct->pAcquireTimeouts, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
         }
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[in_struct->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -24350,27 +24456,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleas
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (acquireCount && copy_src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src.pAcquireSyncs[i];
         }
     }
     if (copy_src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src.acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src.pAcquireKeys, sizeof(uint64_t)*copy_src.acquireCount);
     }
     if (copy_src.pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[copy_src.acquireCount];
+        pAcquireTimeouts = new (kSafeStructAlloc) uint32_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireTimeouts, (void *)copy_src.pAcquireTimeouts, sizeof(uint32_t)*copy_src.acquireCount);
     }
     if (releaseCount && copy_src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src.pReleaseSyncs[i];
         }
     }
     if (copy_src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src.releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src.releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src.pReleaseKeys, sizeof(uint64_t)*copy_src.releaseCount);
     }
 }
@@ -24402,27 +24508,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleas
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (acquireCount && copy_src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src.pAcquireSyncs[i];
         }
     }
     if (copy_src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src.acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src.pAcquireKeys, sizeof(uint64_t)*copy_src.acquireCount);
     }
     if (copy_src.pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[copy_src.acquireCount];
+        pAcquireTimeouts = new (kSafeStructAlloc) uint32_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireTimeouts, (void *)copy_src.pAcquireTimeouts, sizeof(uint32_t)*copy_src.acquireCount);
     }
     if (releaseCount && copy_src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src.pReleaseSyncs[i];
         }
     }
     if (copy_src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src.releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src.releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src.pReleaseKeys, sizeof(uint64_t)*copy_src.releaseCount);
     }
 
@@ -24469,27 +24575,27 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::initialize(const VkWin32KeyedM
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
         }
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeouts = new (kSafeStructAlloc) uint32_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireTimeouts, (void *)in_struct->pAcquireTimeouts, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
         }
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[in_struct->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -24506,27 +24612,27 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::initialize(const safe_VkWin32K
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (acquireCount && copy_src->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src->pAcquireSyncs[i];
         }
     }
     if (copy_src->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src->pAcquireKeys, sizeof(uint64_t)*copy_src->acquireCount);
     }
     if (copy_src->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[copy_src->acquireCount];
+        pAcquireTimeouts = new (kSafeStructAlloc) uint32_t[copy_src->acquireCount];
         memcpy ((void *)pAcquireTimeouts, (void *)copy_src->pAcquireTimeouts, sizeof(uint32_t)*copy_src->acquireCount);
     }
     if (releaseCount && copy_src->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src->pReleaseSyncs[i];
         }
     }
     if (copy_src->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src->pReleaseKeys, sizeof(uint64_t)*copy_src->releaseCount);
     }
 }
@@ -24627,7 +24733,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoK
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -24647,7 +24753,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoK
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 }
 
@@ -24666,7 +24772,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoK
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 
     return *this;
@@ -24692,7 +24798,7 @@ void safe_VkExportSemaphoreWin32HandleInfoKHR::initialize(const VkExportSemaphor
     name = in_struct->name;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -24704,7 +24810,7 @@ void safe_VkExportSemaphoreWin32HandleInfoKHR::initialize(const safe_VkExportSem
     name = copy_src->name;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -24721,11 +24827,11 @@ safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(const VkD3D12Fenc
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->waitSemaphoreValuesCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValuesCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->signalSemaphoreValuesCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValuesCount);
     }
 }
@@ -24748,11 +24854,11 @@ safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(const safe_VkD3D1
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src.waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.waitSemaphoreValuesCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src.pWaitSemaphoreValues, sizeof(uint64_t)*copy_src.waitSemaphoreValuesCount);
     }
     if (copy_src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src.signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.signalSemaphoreValuesCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src.pSignalSemaphoreValues, sizeof(uint64_t)*copy_src.signalSemaphoreValuesCount);
     }
 }
@@ -24775,11 +24881,11 @@ safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(const
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src.waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.waitSemaphoreValuesCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src.pWaitSemaphoreValues, sizeof(uint64_t)*copy_src.waitSemaphoreValuesCount);
     }
     if (copy_src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src.signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src.signalSemaphoreValuesCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src.pSignalSemaphoreValues, sizeof(uint64_t)*copy_src.signalSemaphoreValuesCount);
     }
 
@@ -24811,11 +24917,11 @@ void safe_VkD3D12FenceSubmitInfoKHR::initialize(const VkD3D12FenceSubmitInfoKHR*
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->waitSemaphoreValuesCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValuesCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[in_struct->signalSemaphoreValuesCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValuesCount);
     }
 }
@@ -24829,11 +24935,11 @@ void safe_VkD3D12FenceSubmitInfoKHR::initialize(const safe_VkD3D12FenceSubmitInf
     pSignalSemaphoreValues = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[copy_src->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src->waitSemaphoreValuesCount];
         memcpy ((void *)pWaitSemaphoreValues, (void *)copy_src->pWaitSemaphoreValues, sizeof(uint64_t)*copy_src->waitSemaphoreValuesCount);
     }
     if (copy_src->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[copy_src->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = new (kSafeStructAlloc) uint64_t[copy_src->signalSemaphoreValuesCount];
         memcpy ((void *)pSignalSemaphoreValues, (void *)copy_src->pSignalSemaphoreValues, sizeof(uint64_t)*copy_src->signalSemaphoreValuesCount);
     }
 }
@@ -25103,7 +25209,7 @@ safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(const VkPresentRegionKHR* in_st
     pRectangles(nullptr)
 {
     if (in_struct->pRectangles) {
-        pRectangles = new VkRectLayerKHR[in_struct->rectangleCount];
+        pRectangles = new (kSafeStructAlloc) VkRectLayerKHR[in_struct->rectangleCount];
         memcpy ((void *)pRectangles, (void *)in_struct->pRectangles, sizeof(VkRectLayerKHR)*in_struct->rectangleCount);
     }
 }
@@ -25118,7 +25224,7 @@ safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(const safe_VkPresentRegionKHR&
     rectangleCount = copy_src.rectangleCount;
     pRectangles = nullptr;
     if (copy_src.pRectangles) {
-        pRectangles = new VkRectLayerKHR[copy_src.rectangleCount];
+        pRectangles = new (kSafeStructAlloc) VkRectLayerKHR[copy_src.rectangleCount];
         memcpy ((void *)pRectangles, (void *)copy_src.pRectangles, sizeof(VkRectLayerKHR)*copy_src.rectangleCount);
     }
 }
@@ -25133,7 +25239,7 @@ safe_VkPresentRegionKHR& safe_VkPresentRegionKHR::operator=(const safe_VkPresent
     rectangleCount = copy_src.rectangleCount;
     pRectangles = nullptr;
     if (copy_src.pRectangles) {
-        pRectangles = new VkRectLayerKHR[copy_src.rectangleCount];
+        pRectangles = new (kSafeStructAlloc) VkRectLayerKHR[copy_src.rectangleCount];
         memcpy ((void *)pRectangles, (void *)copy_src.pRectangles, sizeof(VkRectLayerKHR)*copy_src.rectangleCount);
     }
 
@@ -25153,7 +25259,7 @@ void safe_VkPresentRegionKHR::initialize(const VkPresentRegionKHR* in_struct)
     rectangleCount = in_struct->rectangleCount;
     pRectangles = nullptr;
     if (in_struct->pRectangles) {
-        pRectangles = new VkRectLayerKHR[in_struct->rectangleCount];
+        pRectangles = new (kSafeStructAlloc) VkRectLayerKHR[in_struct->rectangleCount];
         memcpy ((void *)pRectangles, (void *)in_struct->pRectangles, sizeof(VkRectLayerKHR)*in_struct->rectangleCount);
     }
 }
@@ -25163,7 +25269,7 @@ void safe_VkPresentRegionKHR::initialize(const safe_VkPresentRegionKHR* copy_src
     rectangleCount = copy_src->rectangleCount;
     pRectangles = nullptr;
     if (copy_src->pRectangles) {
-        pRectangles = new VkRectLayerKHR[copy_src->rectangleCount];
+        pRectangles = new (kSafeStructAlloc) VkRectLayerKHR[copy_src->rectangleCount];
         memcpy ((void *)pRectangles, (void *)copy_src->pRectangles, sizeof(VkRectLayerKHR)*copy_src->rectangleCount);
     }
 }
@@ -25175,7 +25281,7 @@ safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(const VkPresentRegionsKHR* in
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (swapchainCount && in_struct->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = new (kSafeStructAlloc) safe_VkPresentRegionKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -25196,7 +25302,7 @@ safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(const safe_VkPresentRegionsKH
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (swapchainCount && copy_src.pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = new (kSafeStructAlloc) safe_VkPresentRegionKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -25217,7 +25323,7 @@ safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(const safe_VkPrese
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (swapchainCount && copy_src.pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = new (kSafeStructAlloc) safe_VkPresentRegionKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pRegions[i].initialize(&copy_src.pRegions[i]);
         }
@@ -25245,7 +25351,7 @@ void safe_VkPresentRegionsKHR::initialize(const VkPresentRegionsKHR* in_struct)
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (swapchainCount && in_struct->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = new (kSafeStructAlloc) safe_VkPresentRegionKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -25259,7 +25365,7 @@ void safe_VkPresentRegionsKHR::initialize(const safe_VkPresentRegionsKHR* copy_s
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (swapchainCount && copy_src->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = new (kSafeStructAlloc) safe_VkPresentRegionKHR[swapchainCount];
         for (uint32_t i = 0; i < swapchainCount; ++i) {
             pRegions[i].initialize(&copy_src->pRegions[i]);
         }
@@ -25416,7 +25522,7 @@ safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -25436,7 +25542,7 @@ safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(const
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 }
 
@@ -25455,7 +25561,7 @@ safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::oper
     name = copy_src.name;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 
     return *this;
@@ -25481,7 +25587,7 @@ void safe_VkExportFenceWin32HandleInfoKHR::initialize(const VkExportFenceWin32Ha
     name = in_struct->name;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -25493,7 +25599,7 @@ void safe_VkExportFenceWin32HandleInfoKHR::initialize(const safe_VkExportFenceWi
     name = copy_src->name;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -26011,7 +26117,7 @@ safe_VkQueryPoolPerformanceCreateInfoKHR::safe_VkQueryPoolPerformanceCreateInfoK
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCounterIndices) {
-        pCounterIndices = new uint32_t[in_struct->counterIndexCount];
+        pCounterIndices = new (kSafeStructAlloc) uint32_t[in_struct->counterIndexCount];
         memcpy ((void *)pCounterIndices, (void *)in_struct->pCounterIndices, sizeof(uint32_t)*in_struct->counterIndexCount);
     }
 }
@@ -26032,7 +26138,7 @@ safe_VkQueryPoolPerformanceCreateInfoKHR::safe_VkQueryPoolPerformanceCreateInfoK
     pCounterIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCounterIndices) {
-        pCounterIndices = new uint32_t[copy_src.counterIndexCount];
+        pCounterIndices = new (kSafeStructAlloc) uint32_t[copy_src.counterIndexCount];
         memcpy ((void *)pCounterIndices, (void *)copy_src.pCounterIndices, sizeof(uint32_t)*copy_src.counterIndexCount);
     }
 }
@@ -26052,7 +26158,7 @@ safe_VkQueryPoolPerformanceCreateInfoKHR& safe_VkQueryPoolPerformanceCreateInfoK
     pCounterIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCounterIndices) {
-        pCounterIndices = new uint32_t[copy_src.counterIndexCount];
+        pCounterIndices = new (kSafeStructAlloc) uint32_t[copy_src.counterIndexCount];
         memcpy ((void *)pCounterIndices, (void *)copy_src.pCounterIndices, sizeof(uint32_t)*copy_src.counterIndexCount);
     }
 
@@ -26079,7 +26185,7 @@ void safe_VkQueryPoolPerformanceCreateInfoKHR::initialize(const VkQueryPoolPerfo
     pCounterIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCounterIndices) {
-        pCounterIndices = new uint32_t[in_struct->counterIndexCount];
+        pCounterIndices = new (kSafeStructAlloc) uint32_t[in_struct->counterIndexCount];
         memcpy ((void *)pCounterIndices, (void *)in_struct->pCounterIndices, sizeof(uint32_t)*in_struct->counterIndexCount);
     }
 }
@@ -26092,7 +26198,7 @@ void safe_VkQueryPoolPerformanceCreateInfoKHR::initialize(const safe_VkQueryPool
     pCounterIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pCounterIndices) {
-        pCounterIndices = new uint32_t[copy_src->counterIndexCount];
+        pCounterIndices = new (kSafeStructAlloc) uint32_t[copy_src->counterIndexCount];
         memcpy ((void *)pCounterIndices, (void *)copy_src->pCounterIndices, sizeof(uint32_t)*copy_src->counterIndexCount);
     }
 }
@@ -27124,7 +27230,7 @@ safe_VkFragmentShadingRateAttachmentInfoKHR::safe_VkFragmentShadingRateAttachmen
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFragmentShadingRateAttachment)
-        pFragmentShadingRateAttachment = new safe_VkAttachmentReference2(in_struct->pFragmentShadingRateAttachment);
+        pFragmentShadingRateAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pFragmentShadingRateAttachment);
 }
 
 safe_VkFragmentShadingRateAttachmentInfoKHR::safe_VkFragmentShadingRateAttachmentInfoKHR() :
@@ -27141,7 +27247,7 @@ safe_VkFragmentShadingRateAttachmentInfoKHR::safe_VkFragmentShadingRateAttachmen
     shadingRateAttachmentTexelSize = copy_src.shadingRateAttachmentTexelSize;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFragmentShadingRateAttachment)
-        pFragmentShadingRateAttachment = new safe_VkAttachmentReference2(*copy_src.pFragmentShadingRateAttachment);
+        pFragmentShadingRateAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pFragmentShadingRateAttachment);
 }
 
 safe_VkFragmentShadingRateAttachmentInfoKHR& safe_VkFragmentShadingRateAttachmentInfoKHR::operator=(const safe_VkFragmentShadingRateAttachmentInfoKHR& copy_src)
@@ -27158,7 +27264,7 @@ safe_VkFragmentShadingRateAttachmentInfoKHR& safe_VkFragmentShadingRateAttachmen
     shadingRateAttachmentTexelSize = copy_src.shadingRateAttachmentTexelSize;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFragmentShadingRateAttachment)
-        pFragmentShadingRateAttachment = new safe_VkAttachmentReference2(*copy_src.pFragmentShadingRateAttachment);
+        pFragmentShadingRateAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src.pFragmentShadingRateAttachment);
 
     return *this;
 }
@@ -27182,7 +27288,7 @@ void safe_VkFragmentShadingRateAttachmentInfoKHR::initialize(const VkFragmentSha
     shadingRateAttachmentTexelSize = in_struct->shadingRateAttachmentTexelSize;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFragmentShadingRateAttachment)
-        pFragmentShadingRateAttachment = new safe_VkAttachmentReference2(in_struct->pFragmentShadingRateAttachment);
+        pFragmentShadingRateAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(in_struct->pFragmentShadingRateAttachment);
 }
 
 void safe_VkFragmentShadingRateAttachmentInfoKHR::initialize(const safe_VkFragmentShadingRateAttachmentInfoKHR* copy_src)
@@ -27192,7 +27298,7 @@ void safe_VkFragmentShadingRateAttachmentInfoKHR::initialize(const safe_VkFragme
     shadingRateAttachmentTexelSize = copy_src->shadingRateAttachmentTexelSize;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pFragmentShadingRateAttachment)
-        pFragmentShadingRateAttachment = new safe_VkAttachmentReference2(*copy_src->pFragmentShadingRateAttachment);
+        pFragmentShadingRateAttachment = new (kSafeStructAlloc) safe_VkAttachmentReference2(*copy_src->pFragmentShadingRateAttachment);
 }
 
 safe_VkPipelineFragmentShadingRateStateCreateInfoKHR::safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(const VkPipelineFragmentShadingRateStateCreateInfoKHR* in_struct) :
@@ -28123,7 +28229,7 @@ safe_VkPipelineLibraryCreateInfoKHR::safe_VkPipelineLibraryCreateInfoKHR(const V
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (libraryCount && in_struct->pLibraries) {
-        pLibraries = new VkPipeline[libraryCount];
+        pLibraries = new (kSafeStructAlloc) VkPipeline[libraryCount];
         for (uint32_t i = 0; i < libraryCount; ++i) {
             pLibraries[i] = in_struct->pLibraries[i];
         }
@@ -28144,7 +28250,7 @@ safe_VkPipelineLibraryCreateInfoKHR::safe_VkPipelineLibraryCreateInfoKHR(const s
     pLibraries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (libraryCount && copy_src.pLibraries) {
-        pLibraries = new VkPipeline[libraryCount];
+        pLibraries = new (kSafeStructAlloc) VkPipeline[libraryCount];
         for (uint32_t i = 0; i < libraryCount; ++i) {
             pLibraries[i] = copy_src.pLibraries[i];
         }
@@ -28165,7 +28271,7 @@ safe_VkPipelineLibraryCreateInfoKHR& safe_VkPipelineLibraryCreateInfoKHR::operat
     pLibraries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (libraryCount && copy_src.pLibraries) {
-        pLibraries = new VkPipeline[libraryCount];
+        pLibraries = new (kSafeStructAlloc) VkPipeline[libraryCount];
         for (uint32_t i = 0; i < libraryCount; ++i) {
             pLibraries[i] = copy_src.pLibraries[i];
         }
@@ -28193,7 +28299,7 @@ void safe_VkPipelineLibraryCreateInfoKHR::initialize(const VkPipelineLibraryCrea
     pLibraries = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (libraryCount && in_struct->pLibraries) {
-        pLibraries = new VkPipeline[libraryCount];
+        pLibraries = new (kSafeStructAlloc) VkPipeline[libraryCount];
         for (uint32_t i = 0; i < libraryCount; ++i) {
             pLibraries[i] = in_struct->pLibraries[i];
         }
@@ -28207,7 +28313,7 @@ void safe_VkPipelineLibraryCreateInfoKHR::initialize(const safe_VkPipelineLibrar
     pLibraries = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (libraryCount && copy_src->pLibraries) {
-        pLibraries = new VkPipeline[libraryCount];
+        pLibraries = new (kSafeStructAlloc) VkPipeline[libraryCount];
         for (uint32_t i = 0; i < libraryCount; ++i) {
             pLibraries[i] = copy_src->pLibraries[i];
         }
@@ -28221,7 +28327,7 @@ safe_VkPresentIdKHR::safe_VkPresentIdKHR(const VkPresentIdKHR* in_struct) :
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPresentIds) {
-        pPresentIds = new uint64_t[in_struct->swapchainCount];
+        pPresentIds = new (kSafeStructAlloc) uint64_t[in_struct->swapchainCount];
         memcpy ((void *)pPresentIds, (void *)in_struct->pPresentIds, sizeof(uint64_t)*in_struct->swapchainCount);
     }
 }
@@ -28240,7 +28346,7 @@ safe_VkPresentIdKHR::safe_VkPresentIdKHR(const safe_VkPresentIdKHR& copy_src)
     pPresentIds = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPresentIds) {
-        pPresentIds = new uint64_t[copy_src.swapchainCount];
+        pPresentIds = new (kSafeStructAlloc) uint64_t[copy_src.swapchainCount];
         memcpy ((void *)pPresentIds, (void *)copy_src.pPresentIds, sizeof(uint64_t)*copy_src.swapchainCount);
     }
 }
@@ -28259,7 +28365,7 @@ safe_VkPresentIdKHR& safe_VkPresentIdKHR::operator=(const safe_VkPresentIdKHR& c
     pPresentIds = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPresentIds) {
-        pPresentIds = new uint64_t[copy_src.swapchainCount];
+        pPresentIds = new (kSafeStructAlloc) uint64_t[copy_src.swapchainCount];
         memcpy ((void *)pPresentIds, (void *)copy_src.pPresentIds, sizeof(uint64_t)*copy_src.swapchainCount);
     }
 
@@ -28285,7 +28391,7 @@ void safe_VkPresentIdKHR::initialize(const VkPresentIdKHR* in_struct)
     pPresentIds = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPresentIds) {
-        pPresentIds = new uint64_t[in_struct->swapchainCount];
+        pPresentIds = new (kSafeStructAlloc) uint64_t[in_struct->swapchainCount];
         memcpy ((void *)pPresentIds, (void *)in_struct->pPresentIds, sizeof(uint64_t)*in_struct->swapchainCount);
     }
 }
@@ -28297,7 +28403,7 @@ void safe_VkPresentIdKHR::initialize(const safe_VkPresentIdKHR* copy_src)
     pPresentIds = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPresentIds) {
-        pPresentIds = new uint64_t[copy_src->swapchainCount];
+        pPresentIds = new (kSafeStructAlloc) uint64_t[copy_src->swapchainCount];
         memcpy ((void *)pPresentIds, (void *)copy_src->pPresentIds, sizeof(uint64_t)*copy_src->swapchainCount);
     }
 }
@@ -28375,9 +28481,9 @@ safe_VkVideoEncodeInfoKHR::safe_VkVideoEncodeInfoKHR(const VkVideoEncodeInfoKHR*
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -28413,9 +28519,9 @@ safe_VkVideoEncodeInfoKHR::safe_VkVideoEncodeInfoKHR(const safe_VkVideoEncodeInf
     precedingExternallyEncodedBytes = copy_src.precedingExternallyEncodedBytes;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -28446,9 +28552,9 @@ safe_VkVideoEncodeInfoKHR& safe_VkVideoEncodeInfoKHR::operator=(const safe_VkVid
     precedingExternallyEncodedBytes = copy_src.precedingExternallyEncodedBytes;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src.pSetupReferenceSlot);
     if (referenceSlotCount && copy_src.pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src.pReferenceSlots[i]);
         }
@@ -28488,9 +28594,9 @@ void safe_VkVideoEncodeInfoKHR::initialize(const VkVideoEncodeInfoKHR* in_struct
     precedingExternallyEncodedBytes = in_struct->precedingExternallyEncodedBytes;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(in_struct->pSetupReferenceSlot);
     if (referenceSlotCount && in_struct->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&in_struct->pReferenceSlots[i]);
         }
@@ -28512,9 +28618,9 @@ void safe_VkVideoEncodeInfoKHR::initialize(const safe_VkVideoEncodeInfoKHR* copy
     precedingExternallyEncodedBytes = copy_src->precedingExternallyEncodedBytes;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pSetupReferenceSlot)
-        pSetupReferenceSlot = new safe_VkVideoReferenceSlotInfoKHR(*copy_src->pSetupReferenceSlot);
+        pSetupReferenceSlot = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR(*copy_src->pSetupReferenceSlot);
     if (referenceSlotCount && copy_src->pReferenceSlots) {
-        pReferenceSlots = new safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
+        pReferenceSlots = new (kSafeStructAlloc) safe_VkVideoReferenceSlotInfoKHR[referenceSlotCount];
         for (uint32_t i = 0; i < referenceSlotCount; ++i) {
             pReferenceSlots[i].initialize(&copy_src->pReferenceSlots[i]);
         }
@@ -28780,7 +28886,7 @@ safe_VkVideoEncodeRateControlInfoKHR::safe_VkVideoEncodeRateControlInfoKHR(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (layerCount && in_struct->pLayerConfigs) {
-        pLayerConfigs = new safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
+        pLayerConfigs = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
         for (uint32_t i = 0; i < layerCount; ++i) {
             pLayerConfigs[i].initialize(&in_struct->pLayerConfigs[i]);
         }
@@ -28805,7 +28911,7 @@ safe_VkVideoEncodeRateControlInfoKHR::safe_VkVideoEncodeRateControlInfoKHR(const
     pLayerConfigs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (layerCount && copy_src.pLayerConfigs) {
-        pLayerConfigs = new safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
+        pLayerConfigs = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
         for (uint32_t i = 0; i < layerCount; ++i) {
             pLayerConfigs[i].initialize(&copy_src.pLayerConfigs[i]);
         }
@@ -28828,7 +28934,7 @@ safe_VkVideoEncodeRateControlInfoKHR& safe_VkVideoEncodeRateControlInfoKHR::oper
     pLayerConfigs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (layerCount && copy_src.pLayerConfigs) {
-        pLayerConfigs = new safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
+        pLayerConfigs = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
         for (uint32_t i = 0; i < layerCount; ++i) {
             pLayerConfigs[i].initialize(&copy_src.pLayerConfigs[i]);
         }
@@ -28858,7 +28964,7 @@ void safe_VkVideoEncodeRateControlInfoKHR::initialize(const VkVideoEncodeRateCon
     pLayerConfigs = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (layerCount && in_struct->pLayerConfigs) {
-        pLayerConfigs = new safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
+        pLayerConfigs = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
         for (uint32_t i = 0; i < layerCount; ++i) {
             pLayerConfigs[i].initialize(&in_struct->pLayerConfigs[i]);
         }
@@ -28874,7 +28980,7 @@ void safe_VkVideoEncodeRateControlInfoKHR::initialize(const safe_VkVideoEncodeRa
     pLayerConfigs = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (layerCount && copy_src->pLayerConfigs) {
-        pLayerConfigs = new safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
+        pLayerConfigs = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR[layerCount];
         for (uint32_t i = 0; i < layerCount; ++i) {
             pLayerConfigs[i].initialize(&copy_src->pLayerConfigs[i]);
         }
@@ -30572,11 +30678,11 @@ safe_VkVideoEncodeH264SessionParametersAddInfoEXT::safe_VkVideoEncodeH264Session
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -30599,11 +30705,11 @@ safe_VkVideoEncodeH264SessionParametersAddInfoEXT::safe_VkVideoEncodeH264Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src.stdPPSCount);
     }
 }
@@ -30626,11 +30732,11 @@ safe_VkVideoEncodeH264SessionParametersAddInfoEXT& safe_VkVideoEncodeH264Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src.stdPPSCount);
     }
 
@@ -30662,11 +30768,11 @@ void safe_VkVideoEncodeH264SessionParametersAddInfoEXT::initialize(const VkVideo
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -30680,11 +30786,11 @@ void safe_VkVideoEncodeH264SessionParametersAddInfoEXT::initialize(const safe_Vk
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src->stdSPSCount);
     }
     if (copy_src->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src->stdPPSCount);
     }
 }
@@ -30701,7 +30807,7 @@ safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::safe_VkVideoEncodeH264Sess
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::safe_VkVideoEncodeH264SessionParametersCreateInfoEXT() :
@@ -30720,7 +30826,7 @@ safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::safe_VkVideoEncodeH264Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 }
 
 safe_VkVideoEncodeH264SessionParametersCreateInfoEXT& safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::operator=(const safe_VkVideoEncodeH264SessionParametersCreateInfoEXT& copy_src)
@@ -30738,7 +30844,7 @@ safe_VkVideoEncodeH264SessionParametersCreateInfoEXT& safe_VkVideoEncodeH264Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 
     return *this;
 }
@@ -30763,7 +30869,7 @@ void safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::initialize(const VkVi
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 void safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::initialize(const safe_VkVideoEncodeH264SessionParametersCreateInfoEXT* copy_src)
@@ -30774,7 +30880,7 @@ void safe_VkVideoEncodeH264SessionParametersCreateInfoEXT::initialize(const safe
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -30788,7 +30894,7 @@ safe_VkVideoEncodeH264DpbSlotInfoEXT::safe_VkVideoEncodeH264DpbSlotInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -30806,7 +30912,7 @@ safe_VkVideoEncodeH264DpbSlotInfoEXT::safe_VkVideoEncodeH264DpbSlotInfoEXT(const
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 }
 
@@ -30824,7 +30930,7 @@ safe_VkVideoEncodeH264DpbSlotInfoEXT& safe_VkVideoEncodeH264DpbSlotInfoEXT::oper
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 
     return *this;
@@ -30849,7 +30955,7 @@ void safe_VkVideoEncodeH264DpbSlotInfoEXT::initialize(const VkVideoEncodeH264Dpb
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -30860,7 +30966,7 @@ void safe_VkVideoEncodeH264DpbSlotInfoEXT::initialize(const safe_VkVideoEncodeH2
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH264ReferenceInfo(*copy_src->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH264ReferenceInfo(*copy_src->pStdReferenceInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -30878,19 +30984,19 @@ safe_VkVideoEncodeH264ReferenceListsInfoEXT::safe_VkVideoEncodeH264ReferenceList
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceList0EntryCount && in_struct->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&in_struct->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && in_struct->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&in_struct->pReferenceList1Entries[i]);
         }
     }
     if (in_struct->pMemMgmtCtrlOperations) {
-        pMemMgmtCtrlOperations = new StdVideoEncodeH264RefMemMgmtCtrlOperations(*in_struct->pMemMgmtCtrlOperations);
+        pMemMgmtCtrlOperations = new (kSafeStructAlloc) StdVideoEncodeH264RefMemMgmtCtrlOperations(*in_struct->pMemMgmtCtrlOperations);
     }
 }
 
@@ -30914,19 +31020,19 @@ safe_VkVideoEncodeH264ReferenceListsInfoEXT::safe_VkVideoEncodeH264ReferenceList
     pMemMgmtCtrlOperations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceList0EntryCount && copy_src.pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src.pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src.pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src.pReferenceList1Entries[i]);
         }
     }
     if (copy_src.pMemMgmtCtrlOperations) {
-        pMemMgmtCtrlOperations = new StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src.pMemMgmtCtrlOperations);
+        pMemMgmtCtrlOperations = new (kSafeStructAlloc) StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src.pMemMgmtCtrlOperations);
     }
 }
 
@@ -30951,19 +31057,19 @@ safe_VkVideoEncodeH264ReferenceListsInfoEXT& safe_VkVideoEncodeH264ReferenceList
     pMemMgmtCtrlOperations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceList0EntryCount && copy_src.pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src.pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src.pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src.pReferenceList1Entries[i]);
         }
     }
     if (copy_src.pMemMgmtCtrlOperations) {
-        pMemMgmtCtrlOperations = new StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src.pMemMgmtCtrlOperations);
+        pMemMgmtCtrlOperations = new (kSafeStructAlloc) StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src.pMemMgmtCtrlOperations);
     }
 
     return *this;
@@ -30999,19 +31105,19 @@ void safe_VkVideoEncodeH264ReferenceListsInfoEXT::initialize(const VkVideoEncode
     pMemMgmtCtrlOperations = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceList0EntryCount && in_struct->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&in_struct->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && in_struct->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&in_struct->pReferenceList1Entries[i]);
         }
     }
     if (in_struct->pMemMgmtCtrlOperations) {
-        pMemMgmtCtrlOperations = new StdVideoEncodeH264RefMemMgmtCtrlOperations(*in_struct->pMemMgmtCtrlOperations);
+        pMemMgmtCtrlOperations = new (kSafeStructAlloc) StdVideoEncodeH264RefMemMgmtCtrlOperations(*in_struct->pMemMgmtCtrlOperations);
     }
 }
 
@@ -31025,19 +31131,19 @@ void safe_VkVideoEncodeH264ReferenceListsInfoEXT::initialize(const safe_VkVideoE
     pMemMgmtCtrlOperations = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (referenceList0EntryCount && copy_src->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH264DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src->pReferenceList1Entries[i]);
         }
     }
     if (copy_src->pMemMgmtCtrlOperations) {
-        pMemMgmtCtrlOperations = new StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src->pMemMgmtCtrlOperations);
+        pMemMgmtCtrlOperations = new (kSafeStructAlloc) StdVideoEncodeH264RefMemMgmtCtrlOperations(*copy_src->pMemMgmtCtrlOperations);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -31053,9 +31159,9 @@ safe_VkVideoEncodeH264NaluSliceInfoEXT::safe_VkVideoEncodeH264NaluSliceInfoEXT(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (in_struct->pSliceHeaderStd) {
-        pSliceHeaderStd = new StdVideoEncodeH264SliceHeader(*in_struct->pSliceHeaderStd);
+        pSliceHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH264SliceHeader(*in_struct->pSliceHeaderStd);
     }
 }
 
@@ -31075,9 +31181,9 @@ safe_VkVideoEncodeH264NaluSliceInfoEXT::safe_VkVideoEncodeH264NaluSliceInfoEXT(c
     pSliceHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (copy_src.pSliceHeaderStd) {
-        pSliceHeaderStd = new StdVideoEncodeH264SliceHeader(*copy_src.pSliceHeaderStd);
+        pSliceHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH264SliceHeader(*copy_src.pSliceHeaderStd);
     }
 }
 
@@ -31098,9 +31204,9 @@ safe_VkVideoEncodeH264NaluSliceInfoEXT& safe_VkVideoEncodeH264NaluSliceInfoEXT::
     pSliceHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (copy_src.pSliceHeaderStd) {
-        pSliceHeaderStd = new StdVideoEncodeH264SliceHeader(*copy_src.pSliceHeaderStd);
+        pSliceHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH264SliceHeader(*copy_src.pSliceHeaderStd);
     }
 
     return *this;
@@ -31130,9 +31236,9 @@ void safe_VkVideoEncodeH264NaluSliceInfoEXT::initialize(const VkVideoEncodeH264N
     pSliceHeaderStd = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (in_struct->pSliceHeaderStd) {
-        pSliceHeaderStd = new StdVideoEncodeH264SliceHeader(*in_struct->pSliceHeaderStd);
+        pSliceHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH264SliceHeader(*in_struct->pSliceHeaderStd);
     }
 }
 
@@ -31144,9 +31250,9 @@ void safe_VkVideoEncodeH264NaluSliceInfoEXT::initialize(const safe_VkVideoEncode
     pSliceHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
     if (copy_src->pSliceHeaderStd) {
-        pSliceHeaderStd = new StdVideoEncodeH264SliceHeader(*copy_src->pSliceHeaderStd);
+        pSliceHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH264SliceHeader(*copy_src->pSliceHeaderStd);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -31163,15 +31269,15 @@ safe_VkVideoEncodeH264VclFrameInfoEXT::safe_VkVideoEncodeH264VclFrameInfoEXT(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (naluSliceEntryCount && in_struct->pNaluSliceEntries) {
-        pNaluSliceEntries = new safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
+        pNaluSliceEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
         for (uint32_t i = 0; i < naluSliceEntryCount; ++i) {
             pNaluSliceEntries[i].initialize(&in_struct->pNaluSliceEntries[i]);
         }
     }
     if (in_struct->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH264PictureInfo(*in_struct->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH264PictureInfo(*in_struct->pCurrentPictureInfo);
     }
 }
 
@@ -31193,15 +31299,15 @@ safe_VkVideoEncodeH264VclFrameInfoEXT::safe_VkVideoEncodeH264VclFrameInfoEXT(con
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (naluSliceEntryCount && copy_src.pNaluSliceEntries) {
-        pNaluSliceEntries = new safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
+        pNaluSliceEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
         for (uint32_t i = 0; i < naluSliceEntryCount; ++i) {
             pNaluSliceEntries[i].initialize(&copy_src.pNaluSliceEntries[i]);
         }
     }
     if (copy_src.pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH264PictureInfo(*copy_src.pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH264PictureInfo(*copy_src.pCurrentPictureInfo);
     }
 }
 
@@ -31225,15 +31331,15 @@ safe_VkVideoEncodeH264VclFrameInfoEXT& safe_VkVideoEncodeH264VclFrameInfoEXT::op
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (naluSliceEntryCount && copy_src.pNaluSliceEntries) {
-        pNaluSliceEntries = new safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
+        pNaluSliceEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
         for (uint32_t i = 0; i < naluSliceEntryCount; ++i) {
             pNaluSliceEntries[i].initialize(&copy_src.pNaluSliceEntries[i]);
         }
     }
     if (copy_src.pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH264PictureInfo(*copy_src.pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH264PictureInfo(*copy_src.pCurrentPictureInfo);
     }
 
     return *this;
@@ -31268,15 +31374,15 @@ void safe_VkVideoEncodeH264VclFrameInfoEXT::initialize(const VkVideoEncodeH264Vc
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (naluSliceEntryCount && in_struct->pNaluSliceEntries) {
-        pNaluSliceEntries = new safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
+        pNaluSliceEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
         for (uint32_t i = 0; i < naluSliceEntryCount; ++i) {
             pNaluSliceEntries[i].initialize(&in_struct->pNaluSliceEntries[i]);
         }
     }
     if (in_struct->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH264PictureInfo(*in_struct->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH264PictureInfo(*in_struct->pCurrentPictureInfo);
     }
 }
 
@@ -31289,15 +31395,15 @@ void safe_VkVideoEncodeH264VclFrameInfoEXT::initialize(const safe_VkVideoEncodeH
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH264ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
     if (naluSliceEntryCount && copy_src->pNaluSliceEntries) {
-        pNaluSliceEntries = new safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
+        pNaluSliceEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH264NaluSliceInfoEXT[naluSliceEntryCount];
         for (uint32_t i = 0; i < naluSliceEntryCount; ++i) {
             pNaluSliceEntries[i].initialize(&copy_src->pNaluSliceEntries[i]);
         }
     }
     if (copy_src->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH264PictureInfo(*copy_src->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH264PictureInfo(*copy_src->pCurrentPictureInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -31314,7 +31420,7 @@ safe_VkVideoEncodeH264EmitPictureParametersInfoEXT::safe_VkVideoEncodeH264EmitPi
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[in_struct->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[in_struct->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)in_struct->ppsIdEntries, sizeof(uint8_t)*in_struct->ppsIdEntryCount);
     }
 }
@@ -31337,7 +31443,7 @@ safe_VkVideoEncodeH264EmitPictureParametersInfoEXT::safe_VkVideoEncodeH264EmitPi
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src.ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src.ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src.ppsIdEntries, sizeof(uint8_t)*copy_src.ppsIdEntryCount);
     }
 }
@@ -31358,7 +31464,7 @@ safe_VkVideoEncodeH264EmitPictureParametersInfoEXT& safe_VkVideoEncodeH264EmitPi
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src.ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src.ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src.ppsIdEntries, sizeof(uint8_t)*copy_src.ppsIdEntryCount);
     }
 
@@ -31386,7 +31492,7 @@ void safe_VkVideoEncodeH264EmitPictureParametersInfoEXT::initialize(const VkVide
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[in_struct->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[in_struct->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)in_struct->ppsIdEntries, sizeof(uint8_t)*in_struct->ppsIdEntryCount);
     }
 }
@@ -31400,7 +31506,7 @@ void safe_VkVideoEncodeH264EmitPictureParametersInfoEXT::initialize(const safe_V
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src->ppsIdEntries, sizeof(uint8_t)*copy_src->ppsIdEntryCount);
     }
 }
@@ -31846,15 +31952,15 @@ safe_VkVideoEncodeH265SessionParametersAddInfoEXT::safe_VkVideoEncodeH265Session
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)in_struct->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*in_struct->stdVPSCount);
     }
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -31881,15 +31987,15 @@ safe_VkVideoEncodeH265SessionParametersAddInfoEXT::safe_VkVideoEncodeH265Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src.pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src.stdVPSCount);
     }
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src.stdPPSCount);
     }
 }
@@ -31916,15 +32022,15 @@ safe_VkVideoEncodeH265SessionParametersAddInfoEXT& safe_VkVideoEncodeH265Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src.pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src.stdVPSCount);
     }
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src.stdPPSCount);
     }
 
@@ -31962,15 +32068,15 @@ void safe_VkVideoEncodeH265SessionParametersAddInfoEXT::initialize(const VkVideo
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)in_struct->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*in_struct->stdVPSCount);
     }
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -31986,15 +32092,15 @@ void safe_VkVideoEncodeH265SessionParametersAddInfoEXT::initialize(const safe_Vk
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src->stdVPSCount);
     }
     if (copy_src->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src->stdSPSCount);
     }
     if (copy_src->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src->stdPPSCount);
     }
 }
@@ -32012,7 +32118,7 @@ safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::safe_VkVideoEncodeH265Sess
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::safe_VkVideoEncodeH265SessionParametersCreateInfoEXT() :
@@ -32033,7 +32139,7 @@ safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::safe_VkVideoEncodeH265Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 }
 
 safe_VkVideoEncodeH265SessionParametersCreateInfoEXT& safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::operator=(const safe_VkVideoEncodeH265SessionParametersCreateInfoEXT& copy_src)
@@ -32052,7 +32158,7 @@ safe_VkVideoEncodeH265SessionParametersCreateInfoEXT& safe_VkVideoEncodeH265Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 
     return *this;
 }
@@ -32078,7 +32184,7 @@ void safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::initialize(const VkVi
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 void safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::initialize(const safe_VkVideoEncodeH265SessionParametersCreateInfoEXT* copy_src)
@@ -32090,7 +32196,7 @@ void safe_VkVideoEncodeH265SessionParametersCreateInfoEXT::initialize(const safe
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -32104,7 +32210,7 @@ safe_VkVideoEncodeH265DpbSlotInfoEXT::safe_VkVideoEncodeH265DpbSlotInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -32122,7 +32228,7 @@ safe_VkVideoEncodeH265DpbSlotInfoEXT::safe_VkVideoEncodeH265DpbSlotInfoEXT(const
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 }
 
@@ -32140,7 +32246,7 @@ safe_VkVideoEncodeH265DpbSlotInfoEXT& safe_VkVideoEncodeH265DpbSlotInfoEXT::oper
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 
     return *this;
@@ -32165,7 +32271,7 @@ void safe_VkVideoEncodeH265DpbSlotInfoEXT::initialize(const VkVideoEncodeH265Dpb
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -32176,7 +32282,7 @@ void safe_VkVideoEncodeH265DpbSlotInfoEXT::initialize(const safe_VkVideoEncodeH2
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoEncodeH265ReferenceInfo(*copy_src->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceInfo(*copy_src->pStdReferenceInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -32194,19 +32300,19 @@ safe_VkVideoEncodeH265ReferenceListsInfoEXT::safe_VkVideoEncodeH265ReferenceList
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceList0EntryCount && in_struct->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&in_struct->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && in_struct->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&in_struct->pReferenceList1Entries[i]);
         }
     }
     if (in_struct->pReferenceModifications) {
-        pReferenceModifications = new StdVideoEncodeH265ReferenceModifications(*in_struct->pReferenceModifications);
+        pReferenceModifications = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceModifications(*in_struct->pReferenceModifications);
     }
 }
 
@@ -32230,19 +32336,19 @@ safe_VkVideoEncodeH265ReferenceListsInfoEXT::safe_VkVideoEncodeH265ReferenceList
     pReferenceModifications = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceList0EntryCount && copy_src.pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src.pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src.pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src.pReferenceList1Entries[i]);
         }
     }
     if (copy_src.pReferenceModifications) {
-        pReferenceModifications = new StdVideoEncodeH265ReferenceModifications(*copy_src.pReferenceModifications);
+        pReferenceModifications = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceModifications(*copy_src.pReferenceModifications);
     }
 }
 
@@ -32267,19 +32373,19 @@ safe_VkVideoEncodeH265ReferenceListsInfoEXT& safe_VkVideoEncodeH265ReferenceList
     pReferenceModifications = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (referenceList0EntryCount && copy_src.pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src.pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src.pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src.pReferenceList1Entries[i]);
         }
     }
     if (copy_src.pReferenceModifications) {
-        pReferenceModifications = new StdVideoEncodeH265ReferenceModifications(*copy_src.pReferenceModifications);
+        pReferenceModifications = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceModifications(*copy_src.pReferenceModifications);
     }
 
     return *this;
@@ -32315,19 +32421,19 @@ void safe_VkVideoEncodeH265ReferenceListsInfoEXT::initialize(const VkVideoEncode
     pReferenceModifications = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (referenceList0EntryCount && in_struct->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&in_struct->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && in_struct->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&in_struct->pReferenceList1Entries[i]);
         }
     }
     if (in_struct->pReferenceModifications) {
-        pReferenceModifications = new StdVideoEncodeH265ReferenceModifications(*in_struct->pReferenceModifications);
+        pReferenceModifications = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceModifications(*in_struct->pReferenceModifications);
     }
 }
 
@@ -32341,19 +32447,19 @@ void safe_VkVideoEncodeH265ReferenceListsInfoEXT::initialize(const safe_VkVideoE
     pReferenceModifications = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (referenceList0EntryCount && copy_src->pReferenceList0Entries) {
-        pReferenceList0Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
+        pReferenceList0Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList0EntryCount];
         for (uint32_t i = 0; i < referenceList0EntryCount; ++i) {
             pReferenceList0Entries[i].initialize(&copy_src->pReferenceList0Entries[i]);
         }
     }
     if (referenceList1EntryCount && copy_src->pReferenceList1Entries) {
-        pReferenceList1Entries = new safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
+        pReferenceList1Entries = new (kSafeStructAlloc) safe_VkVideoEncodeH265DpbSlotInfoEXT[referenceList1EntryCount];
         for (uint32_t i = 0; i < referenceList1EntryCount; ++i) {
             pReferenceList1Entries[i].initialize(&copy_src->pReferenceList1Entries[i]);
         }
     }
     if (copy_src->pReferenceModifications) {
-        pReferenceModifications = new StdVideoEncodeH265ReferenceModifications(*copy_src->pReferenceModifications);
+        pReferenceModifications = new (kSafeStructAlloc) StdVideoEncodeH265ReferenceModifications(*copy_src->pReferenceModifications);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -32369,9 +32475,9 @@ safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT::safe_VkVideoEncodeH265NaluSliceSe
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (in_struct->pSliceSegmentHeaderStd) {
-        pSliceSegmentHeaderStd = new StdVideoEncodeH265SliceSegmentHeader(*in_struct->pSliceSegmentHeaderStd);
+        pSliceSegmentHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH265SliceSegmentHeader(*in_struct->pSliceSegmentHeaderStd);
     }
 }
 
@@ -32391,9 +32497,9 @@ safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT::safe_VkVideoEncodeH265NaluSliceSe
     pSliceSegmentHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (copy_src.pSliceSegmentHeaderStd) {
-        pSliceSegmentHeaderStd = new StdVideoEncodeH265SliceSegmentHeader(*copy_src.pSliceSegmentHeaderStd);
+        pSliceSegmentHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH265SliceSegmentHeader(*copy_src.pSliceSegmentHeaderStd);
     }
 }
 
@@ -32414,9 +32520,9 @@ safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT& safe_VkVideoEncodeH265NaluSliceSe
     pSliceSegmentHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (copy_src.pSliceSegmentHeaderStd) {
-        pSliceSegmentHeaderStd = new StdVideoEncodeH265SliceSegmentHeader(*copy_src.pSliceSegmentHeaderStd);
+        pSliceSegmentHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH265SliceSegmentHeader(*copy_src.pSliceSegmentHeaderStd);
     }
 
     return *this;
@@ -32446,9 +32552,9 @@ void safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT::initialize(const VkVideoEnco
     pSliceSegmentHeaderStd = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (in_struct->pSliceSegmentHeaderStd) {
-        pSliceSegmentHeaderStd = new StdVideoEncodeH265SliceSegmentHeader(*in_struct->pSliceSegmentHeaderStd);
+        pSliceSegmentHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH265SliceSegmentHeader(*in_struct->pSliceSegmentHeaderStd);
     }
 }
 
@@ -32460,9 +32566,9 @@ void safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT::initialize(const safe_VkVide
     pSliceSegmentHeaderStd = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
     if (copy_src->pSliceSegmentHeaderStd) {
-        pSliceSegmentHeaderStd = new StdVideoEncodeH265SliceSegmentHeader(*copy_src->pSliceSegmentHeaderStd);
+        pSliceSegmentHeaderStd = new (kSafeStructAlloc) StdVideoEncodeH265SliceSegmentHeader(*copy_src->pSliceSegmentHeaderStd);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -32479,15 +32585,15 @@ safe_VkVideoEncodeH265VclFrameInfoEXT::safe_VkVideoEncodeH265VclFrameInfoEXT(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (naluSliceSegmentEntryCount && in_struct->pNaluSliceSegmentEntries) {
-        pNaluSliceSegmentEntries = new safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
+        pNaluSliceSegmentEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
         for (uint32_t i = 0; i < naluSliceSegmentEntryCount; ++i) {
             pNaluSliceSegmentEntries[i].initialize(&in_struct->pNaluSliceSegmentEntries[i]);
         }
     }
     if (in_struct->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH265PictureInfo(*in_struct->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH265PictureInfo(*in_struct->pCurrentPictureInfo);
     }
 }
 
@@ -32509,15 +32615,15 @@ safe_VkVideoEncodeH265VclFrameInfoEXT::safe_VkVideoEncodeH265VclFrameInfoEXT(con
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (naluSliceSegmentEntryCount && copy_src.pNaluSliceSegmentEntries) {
-        pNaluSliceSegmentEntries = new safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
+        pNaluSliceSegmentEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
         for (uint32_t i = 0; i < naluSliceSegmentEntryCount; ++i) {
             pNaluSliceSegmentEntries[i].initialize(&copy_src.pNaluSliceSegmentEntries[i]);
         }
     }
     if (copy_src.pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH265PictureInfo(*copy_src.pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH265PictureInfo(*copy_src.pCurrentPictureInfo);
     }
 }
 
@@ -32541,15 +32647,15 @@ safe_VkVideoEncodeH265VclFrameInfoEXT& safe_VkVideoEncodeH265VclFrameInfoEXT::op
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src.pReferenceFinalLists);
     if (naluSliceSegmentEntryCount && copy_src.pNaluSliceSegmentEntries) {
-        pNaluSliceSegmentEntries = new safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
+        pNaluSliceSegmentEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
         for (uint32_t i = 0; i < naluSliceSegmentEntryCount; ++i) {
             pNaluSliceSegmentEntries[i].initialize(&copy_src.pNaluSliceSegmentEntries[i]);
         }
     }
     if (copy_src.pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH265PictureInfo(*copy_src.pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH265PictureInfo(*copy_src.pCurrentPictureInfo);
     }
 
     return *this;
@@ -32584,15 +32690,15 @@ void safe_VkVideoEncodeH265VclFrameInfoEXT::initialize(const VkVideoEncodeH265Vc
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(in_struct->pReferenceFinalLists);
     if (naluSliceSegmentEntryCount && in_struct->pNaluSliceSegmentEntries) {
-        pNaluSliceSegmentEntries = new safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
+        pNaluSliceSegmentEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
         for (uint32_t i = 0; i < naluSliceSegmentEntryCount; ++i) {
             pNaluSliceSegmentEntries[i].initialize(&in_struct->pNaluSliceSegmentEntries[i]);
         }
     }
     if (in_struct->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH265PictureInfo(*in_struct->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH265PictureInfo(*in_struct->pCurrentPictureInfo);
     }
 }
 
@@ -32605,15 +32711,15 @@ void safe_VkVideoEncodeH265VclFrameInfoEXT::initialize(const safe_VkVideoEncodeH
     pCurrentPictureInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pReferenceFinalLists)
-        pReferenceFinalLists = new safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
+        pReferenceFinalLists = new (kSafeStructAlloc) safe_VkVideoEncodeH265ReferenceListsInfoEXT(*copy_src->pReferenceFinalLists);
     if (naluSliceSegmentEntryCount && copy_src->pNaluSliceSegmentEntries) {
-        pNaluSliceSegmentEntries = new safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
+        pNaluSliceSegmentEntries = new (kSafeStructAlloc) safe_VkVideoEncodeH265NaluSliceSegmentInfoEXT[naluSliceSegmentEntryCount];
         for (uint32_t i = 0; i < naluSliceSegmentEntryCount; ++i) {
             pNaluSliceSegmentEntries[i].initialize(&copy_src->pNaluSliceSegmentEntries[i]);
         }
     }
     if (copy_src->pCurrentPictureInfo) {
-        pCurrentPictureInfo = new StdVideoEncodeH265PictureInfo(*copy_src->pCurrentPictureInfo);
+        pCurrentPictureInfo = new (kSafeStructAlloc) StdVideoEncodeH265PictureInfo(*copy_src->pCurrentPictureInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -32632,7 +32738,7 @@ safe_VkVideoEncodeH265EmitPictureParametersInfoEXT::safe_VkVideoEncodeH265EmitPi
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[in_struct->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[in_struct->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)in_struct->ppsIdEntries, sizeof(uint8_t)*in_struct->ppsIdEntryCount);
     }
 }
@@ -32659,7 +32765,7 @@ safe_VkVideoEncodeH265EmitPictureParametersInfoEXT::safe_VkVideoEncodeH265EmitPi
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src.ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src.ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src.ppsIdEntries, sizeof(uint8_t)*copy_src.ppsIdEntryCount);
     }
 }
@@ -32682,7 +32788,7 @@ safe_VkVideoEncodeH265EmitPictureParametersInfoEXT& safe_VkVideoEncodeH265EmitPi
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src.ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src.ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src.ppsIdEntries, sizeof(uint8_t)*copy_src.ppsIdEntryCount);
     }
 
@@ -32712,7 +32818,7 @@ void safe_VkVideoEncodeH265EmitPictureParametersInfoEXT::initialize(const VkVide
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[in_struct->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[in_struct->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)in_struct->ppsIdEntries, sizeof(uint8_t)*in_struct->ppsIdEntryCount);
     }
 }
@@ -32728,7 +32834,7 @@ void safe_VkVideoEncodeH265EmitPictureParametersInfoEXT::initialize(const safe_V
     ppsIdEntries = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->ppsIdEntries) {
-        ppsIdEntries = new uint8_t[copy_src->ppsIdEntryCount];
+        ppsIdEntries = new (kSafeStructAlloc) uint8_t[copy_src->ppsIdEntryCount];
         memcpy ((void *)ppsIdEntries, (void *)copy_src->ppsIdEntries, sizeof(uint8_t)*copy_src->ppsIdEntryCount);
     }
 }
@@ -33130,11 +33236,11 @@ safe_VkVideoDecodeH264SessionParametersAddInfoEXT::safe_VkVideoDecodeH264Session
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -33157,11 +33263,11 @@ safe_VkVideoDecodeH264SessionParametersAddInfoEXT::safe_VkVideoDecodeH264Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src.stdPPSCount);
     }
 }
@@ -33184,11 +33290,11 @@ safe_VkVideoDecodeH264SessionParametersAddInfoEXT& safe_VkVideoDecodeH264Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src.stdPPSCount);
     }
 
@@ -33220,11 +33326,11 @@ void safe_VkVideoDecodeH264SessionParametersAddInfoEXT::initialize(const VkVideo
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -33238,11 +33344,11 @@ void safe_VkVideoDecodeH264SessionParametersAddInfoEXT::initialize(const safe_Vk
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdSPSs) {
-        pStdSPSs = new StdVideoH264SequenceParameterSet[copy_src->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH264SequenceParameterSet[copy_src->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src->pStdSPSs, sizeof(StdVideoH264SequenceParameterSet)*copy_src->stdSPSCount);
     }
     if (copy_src->pStdPPSs) {
-        pStdPPSs = new StdVideoH264PictureParameterSet[copy_src->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH264PictureParameterSet[copy_src->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src->pStdPPSs, sizeof(StdVideoH264PictureParameterSet)*copy_src->stdPPSCount);
     }
 }
@@ -33259,7 +33365,7 @@ safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::safe_VkVideoDecodeH264Sess
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::safe_VkVideoDecodeH264SessionParametersCreateInfoEXT() :
@@ -33278,7 +33384,7 @@ safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::safe_VkVideoDecodeH264Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 }
 
 safe_VkVideoDecodeH264SessionParametersCreateInfoEXT& safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::operator=(const safe_VkVideoDecodeH264SessionParametersCreateInfoEXT& copy_src)
@@ -33296,7 +33402,7 @@ safe_VkVideoDecodeH264SessionParametersCreateInfoEXT& safe_VkVideoDecodeH264Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 
     return *this;
 }
@@ -33321,7 +33427,7 @@ void safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::initialize(const VkVi
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 void safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::initialize(const safe_VkVideoDecodeH264SessionParametersCreateInfoEXT* copy_src)
@@ -33332,7 +33438,7 @@ void safe_VkVideoDecodeH264SessionParametersCreateInfoEXT::initialize(const safe
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -33347,10 +33453,10 @@ safe_VkVideoDecodeH264PictureInfoEXT::safe_VkVideoDecodeH264PictureInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH264PictureInfo(*in_struct->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH264PictureInfo(*in_struct->pStdPictureInfo);
     }
     if (in_struct->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[in_struct->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[in_struct->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)in_struct->pSliceOffsets, sizeof(uint32_t)*in_struct->sliceCount);
     }
 }
@@ -33371,10 +33477,10 @@ safe_VkVideoDecodeH264PictureInfoEXT::safe_VkVideoDecodeH264PictureInfoEXT(const
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH264PictureInfo(*copy_src.pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH264PictureInfo(*copy_src.pStdPictureInfo);
     }
     if (copy_src.pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src.sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src.sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src.pSliceOffsets, sizeof(uint32_t)*copy_src.sliceCount);
     }
 }
@@ -33396,10 +33502,10 @@ safe_VkVideoDecodeH264PictureInfoEXT& safe_VkVideoDecodeH264PictureInfoEXT::oper
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH264PictureInfo(*copy_src.pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH264PictureInfo(*copy_src.pStdPictureInfo);
     }
     if (copy_src.pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src.sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src.sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src.pSliceOffsets, sizeof(uint32_t)*copy_src.sliceCount);
     }
 
@@ -33430,10 +33536,10 @@ void safe_VkVideoDecodeH264PictureInfoEXT::initialize(const VkVideoDecodeH264Pic
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH264PictureInfo(*in_struct->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH264PictureInfo(*in_struct->pStdPictureInfo);
     }
     if (in_struct->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[in_struct->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[in_struct->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)in_struct->pSliceOffsets, sizeof(uint32_t)*in_struct->sliceCount);
     }
 }
@@ -33446,10 +33552,10 @@ void safe_VkVideoDecodeH264PictureInfoEXT::initialize(const safe_VkVideoDecodeH2
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH264PictureInfo(*copy_src->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH264PictureInfo(*copy_src->pStdPictureInfo);
     }
     if (copy_src->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src->pSliceOffsets, sizeof(uint32_t)*copy_src->sliceCount);
     }
 }
@@ -33464,7 +33570,7 @@ safe_VkVideoDecodeH264DpbSlotInfoEXT::safe_VkVideoDecodeH264DpbSlotInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -33480,7 +33586,7 @@ safe_VkVideoDecodeH264DpbSlotInfoEXT::safe_VkVideoDecodeH264DpbSlotInfoEXT(const
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 }
 
@@ -33497,7 +33603,7 @@ safe_VkVideoDecodeH264DpbSlotInfoEXT& safe_VkVideoDecodeH264DpbSlotInfoEXT::oper
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH264ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 
     return *this;
@@ -33521,7 +33627,7 @@ void safe_VkVideoDecodeH264DpbSlotInfoEXT::initialize(const VkVideoDecodeH264Dpb
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH264ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -33531,7 +33637,7 @@ void safe_VkVideoDecodeH264DpbSlotInfoEXT::initialize(const safe_VkVideoDecodeH2
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH264ReferenceInfo(*copy_src->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH264ReferenceInfo(*copy_src->pStdReferenceInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -33902,7 +34008,7 @@ safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -33920,7 +34026,7 @@ safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(const
     dwAccess = copy_src.dwAccess;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 }
 
@@ -33938,7 +34044,7 @@ safe_VkExportMemoryWin32HandleInfoNV& safe_VkExportMemoryWin32HandleInfoNV::oper
     dwAccess = copy_src.dwAccess;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src.pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src.pAttributes);
     }
 
     return *this;
@@ -33963,7 +34069,7 @@ void safe_VkExportMemoryWin32HandleInfoNV::initialize(const VkExportMemoryWin32H
     dwAccess = in_struct->dwAccess;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*in_struct->pAttributes);
     }
 }
 
@@ -33974,7 +34080,7 @@ void safe_VkExportMemoryWin32HandleInfoNV::initialize(const safe_VkExportMemoryW
     dwAccess = copy_src->dwAccess;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*copy_src->pAttributes);
+        pAttributes = new (kSafeStructAlloc) SECURITY_ATTRIBUTES(*copy_src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -33994,27 +34100,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireRelease
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
         }
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeoutMilliseconds = new (kSafeStructAlloc) uint32_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)in_struct->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
         }
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[in_struct->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -34043,27 +34149,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireRelease
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (acquireCount && copy_src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src.pAcquireSyncs[i];
         }
     }
     if (copy_src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src.acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src.pAcquireKeys, sizeof(uint64_t)*copy_src.acquireCount);
     }
     if (copy_src.pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[copy_src.acquireCount];
+        pAcquireTimeoutMilliseconds = new (kSafeStructAlloc) uint32_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)copy_src.pAcquireTimeoutMilliseconds, sizeof(uint32_t)*copy_src.acquireCount);
     }
     if (releaseCount && copy_src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src.pReleaseSyncs[i];
         }
     }
     if (copy_src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src.releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src.releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src.pReleaseKeys, sizeof(uint64_t)*copy_src.releaseCount);
     }
 }
@@ -34095,27 +34201,27 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireRelease
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (acquireCount && copy_src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src.pAcquireSyncs[i];
         }
     }
     if (copy_src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src.acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src.pAcquireKeys, sizeof(uint64_t)*copy_src.acquireCount);
     }
     if (copy_src.pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[copy_src.acquireCount];
+        pAcquireTimeoutMilliseconds = new (kSafeStructAlloc) uint32_t[copy_src.acquireCount];
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)copy_src.pAcquireTimeoutMilliseconds, sizeof(uint32_t)*copy_src.acquireCount);
     }
     if (releaseCount && copy_src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src.pReleaseSyncs[i];
         }
     }
     if (copy_src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src.releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src.releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src.pReleaseKeys, sizeof(uint64_t)*copy_src.releaseCount);
     }
 
@@ -34162,27 +34268,27 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoNV::initialize(const VkWin32KeyedMu
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
         }
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeoutMilliseconds = new (kSafeStructAlloc) uint32_t[in_struct->acquireCount];
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)in_struct->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
         }
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[in_struct->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -34199,27 +34305,27 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoNV::initialize(const safe_VkWin32Ke
     pReleaseKeys = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (acquireCount && copy_src->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
+        pAcquireSyncs = new (kSafeStructAlloc) VkDeviceMemory[acquireCount];
         for (uint32_t i = 0; i < acquireCount; ++i) {
             pAcquireSyncs[i] = copy_src->pAcquireSyncs[i];
         }
     }
     if (copy_src->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[copy_src->acquireCount];
+        pAcquireKeys = new (kSafeStructAlloc) uint64_t[copy_src->acquireCount];
         memcpy ((void *)pAcquireKeys, (void *)copy_src->pAcquireKeys, sizeof(uint64_t)*copy_src->acquireCount);
     }
     if (copy_src->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[copy_src->acquireCount];
+        pAcquireTimeoutMilliseconds = new (kSafeStructAlloc) uint32_t[copy_src->acquireCount];
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)copy_src->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*copy_src->acquireCount);
     }
     if (releaseCount && copy_src->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
+        pReleaseSyncs = new (kSafeStructAlloc) VkDeviceMemory[releaseCount];
         for (uint32_t i = 0; i < releaseCount; ++i) {
             pReleaseSyncs[i] = copy_src->pReleaseSyncs[i];
         }
     }
     if (copy_src->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[copy_src->releaseCount];
+        pReleaseKeys = new (kSafeStructAlloc) uint64_t[copy_src->releaseCount];
         memcpy ((void *)pReleaseKeys, (void *)copy_src->pReleaseKeys, sizeof(uint64_t)*copy_src->releaseCount);
     }
 }
@@ -34233,7 +34339,7 @@ safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(const VkValidationFlagsEXT*
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
+        pDisabledValidationChecks = new (kSafeStructAlloc) VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
         memcpy ((void *)pDisabledValidationChecks, (void *)in_struct->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*in_struct->disabledValidationCheckCount);
     }
 }
@@ -34252,7 +34358,7 @@ safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(const safe_VkValidationFlag
     pDisabledValidationChecks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[copy_src.disabledValidationCheckCount];
+        pDisabledValidationChecks = new (kSafeStructAlloc) VkValidationCheckEXT[copy_src.disabledValidationCheckCount];
         memcpy ((void *)pDisabledValidationChecks, (void *)copy_src.pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*copy_src.disabledValidationCheckCount);
     }
 }
@@ -34271,7 +34377,7 @@ safe_VkValidationFlagsEXT& safe_VkValidationFlagsEXT::operator=(const safe_VkVal
     pDisabledValidationChecks = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[copy_src.disabledValidationCheckCount];
+        pDisabledValidationChecks = new (kSafeStructAlloc) VkValidationCheckEXT[copy_src.disabledValidationCheckCount];
         memcpy ((void *)pDisabledValidationChecks, (void *)copy_src.pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*copy_src.disabledValidationCheckCount);
     }
 
@@ -34297,7 +34403,7 @@ void safe_VkValidationFlagsEXT::initialize(const VkValidationFlagsEXT* in_struct
     pDisabledValidationChecks = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
+        pDisabledValidationChecks = new (kSafeStructAlloc) VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
         memcpy ((void *)pDisabledValidationChecks, (void *)in_struct->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*in_struct->disabledValidationCheckCount);
     }
 }
@@ -34309,7 +34415,7 @@ void safe_VkValidationFlagsEXT::initialize(const safe_VkValidationFlagsEXT* copy
     pDisabledValidationChecks = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[copy_src->disabledValidationCheckCount];
+        pDisabledValidationChecks = new (kSafeStructAlloc) VkValidationCheckEXT[copy_src->disabledValidationCheckCount];
         memcpy ((void *)pDisabledValidationChecks, (void *)copy_src->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*copy_src->disabledValidationCheckCount);
     }
 }
@@ -34890,7 +34996,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalin
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[in_struct->viewportCount];
+        pViewportWScalings = new (kSafeStructAlloc) VkViewportWScalingNV[in_struct->viewportCount];
         memcpy ((void *)pViewportWScalings, (void *)in_struct->pViewportWScalings, sizeof(VkViewportWScalingNV)*in_struct->viewportCount);
     }
 }
@@ -34911,7 +35017,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalin
     pViewportWScalings = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[copy_src.viewportCount];
+        pViewportWScalings = new (kSafeStructAlloc) VkViewportWScalingNV[copy_src.viewportCount];
         memcpy ((void *)pViewportWScalings, (void *)copy_src.pViewportWScalings, sizeof(VkViewportWScalingNV)*copy_src.viewportCount);
     }
 }
@@ -34931,7 +35037,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalin
     pViewportWScalings = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[copy_src.viewportCount];
+        pViewportWScalings = new (kSafeStructAlloc) VkViewportWScalingNV[copy_src.viewportCount];
         memcpy ((void *)pViewportWScalings, (void *)copy_src.pViewportWScalings, sizeof(VkViewportWScalingNV)*copy_src.viewportCount);
     }
 
@@ -34958,7 +35064,7 @@ void safe_VkPipelineViewportWScalingStateCreateInfoNV::initialize(const VkPipeli
     pViewportWScalings = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[in_struct->viewportCount];
+        pViewportWScalings = new (kSafeStructAlloc) VkViewportWScalingNV[in_struct->viewportCount];
         memcpy ((void *)pViewportWScalings, (void *)in_struct->pViewportWScalings, sizeof(VkViewportWScalingNV)*in_struct->viewportCount);
     }
 }
@@ -34971,7 +35077,7 @@ void safe_VkPipelineViewportWScalingStateCreateInfoNV::initialize(const safe_VkP
     pViewportWScalings = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[copy_src->viewportCount];
+        pViewportWScalings = new (kSafeStructAlloc) VkViewportWScalingNV[copy_src->viewportCount];
         memcpy ((void *)pViewportWScalings, (void *)copy_src->pViewportWScalings, sizeof(VkViewportWScalingNV)*copy_src->viewportCount);
     }
 }
@@ -35323,7 +35429,7 @@ safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(const VkPresentTime
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[in_struct->swapchainCount];
+        pTimes = new (kSafeStructAlloc) VkPresentTimeGOOGLE[in_struct->swapchainCount];
         memcpy ((void *)pTimes, (void *)in_struct->pTimes, sizeof(VkPresentTimeGOOGLE)*in_struct->swapchainCount);
     }
 }
@@ -35342,7 +35448,7 @@ safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(const safe_VkPresen
     pTimes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[copy_src.swapchainCount];
+        pTimes = new (kSafeStructAlloc) VkPresentTimeGOOGLE[copy_src.swapchainCount];
         memcpy ((void *)pTimes, (void *)copy_src.pTimes, sizeof(VkPresentTimeGOOGLE)*copy_src.swapchainCount);
     }
 }
@@ -35361,7 +35467,7 @@ safe_VkPresentTimesInfoGOOGLE& safe_VkPresentTimesInfoGOOGLE::operator=(const sa
     pTimes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[copy_src.swapchainCount];
+        pTimes = new (kSafeStructAlloc) VkPresentTimeGOOGLE[copy_src.swapchainCount];
         memcpy ((void *)pTimes, (void *)copy_src.pTimes, sizeof(VkPresentTimeGOOGLE)*copy_src.swapchainCount);
     }
 
@@ -35387,7 +35493,7 @@ void safe_VkPresentTimesInfoGOOGLE::initialize(const VkPresentTimesInfoGOOGLE* i
     pTimes = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[in_struct->swapchainCount];
+        pTimes = new (kSafeStructAlloc) VkPresentTimeGOOGLE[in_struct->swapchainCount];
         memcpy ((void *)pTimes, (void *)in_struct->pTimes, sizeof(VkPresentTimeGOOGLE)*in_struct->swapchainCount);
     }
 }
@@ -35399,7 +35505,7 @@ void safe_VkPresentTimesInfoGOOGLE::initialize(const safe_VkPresentTimesInfoGOOG
     pTimes = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[copy_src->swapchainCount];
+        pTimes = new (kSafeStructAlloc) VkPresentTimeGOOGLE[copy_src->swapchainCount];
         memcpy ((void *)pTimes, (void *)copy_src->pTimes, sizeof(VkPresentTimeGOOGLE)*copy_src->swapchainCount);
     }
 }
@@ -35468,7 +35574,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleS
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[in_struct->viewportCount];
+        pViewportSwizzles = new (kSafeStructAlloc) VkViewportSwizzleNV[in_struct->viewportCount];
         memcpy ((void *)pViewportSwizzles, (void *)in_struct->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*in_struct->viewportCount);
     }
 }
@@ -35489,7 +35595,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleS
     pViewportSwizzles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[copy_src.viewportCount];
+        pViewportSwizzles = new (kSafeStructAlloc) VkViewportSwizzleNV[copy_src.viewportCount];
         memcpy ((void *)pViewportSwizzles, (void *)copy_src.pViewportSwizzles, sizeof(VkViewportSwizzleNV)*copy_src.viewportCount);
     }
 }
@@ -35509,7 +35615,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleS
     pViewportSwizzles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[copy_src.viewportCount];
+        pViewportSwizzles = new (kSafeStructAlloc) VkViewportSwizzleNV[copy_src.viewportCount];
         memcpy ((void *)pViewportSwizzles, (void *)copy_src.pViewportSwizzles, sizeof(VkViewportSwizzleNV)*copy_src.viewportCount);
     }
 
@@ -35536,7 +35642,7 @@ void safe_VkPipelineViewportSwizzleStateCreateInfoNV::initialize(const VkPipelin
     pViewportSwizzles = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[in_struct->viewportCount];
+        pViewportSwizzles = new (kSafeStructAlloc) VkViewportSwizzleNV[in_struct->viewportCount];
         memcpy ((void *)pViewportSwizzles, (void *)in_struct->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*in_struct->viewportCount);
     }
 }
@@ -35549,7 +35655,7 @@ void safe_VkPipelineViewportSwizzleStateCreateInfoNV::initialize(const safe_VkPi
     pViewportSwizzles = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[copy_src->viewportCount];
+        pViewportSwizzles = new (kSafeStructAlloc) VkViewportSwizzleNV[copy_src->viewportCount];
         memcpy ((void *)pViewportSwizzles, (void *)copy_src->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*copy_src->viewportCount);
     }
 }
@@ -35619,7 +35725,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectang
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[in_struct->discardRectangleCount];
+        pDiscardRectangles = new (kSafeStructAlloc) VkRect2D[in_struct->discardRectangleCount];
         memcpy ((void *)pDiscardRectangles, (void *)in_struct->pDiscardRectangles, sizeof(VkRect2D)*in_struct->discardRectangleCount);
     }
 }
@@ -35642,7 +35748,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectang
     pDiscardRectangles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[copy_src.discardRectangleCount];
+        pDiscardRectangles = new (kSafeStructAlloc) VkRect2D[copy_src.discardRectangleCount];
         memcpy ((void *)pDiscardRectangles, (void *)copy_src.pDiscardRectangles, sizeof(VkRect2D)*copy_src.discardRectangleCount);
     }
 }
@@ -35663,7 +35769,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectang
     pDiscardRectangles = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[copy_src.discardRectangleCount];
+        pDiscardRectangles = new (kSafeStructAlloc) VkRect2D[copy_src.discardRectangleCount];
         memcpy ((void *)pDiscardRectangles, (void *)copy_src.pDiscardRectangles, sizeof(VkRect2D)*copy_src.discardRectangleCount);
     }
 
@@ -35691,7 +35797,7 @@ void safe_VkPipelineDiscardRectangleStateCreateInfoEXT::initialize(const VkPipel
     pDiscardRectangles = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[in_struct->discardRectangleCount];
+        pDiscardRectangles = new (kSafeStructAlloc) VkRect2D[in_struct->discardRectangleCount];
         memcpy ((void *)pDiscardRectangles, (void *)in_struct->pDiscardRectangles, sizeof(VkRect2D)*in_struct->discardRectangleCount);
     }
 }
@@ -35705,7 +35811,7 @@ void safe_VkPipelineDiscardRectangleStateCreateInfoEXT::initialize(const safe_Vk
     pDiscardRectangles = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[copy_src->discardRectangleCount];
+        pDiscardRectangles = new (kSafeStructAlloc) VkRect2D[copy_src->discardRectangleCount];
         memcpy ((void *)pDiscardRectangles, (void *)copy_src->pDiscardRectangles, sizeof(VkRect2D)*copy_src->discardRectangleCount);
     }
 }
@@ -36258,19 +36364,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDat
     pMessageIdName = SafeStringCopy(in_struct->pMessageIdName);
     pMessage = SafeStringCopy(in_struct->pMessage);
     if (queueLabelCount && in_struct->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[queueLabelCount];
         for (uint32_t i = 0; i < queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&in_struct->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && in_struct->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
         for (uint32_t i = 0; i < cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&in_struct->pCmdBufLabels[i]);
         }
     }
     if (objectCount && in_struct->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
         for (uint32_t i = 0; i < objectCount; ++i) {
             pObjects[i].initialize(&in_struct->pObjects[i]);
         }
@@ -36307,19 +36413,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDat
     pMessageIdName = SafeStringCopy(copy_src.pMessageIdName);
     pMessage = SafeStringCopy(copy_src.pMessage);
     if (queueLabelCount && copy_src.pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[queueLabelCount];
         for (uint32_t i = 0; i < queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&copy_src.pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && copy_src.pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
         for (uint32_t i = 0; i < cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&copy_src.pCmdBufLabels[i]);
         }
     }
     if (objectCount && copy_src.pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
         for (uint32_t i = 0; i < objectCount; ++i) {
             pObjects[i].initialize(&copy_src.pObjects[i]);
         }
@@ -36354,19 +36460,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDat
     pMessageIdName = SafeStringCopy(copy_src.pMessageIdName);
     pMessage = SafeStringCopy(copy_src.pMessage);
     if (queueLabelCount && copy_src.pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[queueLabelCount];
         for (uint32_t i = 0; i < queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&copy_src.pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && copy_src.pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
         for (uint32_t i = 0; i < cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&copy_src.pCmdBufLabels[i]);
         }
     }
     if (objectCount && copy_src.pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
         for (uint32_t i = 0; i < objectCount; ++i) {
             pObjects[i].initialize(&copy_src.pObjects[i]);
         }
@@ -36414,19 +36520,19 @@ void safe_VkDebugUtilsMessengerCallbackDataEXT::initialize(const VkDebugUtilsMes
     pMessageIdName = SafeStringCopy(in_struct->pMessageIdName);
     pMessage = SafeStringCopy(in_struct->pMessage);
     if (queueLabelCount && in_struct->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[queueLabelCount];
         for (uint32_t i = 0; i < queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&in_struct->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && in_struct->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
         for (uint32_t i = 0; i < cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&in_struct->pCmdBufLabels[i]);
         }
     }
     if (objectCount && in_struct->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
         for (uint32_t i = 0; i < objectCount; ++i) {
             pObjects[i].initialize(&in_struct->pObjects[i]);
         }
@@ -36448,19 +36554,19 @@ void safe_VkDebugUtilsMessengerCallbackDataEXT::initialize(const safe_VkDebugUti
     pMessageIdName = SafeStringCopy(copy_src->pMessageIdName);
     pMessage = SafeStringCopy(copy_src->pMessage);
     if (queueLabelCount && copy_src->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[queueLabelCount];
         for (uint32_t i = 0; i < queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&copy_src->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && copy_src->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = new (kSafeStructAlloc) safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
         for (uint32_t i = 0; i < cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&copy_src->pCmdBufLabels[i]);
         }
     }
     if (objectCount && copy_src->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
         for (uint32_t i = 0; i < objectCount; ++i) {
             pObjects[i].initialize(&copy_src->pObjects[i]);
         }
@@ -37147,7 +37253,7 @@ safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(const VkSampleLocat
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[in_struct->sampleLocationsCount];
+        pSampleLocations = new (kSafeStructAlloc) VkSampleLocationEXT[in_struct->sampleLocationsCount];
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkSampleLocationEXT)*in_struct->sampleLocationsCount);
     }
 }
@@ -37170,7 +37276,7 @@ safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(const safe_VkSample
     pSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[copy_src.sampleLocationsCount];
+        pSampleLocations = new (kSafeStructAlloc) VkSampleLocationEXT[copy_src.sampleLocationsCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src.pSampleLocations, sizeof(VkSampleLocationEXT)*copy_src.sampleLocationsCount);
     }
 }
@@ -37191,7 +37297,7 @@ safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(const sa
     pSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[copy_src.sampleLocationsCount];
+        pSampleLocations = new (kSafeStructAlloc) VkSampleLocationEXT[copy_src.sampleLocationsCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src.pSampleLocations, sizeof(VkSampleLocationEXT)*copy_src.sampleLocationsCount);
     }
 
@@ -37219,7 +37325,7 @@ void safe_VkSampleLocationsInfoEXT::initialize(const VkSampleLocationsInfoEXT* i
     pSampleLocations = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[in_struct->sampleLocationsCount];
+        pSampleLocations = new (kSafeStructAlloc) VkSampleLocationEXT[in_struct->sampleLocationsCount];
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkSampleLocationEXT)*in_struct->sampleLocationsCount);
     }
 }
@@ -37233,7 +37339,7 @@ void safe_VkSampleLocationsInfoEXT::initialize(const safe_VkSampleLocationsInfoE
     pSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[copy_src->sampleLocationsCount];
+        pSampleLocations = new (kSafeStructAlloc) VkSampleLocationEXT[copy_src->sampleLocationsCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src->pSampleLocations, sizeof(VkSampleLocationEXT)*copy_src->sampleLocationsCount);
     }
 }
@@ -37247,11 +37353,11 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBe
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = new (kSafeStructAlloc) VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)in_struct->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*in_struct->attachmentInitialSampleLocationsCount);
     }
     if (in_struct->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = new (kSafeStructAlloc) VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
         memcpy ((void *)pPostSubpassSampleLocations, (void *)in_struct->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*in_struct->postSubpassSampleLocationsCount);
     }
 }
@@ -37274,11 +37380,11 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBe
     pPostSubpassSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[copy_src.attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = new (kSafeStructAlloc) VkAttachmentSampleLocationsEXT[copy_src.attachmentInitialSampleLocationsCount];
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)copy_src.pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*copy_src.attachmentInitialSampleLocationsCount);
     }
     if (copy_src.pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[copy_src.postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = new (kSafeStructAlloc) VkSubpassSampleLocationsEXT[copy_src.postSubpassSampleLocationsCount];
         memcpy ((void *)pPostSubpassSampleLocations, (void *)copy_src.pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*copy_src.postSubpassSampleLocationsCount);
     }
 }
@@ -37301,11 +37407,11 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBe
     pPostSubpassSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[copy_src.attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = new (kSafeStructAlloc) VkAttachmentSampleLocationsEXT[copy_src.attachmentInitialSampleLocationsCount];
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)copy_src.pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*copy_src.attachmentInitialSampleLocationsCount);
     }
     if (copy_src.pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[copy_src.postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = new (kSafeStructAlloc) VkSubpassSampleLocationsEXT[copy_src.postSubpassSampleLocationsCount];
         memcpy ((void *)pPostSubpassSampleLocations, (void *)copy_src.pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*copy_src.postSubpassSampleLocationsCount);
     }
 
@@ -37337,11 +37443,11 @@ void safe_VkRenderPassSampleLocationsBeginInfoEXT::initialize(const VkRenderPass
     pPostSubpassSampleLocations = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = new (kSafeStructAlloc) VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)in_struct->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*in_struct->attachmentInitialSampleLocationsCount);
     }
     if (in_struct->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = new (kSafeStructAlloc) VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
         memcpy ((void *)pPostSubpassSampleLocations, (void *)in_struct->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*in_struct->postSubpassSampleLocationsCount);
     }
 }
@@ -37355,11 +37461,11 @@ void safe_VkRenderPassSampleLocationsBeginInfoEXT::initialize(const safe_VkRende
     pPostSubpassSampleLocations = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[copy_src->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = new (kSafeStructAlloc) VkAttachmentSampleLocationsEXT[copy_src->attachmentInitialSampleLocationsCount];
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)copy_src->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*copy_src->attachmentInitialSampleLocationsCount);
     }
     if (copy_src->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[copy_src->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = new (kSafeStructAlloc) VkSubpassSampleLocationsEXT[copy_src->postSubpassSampleLocationsCount];
         memcpy ((void *)pPostSubpassSampleLocations, (void *)copy_src->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*copy_src->postSubpassSampleLocationsCount);
     }
 }
@@ -37858,7 +37964,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModul
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[in_struct->coverageModulationTableCount];
+        pCoverageModulationTable = new (kSafeStructAlloc) float[in_struct->coverageModulationTableCount];
         memcpy ((void *)pCoverageModulationTable, (void *)in_struct->pCoverageModulationTable, sizeof(float)*in_struct->coverageModulationTableCount);
     }
 }
@@ -37883,7 +37989,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModul
     pCoverageModulationTable = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCoverageModulationTable) {
-        pCoverageModulationTable = new float[copy_src.coverageModulationTableCount];
+        pCoverageModulationTable = new (kSafeStructAlloc) float[copy_src.coverageModulationTableCount];
         memcpy ((void *)pCoverageModulationTable, (void *)copy_src.pCoverageModulationTable, sizeof(float)*copy_src.coverageModulationTableCount);
     }
 }
@@ -37905,7 +38011,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModul
     pCoverageModulationTable = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pCoverageModulationTable) {
-        pCoverageModulationTable = new float[copy_src.coverageModulationTableCount];
+        pCoverageModulationTable = new (kSafeStructAlloc) float[copy_src.coverageModulationTableCount];
         memcpy ((void *)pCoverageModulationTable, (void *)copy_src.pCoverageModulationTable, sizeof(float)*copy_src.coverageModulationTableCount);
     }
 
@@ -37934,7 +38040,7 @@ void safe_VkPipelineCoverageModulationStateCreateInfoNV::initialize(const VkPipe
     pCoverageModulationTable = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[in_struct->coverageModulationTableCount];
+        pCoverageModulationTable = new (kSafeStructAlloc) float[in_struct->coverageModulationTableCount];
         memcpy ((void *)pCoverageModulationTable, (void *)in_struct->pCoverageModulationTable, sizeof(float)*in_struct->coverageModulationTableCount);
     }
 }
@@ -37949,7 +38055,7 @@ void safe_VkPipelineCoverageModulationStateCreateInfoNV::initialize(const safe_V
     pCoverageModulationTable = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[copy_src->coverageModulationTableCount];
+        pCoverageModulationTable = new (kSafeStructAlloc) float[copy_src->coverageModulationTableCount];
         memcpy ((void *)pCoverageModulationTable, (void *)copy_src->pCoverageModulationTable, sizeof(float)*copy_src->coverageModulationTableCount);
     }
 }
@@ -38079,7 +38185,7 @@ safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesLis
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38098,7 +38204,7 @@ safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesLis
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[copy_src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierPropertiesEXT[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*copy_src.drmFormatModifierCount);
     }
 }
@@ -38117,7 +38223,7 @@ safe_VkDrmFormatModifierPropertiesListEXT& safe_VkDrmFormatModifierPropertiesLis
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[copy_src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierPropertiesEXT[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*copy_src.drmFormatModifierCount);
     }
 
@@ -38143,7 +38249,7 @@ void safe_VkDrmFormatModifierPropertiesListEXT::initialize(const VkDrmFormatModi
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38155,7 +38261,7 @@ void safe_VkDrmFormatModifierPropertiesListEXT::initialize(const safe_VkDrmForma
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[copy_src->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierPropertiesEXT[copy_src->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*copy_src->drmFormatModifierCount);
     }
 }
@@ -38169,7 +38275,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -38194,7 +38300,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDr
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -38217,7 +38323,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDr
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if ((copy_src.sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src.queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src.queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src.pQueueFamilyIndices, sizeof(uint32_t)*copy_src.queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src.queueFamilyIndexCount;
     } else {
@@ -38247,7 +38353,7 @@ void safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::initialize(const VkPhys
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if ((in_struct->sharingMode == VK_SHARING_MODE_CONCURRENT) && in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[in_struct->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
         queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     } else {
@@ -38263,7 +38369,7 @@ void safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::initialize(const safe_V
     pQueueFamilyIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if ((copy_src->sharingMode == VK_SHARING_MODE_CONCURRENT) && copy_src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[copy_src->queueFamilyIndexCount];
+        pQueueFamilyIndices = new (kSafeStructAlloc) uint32_t[copy_src->queueFamilyIndexCount];
         memcpy ((void *)pQueueFamilyIndices, (void *)copy_src->pQueueFamilyIndices, sizeof(uint32_t)*copy_src->queueFamilyIndexCount);
         queueFamilyIndexCount = copy_src->queueFamilyIndexCount;
     } else {
@@ -38278,7 +38384,7 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierLis
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[in_struct->drmFormatModifierCount];
+        pDrmFormatModifiers = new (kSafeStructAlloc) uint64_t[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifiers, (void *)in_struct->pDrmFormatModifiers, sizeof(uint64_t)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38297,7 +38403,7 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierLis
     pDrmFormatModifiers = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[copy_src.drmFormatModifierCount];
+        pDrmFormatModifiers = new (kSafeStructAlloc) uint64_t[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifiers, (void *)copy_src.pDrmFormatModifiers, sizeof(uint64_t)*copy_src.drmFormatModifierCount);
     }
 }
@@ -38316,7 +38422,7 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT& safe_VkImageDrmFormatModifierLis
     pDrmFormatModifiers = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[copy_src.drmFormatModifierCount];
+        pDrmFormatModifiers = new (kSafeStructAlloc) uint64_t[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifiers, (void *)copy_src.pDrmFormatModifiers, sizeof(uint64_t)*copy_src.drmFormatModifierCount);
     }
 
@@ -38342,7 +38448,7 @@ void safe_VkImageDrmFormatModifierListCreateInfoEXT::initialize(const VkImageDrm
     pDrmFormatModifiers = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[in_struct->drmFormatModifierCount];
+        pDrmFormatModifiers = new (kSafeStructAlloc) uint64_t[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifiers, (void *)in_struct->pDrmFormatModifiers, sizeof(uint64_t)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38354,7 +38460,7 @@ void safe_VkImageDrmFormatModifierListCreateInfoEXT::initialize(const safe_VkIma
     pDrmFormatModifiers = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[copy_src->drmFormatModifierCount];
+        pDrmFormatModifiers = new (kSafeStructAlloc) uint64_t[copy_src->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifiers, (void *)copy_src->pDrmFormatModifiers, sizeof(uint64_t)*copy_src->drmFormatModifierCount);
     }
 }
@@ -38367,7 +38473,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifie
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
+        pPlaneLayouts = new (kSafeStructAlloc) VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
         memcpy ((void *)pPlaneLayouts, (void *)in_struct->pPlaneLayouts, sizeof(VkSubresourceLayout)*in_struct->drmFormatModifierPlaneCount);
     }
 }
@@ -38388,7 +38494,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifie
     pPlaneLayouts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[copy_src.drmFormatModifierPlaneCount];
+        pPlaneLayouts = new (kSafeStructAlloc) VkSubresourceLayout[copy_src.drmFormatModifierPlaneCount];
         memcpy ((void *)pPlaneLayouts, (void *)copy_src.pPlaneLayouts, sizeof(VkSubresourceLayout)*copy_src.drmFormatModifierPlaneCount);
     }
 }
@@ -38408,7 +38514,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifie
     pPlaneLayouts = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[copy_src.drmFormatModifierPlaneCount];
+        pPlaneLayouts = new (kSafeStructAlloc) VkSubresourceLayout[copy_src.drmFormatModifierPlaneCount];
         memcpy ((void *)pPlaneLayouts, (void *)copy_src.pPlaneLayouts, sizeof(VkSubresourceLayout)*copy_src.drmFormatModifierPlaneCount);
     }
 
@@ -38435,7 +38541,7 @@ void safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::initialize(const VkImag
     pPlaneLayouts = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
+        pPlaneLayouts = new (kSafeStructAlloc) VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
         memcpy ((void *)pPlaneLayouts, (void *)in_struct->pPlaneLayouts, sizeof(VkSubresourceLayout)*in_struct->drmFormatModifierPlaneCount);
     }
 }
@@ -38448,7 +38554,7 @@ void safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::initialize(const safe_V
     pPlaneLayouts = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[copy_src->drmFormatModifierPlaneCount];
+        pPlaneLayouts = new (kSafeStructAlloc) VkSubresourceLayout[copy_src->drmFormatModifierPlaneCount];
         memcpy ((void *)pPlaneLayouts, (void *)copy_src->pPlaneLayouts, sizeof(VkSubresourceLayout)*copy_src->drmFormatModifierPlaneCount);
     }
 }
@@ -38516,7 +38622,7 @@ safe_VkDrmFormatModifierPropertiesList2EXT::safe_VkDrmFormatModifierPropertiesLi
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierProperties2EXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierProperties2EXT[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierProperties2EXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38535,7 +38641,7 @@ safe_VkDrmFormatModifierPropertiesList2EXT::safe_VkDrmFormatModifierPropertiesLi
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierProperties2EXT[copy_src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierProperties2EXT[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierProperties2EXT)*copy_src.drmFormatModifierCount);
     }
 }
@@ -38554,7 +38660,7 @@ safe_VkDrmFormatModifierPropertiesList2EXT& safe_VkDrmFormatModifierPropertiesLi
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierProperties2EXT[copy_src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierProperties2EXT[copy_src.drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierProperties2EXT)*copy_src.drmFormatModifierCount);
     }
 
@@ -38580,7 +38686,7 @@ void safe_VkDrmFormatModifierPropertiesList2EXT::initialize(const VkDrmFormatMod
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierProperties2EXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierProperties2EXT[in_struct->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierProperties2EXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -38592,7 +38698,7 @@ void safe_VkDrmFormatModifierPropertiesList2EXT::initialize(const safe_VkDrmForm
     pDrmFormatModifierProperties = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierProperties2EXT[copy_src->drmFormatModifierCount];
+        pDrmFormatModifierProperties = new (kSafeStructAlloc) VkDrmFormatModifierProperties2EXT[copy_src->drmFormatModifierCount];
         memcpy ((void *)pDrmFormatModifierProperties, (void *)copy_src->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierProperties2EXT)*copy_src->drmFormatModifierCount);
     }
 }
@@ -38726,7 +38832,7 @@ safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(const VkShadingRatePale
     pShadingRatePaletteEntries(nullptr)
 {
     if (in_struct->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = new (kSafeStructAlloc) VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
         memcpy ((void *)pShadingRatePaletteEntries, (void *)in_struct->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*in_struct->shadingRatePaletteEntryCount);
     }
 }
@@ -38741,7 +38847,7 @@ safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(const safe_VkShadingRat
     shadingRatePaletteEntryCount = copy_src.shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (copy_src.pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[copy_src.shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = new (kSafeStructAlloc) VkShadingRatePaletteEntryNV[copy_src.shadingRatePaletteEntryCount];
         memcpy ((void *)pShadingRatePaletteEntries, (void *)copy_src.pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*copy_src.shadingRatePaletteEntryCount);
     }
 }
@@ -38756,7 +38862,7 @@ safe_VkShadingRatePaletteNV& safe_VkShadingRatePaletteNV::operator=(const safe_V
     shadingRatePaletteEntryCount = copy_src.shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (copy_src.pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[copy_src.shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = new (kSafeStructAlloc) VkShadingRatePaletteEntryNV[copy_src.shadingRatePaletteEntryCount];
         memcpy ((void *)pShadingRatePaletteEntries, (void *)copy_src.pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*copy_src.shadingRatePaletteEntryCount);
     }
 
@@ -38776,7 +38882,7 @@ void safe_VkShadingRatePaletteNV::initialize(const VkShadingRatePaletteNV* in_st
     shadingRatePaletteEntryCount = in_struct->shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (in_struct->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = new (kSafeStructAlloc) VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
         memcpy ((void *)pShadingRatePaletteEntries, (void *)in_struct->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*in_struct->shadingRatePaletteEntryCount);
     }
 }
@@ -38786,7 +38892,7 @@ void safe_VkShadingRatePaletteNV::initialize(const safe_VkShadingRatePaletteNV*
     shadingRatePaletteEntryCount = copy_src->shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (copy_src->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[copy_src->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = new (kSafeStructAlloc) VkShadingRatePaletteEntryNV[copy_src->shadingRatePaletteEntryCount];
         memcpy ((void *)pShadingRatePaletteEntries, (void *)copy_src->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*copy_src->shadingRatePaletteEntryCount);
     }
 }
@@ -38799,7 +38905,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewpor
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (viewportCount && in_struct->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = new (kSafeStructAlloc) safe_VkShadingRatePaletteNV[viewportCount];
         for (uint32_t i = 0; i < viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&in_struct->pShadingRatePalettes[i]);
         }
@@ -38822,7 +38928,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewpor
     pShadingRatePalettes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (viewportCount && copy_src.pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = new (kSafeStructAlloc) safe_VkShadingRatePaletteNV[viewportCount];
         for (uint32_t i = 0; i < viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&copy_src.pShadingRatePalettes[i]);
         }
@@ -38844,7 +38950,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewpor
     pShadingRatePalettes = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (viewportCount && copy_src.pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = new (kSafeStructAlloc) safe_VkShadingRatePaletteNV[viewportCount];
         for (uint32_t i = 0; i < viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&copy_src.pShadingRatePalettes[i]);
         }
@@ -38873,7 +38979,7 @@ void safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::initialize(const
     pShadingRatePalettes = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (viewportCount && in_struct->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = new (kSafeStructAlloc) safe_VkShadingRatePaletteNV[viewportCount];
         for (uint32_t i = 0; i < viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&in_struct->pShadingRatePalettes[i]);
         }
@@ -38888,7 +38994,7 @@ void safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::initialize(const
     pShadingRatePalettes = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (viewportCount && copy_src->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = new (kSafeStructAlloc) safe_VkShadingRatePaletteNV[viewportCount];
         for (uint32_t i = 0; i < viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&copy_src->pShadingRatePalettes[i]);
         }
@@ -39032,7 +39138,7 @@ safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(const VkCoars
     pSampleLocations(nullptr)
 {
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
+        pSampleLocations = new (kSafeStructAlloc) VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*in_struct->sampleLocationCount);
     }
 }
@@ -39051,7 +39157,7 @@ safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(const safe_Vk
     sampleLocationCount = copy_src.sampleLocationCount;
     pSampleLocations = nullptr;
     if (copy_src.pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[copy_src.sampleLocationCount];
+        pSampleLocations = new (kSafeStructAlloc) VkCoarseSampleLocationNV[copy_src.sampleLocationCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src.pSampleLocations, sizeof(VkCoarseSampleLocationNV)*copy_src.sampleLocationCount);
     }
 }
@@ -39068,7 +39174,7 @@ safe_VkCoarseSampleOrderCustomNV& safe_VkCoarseSampleOrderCustomNV::operator=(co
     sampleLocationCount = copy_src.sampleLocationCount;
     pSampleLocations = nullptr;
     if (copy_src.pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[copy_src.sampleLocationCount];
+        pSampleLocations = new (kSafeStructAlloc) VkCoarseSampleLocationNV[copy_src.sampleLocationCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src.pSampleLocations, sizeof(VkCoarseSampleLocationNV)*copy_src.sampleLocationCount);
     }
 
@@ -39090,7 +39196,7 @@ void safe_VkCoarseSampleOrderCustomNV::initialize(const VkCoarseSampleOrderCusto
     sampleLocationCount = in_struct->sampleLocationCount;
     pSampleLocations = nullptr;
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
+        pSampleLocations = new (kSafeStructAlloc) VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*in_struct->sampleLocationCount);
     }
 }
@@ -39102,7 +39208,7 @@ void safe_VkCoarseSampleOrderCustomNV::initialize(const safe_VkCoarseSampleOrder
     sampleLocationCount = copy_src->sampleLocationCount;
     pSampleLocations = nullptr;
     if (copy_src->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[copy_src->sampleLocationCount];
+        pSampleLocations = new (kSafeStructAlloc) VkCoarseSampleLocationNV[copy_src->sampleLocationCount];
         memcpy ((void *)pSampleLocations, (void *)copy_src->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*copy_src->sampleLocationCount);
     }
 }
@@ -39115,7 +39221,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewpo
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (customSampleOrderCount && in_struct->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = new (kSafeStructAlloc) safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
         for (uint32_t i = 0; i < customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&in_struct->pCustomSampleOrders[i]);
         }
@@ -39138,7 +39244,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewpo
     pCustomSampleOrders = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (customSampleOrderCount && copy_src.pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = new (kSafeStructAlloc) safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
         for (uint32_t i = 0; i < customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&copy_src.pCustomSampleOrders[i]);
         }
@@ -39160,7 +39266,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewpo
     pCustomSampleOrders = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (customSampleOrderCount && copy_src.pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = new (kSafeStructAlloc) safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
         for (uint32_t i = 0; i < customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&copy_src.pCustomSampleOrders[i]);
         }
@@ -39189,7 +39295,7 @@ void safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::initialize(const
     pCustomSampleOrders = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (customSampleOrderCount && in_struct->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = new (kSafeStructAlloc) safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
         for (uint32_t i = 0; i < customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&in_struct->pCustomSampleOrders[i]);
         }
@@ -39204,7 +39310,7 @@ void safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::initialize(const
     pCustomSampleOrders = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (customSampleOrderCount && copy_src->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = new (kSafeStructAlloc) safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
         for (uint32_t i = 0; i < customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&copy_src->pCustomSampleOrders[i]);
         }
@@ -39305,13 +39411,13 @@ safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(con
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
@@ -39346,13 +39452,13 @@ safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(con
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
@@ -39382,13 +39488,13 @@ safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::op
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
@@ -39427,13 +39533,13 @@ void safe_VkRayTracingPipelineCreateInfoNV::initialize(const VkRayTracingPipelin
     basePipelineIndex = in_struct->basePipelineIndex;
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
@@ -39454,13 +39560,13 @@ void safe_VkRayTracingPipelineCreateInfoNV::initialize(const safe_VkRayTracingPi
     basePipelineIndex = copy_src->basePipelineIndex;
     pNext = SafePnextCopy(copy_src->pNext);
     if (stageCount && copy_src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src->pStages[i]);
         }
     }
     if (groupCount && copy_src->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src->pGroups[i]);
         }
@@ -39735,7 +39841,7 @@ safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(const VkA
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (geometryCount && in_struct->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = new (kSafeStructAlloc) safe_VkGeometryNV[geometryCount];
         for (uint32_t i = 0; i < geometryCount; ++i) {
             pGeometries[i].initialize(&in_struct->pGeometries[i]);
         }
@@ -39762,7 +39868,7 @@ safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(const saf
     pGeometries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (geometryCount && copy_src.pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = new (kSafeStructAlloc) safe_VkGeometryNV[geometryCount];
         for (uint32_t i = 0; i < geometryCount; ++i) {
             pGeometries[i].initialize(&copy_src.pGeometries[i]);
         }
@@ -39786,7 +39892,7 @@ safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator
     pGeometries = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (geometryCount && copy_src.pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = new (kSafeStructAlloc) safe_VkGeometryNV[geometryCount];
         for (uint32_t i = 0; i < geometryCount; ++i) {
             pGeometries[i].initialize(&copy_src.pGeometries[i]);
         }
@@ -39817,7 +39923,7 @@ void safe_VkAccelerationStructureInfoNV::initialize(const VkAccelerationStructur
     pGeometries = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (geometryCount && in_struct->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = new (kSafeStructAlloc) safe_VkGeometryNV[geometryCount];
         for (uint32_t i = 0; i < geometryCount; ++i) {
             pGeometries[i].initialize(&in_struct->pGeometries[i]);
         }
@@ -39834,7 +39940,7 @@ void safe_VkAccelerationStructureInfoNV::initialize(const safe_VkAccelerationStr
     pGeometries = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (geometryCount && copy_src->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = new (kSafeStructAlloc) safe_VkGeometryNV[geometryCount];
         for (uint32_t i = 0; i < geometryCount; ++i) {
             pGeometries[i].initialize(&copy_src->pGeometries[i]);
         }
@@ -39912,7 +40018,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMe
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -39937,7 +40043,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMe
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
 }
@@ -39959,7 +40065,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMe
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src.deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src.deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src.pDeviceIndices, sizeof(uint32_t)*copy_src.deviceIndexCount);
     }
 
@@ -39988,7 +40094,7 @@ void safe_VkBindAccelerationStructureMemoryInfoNV::initialize(const VkBindAccele
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[in_struct->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -40003,7 +40109,7 @@ void safe_VkBindAccelerationStructureMemoryInfoNV::initialize(const safe_VkBindA
     pDeviceIndices = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[copy_src->deviceIndexCount];
+        pDeviceIndices = new (kSafeStructAlloc) uint32_t[copy_src->deviceIndexCount];
         memcpy ((void *)pDeviceIndices, (void *)copy_src->pDeviceIndices, sizeof(uint32_t)*copy_src->deviceIndexCount);
     }
 }
@@ -40015,7 +40121,7 @@ safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccel
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureNV[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
         }
@@ -40036,7 +40142,7 @@ safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccel
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (accelerationStructureCount && copy_src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureNV[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src.pAccelerationStructures[i];
         }
@@ -40057,7 +40163,7 @@ safe_VkWriteDescriptorSetAccelerationStructureNV& safe_VkWriteDescriptorSetAccel
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (accelerationStructureCount && copy_src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureNV[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src.pAccelerationStructures[i];
         }
@@ -40085,7 +40191,7 @@ void safe_VkWriteDescriptorSetAccelerationStructureNV::initialize(const VkWriteD
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureNV[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
         }
@@ -40099,7 +40205,7 @@ void safe_VkWriteDescriptorSetAccelerationStructureNV::initialize(const safe_VkW
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (accelerationStructureCount && copy_src->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureNV[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src->pAccelerationStructures[i];
         }
@@ -41049,15 +41155,15 @@ safe_VkVideoDecodeH265SessionParametersAddInfoEXT::safe_VkVideoDecodeH265Session
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)in_struct->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*in_struct->stdVPSCount);
     }
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -41084,15 +41190,15 @@ safe_VkVideoDecodeH265SessionParametersAddInfoEXT::safe_VkVideoDecodeH265Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src.pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src.stdVPSCount);
     }
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src.stdPPSCount);
     }
 }
@@ -41119,15 +41225,15 @@ safe_VkVideoDecodeH265SessionParametersAddInfoEXT& safe_VkVideoDecodeH265Session
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src.stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src.pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src.stdVPSCount);
     }
     if (copy_src.pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src.stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src.pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src.stdSPSCount);
     }
     if (copy_src.pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src.stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src.pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src.stdPPSCount);
     }
 
@@ -41165,15 +41271,15 @@ void safe_VkVideoDecodeH265SessionParametersAddInfoEXT::initialize(const VkVideo
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[in_struct->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)in_struct->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*in_struct->stdVPSCount);
     }
     if (in_struct->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[in_struct->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)in_struct->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*in_struct->stdSPSCount);
     }
     if (in_struct->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[in_struct->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)in_struct->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*in_struct->stdPPSCount);
     }
 }
@@ -41189,15 +41295,15 @@ void safe_VkVideoDecodeH265SessionParametersAddInfoEXT::initialize(const safe_Vk
     pStdPPSs = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdVPSs) {
-        pStdVPSs = new StdVideoH265VideoParameterSet[copy_src->stdVPSCount];
+        pStdVPSs = new (kSafeStructAlloc) StdVideoH265VideoParameterSet[copy_src->stdVPSCount];
         memcpy ((void *)pStdVPSs, (void *)copy_src->pStdVPSs, sizeof(StdVideoH265VideoParameterSet)*copy_src->stdVPSCount);
     }
     if (copy_src->pStdSPSs) {
-        pStdSPSs = new StdVideoH265SequenceParameterSet[copy_src->stdSPSCount];
+        pStdSPSs = new (kSafeStructAlloc) StdVideoH265SequenceParameterSet[copy_src->stdSPSCount];
         memcpy ((void *)pStdSPSs, (void *)copy_src->pStdSPSs, sizeof(StdVideoH265SequenceParameterSet)*copy_src->stdSPSCount);
     }
     if (copy_src->pStdPPSs) {
-        pStdPPSs = new StdVideoH265PictureParameterSet[copy_src->stdPPSCount];
+        pStdPPSs = new (kSafeStructAlloc) StdVideoH265PictureParameterSet[copy_src->stdPPSCount];
         memcpy ((void *)pStdPPSs, (void *)copy_src->pStdPPSs, sizeof(StdVideoH265PictureParameterSet)*copy_src->stdPPSCount);
     }
 }
@@ -41215,7 +41321,7 @@ safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::safe_VkVideoDecodeH265Sess
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::safe_VkVideoDecodeH265SessionParametersCreateInfoEXT() :
@@ -41236,7 +41342,7 @@ safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::safe_VkVideoDecodeH265Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 }
 
 safe_VkVideoDecodeH265SessionParametersCreateInfoEXT& safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::operator=(const safe_VkVideoDecodeH265SessionParametersCreateInfoEXT& copy_src)
@@ -41255,7 +41361,7 @@ safe_VkVideoDecodeH265SessionParametersCreateInfoEXT& safe_VkVideoDecodeH265Sess
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src.pParametersAddInfo);
 
     return *this;
 }
@@ -41281,7 +41387,7 @@ void safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::initialize(const VkVi
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(in_struct->pParametersAddInfo);
 }
 
 void safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::initialize(const safe_VkVideoDecodeH265SessionParametersCreateInfoEXT* copy_src)
@@ -41293,7 +41399,7 @@ void safe_VkVideoDecodeH265SessionParametersCreateInfoEXT::initialize(const safe
     pParametersAddInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pParametersAddInfo)
-        pParametersAddInfo = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
+        pParametersAddInfo = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(*copy_src->pParametersAddInfo);
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
 
@@ -41308,10 +41414,10 @@ safe_VkVideoDecodeH265PictureInfoEXT::safe_VkVideoDecodeH265PictureInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH265PictureInfo(*in_struct->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH265PictureInfo(*in_struct->pStdPictureInfo);
     }
     if (in_struct->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[in_struct->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[in_struct->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)in_struct->pSliceOffsets, sizeof(uint32_t)*in_struct->sliceCount);
     }
 }
@@ -41332,10 +41438,10 @@ safe_VkVideoDecodeH265PictureInfoEXT::safe_VkVideoDecodeH265PictureInfoEXT(const
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH265PictureInfo(*copy_src.pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH265PictureInfo(*copy_src.pStdPictureInfo);
     }
     if (copy_src.pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src.sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src.sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src.pSliceOffsets, sizeof(uint32_t)*copy_src.sliceCount);
     }
 }
@@ -41357,10 +41463,10 @@ safe_VkVideoDecodeH265PictureInfoEXT& safe_VkVideoDecodeH265PictureInfoEXT::oper
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH265PictureInfo(*copy_src.pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH265PictureInfo(*copy_src.pStdPictureInfo);
     }
     if (copy_src.pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src.sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src.sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src.pSliceOffsets, sizeof(uint32_t)*copy_src.sliceCount);
     }
 
@@ -41391,10 +41497,10 @@ void safe_VkVideoDecodeH265PictureInfoEXT::initialize(const VkVideoDecodeH265Pic
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH265PictureInfo(*in_struct->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH265PictureInfo(*in_struct->pStdPictureInfo);
     }
     if (in_struct->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[in_struct->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[in_struct->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)in_struct->pSliceOffsets, sizeof(uint32_t)*in_struct->sliceCount);
     }
 }
@@ -41407,10 +41513,10 @@ void safe_VkVideoDecodeH265PictureInfoEXT::initialize(const safe_VkVideoDecodeH2
     pSliceOffsets = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdPictureInfo) {
-        pStdPictureInfo = new StdVideoDecodeH265PictureInfo(*copy_src->pStdPictureInfo);
+        pStdPictureInfo = new (kSafeStructAlloc) StdVideoDecodeH265PictureInfo(*copy_src->pStdPictureInfo);
     }
     if (copy_src->pSliceOffsets) {
-        pSliceOffsets = new uint32_t[copy_src->sliceCount];
+        pSliceOffsets = new (kSafeStructAlloc) uint32_t[copy_src->sliceCount];
         memcpy ((void *)pSliceOffsets, (void *)copy_src->pSliceOffsets, sizeof(uint32_t)*copy_src->sliceCount);
     }
 }
@@ -41425,7 +41531,7 @@ safe_VkVideoDecodeH265DpbSlotInfoEXT::safe_VkVideoDecodeH265DpbSlotInfoEXT(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -41441,7 +41547,7 @@ safe_VkVideoDecodeH265DpbSlotInfoEXT::safe_VkVideoDecodeH265DpbSlotInfoEXT(const
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 }
 
@@ -41458,7 +41564,7 @@ safe_VkVideoDecodeH265DpbSlotInfoEXT& safe_VkVideoDecodeH265DpbSlotInfoEXT::oper
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH265ReferenceInfo(*copy_src.pStdReferenceInfo);
     }
 
     return *this;
@@ -41482,7 +41588,7 @@ void safe_VkVideoDecodeH265DpbSlotInfoEXT::initialize(const VkVideoDecodeH265Dpb
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH265ReferenceInfo(*in_struct->pStdReferenceInfo);
     }
 }
 
@@ -41492,7 +41598,7 @@ void safe_VkVideoDecodeH265DpbSlotInfoEXT::initialize(const safe_VkVideoDecodeH2
     pStdReferenceInfo = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pStdReferenceInfo) {
-        pStdReferenceInfo = new StdVideoDecodeH265ReferenceInfo(*copy_src->pStdReferenceInfo);
+        pStdReferenceInfo = new (kSafeStructAlloc) StdVideoDecodeH265ReferenceInfo(*copy_src->pStdReferenceInfo);
     }
 }
 #endif // VK_ENABLE_BETA_EXTENSIONS
@@ -41617,7 +41723,7 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::safe_VkPipelineVertexInputD
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
+        pVertexBindingDivisors = new (kSafeStructAlloc) VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
         memcpy ((void *)pVertexBindingDivisors, (void *)in_struct->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*in_struct->vertexBindingDivisorCount);
     }
 }
@@ -41636,7 +41742,7 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::safe_VkPipelineVertexInputD
     pVertexBindingDivisors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[copy_src.vertexBindingDivisorCount];
+        pVertexBindingDivisors = new (kSafeStructAlloc) VkVertexInputBindingDivisorDescriptionEXT[copy_src.vertexBindingDivisorCount];
         memcpy ((void *)pVertexBindingDivisors, (void *)copy_src.pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*copy_src.vertexBindingDivisorCount);
     }
 }
@@ -41655,7 +41761,7 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& safe_VkPipelineVertexInputD
     pVertexBindingDivisors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[copy_src.vertexBindingDivisorCount];
+        pVertexBindingDivisors = new (kSafeStructAlloc) VkVertexInputBindingDivisorDescriptionEXT[copy_src.vertexBindingDivisorCount];
         memcpy ((void *)pVertexBindingDivisors, (void *)copy_src.pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*copy_src.vertexBindingDivisorCount);
     }
 
@@ -41681,7 +41787,7 @@ void safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::initialize(const VkPip
     pVertexBindingDivisors = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
+        pVertexBindingDivisors = new (kSafeStructAlloc) VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
         memcpy ((void *)pVertexBindingDivisors, (void *)in_struct->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*in_struct->vertexBindingDivisorCount);
     }
 }
@@ -41693,7 +41799,7 @@ void safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::initialize(const safe_
     pVertexBindingDivisors = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[copy_src->vertexBindingDivisorCount];
+        pVertexBindingDivisors = new (kSafeStructAlloc) VkVertexInputBindingDivisorDescriptionEXT[copy_src->vertexBindingDivisorCount];
         memcpy ((void *)pVertexBindingDivisors, (void *)copy_src->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*copy_src->vertexBindingDivisorCount);
     }
 }
@@ -42153,7 +42259,7 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewpor
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[in_struct->exclusiveScissorCount];
+        pExclusiveScissors = new (kSafeStructAlloc) VkRect2D[in_struct->exclusiveScissorCount];
         memcpy ((void *)pExclusiveScissors, (void *)in_struct->pExclusiveScissors, sizeof(VkRect2D)*in_struct->exclusiveScissorCount);
     }
 }
@@ -42172,7 +42278,7 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewpor
     pExclusiveScissors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[copy_src.exclusiveScissorCount];
+        pExclusiveScissors = new (kSafeStructAlloc) VkRect2D[copy_src.exclusiveScissorCount];
         memcpy ((void *)pExclusiveScissors, (void *)copy_src.pExclusiveScissors, sizeof(VkRect2D)*copy_src.exclusiveScissorCount);
     }
 }
@@ -42191,7 +42297,7 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& safe_VkPipelineViewpor
     pExclusiveScissors = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[copy_src.exclusiveScissorCount];
+        pExclusiveScissors = new (kSafeStructAlloc) VkRect2D[copy_src.exclusiveScissorCount];
         memcpy ((void *)pExclusiveScissors, (void *)copy_src.pExclusiveScissors, sizeof(VkRect2D)*copy_src.exclusiveScissorCount);
     }
 
@@ -42217,7 +42323,7 @@ void safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::initialize(const
     pExclusiveScissors = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[in_struct->exclusiveScissorCount];
+        pExclusiveScissors = new (kSafeStructAlloc) VkRect2D[in_struct->exclusiveScissorCount];
         memcpy ((void *)pExclusiveScissors, (void *)in_struct->pExclusiveScissors, sizeof(VkRect2D)*in_struct->exclusiveScissorCount);
     }
 }
@@ -42229,7 +42335,7 @@ void safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::initialize(const
     pExclusiveScissors = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[copy_src->exclusiveScissorCount];
+        pExclusiveScissors = new (kSafeStructAlloc) VkRect2D[copy_src->exclusiveScissorCount];
         memcpy ((void *)pExclusiveScissors, (void *)copy_src->pExclusiveScissors, sizeof(VkRect2D)*copy_src->exclusiveScissorCount);
     }
 }
@@ -43874,11 +43980,11 @@ safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(const VkValidationFea
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
         memcpy ((void *)pEnabledValidationFeatures, (void *)in_struct->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*in_struct->enabledValidationFeatureCount);
     }
     if (in_struct->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
         memcpy ((void *)pDisabledValidationFeatures, (void *)in_struct->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*in_struct->disabledValidationFeatureCount);
     }
 }
@@ -43901,11 +44007,11 @@ safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(const safe_VkValidati
     pDisabledValidationFeatures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[copy_src.enabledValidationFeatureCount];
+        pEnabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureEnableEXT[copy_src.enabledValidationFeatureCount];
         memcpy ((void *)pEnabledValidationFeatures, (void *)copy_src.pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*copy_src.enabledValidationFeatureCount);
     }
     if (copy_src.pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[copy_src.disabledValidationFeatureCount];
+        pDisabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureDisableEXT[copy_src.disabledValidationFeatureCount];
         memcpy ((void *)pDisabledValidationFeatures, (void *)copy_src.pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*copy_src.disabledValidationFeatureCount);
     }
 }
@@ -43928,11 +44034,11 @@ safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(const safe
     pDisabledValidationFeatures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[copy_src.enabledValidationFeatureCount];
+        pEnabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureEnableEXT[copy_src.enabledValidationFeatureCount];
         memcpy ((void *)pEnabledValidationFeatures, (void *)copy_src.pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*copy_src.enabledValidationFeatureCount);
     }
     if (copy_src.pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[copy_src.disabledValidationFeatureCount];
+        pDisabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureDisableEXT[copy_src.disabledValidationFeatureCount];
         memcpy ((void *)pDisabledValidationFeatures, (void *)copy_src.pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*copy_src.disabledValidationFeatureCount);
     }
 
@@ -43964,11 +44070,11 @@ void safe_VkValidationFeaturesEXT::initialize(const VkValidationFeaturesEXT* in_
     pDisabledValidationFeatures = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
         memcpy ((void *)pEnabledValidationFeatures, (void *)in_struct->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*in_struct->enabledValidationFeatureCount);
     }
     if (in_struct->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
         memcpy ((void *)pDisabledValidationFeatures, (void *)in_struct->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*in_struct->disabledValidationFeatureCount);
     }
 }
@@ -43982,11 +44088,11 @@ void safe_VkValidationFeaturesEXT::initialize(const safe_VkValidationFeaturesEXT
     pDisabledValidationFeatures = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[copy_src->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureEnableEXT[copy_src->enabledValidationFeatureCount];
         memcpy ((void *)pEnabledValidationFeatures, (void *)copy_src->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*copy_src->enabledValidationFeatureCount);
     }
     if (copy_src->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[copy_src->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = new (kSafeStructAlloc) VkValidationFeatureDisableEXT[copy_src->disabledValidationFeatureCount];
         memcpy ((void *)pDisabledValidationFeatures, (void *)copy_src->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*copy_src->disabledValidationFeatureCount);
     }
 }
@@ -45680,15 +45786,15 @@ safe_VkGraphicsShaderGroupCreateInfoNV::safe_VkGraphicsShaderGroupCreateInfoNV(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
     if (in_struct->pTessellationState)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
 }
 
 safe_VkGraphicsShaderGroupCreateInfoNV::safe_VkGraphicsShaderGroupCreateInfoNV() :
@@ -45709,15 +45815,15 @@ safe_VkGraphicsShaderGroupCreateInfoNV::safe_VkGraphicsShaderGroupCreateInfoNV(c
     pTessellationState = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (copy_src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
     if (copy_src.pTessellationState)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
 }
 
 safe_VkGraphicsShaderGroupCreateInfoNV& safe_VkGraphicsShaderGroupCreateInfoNV::operator=(const safe_VkGraphicsShaderGroupCreateInfoNV& copy_src)
@@ -45740,15 +45846,15 @@ safe_VkGraphicsShaderGroupCreateInfoNV& safe_VkGraphicsShaderGroupCreateInfoNV::
     pTessellationState = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (copy_src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);
     if (copy_src.pTessellationState)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);
 
     return *this;
 }
@@ -45782,15 +45888,15 @@ void safe_VkGraphicsShaderGroupCreateInfoNV::initialize(const VkGraphicsShaderGr
     pTessellationState = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
     if (in_struct->pTessellationState)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
 }
 
 void safe_VkGraphicsShaderGroupCreateInfoNV::initialize(const safe_VkGraphicsShaderGroupCreateInfoNV* copy_src)
@@ -45802,15 +45908,15 @@ void safe_VkGraphicsShaderGroupCreateInfoNV::initialize(const safe_VkGraphicsSha
     pTessellationState = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (stageCount && copy_src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src->pStages[i]);
         }
     }
     if (copy_src->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src->pVertexInputState);
+        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src->pVertexInputState);
     if (copy_src->pTessellationState)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src->pTessellationState);
+        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src->pTessellationState);
 }
 
 safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(const VkGraphicsPipelineShaderGroupsCreateInfoNV* in_struct) :
@@ -45822,13 +45928,13 @@ safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::safe_VkGraphicsPipelineShaderGr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
     }
     if (pipelineCount && in_struct->pPipelines) {
-        pPipelines = new VkPipeline[pipelineCount];
+        pPipelines = new (kSafeStructAlloc) VkPipeline[pipelineCount];
         for (uint32_t i = 0; i < pipelineCount; ++i) {
             pPipelines[i] = in_struct->pPipelines[i];
         }
@@ -45853,13 +45959,13 @@ safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::safe_VkGraphicsPipelineShaderGr
     pPipelines = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
     }
     if (pipelineCount && copy_src.pPipelines) {
-        pPipelines = new VkPipeline[pipelineCount];
+        pPipelines = new (kSafeStructAlloc) VkPipeline[pipelineCount];
         for (uint32_t i = 0; i < pipelineCount; ++i) {
             pPipelines[i] = copy_src.pPipelines[i];
         }
@@ -45884,13 +45990,13 @@ safe_VkGraphicsPipelineShaderGroupsCreateInfoNV& safe_VkGraphicsPipelineShaderGr
     pPipelines = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
     }
     if (pipelineCount && copy_src.pPipelines) {
-        pPipelines = new VkPipeline[pipelineCount];
+        pPipelines = new (kSafeStructAlloc) VkPipeline[pipelineCount];
         for (uint32_t i = 0; i < pipelineCount; ++i) {
             pPipelines[i] = copy_src.pPipelines[i];
         }
@@ -45924,13 +46030,13 @@ void safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::initialize(const VkGraphic
     pPipelines = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
     }
     if (pipelineCount && in_struct->pPipelines) {
-        pPipelines = new VkPipeline[pipelineCount];
+        pPipelines = new (kSafeStructAlloc) VkPipeline[pipelineCount];
         for (uint32_t i = 0; i < pipelineCount; ++i) {
             pPipelines[i] = in_struct->pPipelines[i];
         }
@@ -45946,13 +46052,13 @@ void safe_VkGraphicsPipelineShaderGroupsCreateInfoNV::initialize(const safe_VkGr
     pPipelines = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (groupCount && copy_src->pGroups) {
-        pGroups = new safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkGraphicsShaderGroupCreateInfoNV[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src->pGroups[i]);
         }
     }
     if (pipelineCount && copy_src->pPipelines) {
-        pPipelines = new VkPipeline[pipelineCount];
+        pPipelines = new (kSafeStructAlloc) VkPipeline[pipelineCount];
         for (uint32_t i = 0; i < pipelineCount; ++i) {
             pPipelines[i] = copy_src->pPipelines[i];
         }
@@ -45977,11 +46083,11 @@ safe_VkIndirectCommandsLayoutTokenNV::safe_VkIndirectCommandsLayoutTokenNV(const
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pIndexTypes) {
-        pIndexTypes = new VkIndexType[in_struct->indexTypeCount];
+        pIndexTypes = new (kSafeStructAlloc) VkIndexType[in_struct->indexTypeCount];
         memcpy ((void *)pIndexTypes, (void *)in_struct->pIndexTypes, sizeof(VkIndexType)*in_struct->indexTypeCount);
     }
     if (in_struct->pIndexTypeValues) {
-        pIndexTypeValues = new uint32_t[in_struct->indexTypeCount];
+        pIndexTypeValues = new (kSafeStructAlloc) uint32_t[in_struct->indexTypeCount];
         memcpy ((void *)pIndexTypeValues, (void *)in_struct->pIndexTypeValues, sizeof(uint32_t)*in_struct->indexTypeCount);
     }
 }
@@ -46022,11 +46128,11 @@ safe_VkIndirectCommandsLayoutTokenNV::safe_VkIndirectCommandsLayoutTokenNV(const
     pIndexTypeValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pIndexTypes) {
-        pIndexTypes = new VkIndexType[copy_src.indexTypeCount];
+        pIndexTypes = new (kSafeStructAlloc) VkIndexType[copy_src.indexTypeCount];
         memcpy ((void *)pIndexTypes, (void *)copy_src.pIndexTypes, sizeof(VkIndexType)*copy_src.indexTypeCount);
     }
     if (copy_src.pIndexTypeValues) {
-        pIndexTypeValues = new uint32_t[copy_src.indexTypeCount];
+        pIndexTypeValues = new (kSafeStructAlloc) uint32_t[copy_src.indexTypeCount];
         memcpy ((void *)pIndexTypeValues, (void *)copy_src.pIndexTypeValues, sizeof(uint32_t)*copy_src.indexTypeCount);
     }
 }
@@ -46058,11 +46164,11 @@ safe_VkIndirectCommandsLayoutTokenNV& safe_VkIndirectCommandsLayoutTokenNV::oper
     pIndexTypeValues = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pIndexTypes) {
-        pIndexTypes = new VkIndexType[copy_src.indexTypeCount];
+        pIndexTypes = new (kSafeStructAlloc) VkIndexType[copy_src.indexTypeCount];
         memcpy ((void *)pIndexTypes, (void *)copy_src.pIndexTypes, sizeof(VkIndexType)*copy_src.indexTypeCount);
     }
     if (copy_src.pIndexTypeValues) {
-        pIndexTypeValues = new uint32_t[copy_src.indexTypeCount];
+        pIndexTypeValues = new (kSafeStructAlloc) uint32_t[copy_src.indexTypeCount];
         memcpy ((void *)pIndexTypeValues, (void *)copy_src.pIndexTypeValues, sizeof(uint32_t)*copy_src.indexTypeCount);
     }
 
@@ -46103,11 +46209,11 @@ void safe_VkIndirectCommandsLayoutTokenNV::initialize(const VkIndirectCommandsLa
     pIndexTypeValues = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pIndexTypes) {
-        pIndexTypes = new VkIndexType[in_struct->indexTypeCount];
+        pIndexTypes = new (kSafeStructAlloc) VkIndexType[in_struct->indexTypeCount];
         memcpy ((void *)pIndexTypes, (void *)in_struct->pIndexTypes, sizeof(VkIndexType)*in_struct->indexTypeCount);
     }
     if (in_struct->pIndexTypeValues) {
-        pIndexTypeValues = new uint32_t[in_struct->indexTypeCount];
+        pIndexTypeValues = new (kSafeStructAlloc) uint32_t[in_struct->indexTypeCount];
         memcpy ((void *)pIndexTypeValues, (void *)in_struct->pIndexTypeValues, sizeof(uint32_t)*in_struct->indexTypeCount);
     }
 }
@@ -46130,11 +46236,11 @@ void safe_VkIndirectCommandsLayoutTokenNV::initialize(const safe_VkIndirectComma
     pIndexTypeValues = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pIndexTypes) {
-        pIndexTypes = new VkIndexType[copy_src->indexTypeCount];
+        pIndexTypes = new (kSafeStructAlloc) VkIndexType[copy_src->indexTypeCount];
         memcpy ((void *)pIndexTypes, (void *)copy_src->pIndexTypes, sizeof(VkIndexType)*copy_src->indexTypeCount);
     }
     if (copy_src->pIndexTypeValues) {
-        pIndexTypeValues = new uint32_t[copy_src->indexTypeCount];
+        pIndexTypeValues = new (kSafeStructAlloc) uint32_t[copy_src->indexTypeCount];
         memcpy ((void *)pIndexTypeValues, (void *)copy_src->pIndexTypeValues, sizeof(uint32_t)*copy_src->indexTypeCount);
     }
 }
@@ -46150,13 +46256,13 @@ safe_VkIndirectCommandsLayoutCreateInfoNV::safe_VkIndirectCommandsLayoutCreateIn
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (tokenCount && in_struct->pTokens) {
-        pTokens = new safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
+        pTokens = new (kSafeStructAlloc) safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
         for (uint32_t i = 0; i < tokenCount; ++i) {
             pTokens[i].initialize(&in_struct->pTokens[i]);
         }
     }
     if (in_struct->pStreamStrides) {
-        pStreamStrides = new uint32_t[in_struct->streamCount];
+        pStreamStrides = new (kSafeStructAlloc) uint32_t[in_struct->streamCount];
         memcpy ((void *)pStreamStrides, (void *)in_struct->pStreamStrides, sizeof(uint32_t)*in_struct->streamCount);
     }
 }
@@ -46183,13 +46289,13 @@ safe_VkIndirectCommandsLayoutCreateInfoNV::safe_VkIndirectCommandsLayoutCreateIn
     pStreamStrides = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (tokenCount && copy_src.pTokens) {
-        pTokens = new safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
+        pTokens = new (kSafeStructAlloc) safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
         for (uint32_t i = 0; i < tokenCount; ++i) {
             pTokens[i].initialize(&copy_src.pTokens[i]);
         }
     }
     if (copy_src.pStreamStrides) {
-        pStreamStrides = new uint32_t[copy_src.streamCount];
+        pStreamStrides = new (kSafeStructAlloc) uint32_t[copy_src.streamCount];
         memcpy ((void *)pStreamStrides, (void *)copy_src.pStreamStrides, sizeof(uint32_t)*copy_src.streamCount);
     }
 }
@@ -46214,13 +46320,13 @@ safe_VkIndirectCommandsLayoutCreateInfoNV& safe_VkIndirectCommandsLayoutCreateIn
     pStreamStrides = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (tokenCount && copy_src.pTokens) {
-        pTokens = new safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
+        pTokens = new (kSafeStructAlloc) safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
         for (uint32_t i = 0; i < tokenCount; ++i) {
             pTokens[i].initialize(&copy_src.pTokens[i]);
         }
     }
     if (copy_src.pStreamStrides) {
-        pStreamStrides = new uint32_t[copy_src.streamCount];
+        pStreamStrides = new (kSafeStructAlloc) uint32_t[copy_src.streamCount];
         memcpy ((void *)pStreamStrides, (void *)copy_src.pStreamStrides, sizeof(uint32_t)*copy_src.streamCount);
     }
 
@@ -46254,13 +46360,13 @@ void safe_VkIndirectCommandsLayoutCreateInfoNV::initialize(const VkIndirectComma
     pStreamStrides = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (tokenCount && in_struct->pTokens) {
-        pTokens = new safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
+        pTokens = new (kSafeStructAlloc) safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
         for (uint32_t i = 0; i < tokenCount; ++i) {
             pTokens[i].initialize(&in_struct->pTokens[i]);
         }
     }
     if (in_struct->pStreamStrides) {
-        pStreamStrides = new uint32_t[in_struct->streamCount];
+        pStreamStrides = new (kSafeStructAlloc) uint32_t[in_struct->streamCount];
         memcpy ((void *)pStreamStrides, (void *)in_struct->pStreamStrides, sizeof(uint32_t)*in_struct->streamCount);
     }
 }
@@ -46276,13 +46382,13 @@ void safe_VkIndirectCommandsLayoutCreateInfoNV::initialize(const safe_VkIndirect
     pStreamStrides = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (tokenCount && copy_src->pTokens) {
-        pTokens = new safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
+        pTokens = new (kSafeStructAlloc) safe_VkIndirectCommandsLayoutTokenNV[tokenCount];
         for (uint32_t i = 0; i < tokenCount; ++i) {
             pTokens[i].initialize(&copy_src->pTokens[i]);
         }
     }
     if (copy_src->pStreamStrides) {
-        pStreamStrides = new uint32_t[copy_src->streamCount];
+        pStreamStrides = new (kSafeStructAlloc) uint32_t[copy_src->streamCount];
         memcpy ((void *)pStreamStrides, (void *)copy_src->pStreamStrides, sizeof(uint32_t)*copy_src->streamCount);
     }
 }
@@ -46305,7 +46411,7 @@ safe_VkGeneratedCommandsInfoNV::safe_VkGeneratedCommandsInfoNV(const VkGenerated
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (streamCount && in_struct->pStreams) {
-        pStreams = new VkIndirectCommandsStreamNV[streamCount];
+        pStreams = new (kSafeStructAlloc) VkIndirectCommandsStreamNV[streamCount];
         for (uint32_t i = 0; i < streamCount; ++i) {
             pStreams[i] = in_struct->pStreams[i];
         }
@@ -46348,7 +46454,7 @@ safe_VkGeneratedCommandsInfoNV::safe_VkGeneratedCommandsInfoNV(const safe_VkGene
     sequencesIndexOffset = copy_src.sequencesIndexOffset;
     pNext = SafePnextCopy(copy_src.pNext);
     if (streamCount && copy_src.pStreams) {
-        pStreams = new VkIndirectCommandsStreamNV[streamCount];
+        pStreams = new (kSafeStructAlloc) VkIndirectCommandsStreamNV[streamCount];
         for (uint32_t i = 0; i < streamCount; ++i) {
             pStreams[i] = copy_src.pStreams[i];
         }
@@ -46380,7 +46486,7 @@ safe_VkGeneratedCommandsInfoNV& safe_VkGeneratedCommandsInfoNV::operator=(const
     sequencesIndexOffset = copy_src.sequencesIndexOffset;
     pNext = SafePnextCopy(copy_src.pNext);
     if (streamCount && copy_src.pStreams) {
-        pStreams = new VkIndirectCommandsStreamNV[streamCount];
+        pStreams = new (kSafeStructAlloc) VkIndirectCommandsStreamNV[streamCount];
         for (uint32_t i = 0; i < streamCount; ++i) {
             pStreams[i] = copy_src.pStreams[i];
         }
@@ -46419,7 +46525,7 @@ void safe_VkGeneratedCommandsInfoNV::initialize(const VkGeneratedCommandsInfoNV*
     sequencesIndexOffset = in_struct->sequencesIndexOffset;
     pNext = SafePnextCopy(in_struct->pNext);
     if (streamCount && in_struct->pStreams) {
-        pStreams = new VkIndirectCommandsStreamNV[streamCount];
+        pStreams = new (kSafeStructAlloc) VkIndirectCommandsStreamNV[streamCount];
         for (uint32_t i = 0; i < streamCount; ++i) {
             pStreams[i] = in_struct->pStreams[i];
         }
@@ -46444,7 +46550,7 @@ void safe_VkGeneratedCommandsInfoNV::initialize(const safe_VkGeneratedCommandsIn
     sequencesIndexOffset = copy_src->sequencesIndexOffset;
     pNext = SafePnextCopy(copy_src->pNext);
     if (streamCount && copy_src->pStreams) {
-        pStreams = new VkIndirectCommandsStreamNV[streamCount];
+        pStreams = new (kSafeStructAlloc) VkIndirectCommandsStreamNV[streamCount];
         for (uint32_t i = 0; i < streamCount; ++i) {
             pStreams[i] = copy_src->pStreams[i];
         }
@@ -46589,7 +46695,7 @@ safe_VkCommandBufferInheritanceViewportScissorInfoNV::safe_VkCommandBufferInheri
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportDepths) {
-        pViewportDepths = new VkViewport(*in_struct->pViewportDepths);
+        pViewportDepths = new (kSafeStructAlloc) VkViewport(*in_struct->pViewportDepths);
     }
 }
 
@@ -46609,7 +46715,7 @@ safe_VkCommandBufferInheritanceViewportScissorInfoNV::safe_VkCommandBufferInheri
     pViewportDepths = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportDepths) {
-        pViewportDepths = new VkViewport(*copy_src.pViewportDepths);
+        pViewportDepths = new (kSafeStructAlloc) VkViewport(*copy_src.pViewportDepths);
     }
 }
 
@@ -46628,7 +46734,7 @@ safe_VkCommandBufferInheritanceViewportScissorInfoNV& safe_VkCommandBufferInheri
     pViewportDepths = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pViewportDepths) {
-        pViewportDepths = new VkViewport(*copy_src.pViewportDepths);
+        pViewportDepths = new (kSafeStructAlloc) VkViewport(*copy_src.pViewportDepths);
     }
 
     return *this;
@@ -46654,7 +46760,7 @@ void safe_VkCommandBufferInheritanceViewportScissorInfoNV::initialize(const VkCo
     pViewportDepths = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pViewportDepths) {
-        pViewportDepths = new VkViewport(*in_struct->pViewportDepths);
+        pViewportDepths = new (kSafeStructAlloc) VkViewport(*in_struct->pViewportDepths);
     }
 }
 
@@ -46666,7 +46772,7 @@ void safe_VkCommandBufferInheritanceViewportScissorInfoNV::initialize(const safe
     pViewportDepths = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pViewportDepths) {
-        pViewportDepths = new VkViewport(*copy_src->pViewportDepths);
+        pViewportDepths = new (kSafeStructAlloc) VkViewport(*copy_src->pViewportDepths);
     }
 }
 
@@ -49382,7 +49488,7 @@ safe_VkImageCompressionControlEXT::safe_VkImageCompressionControlEXT(const VkIma
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFixedRateFlags) {
-        pFixedRateFlags = new VkImageCompressionFixedRateFlagsEXT[in_struct->compressionControlPlaneCount];
+        pFixedRateFlags = new (kSafeStructAlloc) VkImageCompressionFixedRateFlagsEXT[in_struct->compressionControlPlaneCount];
         memcpy ((void *)pFixedRateFlags, (void *)in_struct->pFixedRateFlags, sizeof(VkImageCompressionFixedRateFlagsEXT)*in_struct->compressionControlPlaneCount);
     }
 }
@@ -49403,7 +49509,7 @@ safe_VkImageCompressionControlEXT::safe_VkImageCompressionControlEXT(const safe_
     pFixedRateFlags = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFixedRateFlags) {
-        pFixedRateFlags = new VkImageCompressionFixedRateFlagsEXT[copy_src.compressionControlPlaneCount];
+        pFixedRateFlags = new (kSafeStructAlloc) VkImageCompressionFixedRateFlagsEXT[copy_src.compressionControlPlaneCount];
         memcpy ((void *)pFixedRateFlags, (void *)copy_src.pFixedRateFlags, sizeof(VkImageCompressionFixedRateFlagsEXT)*copy_src.compressionControlPlaneCount);
     }
 }
@@ -49423,7 +49529,7 @@ safe_VkImageCompressionControlEXT& safe_VkImageCompressionControlEXT::operator=(
     pFixedRateFlags = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFixedRateFlags) {
-        pFixedRateFlags = new VkImageCompressionFixedRateFlagsEXT[copy_src.compressionControlPlaneCount];
+        pFixedRateFlags = new (kSafeStructAlloc) VkImageCompressionFixedRateFlagsEXT[copy_src.compressionControlPlaneCount];
         memcpy ((void *)pFixedRateFlags, (void *)copy_src.pFixedRateFlags, sizeof(VkImageCompressionFixedRateFlagsEXT)*copy_src.compressionControlPlaneCount);
     }
 
@@ -49450,7 +49556,7 @@ void safe_VkImageCompressionControlEXT::initialize(const VkImageCompressionContr
     pFixedRateFlags = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFixedRateFlags) {
-        pFixedRateFlags = new VkImageCompressionFixedRateFlagsEXT[in_struct->compressionControlPlaneCount];
+        pFixedRateFlags = new (kSafeStructAlloc) VkImageCompressionFixedRateFlagsEXT[in_struct->compressionControlPlaneCount];
         memcpy ((void *)pFixedRateFlags, (void *)in_struct->pFixedRateFlags, sizeof(VkImageCompressionFixedRateFlagsEXT)*in_struct->compressionControlPlaneCount);
     }
 }
@@ -49463,7 +49569,7 @@ void safe_VkImageCompressionControlEXT::initialize(const safe_VkImageCompression
     pFixedRateFlags = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pFixedRateFlags) {
-        pFixedRateFlags = new VkImageCompressionFixedRateFlagsEXT[copy_src->compressionControlPlaneCount];
+        pFixedRateFlags = new (kSafeStructAlloc) VkImageCompressionFixedRateFlagsEXT[copy_src->compressionControlPlaneCount];
         memcpy ((void *)pFixedRateFlags, (void *)copy_src->pFixedRateFlags, sizeof(VkImageCompressionFixedRateFlagsEXT)*copy_src->compressionControlPlaneCount);
     }
 }
@@ -49901,10 +50007,10 @@ safe_VkDeviceFaultInfoEXT::safe_VkDeviceFaultInfoEXT(const VkDeviceFaultInfoEXT*
         description[i] = in_struct->description[i];
     }
     if (in_struct->pAddressInfos) {
-        pAddressInfos = new VkDeviceFaultAddressInfoEXT(*in_struct->pAddressInfos);
+        pAddressInfos = new (kSafeStructAlloc) VkDeviceFaultAddressInfoEXT(*in_struct->pAddressInfos);
     }
     if (in_struct->pVendorInfos) {
-        pVendorInfos = new VkDeviceFaultVendorInfoEXT(*in_struct->pVendorInfos);
+        pVendorInfos = new (kSafeStructAlloc) VkDeviceFaultVendorInfoEXT(*in_struct->pVendorInfos);
     }
 }
 
@@ -49927,10 +50033,10 @@ safe_VkDeviceFaultInfoEXT::safe_VkDeviceFaultInfoEXT(const safe_VkDeviceFaultInf
         description[i] = copy_src.description[i];
     }
     if (copy_src.pAddressInfos) {
-        pAddressInfos = new VkDeviceFaultAddressInfoEXT(*copy_src.pAddressInfos);
+        pAddressInfos = new (kSafeStructAlloc) VkDeviceFaultAddressInfoEXT(*copy_src.pAddressInfos);
     }
     if (copy_src.pVendorInfos) {
-        pVendorInfos = new VkDeviceFaultVendorInfoEXT(*copy_src.pVendorInfos);
+        pVendorInfos = new (kSafeStructAlloc) VkDeviceFaultVendorInfoEXT(*copy_src.pVendorInfos);
     }
 }
 
@@ -49954,10 +50060,10 @@ safe_VkDeviceFaultInfoEXT& safe_VkDeviceFaultInfoEXT::operator=(const safe_VkDev
         description[i] = copy_src.description[i];
     }
     if (copy_src.pAddressInfos) {
-        pAddressInfos = new VkDeviceFaultAddressInfoEXT(*copy_src.pAddressInfos);
+        pAddressInfos = new (kSafeStructAlloc) VkDeviceFaultAddressInfoEXT(*copy_src.pAddressInfos);
     }
     if (copy_src.pVendorInfos) {
-        pVendorInfos = new VkDeviceFaultVendorInfoEXT(*copy_src.pVendorInfos);
+        pVendorInfos = new (kSafeStructAlloc) VkDeviceFaultVendorInfoEXT(*copy_src.pVendorInfos);
     }
 
     return *this;
@@ -49990,10 +50096,10 @@ void safe_VkDeviceFaultInfoEXT::initialize(const VkDeviceFaultInfoEXT* in_struct
         description[i] = in_struct->description[i];
     }
     if (in_struct->pAddressInfos) {
-        pAddressInfos = new VkDeviceFaultAddressInfoEXT(*in_struct->pAddressInfos);
+        pAddressInfos = new (kSafeStructAlloc) VkDeviceFaultAddressInfoEXT(*in_struct->pAddressInfos);
     }
     if (in_struct->pVendorInfos) {
-        pVendorInfos = new VkDeviceFaultVendorInfoEXT(*in_struct->pVendorInfos);
+        pVendorInfos = new (kSafeStructAlloc) VkDeviceFaultVendorInfoEXT(*in_struct->pVendorInfos);
     }
 }
 
@@ -50008,10 +50114,10 @@ void safe_VkDeviceFaultInfoEXT::initialize(const safe_VkDeviceFaultInfoEXT* copy
         description[i] = copy_src->description[i];
     }
     if (copy_src->pAddressInfos) {
-        pAddressInfos = new VkDeviceFaultAddressInfoEXT(*copy_src->pAddressInfos);
+        pAddressInfos = new (kSafeStructAlloc) VkDeviceFaultAddressInfoEXT(*copy_src->pAddressInfos);
     }
     if (copy_src->pVendorInfos) {
-        pVendorInfos = new VkDeviceFaultVendorInfoEXT(*copy_src->pVendorInfos);
+        pVendorInfos = new (kSafeStructAlloc) VkDeviceFaultVendorInfoEXT(*copy_src->pVendorInfos);
     }
 }
 
@@ -50149,10 +50255,10 @@ safe_VkDirectFBSurfaceCreateInfoEXT::safe_VkDirectFBSurfaceCreateInfoEXT(const V
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->dfb) {
-        dfb = new IDirectFB(*in_struct->dfb);
+        dfb = new (kSafeStructAlloc) IDirectFB(*in_struct->dfb);
     }
     if (in_struct->surface) {
-        surface = new IDirectFBSurface(*in_struct->surface);
+        surface = new (kSafeStructAlloc) IDirectFBSurface(*in_struct->surface);
     }
 }
 
@@ -50172,10 +50278,10 @@ safe_VkDirectFBSurfaceCreateInfoEXT::safe_VkDirectFBSurfaceCreateInfoEXT(const s
     surface = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.dfb) {
-        dfb = new IDirectFB(*copy_src.dfb);
+        dfb = new (kSafeStructAlloc) IDirectFB(*copy_src.dfb);
     }
     if (copy_src.surface) {
-        surface = new IDirectFBSurface(*copy_src.surface);
+        surface = new (kSafeStructAlloc) IDirectFBSurface(*copy_src.surface);
     }
 }
 
@@ -50196,10 +50302,10 @@ safe_VkDirectFBSurfaceCreateInfoEXT& safe_VkDirectFBSurfaceCreateInfoEXT::operat
     surface = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.dfb) {
-        dfb = new IDirectFB(*copy_src.dfb);
+        dfb = new (kSafeStructAlloc) IDirectFB(*copy_src.dfb);
     }
     if (copy_src.surface) {
-        surface = new IDirectFBSurface(*copy_src.surface);
+        surface = new (kSafeStructAlloc) IDirectFBSurface(*copy_src.surface);
     }
 
     return *this;
@@ -50229,10 +50335,10 @@ void safe_VkDirectFBSurfaceCreateInfoEXT::initialize(const VkDirectFBSurfaceCrea
     surface = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->dfb) {
-        dfb = new IDirectFB(*in_struct->dfb);
+        dfb = new (kSafeStructAlloc) IDirectFB(*in_struct->dfb);
     }
     if (in_struct->surface) {
-        surface = new IDirectFBSurface(*in_struct->surface);
+        surface = new (kSafeStructAlloc) IDirectFBSurface(*in_struct->surface);
     }
 }
 
@@ -50244,10 +50350,10 @@ void safe_VkDirectFBSurfaceCreateInfoEXT::initialize(const safe_VkDirectFBSurfac
     surface = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->dfb) {
-        dfb = new IDirectFB(*copy_src->dfb);
+        dfb = new (kSafeStructAlloc) IDirectFB(*copy_src->dfb);
     }
     if (copy_src->surface) {
-        surface = new IDirectFBSurface(*copy_src->surface);
+        surface = new (kSafeStructAlloc) IDirectFBSurface(*copy_src->surface);
     }
 }
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
@@ -50314,7 +50420,7 @@ safe_VkMutableDescriptorTypeListEXT::safe_VkMutableDescriptorTypeListEXT(const V
     pDescriptorTypes(nullptr)
 {
     if (in_struct->pDescriptorTypes) {
-        pDescriptorTypes = new VkDescriptorType[in_struct->descriptorTypeCount];
+        pDescriptorTypes = new (kSafeStructAlloc) VkDescriptorType[in_struct->descriptorTypeCount];
         memcpy ((void *)pDescriptorTypes, (void *)in_struct->pDescriptorTypes, sizeof(VkDescriptorType)*in_struct->descriptorTypeCount);
     }
 }
@@ -50329,7 +50435,7 @@ safe_VkMutableDescriptorTypeListEXT::safe_VkMutableDescriptorTypeListEXT(const s
     descriptorTypeCount = copy_src.descriptorTypeCount;
     pDescriptorTypes = nullptr;
     if (copy_src.pDescriptorTypes) {
-        pDescriptorTypes = new VkDescriptorType[copy_src.descriptorTypeCount];
+        pDescriptorTypes = new (kSafeStructAlloc) VkDescriptorType[copy_src.descriptorTypeCount];
         memcpy ((void *)pDescriptorTypes, (void *)copy_src.pDescriptorTypes, sizeof(VkDescriptorType)*copy_src.descriptorTypeCount);
     }
 }
@@ -50344,7 +50450,7 @@ safe_VkMutableDescriptorTypeListEXT& safe_VkMutableDescriptorTypeListEXT::operat
     descriptorTypeCount = copy_src.descriptorTypeCount;
     pDescriptorTypes = nullptr;
     if (copy_src.pDescriptorTypes) {
-        pDescriptorTypes = new VkDescriptorType[copy_src.descriptorTypeCount];
+        pDescriptorTypes = new (kSafeStructAlloc) VkDescriptorType[copy_src.descriptorTypeCount];
         memcpy ((void *)pDescriptorTypes, (void *)copy_src.pDescriptorTypes, sizeof(VkDescriptorType)*copy_src.descriptorTypeCount);
     }
 
@@ -50364,7 +50470,7 @@ void safe_VkMutableDescriptorTypeListEXT::initialize(const VkMutableDescriptorTy
     descriptorTypeCount = in_struct->descriptorTypeCount;
     pDescriptorTypes = nullptr;
     if (in_struct->pDescriptorTypes) {
-        pDescriptorTypes = new VkDescriptorType[in_struct->descriptorTypeCount];
+        pDescriptorTypes = new (kSafeStructAlloc) VkDescriptorType[in_struct->descriptorTypeCount];
         memcpy ((void *)pDescriptorTypes, (void *)in_struct->pDescriptorTypes, sizeof(VkDescriptorType)*in_struct->descriptorTypeCount);
     }
 }
@@ -50374,7 +50480,7 @@ void safe_VkMutableDescriptorTypeListEXT::initialize(const safe_VkMutableDescrip
     descriptorTypeCount = copy_src->descriptorTypeCount;
     pDescriptorTypes = nullptr;
     if (copy_src->pDescriptorTypes) {
-        pDescriptorTypes = new VkDescriptorType[copy_src->descriptorTypeCount];
+        pDescriptorTypes = new (kSafeStructAlloc) VkDescriptorType[copy_src->descriptorTypeCount];
         memcpy ((void *)pDescriptorTypes, (void *)copy_src->pDescriptorTypes, sizeof(VkDescriptorType)*copy_src->descriptorTypeCount);
     }
 }
@@ -50386,7 +50492,7 @@ safe_VkMutableDescriptorTypeCreateInfoEXT::safe_VkMutableDescriptorTypeCreateInf
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (mutableDescriptorTypeListCount && in_struct->pMutableDescriptorTypeLists) {
-        pMutableDescriptorTypeLists = new safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
+        pMutableDescriptorTypeLists = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
         for (uint32_t i = 0; i < mutableDescriptorTypeListCount; ++i) {
             pMutableDescriptorTypeLists[i].initialize(&in_struct->pMutableDescriptorTypeLists[i]);
         }
@@ -50407,7 +50513,7 @@ safe_VkMutableDescriptorTypeCreateInfoEXT::safe_VkMutableDescriptorTypeCreateInf
     pMutableDescriptorTypeLists = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (mutableDescriptorTypeListCount && copy_src.pMutableDescriptorTypeLists) {
-        pMutableDescriptorTypeLists = new safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
+        pMutableDescriptorTypeLists = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
         for (uint32_t i = 0; i < mutableDescriptorTypeListCount; ++i) {
             pMutableDescriptorTypeLists[i].initialize(&copy_src.pMutableDescriptorTypeLists[i]);
         }
@@ -50428,7 +50534,7 @@ safe_VkMutableDescriptorTypeCreateInfoEXT& safe_VkMutableDescriptorTypeCreateInf
     pMutableDescriptorTypeLists = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (mutableDescriptorTypeListCount && copy_src.pMutableDescriptorTypeLists) {
-        pMutableDescriptorTypeLists = new safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
+        pMutableDescriptorTypeLists = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
         for (uint32_t i = 0; i < mutableDescriptorTypeListCount; ++i) {
             pMutableDescriptorTypeLists[i].initialize(&copy_src.pMutableDescriptorTypeLists[i]);
         }
@@ -50456,7 +50562,7 @@ void safe_VkMutableDescriptorTypeCreateInfoEXT::initialize(const VkMutableDescri
     pMutableDescriptorTypeLists = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (mutableDescriptorTypeListCount && in_struct->pMutableDescriptorTypeLists) {
-        pMutableDescriptorTypeLists = new safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
+        pMutableDescriptorTypeLists = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
         for (uint32_t i = 0; i < mutableDescriptorTypeListCount; ++i) {
             pMutableDescriptorTypeLists[i].initialize(&in_struct->pMutableDescriptorTypeLists[i]);
         }
@@ -50470,7 +50576,7 @@ void safe_VkMutableDescriptorTypeCreateInfoEXT::initialize(const safe_VkMutableD
     pMutableDescriptorTypeLists = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (mutableDescriptorTypeListCount && copy_src->pMutableDescriptorTypeLists) {
-        pMutableDescriptorTypeLists = new safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
+        pMutableDescriptorTypeLists = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeListEXT[mutableDescriptorTypeListCount];
         for (uint32_t i = 0; i < mutableDescriptorTypeListCount; ++i) {
             pMutableDescriptorTypeLists[i].initialize(&copy_src->pMutableDescriptorTypeLists[i]);
         }
@@ -52011,7 +52117,7 @@ safe_VkImageFormatConstraintsInfoFUCHSIA::safe_VkImageFormatConstraintsInfoFUCHS
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (colorSpaceCount && in_struct->pColorSpaces) {
-        pColorSpaces = new safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
+        pColorSpaces = new (kSafeStructAlloc) safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
         for (uint32_t i = 0; i < colorSpaceCount; ++i) {
             pColorSpaces[i].initialize(&in_struct->pColorSpaces[i]);
         }
@@ -52039,7 +52145,7 @@ safe_VkImageFormatConstraintsInfoFUCHSIA::safe_VkImageFormatConstraintsInfoFUCHS
     pColorSpaces = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (colorSpaceCount && copy_src.pColorSpaces) {
-        pColorSpaces = new safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
+        pColorSpaces = new (kSafeStructAlloc) safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
         for (uint32_t i = 0; i < colorSpaceCount; ++i) {
             pColorSpaces[i].initialize(&copy_src.pColorSpaces[i]);
         }
@@ -52064,7 +52170,7 @@ safe_VkImageFormatConstraintsInfoFUCHSIA& safe_VkImageFormatConstraintsInfoFUCHS
     pColorSpaces = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (colorSpaceCount && copy_src.pColorSpaces) {
-        pColorSpaces = new safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
+        pColorSpaces = new (kSafeStructAlloc) safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
         for (uint32_t i = 0; i < colorSpaceCount; ++i) {
             pColorSpaces[i].initialize(&copy_src.pColorSpaces[i]);
         }
@@ -52096,7 +52202,7 @@ void safe_VkImageFormatConstraintsInfoFUCHSIA::initialize(const VkImageFormatCon
     pColorSpaces = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (colorSpaceCount && in_struct->pColorSpaces) {
-        pColorSpaces = new safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
+        pColorSpaces = new (kSafeStructAlloc) safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
         for (uint32_t i = 0; i < colorSpaceCount; ++i) {
             pColorSpaces[i].initialize(&in_struct->pColorSpaces[i]);
         }
@@ -52114,7 +52220,7 @@ void safe_VkImageFormatConstraintsInfoFUCHSIA::initialize(const safe_VkImageForm
     pColorSpaces = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (colorSpaceCount && copy_src->pColorSpaces) {
-        pColorSpaces = new safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
+        pColorSpaces = new (kSafeStructAlloc) safe_VkSysmemColorSpaceFUCHSIA[colorSpaceCount];
         for (uint32_t i = 0; i < colorSpaceCount; ++i) {
             pColorSpaces[i].initialize(&copy_src->pColorSpaces[i]);
         }
@@ -52134,7 +52240,7 @@ safe_VkImageConstraintsInfoFUCHSIA::safe_VkImageConstraintsInfoFUCHSIA(const VkI
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (formatConstraintsCount && in_struct->pFormatConstraints) {
-        pFormatConstraints = new safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
+        pFormatConstraints = new (kSafeStructAlloc) safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
         for (uint32_t i = 0; i < formatConstraintsCount; ++i) {
             pFormatConstraints[i].initialize(&in_struct->pFormatConstraints[i]);
         }
@@ -52158,7 +52264,7 @@ safe_VkImageConstraintsInfoFUCHSIA::safe_VkImageConstraintsInfoFUCHSIA(const saf
     flags = copy_src.flags;
     pNext = SafePnextCopy(copy_src.pNext);
     if (formatConstraintsCount && copy_src.pFormatConstraints) {
-        pFormatConstraints = new safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
+        pFormatConstraints = new (kSafeStructAlloc) safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
         for (uint32_t i = 0; i < formatConstraintsCount; ++i) {
             pFormatConstraints[i].initialize(&copy_src.pFormatConstraints[i]);
         }
@@ -52181,7 +52287,7 @@ safe_VkImageConstraintsInfoFUCHSIA& safe_VkImageConstraintsInfoFUCHSIA::operator
     flags = copy_src.flags;
     pNext = SafePnextCopy(copy_src.pNext);
     if (formatConstraintsCount && copy_src.pFormatConstraints) {
-        pFormatConstraints = new safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
+        pFormatConstraints = new (kSafeStructAlloc) safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
         for (uint32_t i = 0; i < formatConstraintsCount; ++i) {
             pFormatConstraints[i].initialize(&copy_src.pFormatConstraints[i]);
         }
@@ -52211,7 +52317,7 @@ void safe_VkImageConstraintsInfoFUCHSIA::initialize(const VkImageConstraintsInfo
     flags = in_struct->flags;
     pNext = SafePnextCopy(in_struct->pNext);
     if (formatConstraintsCount && in_struct->pFormatConstraints) {
-        pFormatConstraints = new safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
+        pFormatConstraints = new (kSafeStructAlloc) safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
         for (uint32_t i = 0; i < formatConstraintsCount; ++i) {
             pFormatConstraints[i].initialize(&in_struct->pFormatConstraints[i]);
         }
@@ -52227,7 +52333,7 @@ void safe_VkImageConstraintsInfoFUCHSIA::initialize(const safe_VkImageConstraint
     flags = copy_src->flags;
     pNext = SafePnextCopy(copy_src->pNext);
     if (formatConstraintsCount && copy_src->pFormatConstraints) {
-        pFormatConstraints = new safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
+        pFormatConstraints = new (kSafeStructAlloc) safe_VkImageFormatConstraintsInfoFUCHSIA[formatConstraintsCount];
         for (uint32_t i = 0; i < formatConstraintsCount; ++i) {
             pFormatConstraints[i].initialize(&copy_src->pFormatConstraints[i]);
         }
@@ -52957,10 +53063,10 @@ safe_VkScreenSurfaceCreateInfoQNX::safe_VkScreenSurfaceCreateInfoQNX(const VkScr
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->context) {
-        context = new _screen_context(*in_struct->context);
+        context = new (kSafeStructAlloc) _screen_context(*in_struct->context);
     }
     if (in_struct->window) {
-        window = new _screen_window(*in_struct->window);
+        window = new (kSafeStructAlloc) _screen_window(*in_struct->window);
     }
 }
 
@@ -52980,10 +53086,10 @@ safe_VkScreenSurfaceCreateInfoQNX::safe_VkScreenSurfaceCreateInfoQNX(const safe_
     window = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.context) {
-        context = new _screen_context(*copy_src.context);
+        context = new (kSafeStructAlloc) _screen_context(*copy_src.context);
     }
     if (copy_src.window) {
-        window = new _screen_window(*copy_src.window);
+        window = new (kSafeStructAlloc) _screen_window(*copy_src.window);
     }
 }
 
@@ -53004,10 +53110,10 @@ safe_VkScreenSurfaceCreateInfoQNX& safe_VkScreenSurfaceCreateInfoQNX::operator=(
     window = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.context) {
-        context = new _screen_context(*copy_src.context);
+        context = new (kSafeStructAlloc) _screen_context(*copy_src.context);
     }
     if (copy_src.window) {
-        window = new _screen_window(*copy_src.window);
+        window = new (kSafeStructAlloc) _screen_window(*copy_src.window);
     }
 
     return *this;
@@ -53037,10 +53143,10 @@ void safe_VkScreenSurfaceCreateInfoQNX::initialize(const VkScreenSurfaceCreateIn
     window = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->context) {
-        context = new _screen_context(*in_struct->context);
+        context = new (kSafeStructAlloc) _screen_context(*in_struct->context);
     }
     if (in_struct->window) {
-        window = new _screen_window(*in_struct->window);
+        window = new (kSafeStructAlloc) _screen_window(*in_struct->window);
     }
 }
 
@@ -53052,10 +53158,10 @@ void safe_VkScreenSurfaceCreateInfoQNX::initialize(const safe_VkScreenSurfaceCre
     window = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->context) {
-        context = new _screen_context(*copy_src->context);
+        context = new (kSafeStructAlloc) _screen_context(*copy_src->context);
     }
     if (copy_src->window) {
-        window = new _screen_window(*copy_src->window);
+        window = new (kSafeStructAlloc) _screen_window(*copy_src->window);
     }
 }
 #endif // VK_USE_PLATFORM_SCREEN_QNX
@@ -53124,7 +53230,7 @@ safe_VkPipelineColorWriteCreateInfoEXT::safe_VkPipelineColorWriteCreateInfoEXT(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorWriteEnables) {
-        pColorWriteEnables = new VkBool32[in_struct->attachmentCount];
+        pColorWriteEnables = new (kSafeStructAlloc) VkBool32[in_struct->attachmentCount];
         memcpy ((void *)pColorWriteEnables, (void *)in_struct->pColorWriteEnables, sizeof(VkBool32)*in_struct->attachmentCount);
     }
 }
@@ -53143,7 +53249,7 @@ safe_VkPipelineColorWriteCreateInfoEXT::safe_VkPipelineColorWriteCreateInfoEXT(c
     pColorWriteEnables = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorWriteEnables) {
-        pColorWriteEnables = new VkBool32[copy_src.attachmentCount];
+        pColorWriteEnables = new (kSafeStructAlloc) VkBool32[copy_src.attachmentCount];
         memcpy ((void *)pColorWriteEnables, (void *)copy_src.pColorWriteEnables, sizeof(VkBool32)*copy_src.attachmentCount);
     }
 }
@@ -53162,7 +53268,7 @@ safe_VkPipelineColorWriteCreateInfoEXT& safe_VkPipelineColorWriteCreateInfoEXT::
     pColorWriteEnables = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pColorWriteEnables) {
-        pColorWriteEnables = new VkBool32[copy_src.attachmentCount];
+        pColorWriteEnables = new (kSafeStructAlloc) VkBool32[copy_src.attachmentCount];
         memcpy ((void *)pColorWriteEnables, (void *)copy_src.pColorWriteEnables, sizeof(VkBool32)*copy_src.attachmentCount);
     }
 
@@ -53188,7 +53294,7 @@ void safe_VkPipelineColorWriteCreateInfoEXT::initialize(const VkPipelineColorWri
     pColorWriteEnables = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pColorWriteEnables) {
-        pColorWriteEnables = new VkBool32[in_struct->attachmentCount];
+        pColorWriteEnables = new (kSafeStructAlloc) VkBool32[in_struct->attachmentCount];
         memcpy ((void *)pColorWriteEnables, (void *)in_struct->pColorWriteEnables, sizeof(VkBool32)*in_struct->attachmentCount);
     }
 }
@@ -53200,7 +53306,7 @@ void safe_VkPipelineColorWriteCreateInfoEXT::initialize(const safe_VkPipelineCol
     pColorWriteEnables = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pColorWriteEnables) {
-        pColorWriteEnables = new VkBool32[copy_src->attachmentCount];
+        pColorWriteEnables = new (kSafeStructAlloc) VkBool32[copy_src->attachmentCount];
         memcpy ((void *)pColorWriteEnables, (void *)copy_src->pColorWriteEnables, sizeof(VkBool32)*copy_src->attachmentCount);
     }
 }
@@ -53618,13 +53724,13 @@ safe_VkMicromapBuildInfoEXT::safe_VkMicromapBuildInfoEXT(const VkMicromapBuildIn
     pNext = SafePnextCopy(in_struct->pNext);
    pNext = SafePnextCopy(in_struct->pNext);
    if (in_struct->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);
    }
    if (in_struct->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[in_struct->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];
        for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -53660,13 +53766,13 @@ safe_VkMicromapBuildInfoEXT::safe_VkMicromapBuildInfoEXT(const safe_VkMicromapBu
     pNext = SafePnextCopy(copy_src.pNext);
    pNext = SafePnextCopy(copy_src.pNext);
    if (copy_src.pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src.usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src.usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src.pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src.usageCountsCount);
    }
    if (copy_src.ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[copy_src.usageCountsCount];
+       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src.usageCountsCount];
        for (uint32_t i = 0; i < copy_src.usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -53704,13 +53810,13 @@ safe_VkMicromapBuildInfoEXT& safe_VkMicromapBuildInfoEXT::operator=(const safe_V
     pNext = SafePnextCopy(copy_src.pNext);
    pNext = SafePnextCopy(copy_src.pNext);
    if (copy_src.pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src.usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src.usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src.pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src.usageCountsCount);
    }
    if (copy_src.ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[copy_src.usageCountsCount];
+       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src.usageCountsCount];
        for (uint32_t i = 0; i < copy_src.usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -53763,13 +53869,13 @@ void safe_VkMicromapBuildInfoEXT::initialize(const VkMicromapBuildInfoEXT* in_st
     pNext = SafePnextCopy(in_struct->pNext);
    pNext = SafePnextCopy(in_struct->pNext);
    if (in_struct->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);
    }
    if (in_struct->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[in_struct->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];
        for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -53792,13 +53898,13 @@ void safe_VkMicromapBuildInfoEXT::initialize(const safe_VkMicromapBuildInfoEXT*
     pNext = SafePnextCopy(copy_src->pNext);
    pNext = SafePnextCopy(copy_src->pNext);
    if (copy_src->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src->pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src->usageCountsCount);
    }
    if (copy_src->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[copy_src->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src->usageCountsCount];
        for (uint32_t i = 0; i < copy_src->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -54026,7 +54132,7 @@ safe_VkMicromapVersionInfoEXT::safe_VkMicromapVersionInfoEXT(const VkMicromapVer
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)in_struct->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -54043,7 +54149,7 @@ safe_VkMicromapVersionInfoEXT::safe_VkMicromapVersionInfoEXT(const safe_VkMicrom
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src.pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -54061,7 +54167,7 @@ safe_VkMicromapVersionInfoEXT& safe_VkMicromapVersionInfoEXT::operator=(const sa
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src.pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 
@@ -54086,7 +54192,7 @@ void safe_VkMicromapVersionInfoEXT::initialize(const VkMicromapVersionInfoEXT* i
     pVersionData = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)in_struct->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -54097,7 +54203,7 @@ void safe_VkMicromapVersionInfoEXT::initialize(const safe_VkMicromapVersionInfoE
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -54386,13 +54492,13 @@ safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::safe_VkAccelerationStru
     pNext = SafePnextCopy(in_struct->pNext);
    pNext = SafePnextCopy(in_struct->pNext);
    if (in_struct->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);
    }
    if (in_struct->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[in_struct->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];
        for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -54424,13 +54530,13 @@ safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::safe_VkAccelerationStru
     pNext = SafePnextCopy(copy_src.pNext);
    pNext = SafePnextCopy(copy_src.pNext);
    if (copy_src.pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src.usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src.usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src.pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src.usageCountsCount);
    }
    if (copy_src.ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[copy_src.usageCountsCount];
+       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src.usageCountsCount];
        for (uint32_t i = 0; i < copy_src.usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -54465,13 +54571,13 @@ safe_VkAccelerationStructureTrianglesOpacityMicromapEXT& safe_VkAccelerationStru
     pNext = SafePnextCopy(copy_src.pNext);
    pNext = SafePnextCopy(copy_src.pNext);
    if (copy_src.pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src.usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src.usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src.pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src.usageCountsCount);
    }
    if (copy_src.ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[copy_src.usageCountsCount];
+       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src.usageCountsCount];
        for (uint32_t i = 0; i < copy_src.usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src.ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -54521,13 +54627,13 @@ void safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::initialize(const V
     pNext = SafePnextCopy(in_struct->pNext);
    pNext = SafePnextCopy(in_struct->pNext);
    if (in_struct->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);
    }
    if (in_struct->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[in_struct->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];
        for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -54547,13 +54653,13 @@ void safe_VkAccelerationStructureTrianglesOpacityMicromapEXT::initialize(const s
     pNext = SafePnextCopy(copy_src->pNext);
    pNext = SafePnextCopy(copy_src->pNext);
    if (copy_src->pUsageCounts) {
-       pUsageCounts = new VkMicromapUsageEXT[copy_src->usageCountsCount];
+       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[copy_src->usageCountsCount];
        memcpy ((void *)pUsageCounts, (void *)copy_src->pUsageCounts, sizeof(VkMicromapUsageEXT)*copy_src->usageCountsCount);
    }
    if (copy_src->ppUsageCounts) {
-       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[copy_src->usageCountsCount];
+       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[copy_src->usageCountsCount];
        for (uint32_t i = 0; i < copy_src->usageCountsCount; ++i) {
-           pointer_array[i] = new VkMicromapUsageEXT(*copy_src->ppUsageCounts[i]);
+           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*copy_src->ppUsageCounts[i]);
        }
        ppUsageCounts = pointer_array;
    }
@@ -55150,7 +55256,7 @@ safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::safe_VkSubpassFragmentDensity
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFragmentDensityOffsets) {
-        pFragmentDensityOffsets = new VkOffset2D[in_struct->fragmentDensityOffsetCount];
+        pFragmentDensityOffsets = new (kSafeStructAlloc) VkOffset2D[in_struct->fragmentDensityOffsetCount];
         memcpy ((void *)pFragmentDensityOffsets, (void *)in_struct->pFragmentDensityOffsets, sizeof(VkOffset2D)*in_struct->fragmentDensityOffsetCount);
     }
 }
@@ -55169,7 +55275,7 @@ safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::safe_VkSubpassFragmentDensity
     pFragmentDensityOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFragmentDensityOffsets) {
-        pFragmentDensityOffsets = new VkOffset2D[copy_src.fragmentDensityOffsetCount];
+        pFragmentDensityOffsets = new (kSafeStructAlloc) VkOffset2D[copy_src.fragmentDensityOffsetCount];
         memcpy ((void *)pFragmentDensityOffsets, (void *)copy_src.pFragmentDensityOffsets, sizeof(VkOffset2D)*copy_src.fragmentDensityOffsetCount);
     }
 }
@@ -55188,7 +55294,7 @@ safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM& safe_VkSubpassFragmentDensity
     pFragmentDensityOffsets = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pFragmentDensityOffsets) {
-        pFragmentDensityOffsets = new VkOffset2D[copy_src.fragmentDensityOffsetCount];
+        pFragmentDensityOffsets = new (kSafeStructAlloc) VkOffset2D[copy_src.fragmentDensityOffsetCount];
         memcpy ((void *)pFragmentDensityOffsets, (void *)copy_src.pFragmentDensityOffsets, sizeof(VkOffset2D)*copy_src.fragmentDensityOffsetCount);
     }
 
@@ -55214,7 +55320,7 @@ void safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::initialize(const VkSubpa
     pFragmentDensityOffsets = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pFragmentDensityOffsets) {
-        pFragmentDensityOffsets = new VkOffset2D[in_struct->fragmentDensityOffsetCount];
+        pFragmentDensityOffsets = new (kSafeStructAlloc) VkOffset2D[in_struct->fragmentDensityOffsetCount];
         memcpy ((void *)pFragmentDensityOffsets, (void *)in_struct->pFragmentDensityOffsets, sizeof(VkOffset2D)*in_struct->fragmentDensityOffsetCount);
     }
 }
@@ -55226,7 +55332,7 @@ void safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM::initialize(const safe_Vk
     pFragmentDensityOffsets = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pFragmentDensityOffsets) {
-        pFragmentDensityOffsets = new VkOffset2D[copy_src->fragmentDensityOffsetCount];
+        pFragmentDensityOffsets = new (kSafeStructAlloc) VkOffset2D[copy_src->fragmentDensityOffsetCount];
         memcpy ((void *)pFragmentDensityOffsets, (void *)copy_src->pFragmentDensityOffsets, sizeof(VkOffset2D)*copy_src->fragmentDensityOffsetCount);
     }
 }
@@ -55963,7 +56069,7 @@ safe_VkRenderPassCreationFeedbackCreateInfoEXT::safe_VkRenderPassCreationFeedbac
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pRenderPassFeedback) {
-        pRenderPassFeedback = new VkRenderPassCreationFeedbackInfoEXT(*in_struct->pRenderPassFeedback);
+        pRenderPassFeedback = new (kSafeStructAlloc) VkRenderPassCreationFeedbackInfoEXT(*in_struct->pRenderPassFeedback);
     }
 }
 
@@ -55979,7 +56085,7 @@ safe_VkRenderPassCreationFeedbackCreateInfoEXT::safe_VkRenderPassCreationFeedbac
     pRenderPassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pRenderPassFeedback) {
-        pRenderPassFeedback = new VkRenderPassCreationFeedbackInfoEXT(*copy_src.pRenderPassFeedback);
+        pRenderPassFeedback = new (kSafeStructAlloc) VkRenderPassCreationFeedbackInfoEXT(*copy_src.pRenderPassFeedback);
     }
 }
 
@@ -55996,7 +56102,7 @@ safe_VkRenderPassCreationFeedbackCreateInfoEXT& safe_VkRenderPassCreationFeedbac
     pRenderPassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pRenderPassFeedback) {
-        pRenderPassFeedback = new VkRenderPassCreationFeedbackInfoEXT(*copy_src.pRenderPassFeedback);
+        pRenderPassFeedback = new (kSafeStructAlloc) VkRenderPassCreationFeedbackInfoEXT(*copy_src.pRenderPassFeedback);
     }
 
     return *this;
@@ -56020,7 +56126,7 @@ void safe_VkRenderPassCreationFeedbackCreateInfoEXT::initialize(const VkRenderPa
     pRenderPassFeedback = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pRenderPassFeedback) {
-        pRenderPassFeedback = new VkRenderPassCreationFeedbackInfoEXT(*in_struct->pRenderPassFeedback);
+        pRenderPassFeedback = new (kSafeStructAlloc) VkRenderPassCreationFeedbackInfoEXT(*in_struct->pRenderPassFeedback);
     }
 }
 
@@ -56030,7 +56136,7 @@ void safe_VkRenderPassCreationFeedbackCreateInfoEXT::initialize(const safe_VkRen
     pRenderPassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pRenderPassFeedback) {
-        pRenderPassFeedback = new VkRenderPassCreationFeedbackInfoEXT(*copy_src->pRenderPassFeedback);
+        pRenderPassFeedback = new (kSafeStructAlloc) VkRenderPassCreationFeedbackInfoEXT(*copy_src->pRenderPassFeedback);
     }
 }
 
@@ -56040,7 +56146,7 @@ safe_VkRenderPassSubpassFeedbackCreateInfoEXT::safe_VkRenderPassSubpassFeedbackC
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSubpassFeedback) {
-        pSubpassFeedback = new VkRenderPassSubpassFeedbackInfoEXT(*in_struct->pSubpassFeedback);
+        pSubpassFeedback = new (kSafeStructAlloc) VkRenderPassSubpassFeedbackInfoEXT(*in_struct->pSubpassFeedback);
     }
 }
 
@@ -56056,7 +56162,7 @@ safe_VkRenderPassSubpassFeedbackCreateInfoEXT::safe_VkRenderPassSubpassFeedbackC
     pSubpassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSubpassFeedback) {
-        pSubpassFeedback = new VkRenderPassSubpassFeedbackInfoEXT(*copy_src.pSubpassFeedback);
+        pSubpassFeedback = new (kSafeStructAlloc) VkRenderPassSubpassFeedbackInfoEXT(*copy_src.pSubpassFeedback);
     }
 }
 
@@ -56073,7 +56179,7 @@ safe_VkRenderPassSubpassFeedbackCreateInfoEXT& safe_VkRenderPassSubpassFeedbackC
     pSubpassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pSubpassFeedback) {
-        pSubpassFeedback = new VkRenderPassSubpassFeedbackInfoEXT(*copy_src.pSubpassFeedback);
+        pSubpassFeedback = new (kSafeStructAlloc) VkRenderPassSubpassFeedbackInfoEXT(*copy_src.pSubpassFeedback);
     }
 
     return *this;
@@ -56097,7 +56203,7 @@ void safe_VkRenderPassSubpassFeedbackCreateInfoEXT::initialize(const VkRenderPas
     pSubpassFeedback = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pSubpassFeedback) {
-        pSubpassFeedback = new VkRenderPassSubpassFeedbackInfoEXT(*in_struct->pSubpassFeedback);
+        pSubpassFeedback = new (kSafeStructAlloc) VkRenderPassSubpassFeedbackInfoEXT(*in_struct->pSubpassFeedback);
     }
 }
 
@@ -56107,7 +56213,7 @@ void safe_VkRenderPassSubpassFeedbackCreateInfoEXT::initialize(const safe_VkRend
     pSubpassFeedback = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pSubpassFeedback) {
-        pSubpassFeedback = new VkRenderPassSubpassFeedbackInfoEXT(*copy_src->pSubpassFeedback);
+        pSubpassFeedback = new (kSafeStructAlloc) VkRenderPassSubpassFeedbackInfoEXT(*copy_src->pSubpassFeedback);
     }
 }
 
@@ -56239,7 +56345,7 @@ safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::safe_VkPipelineShaderSt
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pIdentifier) {
-        pIdentifier = new uint8_t[in_struct->identifierSize];
+        pIdentifier = new (kSafeStructAlloc) uint8_t[in_struct->identifierSize];
         memcpy ((void *)pIdentifier, (void *)in_struct->pIdentifier, sizeof(uint8_t)*in_struct->identifierSize);
     }
 }
@@ -56258,7 +56364,7 @@ safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::safe_VkPipelineShaderSt
     pIdentifier = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pIdentifier) {
-        pIdentifier = new uint8_t[copy_src.identifierSize];
+        pIdentifier = new (kSafeStructAlloc) uint8_t[copy_src.identifierSize];
         memcpy ((void *)pIdentifier, (void *)copy_src.pIdentifier, sizeof(uint8_t)*copy_src.identifierSize);
     }
 }
@@ -56277,7 +56383,7 @@ safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT& safe_VkPipelineShaderSt
     pIdentifier = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pIdentifier) {
-        pIdentifier = new uint8_t[copy_src.identifierSize];
+        pIdentifier = new (kSafeStructAlloc) uint8_t[copy_src.identifierSize];
         memcpy ((void *)pIdentifier, (void *)copy_src.pIdentifier, sizeof(uint8_t)*copy_src.identifierSize);
     }
 
@@ -56303,7 +56409,7 @@ void safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::initialize(const V
     pIdentifier = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pIdentifier) {
-        pIdentifier = new uint8_t[in_struct->identifierSize];
+        pIdentifier = new (kSafeStructAlloc) uint8_t[in_struct->identifierSize];
         memcpy ((void *)pIdentifier, (void *)in_struct->pIdentifier, sizeof(uint8_t)*in_struct->identifierSize);
     }
 }
@@ -56315,7 +56421,7 @@ void safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT::initialize(const s
     pIdentifier = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pIdentifier) {
-        pIdentifier = new uint8_t[copy_src->identifierSize];
+        pIdentifier = new (kSafeStructAlloc) uint8_t[copy_src->identifierSize];
         memcpy ((void *)pIdentifier, (void *)copy_src->pIdentifier, sizeof(uint8_t)*copy_src->identifierSize);
     }
 }
@@ -56855,7 +56961,7 @@ safe_VkOpticalFlowExecuteInfoNV::safe_VkOpticalFlowExecuteInfoNV(const VkOptical
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pRegions) {
-        pRegions = new VkRect2D[in_struct->regionCount];
+        pRegions = new (kSafeStructAlloc) VkRect2D[in_struct->regionCount];
         memcpy ((void *)pRegions, (void *)in_struct->pRegions, sizeof(VkRect2D)*in_struct->regionCount);
     }
 }
@@ -56876,7 +56982,7 @@ safe_VkOpticalFlowExecuteInfoNV::safe_VkOpticalFlowExecuteInfoNV(const safe_VkOp
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pRegions) {
-        pRegions = new VkRect2D[copy_src.regionCount];
+        pRegions = new (kSafeStructAlloc) VkRect2D[copy_src.regionCount];
         memcpy ((void *)pRegions, (void *)copy_src.pRegions, sizeof(VkRect2D)*copy_src.regionCount);
     }
 }
@@ -56896,7 +57002,7 @@ safe_VkOpticalFlowExecuteInfoNV& safe_VkOpticalFlowExecuteInfoNV::operator=(cons
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pRegions) {
-        pRegions = new VkRect2D[copy_src.regionCount];
+        pRegions = new (kSafeStructAlloc) VkRect2D[copy_src.regionCount];
         memcpy ((void *)pRegions, (void *)copy_src.pRegions, sizeof(VkRect2D)*copy_src.regionCount);
     }
 
@@ -56923,7 +57029,7 @@ void safe_VkOpticalFlowExecuteInfoNV::initialize(const VkOpticalFlowExecuteInfoN
     pRegions = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pRegions) {
-        pRegions = new VkRect2D[in_struct->regionCount];
+        pRegions = new (kSafeStructAlloc) VkRect2D[in_struct->regionCount];
         memcpy ((void *)pRegions, (void *)in_struct->pRegions, sizeof(VkRect2D)*in_struct->regionCount);
     }
 }
@@ -56936,7 +57042,7 @@ void safe_VkOpticalFlowExecuteInfoNV::initialize(const safe_VkOpticalFlowExecute
     pRegions = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pRegions) {
-        pRegions = new VkRect2D[copy_src->regionCount];
+        pRegions = new (kSafeStructAlloc) VkRect2D[copy_src->regionCount];
         memcpy ((void *)pRegions, (void *)copy_src->pRegions, sizeof(VkRect2D)*copy_src->regionCount);
     }
 }
@@ -57837,12 +57943,12 @@ safe_VkAccelerationStructureBuildGeometryInfoKHR::safe_VkAccelerationStructureBu
     pNext = SafePnextCopy(in_struct->pNext);
     if (geometryCount) {
         if ( in_struct->ppGeometries) {
-            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];
+            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
-                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);
+                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);
             }
         } else {
-            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];
+            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
                 (pGeometries)[i] = safe_VkAccelerationStructureGeometryKHR(&(in_struct->pGeometries)[i], is_host, &build_range_infos[i]);
             }
@@ -57877,12 +57983,12 @@ safe_VkAccelerationStructureBuildGeometryInfoKHR::safe_VkAccelerationStructureBu
     scratchData.initialize(&copy_src.scratchData);
     if (geometryCount) {
         if ( copy_src.ppGeometries) {
-            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];
+            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
-                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);
+                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);
             }
         } else {
-            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];
+            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
                 pGeometries[i] = safe_VkAccelerationStructureGeometryKHR(copy_src.pGeometries[i]);
             }
@@ -57917,12 +58023,12 @@ safe_VkAccelerationStructureBuildGeometryInfoKHR& safe_VkAccelerationStructureBu
     scratchData.initialize(&copy_src.scratchData);
     if (geometryCount) {
         if ( copy_src.ppGeometries) {
-            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];
+            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
-                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);
+                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);
             }
         } else {
-            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];
+            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
                 pGeometries[i] = safe_VkAccelerationStructureGeometryKHR(copy_src.pGeometries[i]);
             }
@@ -57971,12 +58077,12 @@ void safe_VkAccelerationStructureBuildGeometryInfoKHR::initialize(const VkAccele
     pNext = SafePnextCopy(in_struct->pNext);
     if (geometryCount) {
         if ( in_struct->ppGeometries) {
-            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];
+            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
-                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);
+                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);
             }
         } else {
-            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];
+            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
                 (pGeometries)[i] = safe_VkAccelerationStructureGeometryKHR(&(in_struct->pGeometries)[i], is_host, &build_range_infos[i]);
             }
@@ -57998,12 +58104,12 @@ void safe_VkAccelerationStructureBuildGeometryInfoKHR::initialize(const safe_VkA
     scratchData.initialize(&copy_src->scratchData);
     if (geometryCount) {
         if ( copy_src->ppGeometries) {
-            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];
+            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
-                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(*copy_src->ppGeometries[i]);
+                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(*copy_src->ppGeometries[i]);
             }
         } else {
-            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];
+            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];
             for (uint32_t i = 0; i < geometryCount; ++i) {
                 pGeometries[i] = safe_VkAccelerationStructureGeometryKHR(copy_src->pGeometries[i]);
             }
@@ -58104,7 +58210,7 @@ safe_VkWriteDescriptorSetAccelerationStructureKHR::safe_VkWriteDescriptorSetAcce
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureKHR[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureKHR[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
         }
@@ -58125,7 +58231,7 @@ safe_VkWriteDescriptorSetAccelerationStructureKHR::safe_VkWriteDescriptorSetAcce
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (accelerationStructureCount && copy_src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureKHR[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureKHR[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src.pAccelerationStructures[i];
         }
@@ -58146,7 +58252,7 @@ safe_VkWriteDescriptorSetAccelerationStructureKHR& safe_VkWriteDescriptorSetAcce
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (accelerationStructureCount && copy_src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureKHR[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureKHR[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src.pAccelerationStructures[i];
         }
@@ -58174,7 +58280,7 @@ void safe_VkWriteDescriptorSetAccelerationStructureKHR::initialize(const VkWrite
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureKHR[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureKHR[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
         }
@@ -58188,7 +58294,7 @@ void safe_VkWriteDescriptorSetAccelerationStructureKHR::initialize(const safe_Vk
     pAccelerationStructures = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (accelerationStructureCount && copy_src->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureKHR[accelerationStructureCount];
+        pAccelerationStructures = new (kSafeStructAlloc) VkAccelerationStructureKHR[accelerationStructureCount];
         for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
             pAccelerationStructures[i] = copy_src->pAccelerationStructures[i];
         }
@@ -58435,7 +58541,7 @@ safe_VkAccelerationStructureVersionInfoKHR::safe_VkAccelerationStructureVersionI
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)in_struct->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -58452,7 +58558,7 @@ safe_VkAccelerationStructureVersionInfoKHR::safe_VkAccelerationStructureVersionI
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src.pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -58470,7 +58576,7 @@ safe_VkAccelerationStructureVersionInfoKHR& safe_VkAccelerationStructureVersionI
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src.pNext);
     if (copy_src.pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src.pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 
@@ -58495,7 +58601,7 @@ void safe_VkAccelerationStructureVersionInfoKHR::initialize(const VkAcceleration
     pVersionData = nullptr;
     pNext = SafePnextCopy(in_struct->pNext);
     if (in_struct->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)in_struct->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -58506,7 +58612,7 @@ void safe_VkAccelerationStructureVersionInfoKHR::initialize(const safe_VkAcceler
     pVersionData = nullptr;
     pNext = SafePnextCopy(copy_src->pNext);
     if (copy_src->pVersionData) {
-        pVersionData = new uint8_t[2*VK_UUID_SIZE];
+        pVersionData = new (kSafeStructAlloc) uint8_t[2*VK_UUID_SIZE];
         memcpy ((void *)pVersionData, (void *)copy_src->pVersionData, sizeof(uint8_t)*2*VK_UUID_SIZE);
     }
 }
@@ -58946,23 +59052,23 @@ safe_VkRayTracingPipelineCreateInfoKHR::safe_VkRayTracingPipelineCreateInfoKHR(c
 {
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
     }
     if (in_struct->pLibraryInfo)
-        pLibraryInfo = new safe_VkPipelineLibraryCreateInfoKHR(in_struct->pLibraryInfo);
+        pLibraryInfo = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(in_struct->pLibraryInfo);
     if (in_struct->pLibraryInterface)
-        pLibraryInterface = new safe_VkRayTracingPipelineInterfaceCreateInfoKHR(in_struct->pLibraryInterface);
+        pLibraryInterface = new (kSafeStructAlloc) safe_VkRayTracingPipelineInterfaceCreateInfoKHR(in_struct->pLibraryInterface);
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
 }
 
 safe_VkRayTracingPipelineCreateInfoKHR::safe_VkRayTracingPipelineCreateInfoKHR() :
@@ -58999,23 +59105,23 @@ safe_VkRayTracingPipelineCreateInfoKHR::safe_VkRayTracingPipelineCreateInfoKHR(c
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
     }
     if (copy_src.pLibraryInfo)
-        pLibraryInfo = new safe_VkPipelineLibraryCreateInfoKHR(*copy_src.pLibraryInfo);
+        pLibraryInfo = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(*copy_src.pLibraryInfo);
     if (copy_src.pLibraryInterface)
-        pLibraryInterface = new safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src.pLibraryInterface);
+        pLibraryInterface = new (kSafeStructAlloc) safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src.pLibraryInterface);
     if (copy_src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
 }
 
 safe_VkRayTracingPipelineCreateInfoKHR& safe_VkRayTracingPipelineCreateInfoKHR::operator=(const safe_VkRayTracingPipelineCreateInfoKHR& copy_src)
@@ -59050,23 +59156,23 @@ safe_VkRayTracingPipelineCreateInfoKHR& safe_VkRayTracingPipelineCreateInfoKHR::
     basePipelineIndex = copy_src.basePipelineIndex;
     pNext = SafePnextCopy(copy_src.pNext);
     if (stageCount && copy_src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src.pStages[i]);
         }
     }
     if (groupCount && copy_src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src.pGroups[i]);
         }
     }
     if (copy_src.pLibraryInfo)
-        pLibraryInfo = new safe_VkPipelineLibraryCreateInfoKHR(*copy_src.pLibraryInfo);
+        pLibraryInfo = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(*copy_src.pLibraryInfo);
     if (copy_src.pLibraryInterface)
-        pLibraryInterface = new safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src.pLibraryInterface);
+        pLibraryInterface = new (kSafeStructAlloc) safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src.pLibraryInterface);
     if (copy_src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);
 
     return *this;
 }
@@ -59116,23 +59222,23 @@ void safe_VkRayTracingPipelineCreateInfoKHR::initialize(const VkRayTracingPipeli
     basePipelineIndex = in_struct->basePipelineIndex;
     pNext = SafePnextCopy(in_struct->pNext);
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
     }
     if (in_struct->pLibraryInfo)
-        pLibraryInfo = new safe_VkPipelineLibraryCreateInfoKHR(in_struct->pLibraryInfo);
+        pLibraryInfo = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(in_struct->pLibraryInfo);
     if (in_struct->pLibraryInterface)
-        pLibraryInterface = new safe_VkRayTracingPipelineInterfaceCreateInfoKHR(in_struct->pLibraryInterface);
+        pLibraryInterface = new (kSafeStructAlloc) safe_VkRayTracingPipelineInterfaceCreateInfoKHR(in_struct->pLibraryInterface);
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
 }
 
 void safe_VkRayTracingPipelineCreateInfoKHR::initialize(const safe_VkRayTracingPipelineCreateInfoKHR* copy_src)
@@ -59152,23 +59258,23 @@ void safe_VkRayTracingPipelineCreateInfoKHR::initialize(const safe_VkRayTracingP
     basePipelineIndex = copy_src->basePipelineIndex;
     pNext = SafePnextCopy(copy_src->pNext);
     if (stageCount && copy_src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];
         for (uint32_t i = 0; i < stageCount; ++i) {
             pStages[i].initialize(&copy_src->pStages[i]);
         }
     }
     if (groupCount && copy_src->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
+        pGroups = new (kSafeStructAlloc) safe_VkRayTracingShaderGroupCreateInfoKHR[groupCount];
         for (uint32_t i = 0; i < groupCount; ++i) {
             pGroups[i].initialize(&copy_src->pGroups[i]);
         }
     }
     if (copy_src->pLibraryInfo)
-        pLibraryInfo = new safe_VkPipelineLibraryCreateInfoKHR(*copy_src->pLibraryInfo);
+        pLibraryInfo = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(*copy_src->pLibraryInfo);
     if (copy_src->pLibraryInterface)
-        pLibraryInterface = new safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src->pLibraryInterface);
+        pLibraryInterface = new (kSafeStructAlloc) safe_VkRayTracingPipelineInterfaceCreateInfoKHR(*copy_src->pLibraryInterface);
     if (copy_src->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src->pDynamicState);
+        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src->pDynamicState);
 }
 
 safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR::safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR* in_struct) :
@@ -59741,7 +59847,7 @@ void safe_VkPhysicalDeviceMeshShaderPropertiesEXT::initialize(const safe_VkPhysi
 
 char *SafeStringCopy(const char *in_string) {
     if (nullptr == in_string) return nullptr;
-    char* dest = new char[std::strlen(in_string) + 1];
+    char* dest = new (kSafeStructAlloc) char[std::strlen(in_string) + 1];
     return std::strcpy(dest, in_string);
 }
 
@@ -59754,7 +59860,7 @@ void *SafePnextCopy(const void *pNext) {
     switch (header->sType) {
         // Special-case Loader Instance Struct passed to/from layer in pNext chain
         case VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO: {
-            VkLayerInstanceCreateInfo *struct_copy = new VkLayerInstanceCreateInfo;
+            VkLayerInstanceCreateInfo *struct_copy = new (kSafeStructAlloc) VkLayerInstanceCreateInfo;
             // TODO: Uses original VkLayerInstanceLink* chain, which should be okay for our uses
             memcpy(struct_copy, pNext, sizeof(VkLayerInstanceCreateInfo));
             struct_copy->pNext = SafePnextCopy(header->pNext);
@@ -59763,7 +59869,7 @@ void *SafePnextCopy(const void *pNext) {
         }
         // Special-case Loader Device Struct passed to/from layer in pNext chain
         case VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO: {
-            VkLayerDeviceCreateInfo *struct_copy = new VkLayerDeviceCreateInfo;
+            VkLayerDeviceCreateInfo *struct_copy = new (kSafeStructAlloc) VkLayerDeviceCreateInfo;
             // TODO: Uses original VkLayerDeviceLink*, which should be okay for our uses
             memcpy(struct_copy, pNext, sizeof(VkLayerDeviceCreateInfo));
             struct_copy->pNext = SafePnextCopy(header->pNext);
@@ -59771,1342 +59877,1342 @@ void *SafePnextCopy(const void *pNext) {
             break;
         }
         case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
-            safe_pNext = new safe_VkShaderModuleCreateInfo(reinterpret_cast<const VkShaderModuleCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkShaderModuleCreateInfo(reinterpret_cast<const VkShaderModuleCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceSubgroupProperties(reinterpret_cast<const VkPhysicalDeviceSubgroupProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubgroupProperties(reinterpret_cast<const VkPhysicalDeviceSubgroupProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
-            safe_pNext = new safe_VkPhysicalDevice16BitStorageFeatures(reinterpret_cast<const VkPhysicalDevice16BitStorageFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevice16BitStorageFeatures(reinterpret_cast<const VkPhysicalDevice16BitStorageFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
-            safe_pNext = new safe_VkMemoryDedicatedRequirements(reinterpret_cast<const VkMemoryDedicatedRequirements *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryDedicatedRequirements(reinterpret_cast<const VkMemoryDedicatedRequirements *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
-            safe_pNext = new safe_VkMemoryDedicatedAllocateInfo(reinterpret_cast<const VkMemoryDedicatedAllocateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryDedicatedAllocateInfo(reinterpret_cast<const VkMemoryDedicatedAllocateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
-            safe_pNext = new safe_VkMemoryAllocateFlagsInfo(reinterpret_cast<const VkMemoryAllocateFlagsInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryAllocateFlagsInfo(reinterpret_cast<const VkMemoryAllocateFlagsInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
-            safe_pNext = new safe_VkDeviceGroupRenderPassBeginInfo(reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupRenderPassBeginInfo(reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
-            safe_pNext = new safe_VkDeviceGroupCommandBufferBeginInfo(reinterpret_cast<const VkDeviceGroupCommandBufferBeginInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupCommandBufferBeginInfo(reinterpret_cast<const VkDeviceGroupCommandBufferBeginInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
-            safe_pNext = new safe_VkDeviceGroupSubmitInfo(reinterpret_cast<const VkDeviceGroupSubmitInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupSubmitInfo(reinterpret_cast<const VkDeviceGroupSubmitInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
-            safe_pNext = new safe_VkDeviceGroupBindSparseInfo(reinterpret_cast<const VkDeviceGroupBindSparseInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupBindSparseInfo(reinterpret_cast<const VkDeviceGroupBindSparseInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
-            safe_pNext = new safe_VkBindBufferMemoryDeviceGroupInfo(reinterpret_cast<const VkBindBufferMemoryDeviceGroupInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBindBufferMemoryDeviceGroupInfo(reinterpret_cast<const VkBindBufferMemoryDeviceGroupInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
-            safe_pNext = new safe_VkBindImageMemoryDeviceGroupInfo(reinterpret_cast<const VkBindImageMemoryDeviceGroupInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBindImageMemoryDeviceGroupInfo(reinterpret_cast<const VkBindImageMemoryDeviceGroupInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
-            safe_pNext = new safe_VkDeviceGroupDeviceCreateInfo(reinterpret_cast<const VkDeviceGroupDeviceCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupDeviceCreateInfo(reinterpret_cast<const VkDeviceGroupDeviceCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
-            safe_pNext = new safe_VkPhysicalDeviceFeatures2(reinterpret_cast<const VkPhysicalDeviceFeatures2 *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFeatures2(reinterpret_cast<const VkPhysicalDeviceFeatures2 *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDevicePointClippingProperties(reinterpret_cast<const VkPhysicalDevicePointClippingProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePointClippingProperties(reinterpret_cast<const VkPhysicalDevicePointClippingProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
-            safe_pNext = new safe_VkRenderPassInputAttachmentAspectCreateInfo(reinterpret_cast<const VkRenderPassInputAttachmentAspectCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassInputAttachmentAspectCreateInfo(reinterpret_cast<const VkRenderPassInputAttachmentAspectCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
-            safe_pNext = new safe_VkImageViewUsageCreateInfo(reinterpret_cast<const VkImageViewUsageCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageViewUsageCreateInfo(reinterpret_cast<const VkImageViewUsageCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
-            safe_pNext = new safe_VkPipelineTessellationDomainOriginStateCreateInfo(reinterpret_cast<const VkPipelineTessellationDomainOriginStateCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineTessellationDomainOriginStateCreateInfo(reinterpret_cast<const VkPipelineTessellationDomainOriginStateCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
-            safe_pNext = new safe_VkRenderPassMultiviewCreateInfo(reinterpret_cast<const VkRenderPassMultiviewCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassMultiviewCreateInfo(reinterpret_cast<const VkRenderPassMultiviewCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceMultiviewFeatures(reinterpret_cast<const VkPhysicalDeviceMultiviewFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultiviewFeatures(reinterpret_cast<const VkPhysicalDeviceMultiviewFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceMultiviewProperties(reinterpret_cast<const VkPhysicalDeviceMultiviewProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultiviewProperties(reinterpret_cast<const VkPhysicalDeviceMultiviewProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceVariablePointersFeatures(reinterpret_cast<const VkPhysicalDeviceVariablePointersFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVariablePointersFeatures(reinterpret_cast<const VkPhysicalDeviceVariablePointersFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceProtectedMemoryFeatures(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceProtectedMemoryFeatures(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceProtectedMemoryProperties(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceProtectedMemoryProperties(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
-            safe_pNext = new safe_VkProtectedSubmitInfo(reinterpret_cast<const VkProtectedSubmitInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkProtectedSubmitInfo(reinterpret_cast<const VkProtectedSubmitInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
-            safe_pNext = new safe_VkSamplerYcbcrConversionInfo(reinterpret_cast<const VkSamplerYcbcrConversionInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSamplerYcbcrConversionInfo(reinterpret_cast<const VkSamplerYcbcrConversionInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
-            safe_pNext = new safe_VkBindImagePlaneMemoryInfo(reinterpret_cast<const VkBindImagePlaneMemoryInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBindImagePlaneMemoryInfo(reinterpret_cast<const VkBindImagePlaneMemoryInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
-            safe_pNext = new safe_VkImagePlaneMemoryRequirementsInfo(reinterpret_cast<const VkImagePlaneMemoryRequirementsInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImagePlaneMemoryRequirementsInfo(reinterpret_cast<const VkImagePlaneMemoryRequirementsInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
-            safe_pNext = new safe_VkSamplerYcbcrConversionImageFormatProperties(reinterpret_cast<const VkSamplerYcbcrConversionImageFormatProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSamplerYcbcrConversionImageFormatProperties(reinterpret_cast<const VkSamplerYcbcrConversionImageFormatProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
-            safe_pNext = new safe_VkPhysicalDeviceExternalImageFormatInfo(reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExternalImageFormatInfo(reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
-            safe_pNext = new safe_VkExternalImageFormatProperties(reinterpret_cast<const VkExternalImageFormatProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExternalImageFormatProperties(reinterpret_cast<const VkExternalImageFormatProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceIDProperties(reinterpret_cast<const VkPhysicalDeviceIDProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceIDProperties(reinterpret_cast<const VkPhysicalDeviceIDProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
-            safe_pNext = new safe_VkExternalMemoryImageCreateInfo(reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExternalMemoryImageCreateInfo(reinterpret_cast<const VkExternalMemoryImageCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
-            safe_pNext = new safe_VkExternalMemoryBufferCreateInfo(reinterpret_cast<const VkExternalMemoryBufferCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExternalMemoryBufferCreateInfo(reinterpret_cast<const VkExternalMemoryBufferCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
-            safe_pNext = new safe_VkExportMemoryAllocateInfo(reinterpret_cast<const VkExportMemoryAllocateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMemoryAllocateInfo(reinterpret_cast<const VkExportMemoryAllocateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
-            safe_pNext = new safe_VkExportFenceCreateInfo(reinterpret_cast<const VkExportFenceCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportFenceCreateInfo(reinterpret_cast<const VkExportFenceCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
-            safe_pNext = new safe_VkExportSemaphoreCreateInfo(reinterpret_cast<const VkExportSemaphoreCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportSemaphoreCreateInfo(reinterpret_cast<const VkExportSemaphoreCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceMaintenance3Properties(reinterpret_cast<const VkPhysicalDeviceMaintenance3Properties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMaintenance3Properties(reinterpret_cast<const VkPhysicalDeviceMaintenance3Properties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderDrawParametersFeatures(reinterpret_cast<const VkPhysicalDeviceShaderDrawParametersFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderDrawParametersFeatures(reinterpret_cast<const VkPhysicalDeviceShaderDrawParametersFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan11Features(reinterpret_cast<const VkPhysicalDeviceVulkan11Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan11Features(reinterpret_cast<const VkPhysicalDeviceVulkan11Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan11Properties(reinterpret_cast<const VkPhysicalDeviceVulkan11Properties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan11Properties(reinterpret_cast<const VkPhysicalDeviceVulkan11Properties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan12Features(reinterpret_cast<const VkPhysicalDeviceVulkan12Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan12Features(reinterpret_cast<const VkPhysicalDeviceVulkan12Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan12Properties(reinterpret_cast<const VkPhysicalDeviceVulkan12Properties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan12Properties(reinterpret_cast<const VkPhysicalDeviceVulkan12Properties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
-            safe_pNext = new safe_VkImageFormatListCreateInfo(reinterpret_cast<const VkImageFormatListCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageFormatListCreateInfo(reinterpret_cast<const VkImageFormatListCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES:
-            safe_pNext = new safe_VkPhysicalDevice8BitStorageFeatures(reinterpret_cast<const VkPhysicalDevice8BitStorageFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevice8BitStorageFeatures(reinterpret_cast<const VkPhysicalDevice8BitStorageFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceDriverProperties(reinterpret_cast<const VkPhysicalDeviceDriverProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDriverProperties(reinterpret_cast<const VkPhysicalDeviceDriverProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderAtomicInt64Features(reinterpret_cast<const VkPhysicalDeviceShaderAtomicInt64Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderAtomicInt64Features(reinterpret_cast<const VkPhysicalDeviceShaderAtomicInt64Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderFloat16Int8Features(reinterpret_cast<const VkPhysicalDeviceShaderFloat16Int8Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderFloat16Int8Features(reinterpret_cast<const VkPhysicalDeviceShaderFloat16Int8Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceFloatControlsProperties(reinterpret_cast<const VkPhysicalDeviceFloatControlsProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFloatControlsProperties(reinterpret_cast<const VkPhysicalDeviceFloatControlsProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO:
-            safe_pNext = new safe_VkDescriptorSetLayoutBindingFlagsCreateInfo(reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDescriptorSetLayoutBindingFlagsCreateInfo(reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceDescriptorIndexingFeatures(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDescriptorIndexingFeatures(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceDescriptorIndexingProperties(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDescriptorIndexingProperties(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO:
-            safe_pNext = new safe_VkDescriptorSetVariableDescriptorCountAllocateInfo(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDescriptorSetVariableDescriptorCountAllocateInfo(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT:
-            safe_pNext = new safe_VkDescriptorSetVariableDescriptorCountLayoutSupport(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountLayoutSupport *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDescriptorSetVariableDescriptorCountLayoutSupport(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountLayoutSupport *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE:
-            safe_pNext = new safe_VkSubpassDescriptionDepthStencilResolve(reinterpret_cast<const VkSubpassDescriptionDepthStencilResolve *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSubpassDescriptionDepthStencilResolve(reinterpret_cast<const VkSubpassDescriptionDepthStencilResolve *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceDepthStencilResolveProperties(reinterpret_cast<const VkPhysicalDeviceDepthStencilResolveProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDepthStencilResolveProperties(reinterpret_cast<const VkPhysicalDeviceDepthStencilResolveProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceScalarBlockLayoutFeatures(reinterpret_cast<const VkPhysicalDeviceScalarBlockLayoutFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceScalarBlockLayoutFeatures(reinterpret_cast<const VkPhysicalDeviceScalarBlockLayoutFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
-            safe_pNext = new safe_VkImageStencilUsageCreateInfo(reinterpret_cast<const VkImageStencilUsageCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageStencilUsageCreateInfo(reinterpret_cast<const VkImageStencilUsageCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
-            safe_pNext = new safe_VkSamplerReductionModeCreateInfo(reinterpret_cast<const VkSamplerReductionModeCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSamplerReductionModeCreateInfo(reinterpret_cast<const VkSamplerReductionModeCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceSamplerFilterMinmaxProperties(reinterpret_cast<const VkPhysicalDeviceSamplerFilterMinmaxProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSamplerFilterMinmaxProperties(reinterpret_cast<const VkPhysicalDeviceSamplerFilterMinmaxProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkanMemoryModelFeatures(reinterpret_cast<const VkPhysicalDeviceVulkanMemoryModelFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkanMemoryModelFeatures(reinterpret_cast<const VkPhysicalDeviceVulkanMemoryModelFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceImagelessFramebufferFeatures(reinterpret_cast<const VkPhysicalDeviceImagelessFramebufferFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImagelessFramebufferFeatures(reinterpret_cast<const VkPhysicalDeviceImagelessFramebufferFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO:
-            safe_pNext = new safe_VkFramebufferAttachmentsCreateInfo(reinterpret_cast<const VkFramebufferAttachmentsCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkFramebufferAttachmentsCreateInfo(reinterpret_cast<const VkFramebufferAttachmentsCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
-            safe_pNext = new safe_VkRenderPassAttachmentBeginInfo(reinterpret_cast<const VkRenderPassAttachmentBeginInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassAttachmentBeginInfo(reinterpret_cast<const VkRenderPassAttachmentBeginInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(reinterpret_cast<const VkPhysicalDeviceUniformBufferStandardLayoutFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(reinterpret_cast<const VkPhysicalDeviceUniformBufferStandardLayoutFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(reinterpret_cast<const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(reinterpret_cast<const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(reinterpret_cast<const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(reinterpret_cast<const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT:
-            safe_pNext = new safe_VkAttachmentReferenceStencilLayout(reinterpret_cast<const VkAttachmentReferenceStencilLayout *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAttachmentReferenceStencilLayout(reinterpret_cast<const VkAttachmentReferenceStencilLayout *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT:
-            safe_pNext = new safe_VkAttachmentDescriptionStencilLayout(reinterpret_cast<const VkAttachmentDescriptionStencilLayout *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAttachmentDescriptionStencilLayout(reinterpret_cast<const VkAttachmentDescriptionStencilLayout *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceHostQueryResetFeatures(reinterpret_cast<const VkPhysicalDeviceHostQueryResetFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceHostQueryResetFeatures(reinterpret_cast<const VkPhysicalDeviceHostQueryResetFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceTimelineSemaphoreFeatures(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTimelineSemaphoreFeatures(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceTimelineSemaphoreProperties(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTimelineSemaphoreProperties(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO:
-            safe_pNext = new safe_VkSemaphoreTypeCreateInfo(reinterpret_cast<const VkSemaphoreTypeCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSemaphoreTypeCreateInfo(reinterpret_cast<const VkSemaphoreTypeCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
-            safe_pNext = new safe_VkTimelineSemaphoreSubmitInfo(reinterpret_cast<const VkTimelineSemaphoreSubmitInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkTimelineSemaphoreSubmitInfo(reinterpret_cast<const VkTimelineSemaphoreSubmitInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceBufferDeviceAddressFeatures(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceBufferDeviceAddressFeatures(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
-            safe_pNext = new safe_VkBufferOpaqueCaptureAddressCreateInfo(reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBufferOpaqueCaptureAddressCreateInfo(reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
-            safe_pNext = new safe_VkMemoryOpaqueCaptureAddressAllocateInfo(reinterpret_cast<const VkMemoryOpaqueCaptureAddressAllocateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryOpaqueCaptureAddressAllocateInfo(reinterpret_cast<const VkMemoryOpaqueCaptureAddressAllocateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan13Features(reinterpret_cast<const VkPhysicalDeviceVulkan13Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan13Features(reinterpret_cast<const VkPhysicalDeviceVulkan13Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceVulkan13Properties(reinterpret_cast<const VkPhysicalDeviceVulkan13Properties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVulkan13Properties(reinterpret_cast<const VkPhysicalDeviceVulkan13Properties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO:
-            safe_pNext = new safe_VkPipelineCreationFeedbackCreateInfo(reinterpret_cast<const VkPipelineCreationFeedbackCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineCreationFeedbackCreateInfo(reinterpret_cast<const VkPipelineCreationFeedbackCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderTerminateInvocationFeatures(reinterpret_cast<const VkPhysicalDeviceShaderTerminateInvocationFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderTerminateInvocationFeatures(reinterpret_cast<const VkPhysicalDeviceShaderTerminateInvocationFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(reinterpret_cast<const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(reinterpret_cast<const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES:
-            safe_pNext = new safe_VkPhysicalDevicePrivateDataFeatures(reinterpret_cast<const VkPhysicalDevicePrivateDataFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePrivateDataFeatures(reinterpret_cast<const VkPhysicalDevicePrivateDataFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO:
-            safe_pNext = new safe_VkDevicePrivateDataCreateInfo(reinterpret_cast<const VkDevicePrivateDataCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDevicePrivateDataCreateInfo(reinterpret_cast<const VkDevicePrivateDataCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES:
-            safe_pNext = new safe_VkPhysicalDevicePipelineCreationCacheControlFeatures(reinterpret_cast<const VkPhysicalDevicePipelineCreationCacheControlFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelineCreationCacheControlFeatures(reinterpret_cast<const VkPhysicalDevicePipelineCreationCacheControlFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2:
-            safe_pNext = new safe_VkMemoryBarrier2(reinterpret_cast<const VkMemoryBarrier2 *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryBarrier2(reinterpret_cast<const VkMemoryBarrier2 *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceSynchronization2Features(reinterpret_cast<const VkPhysicalDeviceSynchronization2Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSynchronization2Features(reinterpret_cast<const VkPhysicalDeviceSynchronization2Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(reinterpret_cast<const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(reinterpret_cast<const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceImageRobustnessFeatures(reinterpret_cast<const VkPhysicalDeviceImageRobustnessFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageRobustnessFeatures(reinterpret_cast<const VkPhysicalDeviceImageRobustnessFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceSubgroupSizeControlFeatures(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubgroupSizeControlFeatures(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceSubgroupSizeControlProperties(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubgroupSizeControlProperties(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
-            safe_pNext = new safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceInlineUniformBlockFeatures(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceInlineUniformBlockFeatures(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceInlineUniformBlockProperties(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceInlineUniformBlockProperties(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK:
-            safe_pNext = new safe_VkWriteDescriptorSetInlineUniformBlock(reinterpret_cast<const VkWriteDescriptorSetInlineUniformBlock *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkWriteDescriptorSetInlineUniformBlock(reinterpret_cast<const VkWriteDescriptorSetInlineUniformBlock *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO:
-            safe_pNext = new safe_VkDescriptorPoolInlineUniformBlockCreateInfo(reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDescriptorPoolInlineUniformBlockCreateInfo(reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(reinterpret_cast<const VkPhysicalDeviceTextureCompressionASTCHDRFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(reinterpret_cast<const VkPhysicalDeviceTextureCompressionASTCHDRFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
-            safe_pNext = new safe_VkPipelineRenderingCreateInfo(reinterpret_cast<const VkPipelineRenderingCreateInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRenderingCreateInfo(reinterpret_cast<const VkPipelineRenderingCreateInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceDynamicRenderingFeatures(reinterpret_cast<const VkPhysicalDeviceDynamicRenderingFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDynamicRenderingFeatures(reinterpret_cast<const VkPhysicalDeviceDynamicRenderingFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO:
-            safe_pNext = new safe_VkCommandBufferInheritanceRenderingInfo(reinterpret_cast<const VkCommandBufferInheritanceRenderingInfo *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceRenderingInfo(reinterpret_cast<const VkCommandBufferInheritanceRenderingInfo *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderIntegerDotProductFeatures(reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductFeatures *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderIntegerDotProductFeatures(reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductFeatures *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceShaderIntegerDotProductProperties(reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderIntegerDotProductProperties(reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceTexelBufferAlignmentProperties(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentProperties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTexelBufferAlignmentProperties(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentProperties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3:
-            safe_pNext = new safe_VkFormatProperties3(reinterpret_cast<const VkFormatProperties3 *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkFormatProperties3(reinterpret_cast<const VkFormatProperties3 *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES:
-            safe_pNext = new safe_VkPhysicalDeviceMaintenance4Features(reinterpret_cast<const VkPhysicalDeviceMaintenance4Features *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMaintenance4Features(reinterpret_cast<const VkPhysicalDeviceMaintenance4Features *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES:
-            safe_pNext = new safe_VkPhysicalDeviceMaintenance4Properties(reinterpret_cast<const VkPhysicalDeviceMaintenance4Properties *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMaintenance4Properties(reinterpret_cast<const VkPhysicalDeviceMaintenance4Properties *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkImageSwapchainCreateInfoKHR(reinterpret_cast<const VkImageSwapchainCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageSwapchainCreateInfoKHR(reinterpret_cast<const VkImageSwapchainCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
-            safe_pNext = new safe_VkBindImageMemorySwapchainInfoKHR(reinterpret_cast<const VkBindImageMemorySwapchainInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBindImageMemorySwapchainInfoKHR(reinterpret_cast<const VkBindImageMemorySwapchainInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
-            safe_pNext = new safe_VkDeviceGroupPresentInfoKHR(reinterpret_cast<const VkDeviceGroupPresentInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupPresentInfoKHR(reinterpret_cast<const VkDeviceGroupPresentInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkDeviceGroupSwapchainCreateInfoKHR(reinterpret_cast<const VkDeviceGroupSwapchainCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceGroupSwapchainCreateInfoKHR(reinterpret_cast<const VkDeviceGroupSwapchainCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
-            safe_pNext = new safe_VkDisplayPresentInfoKHR(reinterpret_cast<const VkDisplayPresentInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDisplayPresentInfoKHR(reinterpret_cast<const VkDisplayPresentInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
-            safe_pNext = new safe_VkRenderingFragmentShadingRateAttachmentInfoKHR(reinterpret_cast<const VkRenderingFragmentShadingRateAttachmentInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderingFragmentShadingRateAttachmentInfoKHR(reinterpret_cast<const VkRenderingFragmentShadingRateAttachmentInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT:
-            safe_pNext = new safe_VkRenderingFragmentDensityMapAttachmentInfoEXT(reinterpret_cast<const VkRenderingFragmentDensityMapAttachmentInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderingFragmentDensityMapAttachmentInfoEXT(reinterpret_cast<const VkRenderingFragmentDensityMapAttachmentInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD:
-            safe_pNext = new safe_VkAttachmentSampleCountInfoAMD(reinterpret_cast<const VkAttachmentSampleCountInfoAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAttachmentSampleCountInfoAMD(reinterpret_cast<const VkAttachmentSampleCountInfoAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX:
-            safe_pNext = new safe_VkMultiviewPerViewAttributesInfoNVX(reinterpret_cast<const VkMultiviewPerViewAttributesInfoNVX *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMultiviewPerViewAttributesInfoNVX(reinterpret_cast<const VkMultiviewPerViewAttributesInfoNVX *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
-            safe_pNext = new safe_VkImportMemoryFdInfoKHR(reinterpret_cast<const VkImportMemoryFdInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryFdInfoKHR(reinterpret_cast<const VkImportMemoryFdInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePushDescriptorPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePushDescriptorPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePushDescriptorPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePushDescriptorPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
-            safe_pNext = new safe_VkPresentRegionsKHR(reinterpret_cast<const VkPresentRegionsKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPresentRegionsKHR(reinterpret_cast<const VkPresentRegionsKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
-            safe_pNext = new safe_VkSharedPresentSurfaceCapabilitiesKHR(reinterpret_cast<const VkSharedPresentSurfaceCapabilitiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSharedPresentSurfaceCapabilitiesKHR(reinterpret_cast<const VkSharedPresentSurfaceCapabilitiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePerformanceQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePerformanceQueryFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePerformanceQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePerformanceQueryFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePerformanceQueryPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePerformanceQueryPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePerformanceQueryPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePerformanceQueryPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkQueryPoolPerformanceCreateInfoKHR(reinterpret_cast<const VkQueryPoolPerformanceCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueryPoolPerformanceCreateInfoKHR(reinterpret_cast<const VkQueryPoolPerformanceCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR:
-            safe_pNext = new safe_VkPerformanceQuerySubmitInfoKHR(reinterpret_cast<const VkPerformanceQuerySubmitInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPerformanceQuerySubmitInfoKHR(reinterpret_cast<const VkPerformanceQuerySubmitInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceShaderClockFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceShaderClockFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderClockFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceShaderClockFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkDeviceQueueGlobalPriorityCreateInfoKHR(reinterpret_cast<const VkDeviceQueueGlobalPriorityCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceQueueGlobalPriorityCreateInfoKHR(reinterpret_cast<const VkDeviceQueueGlobalPriorityCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR:
-            safe_pNext = new safe_VkQueueFamilyGlobalPriorityPropertiesKHR(reinterpret_cast<const VkQueueFamilyGlobalPriorityPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueueFamilyGlobalPriorityPropertiesKHR(reinterpret_cast<const VkQueueFamilyGlobalPriorityPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
-            safe_pNext = new safe_VkFragmentShadingRateAttachmentInfoKHR(reinterpret_cast<const VkFragmentShadingRateAttachmentInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkFragmentShadingRateAttachmentInfoKHR(reinterpret_cast<const VkFragmentShadingRateAttachmentInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(reinterpret_cast<const VkPipelineFragmentShadingRateStateCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineFragmentShadingRateStateCreateInfoKHR(reinterpret_cast<const VkPipelineFragmentShadingRateStateCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShadingRateFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRatePropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShadingRatePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRatePropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR:
-            safe_pNext = new safe_VkSurfaceProtectedCapabilitiesKHR(reinterpret_cast<const VkSurfaceProtectedCapabilitiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSurfaceProtectedCapabilitiesKHR(reinterpret_cast<const VkSurfaceProtectedCapabilitiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePresentWaitFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePresentWaitFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePresentWaitFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePresentWaitFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
-            safe_pNext = new safe_VkPipelineLibraryCreateInfoKHR(reinterpret_cast<const VkPipelineLibraryCreateInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineLibraryCreateInfoKHR(reinterpret_cast<const VkPipelineLibraryCreateInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PRESENT_ID_KHR:
-            safe_pNext = new safe_VkPresentIdKHR(reinterpret_cast<const VkPresentIdKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPresentIdKHR(reinterpret_cast<const VkPresentIdKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePresentIdFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePresentIdFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePresentIdFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePresentIdFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV:
-            safe_pNext = new safe_VkQueueFamilyCheckpointProperties2NV(reinterpret_cast<const VkQueueFamilyCheckpointProperties2NV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueueFamilyCheckpointProperties2NV(reinterpret_cast<const VkQueueFamilyCheckpointProperties2NV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR(reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkDebugReportCallbackCreateInfoEXT(reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDebugReportCallbackCreateInfoEXT(reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
-            safe_pNext = new safe_VkPipelineRasterizationStateRasterizationOrderAMD(reinterpret_cast<const VkPipelineRasterizationStateRasterizationOrderAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateRasterizationOrderAMD(reinterpret_cast<const VkPipelineRasterizationStateRasterizationOrderAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkDedicatedAllocationImageCreateInfoNV(reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDedicatedAllocationImageCreateInfoNV(reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
-            safe_pNext = new safe_VkDedicatedAllocationBufferCreateInfoNV(reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDedicatedAllocationBufferCreateInfoNV(reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
-            safe_pNext = new safe_VkDedicatedAllocationMemoryAllocateInfoNV(reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDedicatedAllocationMemoryAllocateInfoNV(reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRasterizationStateStreamCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationStateStreamCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateStreamCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationStateStreamCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
-            safe_pNext = new safe_VkTextureLODGatherFormatPropertiesAMD(reinterpret_cast<const VkTextureLODGatherFormatPropertiesAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkTextureLODGatherFormatPropertiesAMD(reinterpret_cast<const VkTextureLODGatherFormatPropertiesAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCornerSampledImageFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCornerSampledImageFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkExternalMemoryImageCreateInfoNV(reinterpret_cast<const VkExternalMemoryImageCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExternalMemoryImageCreateInfoNV(reinterpret_cast<const VkExternalMemoryImageCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
-            safe_pNext = new safe_VkExportMemoryAllocateInfoNV(reinterpret_cast<const VkExportMemoryAllocateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMemoryAllocateInfoNV(reinterpret_cast<const VkExportMemoryAllocateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
-            safe_pNext = new safe_VkValidationFlagsEXT(reinterpret_cast<const VkValidationFlagsEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkValidationFlagsEXT(reinterpret_cast<const VkValidationFlagsEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
-            safe_pNext = new safe_VkImageViewASTCDecodeModeEXT(reinterpret_cast<const VkImageViewASTCDecodeModeEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageViewASTCDecodeModeEXT(reinterpret_cast<const VkImageViewASTCDecodeModeEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceASTCDecodeFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceASTCDecodeFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelineRobustnessFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelineRobustnessFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelineRobustnessFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT(reinterpret_cast<const VkPhysicalDevicePipelineRobustnessPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelineRobustnessPropertiesEXT(reinterpret_cast<const VkPhysicalDevicePipelineRobustnessPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRobustnessCreateInfoEXT(reinterpret_cast<const VkPipelineRobustnessCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRobustnessCreateInfoEXT(reinterpret_cast<const VkPipelineRobustnessCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceConditionalRenderingFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceConditionalRenderingFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
-            safe_pNext = new safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(reinterpret_cast<const VkCommandBufferInheritanceConditionalRenderingInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(reinterpret_cast<const VkCommandBufferInheritanceConditionalRenderingInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineViewportWScalingStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportWScalingStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportWScalingStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportWScalingStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkSwapchainCounterCreateInfoEXT(reinterpret_cast<const VkSwapchainCounterCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSwapchainCounterCreateInfoEXT(reinterpret_cast<const VkSwapchainCounterCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
-            safe_pNext = new safe_VkPresentTimesInfoGOOGLE(reinterpret_cast<const VkPresentTimesInfoGOOGLE *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPresentTimesInfoGOOGLE(reinterpret_cast<const VkPresentTimesInfoGOOGLE *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
-            safe_pNext = new safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineViewportSwizzleStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportSwizzleStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportSwizzleStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportSwizzleStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(reinterpret_cast<const VkPhysicalDeviceDiscardRectanglePropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(reinterpret_cast<const VkPhysicalDeviceDiscardRectanglePropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineDiscardRectangleStateCreateInfoEXT(reinterpret_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineDiscardRectangleStateCreateInfoEXT(reinterpret_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceConservativeRasterizationPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceConservativeRasterizationPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClipEnableFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClipEnableFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT:
-            safe_pNext = new safe_VkDebugUtilsObjectNameInfoEXT(reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDebugUtilsObjectNameInfoEXT(reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkDebugUtilsMessengerCreateInfoEXT(reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDebugUtilsMessengerCreateInfoEXT(reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
-            safe_pNext = new safe_VkSampleLocationsInfoEXT(reinterpret_cast<const VkSampleLocationsInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSampleLocationsInfoEXT(reinterpret_cast<const VkSampleLocationsInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
-            safe_pNext = new safe_VkRenderPassSampleLocationsBeginInfoEXT(reinterpret_cast<const VkRenderPassSampleLocationsBeginInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassSampleLocationsBeginInfoEXT(reinterpret_cast<const VkRenderPassSampleLocationsBeginInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineSampleLocationsStateCreateInfoEXT(reinterpret_cast<const VkPipelineSampleLocationsStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineSampleLocationsStateCreateInfoEXT(reinterpret_cast<const VkPipelineSampleLocationsStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceSampleLocationsPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceSampleLocationsPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(reinterpret_cast<const VkPipelineColorBlendAdvancedStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(reinterpret_cast<const VkPipelineColorBlendAdvancedStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineCoverageToColorStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageToColorStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineCoverageToColorStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageToColorStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineCoverageModulationStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageModulationStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineCoverageModulationStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageModulationStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT:
-            safe_pNext = new safe_VkDrmFormatModifierPropertiesListEXT(reinterpret_cast<const VkDrmFormatModifierPropertiesListEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDrmFormatModifierPropertiesListEXT(reinterpret_cast<const VkDrmFormatModifierPropertiesListEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkImageDrmFormatModifierListCreateInfoEXT(reinterpret_cast<const VkImageDrmFormatModifierListCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageDrmFormatModifierListCreateInfoEXT(reinterpret_cast<const VkImageDrmFormatModifierListCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(reinterpret_cast<const VkImageDrmFormatModifierExplicitCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(reinterpret_cast<const VkImageDrmFormatModifierExplicitCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT:
-            safe_pNext = new safe_VkDrmFormatModifierPropertiesList2EXT(reinterpret_cast<const VkDrmFormatModifierPropertiesList2EXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDrmFormatModifierPropertiesList2EXT(reinterpret_cast<const VkDrmFormatModifierPropertiesList2EXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkShaderModuleValidationCacheCreateInfoEXT(reinterpret_cast<const VkShaderModuleValidationCacheCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkShaderModuleValidationCacheCreateInfoEXT(reinterpret_cast<const VkShaderModuleValidationCacheCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportShadingRateImageStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportShadingRateImageStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceShadingRateImageFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShadingRateImageFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShadingRateImageFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShadingRateImageFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceShadingRateImagePropertiesNV(reinterpret_cast<const VkPhysicalDeviceShadingRateImagePropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShadingRateImagePropertiesNV(reinterpret_cast<const VkPhysicalDeviceShadingRateImagePropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
-            safe_pNext = new safe_VkWriteDescriptorSetAccelerationStructureNV(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkWriteDescriptorSetAccelerationStructureNV(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceRayTracingPropertiesNV(reinterpret_cast<const VkPhysicalDeviceRayTracingPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayTracingPropertiesNV(reinterpret_cast<const VkPhysicalDeviceRayTracingPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(reinterpret_cast<const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(reinterpret_cast<const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(reinterpret_cast<const VkPipelineRepresentativeFragmentTestStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(reinterpret_cast<const VkPipelineRepresentativeFragmentTestStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT:
-            safe_pNext = new safe_VkFilterCubicImageViewImageFormatPropertiesEXT(reinterpret_cast<const VkFilterCubicImageViewImageFormatPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkFilterCubicImageViewImageFormatPropertiesEXT(reinterpret_cast<const VkFilterCubicImageViewImageFormatPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT:
-            safe_pNext = new safe_VkImportMemoryHostPointerInfoEXT(reinterpret_cast<const VkImportMemoryHostPointerInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryHostPointerInfoEXT(reinterpret_cast<const VkImportMemoryHostPointerInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceExternalMemoryHostPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceExternalMemoryHostPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD:
-            safe_pNext = new safe_VkPipelineCompilerControlCreateInfoAMD(reinterpret_cast<const VkPipelineCompilerControlCreateInfoAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineCompilerControlCreateInfoAMD(reinterpret_cast<const VkPipelineCompilerControlCreateInfoAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
-            safe_pNext = new safe_VkPhysicalDeviceShaderCorePropertiesAMD(reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderCorePropertiesAMD(reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD:
-            safe_pNext = new safe_VkDeviceMemoryOverallocationCreateInfoAMD(reinterpret_cast<const VkDeviceMemoryOverallocationCreateInfoAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceMemoryOverallocationCreateInfoAMD(reinterpret_cast<const VkDeviceMemoryOverallocationCreateInfoAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(reinterpret_cast<const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(reinterpret_cast<const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceMeshShaderFeaturesNV(reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMeshShaderFeaturesNV(reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceMeshShaderPropertiesNV(reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMeshShaderPropertiesNV(reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShaderImageFootprintFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(reinterpret_cast<const VkPhysicalDeviceShaderImageFootprintFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportExclusiveScissorStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(reinterpret_cast<const VkPipelineViewportExclusiveScissorStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(reinterpret_cast<const VkPhysicalDeviceExclusiveScissorFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(reinterpret_cast<const VkPhysicalDeviceExclusiveScissorFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
-            safe_pNext = new safe_VkQueueFamilyCheckpointPropertiesNV(reinterpret_cast<const VkQueueFamilyCheckpointPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueueFamilyCheckpointPropertiesNV(reinterpret_cast<const VkQueueFamilyCheckpointPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL:
-            safe_pNext = new safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL(reinterpret_cast<const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL(reinterpret_cast<const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL:
-            safe_pNext = new safe_VkQueryPoolPerformanceQueryCreateInfoINTEL(reinterpret_cast<const VkQueryPoolPerformanceQueryCreateInfoINTEL *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueryPoolPerformanceQueryCreateInfoINTEL(reinterpret_cast<const VkQueryPoolPerformanceQueryCreateInfoINTEL *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(reinterpret_cast<const VkPhysicalDevicePCIBusInfoPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(reinterpret_cast<const VkPhysicalDevicePCIBusInfoPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD:
-            safe_pNext = new safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(reinterpret_cast<const VkDisplayNativeHdrSurfaceCapabilitiesAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(reinterpret_cast<const VkDisplayNativeHdrSurfaceCapabilitiesAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD:
-            safe_pNext = new safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(reinterpret_cast<const VkSwapchainDisplayNativeHdrCreateInfoAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(reinterpret_cast<const VkSwapchainDisplayNativeHdrCreateInfoAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkRenderPassFragmentDensityMapCreateInfoEXT(reinterpret_cast<const VkRenderPassFragmentDensityMapCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassFragmentDensityMapCreateInfoEXT(reinterpret_cast<const VkRenderPassFragmentDensityMapCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD:
-            safe_pNext = new safe_VkPhysicalDeviceShaderCoreProperties2AMD(reinterpret_cast<const VkPhysicalDeviceShaderCoreProperties2AMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderCoreProperties2AMD(reinterpret_cast<const VkPhysicalDeviceShaderCoreProperties2AMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD:
-            safe_pNext = new safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD(reinterpret_cast<const VkPhysicalDeviceCoherentMemoryFeaturesAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCoherentMemoryFeaturesAMD(reinterpret_cast<const VkPhysicalDeviceCoherentMemoryFeaturesAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMemoryBudgetPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMemoryBudgetPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMemoryPriorityFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMemoryPriorityFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT:
-            safe_pNext = new safe_VkMemoryPriorityAllocateInfoEXT(reinterpret_cast<const VkMemoryPriorityAllocateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMemoryPriorityAllocateInfoEXT(reinterpret_cast<const VkMemoryPriorityAllocateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkBufferDeviceAddressCreateInfoEXT(reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBufferDeviceAddressCreateInfoEXT(reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT:
-            safe_pNext = new safe_VkValidationFeaturesEXT(reinterpret_cast<const VkValidationFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkValidationFeaturesEXT(reinterpret_cast<const VkValidationFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCoverageReductionModeFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(reinterpret_cast<const VkPhysicalDeviceCoverageReductionModeFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineCoverageReductionStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageReductionStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineCoverageReductionStateCreateInfoNV(reinterpret_cast<const VkPipelineCoverageReductionStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceProvokingVertexFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceProvokingVertexFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceProvokingVertexFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceProvokingVertexFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceProvokingVertexPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceProvokingVertexPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceProvokingVertexPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceProvokingVertexPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationProvokingVertexStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceLineRasterizationFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceLineRasterizationFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceLineRasterizationFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceLineRasterizationFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceLineRasterizationPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceLineRasterizationPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceLineRasterizationPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceLineRasterizationPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineRasterizationLineStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationLineStateCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineRasterizationLineStateCreateInfoEXT(reinterpret_cast<const VkPipelineRasterizationLineStateCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceIndexTypeUint8FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceIndexTypeUint8FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceIndexTypeUint8FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
-            safe_pNext = new safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(reinterpret_cast<const VkGraphicsPipelineShaderGroupsCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkGraphicsPipelineShaderGroupsCreateInfoNV(reinterpret_cast<const VkGraphicsPipelineShaderGroupsCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV(reinterpret_cast<const VkPhysicalDeviceInheritedViewportScissorFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceInheritedViewportScissorFeaturesNV(reinterpret_cast<const VkPhysicalDeviceInheritedViewportScissorFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV:
-            safe_pNext = new safe_VkCommandBufferInheritanceViewportScissorInfoNV(reinterpret_cast<const VkCommandBufferInheritanceViewportScissorInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceViewportScissorInfoNV(reinterpret_cast<const VkCommandBufferInheritanceViewportScissorInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM:
-            safe_pNext = new safe_VkRenderPassTransformBeginInfoQCOM(reinterpret_cast<const VkRenderPassTransformBeginInfoQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassTransformBeginInfoQCOM(reinterpret_cast<const VkRenderPassTransformBeginInfoQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM:
-            safe_pNext = new safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM(reinterpret_cast<const VkCommandBufferInheritanceRenderPassTransformInfoQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkCommandBufferInheritanceRenderPassTransformInfoQCOM(reinterpret_cast<const VkCommandBufferInheritanceRenderPassTransformInfoQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkDeviceDeviceMemoryReportCreateInfoEXT(reinterpret_cast<const VkDeviceDeviceMemoryReportCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceDeviceMemoryReportCreateInfoEXT(reinterpret_cast<const VkDeviceDeviceMemoryReportCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceRobustness2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRobustness2FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRobustness2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRobustness2FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceRobustness2PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceRobustness2PropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRobustness2PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceRobustness2PropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkSamplerCustomBorderColorCreateInfoEXT(reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSamplerCustomBorderColorCreateInfoEXT(reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCustomBorderColorPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceCustomBorderColorFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_BARRIER_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDevicePresentBarrierFeaturesNV(reinterpret_cast<const VkPhysicalDevicePresentBarrierFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePresentBarrierFeaturesNV(reinterpret_cast<const VkPhysicalDevicePresentBarrierFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_BARRIER_NV:
-            safe_pNext = new safe_VkSurfaceCapabilitiesPresentBarrierNV(reinterpret_cast<const VkSurfaceCapabilitiesPresentBarrierNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSurfaceCapabilitiesPresentBarrierNV(reinterpret_cast<const VkSurfaceCapabilitiesPresentBarrierNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_BARRIER_CREATE_INFO_NV:
-            safe_pNext = new safe_VkSwapchainPresentBarrierCreateInfoNV(reinterpret_cast<const VkSwapchainPresentBarrierCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSwapchainPresentBarrierCreateInfoNV(reinterpret_cast<const VkSwapchainPresentBarrierCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDiagnosticsConfigFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDiagnosticsConfigFeaturesNV(reinterpret_cast<const VkPhysicalDeviceDiagnosticsConfigFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV:
-            safe_pNext = new safe_VkDeviceDiagnosticsConfigCreateInfoNV(reinterpret_cast<const VkDeviceDiagnosticsConfigCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceDiagnosticsConfigCreateInfoNV(reinterpret_cast<const VkDeviceDiagnosticsConfigCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkGraphicsPipelineLibraryCreateInfoEXT(reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkGraphicsPipelineLibraryCreateInfoEXT(reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EARLY_AND_LATE_FRAGMENT_TESTS_FEATURES_AMD:
-            safe_pNext = new safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD(reinterpret_cast<const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD(reinterpret_cast<const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV:
-            safe_pNext = new safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV(reinterpret_cast<const VkPipelineFragmentShadingRateEnumStateCreateInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineFragmentShadingRateEnumStateCreateInfoNV(reinterpret_cast<const VkPipelineFragmentShadingRateEnumStateCreateInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV:
-            safe_pNext = new safe_VkAccelerationStructureGeometryMotionTrianglesDataNV(reinterpret_cast<const VkAccelerationStructureGeometryMotionTrianglesDataNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryMotionTrianglesDataNV(reinterpret_cast<const VkAccelerationStructureGeometryMotionTrianglesDataNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV:
-            safe_pNext = new safe_VkAccelerationStructureMotionInfoNV(reinterpret_cast<const VkAccelerationStructureMotionInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAccelerationStructureMotionInfoNV(reinterpret_cast<const VkAccelerationStructureMotionInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV(reinterpret_cast<const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayTracingMotionBlurFeaturesNV(reinterpret_cast<const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM:
-            safe_pNext = new safe_VkCopyCommandTransformInfoQCOM(reinterpret_cast<const VkCopyCommandTransformInfoQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkCopyCommandTransformInfoQCOM(reinterpret_cast<const VkCopyCommandTransformInfoQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageCompressionControlFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageCompressionControlFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageCompressionControlFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT:
-            safe_pNext = new safe_VkImageCompressionControlEXT(reinterpret_cast<const VkImageCompressionControlEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageCompressionControlEXT(reinterpret_cast<const VkImageCompressionControlEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT:
-            safe_pNext = new safe_VkImageCompressionPropertiesEXT(reinterpret_cast<const VkImageCompressionPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageCompressionPropertiesEXT(reinterpret_cast<const VkImageCompressionPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevice4444FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDevice4444FormatsFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevice4444FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDevice4444FormatsFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceFaultFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFaultFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFaultFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceFaultFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkMutableDescriptorTypeCreateInfoEXT(reinterpret_cast<const VkMutableDescriptorTypeCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMutableDescriptorTypeCreateInfoEXT(reinterpret_cast<const VkMutableDescriptorTypeCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDrmPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceDrmPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDrmPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceDrmPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceAddressBindingReportFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceAddressBindingReportFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceAddressBindingReportFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT:
-            safe_pNext = new safe_VkDeviceAddressBindingCallbackDataEXT(reinterpret_cast<const VkDeviceAddressBindingCallbackDataEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkDeviceAddressBindingCallbackDataEXT(reinterpret_cast<const VkDeviceAddressBindingCallbackDataEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDepthClipControlFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClipControlFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDepthClipControlFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClipControlFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineViewportDepthClipControlCreateInfoEXT(reinterpret_cast<const VkPipelineViewportDepthClipControlCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineViewportDepthClipControlCreateInfoEXT(reinterpret_cast<const VkPipelineViewportDepthClipControlCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI:
-            safe_pNext = new safe_VkSubpassShadingPipelineCreateInfoHUAWEI(reinterpret_cast<const VkSubpassShadingPipelineCreateInfoHUAWEI *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSubpassShadingPipelineCreateInfoHUAWEI(reinterpret_cast<const VkSubpassShadingPipelineCreateInfoHUAWEI *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI:
-            safe_pNext = new safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI(reinterpret_cast<const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubpassShadingFeaturesHUAWEI(reinterpret_cast<const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI:
-            safe_pNext = new safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI(reinterpret_cast<const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubpassShadingPropertiesHUAWEI(reinterpret_cast<const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI:
-            safe_pNext = new safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI(reinterpret_cast<const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceInvocationMaskFeaturesHUAWEI(reinterpret_cast<const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV(reinterpret_cast<const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExternalMemoryRDMAFeaturesNV(reinterpret_cast<const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelinePropertiesFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelinePropertiesFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelinePropertiesFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT:
-            safe_pNext = new safe_VkSubpassResolvePerformanceQueryEXT(reinterpret_cast<const VkSubpassResolvePerformanceQueryEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSubpassResolvePerformanceQueryEXT(reinterpret_cast<const VkSubpassResolvePerformanceQueryEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT:
-            safe_pNext = new safe_VkMultisampledRenderToSingleSampledInfoEXT(reinterpret_cast<const VkMultisampledRenderToSingleSampledInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkMultisampledRenderToSingleSampledInfoEXT(reinterpret_cast<const VkMultisampledRenderToSingleSampledInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExtendedDynamicState2FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceColorWriteEnableFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceColorWriteEnableFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceColorWriteEnableFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineColorWriteCreateInfoEXT(reinterpret_cast<const VkPipelineColorWriteCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineColorWriteCreateInfoEXT(reinterpret_cast<const VkPipelineColorWriteCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageViewMinLodFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageViewMinLodFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageViewMinLodFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkImageViewMinLodCreateInfoEXT(reinterpret_cast<const VkImageViewMinLodCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageViewMinLodCreateInfoEXT(reinterpret_cast<const VkImageViewMinLodCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMultiDrawFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMultiDrawFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultiDrawFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMultiDrawFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMultiDrawPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMultiDrawPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMultiDrawPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMultiDrawPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImage2DViewOf3DFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceOpacityMicromapFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceOpacityMicromapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceOpacityMicromapFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceOpacityMicromapPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceOpacityMicromapPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceOpacityMicromapPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT:
-            safe_pNext = new safe_VkAccelerationStructureTrianglesOpacityMicromapEXT(reinterpret_cast<const VkAccelerationStructureTrianglesOpacityMicromapEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAccelerationStructureTrianglesOpacityMicromapEXT(reinterpret_cast<const VkAccelerationStructureTrianglesOpacityMicromapEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceBorderColorSwizzleFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkSamplerBorderColorComponentMappingCreateInfoEXT(reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSamplerBorderColorComponentMappingCreateInfoEXT(reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE:
-            safe_pNext = new safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE(reinterpret_cast<const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE(reinterpret_cast<const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceDepthClampZeroOneFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_QCOM:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM:
-            safe_pNext = new safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM:
-            safe_pNext = new safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM(reinterpret_cast<const VkSubpassFragmentDensityMapOffsetEndInfoQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSubpassFragmentDensityMapOffsetEndInfoQCOM(reinterpret_cast<const VkSubpassFragmentDensityMapOffsetEndInfoQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV(reinterpret_cast<const VkPhysicalDeviceLinearColorAttachmentFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceLinearColorAttachmentFeaturesNV(reinterpret_cast<const VkPhysicalDeviceLinearColorAttachmentFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM:
-            safe_pNext = new safe_VkImageViewSampleWeightCreateInfoQCOM(reinterpret_cast<const VkImageViewSampleWeightCreateInfoQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImageViewSampleWeightCreateInfoQCOM(reinterpret_cast<const VkImageViewSampleWeightCreateInfoQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_FEATURES_QCOM:
-            safe_pNext = new safe_VkPhysicalDeviceImageProcessingFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceImageProcessingFeaturesQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageProcessingFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceImageProcessingFeaturesQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_PROPERTIES_QCOM:
-            safe_pNext = new safe_VkPhysicalDeviceImageProcessingPropertiesQCOM(reinterpret_cast<const VkPhysicalDeviceImageProcessingPropertiesQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceImageProcessingPropertiesQCOM(reinterpret_cast<const VkPhysicalDeviceImageProcessingPropertiesQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExtendedDynamicState3FeaturesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceExtendedDynamicState3PropertiesEXT(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_CONTROL_EXT:
-            safe_pNext = new safe_VkRenderPassCreationControlEXT(reinterpret_cast<const VkRenderPassCreationControlEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassCreationControlEXT(reinterpret_cast<const VkRenderPassCreationControlEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_FEEDBACK_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkRenderPassCreationFeedbackCreateInfoEXT(reinterpret_cast<const VkRenderPassCreationFeedbackCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassCreationFeedbackCreateInfoEXT(reinterpret_cast<const VkRenderPassCreationFeedbackCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_RENDER_PASS_SUBPASS_FEEDBACK_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkRenderPassSubpassFeedbackCreateInfoEXT(reinterpret_cast<const VkRenderPassSubpassFeedbackCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkRenderPassSubpassFeedbackCreateInfoEXT(reinterpret_cast<const VkRenderPassSubpassFeedbackCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT(reinterpret_cast<const VkPipelineShaderStageModuleIdentifierCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPipelineShaderStageModuleIdentifierCreateInfoEXT(reinterpret_cast<const VkPipelineShaderStageModuleIdentifierCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_FEATURES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceOpticalFlowFeaturesNV(reinterpret_cast<const VkPhysicalDeviceOpticalFlowFeaturesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceOpticalFlowFeaturesNV(reinterpret_cast<const VkPhysicalDeviceOpticalFlowFeaturesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_PROPERTIES_NV:
-            safe_pNext = new safe_VkPhysicalDeviceOpticalFlowPropertiesNV(reinterpret_cast<const VkPhysicalDeviceOpticalFlowPropertiesNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceOpticalFlowPropertiesNV(reinterpret_cast<const VkPhysicalDeviceOpticalFlowPropertiesNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_INFO_NV:
-            safe_pNext = new safe_VkOpticalFlowImageFormatInfoNV(reinterpret_cast<const VkOpticalFlowImageFormatInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkOpticalFlowImageFormatInfoNV(reinterpret_cast<const VkOpticalFlowImageFormatInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_PRIVATE_DATA_INFO_NV:
-            safe_pNext = new safe_VkOpticalFlowSessionCreatePrivateDataInfoNV(reinterpret_cast<const VkOpticalFlowSessionCreatePrivateDataInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkOpticalFlowSessionCreatePrivateDataInfoNV(reinterpret_cast<const VkOpticalFlowSessionCreatePrivateDataInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceLegacyDitheringFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceLegacyDitheringFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceLegacyDitheringFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePipelineProtectedAccessFeaturesEXT(reinterpret_cast<const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_PROPERTIES_FEATURES_QCOM:
-            safe_pNext = new safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceTilePropertiesFeaturesQCOM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceTilePropertiesFeaturesQCOM(reinterpret_cast<const VkPhysicalDeviceTilePropertiesFeaturesQCOM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_AMIGO_PROFILING_FEATURES_SEC:
-            safe_pNext = new safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC(reinterpret_cast<const VkPhysicalDeviceAmigoProfilingFeaturesSEC *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceAmigoProfilingFeaturesSEC(reinterpret_cast<const VkPhysicalDeviceAmigoProfilingFeaturesSEC *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC:
-            safe_pNext = new safe_VkAmigoProfilingSubmitInfoSEC(reinterpret_cast<const VkAmigoProfilingSubmitInfoSEC *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAmigoProfilingSubmitInfoSEC(reinterpret_cast<const VkAmigoProfilingSubmitInfoSEC *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_FEATURES_ARM:
-            safe_pNext = new safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM(reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM(reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_PROPERTIES_ARM:
-            safe_pNext = new safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM(reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM(reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
-            safe_pNext = new safe_VkWriteDescriptorSetAccelerationStructureKHR(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkWriteDescriptorSetAccelerationStructureKHR(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceAccelerationStructureFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceAccelerationStructureFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceAccelerationStructureFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceAccelerationStructurePropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceAccelerationStructurePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceAccelerationStructurePropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelineFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayTracingPipelineFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelineFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelinePropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayTracingPipelinePropertiesKHR(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelinePropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDeviceRayQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayQueryFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceRayQueryFeaturesKHR(reinterpret_cast<const VkPhysicalDeviceRayQueryFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMeshShaderFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMeshShaderFeaturesEXT(reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT:
-            safe_pNext = new safe_VkPhysicalDeviceMeshShaderPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDeviceMeshShaderPropertiesEXT(reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesEXT *>(pNext));
             break;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
         case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR:
-            safe_pNext = new safe_VkQueueFamilyQueryResultStatusPropertiesKHR(reinterpret_cast<const VkQueueFamilyQueryResultStatusPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueueFamilyQueryResultStatusPropertiesKHR(reinterpret_cast<const VkQueueFamilyQueryResultStatusPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR:
-            safe_pNext = new safe_VkQueueFamilyVideoPropertiesKHR(reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkQueueFamilyVideoPropertiesKHR(reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR:
-            safe_pNext = new safe_VkVideoProfileInfoKHR(reinterpret_cast<const VkVideoProfileInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoProfileInfoKHR(reinterpret_cast<const VkVideoProfileInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR:
-            safe_pNext = new safe_VkVideoProfileListInfoKHR(reinterpret_cast<const VkVideoProfileListInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoProfileListInfoKHR(reinterpret_cast<const VkVideoProfileListInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR:
-            safe_pNext = new safe_VkVideoDecodeCapabilitiesKHR(reinterpret_cast<const VkVideoDecodeCapabilitiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeCapabilitiesKHR(reinterpret_cast<const VkVideoDecodeCapabilitiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR:
-            safe_pNext = new safe_VkVideoDecodeUsageInfoKHR(reinterpret_cast<const VkVideoDecodeUsageInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeUsageInfoKHR(reinterpret_cast<const VkVideoDecodeUsageInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetFeaturesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePortabilitySubsetFeaturesKHR(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetFeaturesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR:
-            safe_pNext = new safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetPropertiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPhysicalDevicePortabilitySubsetPropertiesKHR(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetPropertiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR:
-            safe_pNext = new safe_VkVideoEncodeCapabilitiesKHR(reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeCapabilitiesKHR(reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR:
-            safe_pNext = new safe_VkVideoEncodeUsageInfoKHR(reinterpret_cast<const VkVideoEncodeUsageInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeUsageInfoKHR(reinterpret_cast<const VkVideoEncodeUsageInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR:
-            safe_pNext = new safe_VkVideoEncodeRateControlLayerInfoKHR(reinterpret_cast<const VkVideoEncodeRateControlLayerInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlLayerInfoKHR(reinterpret_cast<const VkVideoEncodeRateControlLayerInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR:
-            safe_pNext = new safe_VkVideoEncodeRateControlInfoKHR(reinterpret_cast<const VkVideoEncodeRateControlInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeRateControlInfoKHR(reinterpret_cast<const VkVideoEncodeRateControlInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264CapabilitiesEXT(reinterpret_cast<const VkVideoEncodeH264CapabilitiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264CapabilitiesEXT(reinterpret_cast<const VkVideoEncodeH264CapabilitiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoEncodeH264SessionParametersAddInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoEncodeH264SessionParametersAddInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoEncodeH264SessionParametersCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoEncodeH264SessionParametersCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_VCL_FRAME_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264VclFrameInfoEXT(reinterpret_cast<const VkVideoEncodeH264VclFrameInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264VclFrameInfoEXT(reinterpret_cast<const VkVideoEncodeH264VclFrameInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_EMIT_PICTURE_PARAMETERS_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264EmitPictureParametersInfoEXT(reinterpret_cast<const VkVideoEncodeH264EmitPictureParametersInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264EmitPictureParametersInfoEXT(reinterpret_cast<const VkVideoEncodeH264EmitPictureParametersInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264ProfileInfoEXT(reinterpret_cast<const VkVideoEncodeH264ProfileInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264ProfileInfoEXT(reinterpret_cast<const VkVideoEncodeH264ProfileInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264RateControlInfoEXT(reinterpret_cast<const VkVideoEncodeH264RateControlInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264RateControlInfoEXT(reinterpret_cast<const VkVideoEncodeH264RateControlInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH264RateControlLayerInfoEXT(reinterpret_cast<const VkVideoEncodeH264RateControlLayerInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH264RateControlLayerInfoEXT(reinterpret_cast<const VkVideoEncodeH264RateControlLayerInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265CapabilitiesEXT(reinterpret_cast<const VkVideoEncodeH265CapabilitiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265CapabilitiesEXT(reinterpret_cast<const VkVideoEncodeH265CapabilitiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoEncodeH265SessionParametersAddInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoEncodeH265SessionParametersAddInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoEncodeH265SessionParametersCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoEncodeH265SessionParametersCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_VCL_FRAME_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265VclFrameInfoEXT(reinterpret_cast<const VkVideoEncodeH265VclFrameInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265VclFrameInfoEXT(reinterpret_cast<const VkVideoEncodeH265VclFrameInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_EMIT_PICTURE_PARAMETERS_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265EmitPictureParametersInfoEXT(reinterpret_cast<const VkVideoEncodeH265EmitPictureParametersInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265EmitPictureParametersInfoEXT(reinterpret_cast<const VkVideoEncodeH265EmitPictureParametersInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265ProfileInfoEXT(reinterpret_cast<const VkVideoEncodeH265ProfileInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265ProfileInfoEXT(reinterpret_cast<const VkVideoEncodeH265ProfileInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265RateControlInfoEXT(reinterpret_cast<const VkVideoEncodeH265RateControlInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265RateControlInfoEXT(reinterpret_cast<const VkVideoEncodeH265RateControlInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT:
-            safe_pNext = new safe_VkVideoEncodeH265RateControlLayerInfoEXT(reinterpret_cast<const VkVideoEncodeH265RateControlLayerInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoEncodeH265RateControlLayerInfoEXT(reinterpret_cast<const VkVideoEncodeH265RateControlLayerInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264ProfileInfoEXT(reinterpret_cast<const VkVideoDecodeH264ProfileInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264ProfileInfoEXT(reinterpret_cast<const VkVideoDecodeH264ProfileInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264CapabilitiesEXT(reinterpret_cast<const VkVideoDecodeH264CapabilitiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264CapabilitiesEXT(reinterpret_cast<const VkVideoDecodeH264CapabilitiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoDecodeH264SessionParametersAddInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoDecodeH264SessionParametersAddInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoDecodeH264SessionParametersCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoDecodeH264SessionParametersCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264PictureInfoEXT(reinterpret_cast<const VkVideoDecodeH264PictureInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264PictureInfoEXT(reinterpret_cast<const VkVideoDecodeH264PictureInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH264DpbSlotInfoEXT(reinterpret_cast<const VkVideoDecodeH264DpbSlotInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH264DpbSlotInfoEXT(reinterpret_cast<const VkVideoDecodeH264DpbSlotInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265ProfileInfoEXT(reinterpret_cast<const VkVideoDecodeH265ProfileInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265ProfileInfoEXT(reinterpret_cast<const VkVideoDecodeH265ProfileInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265CapabilitiesEXT(reinterpret_cast<const VkVideoDecodeH265CapabilitiesEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265CapabilitiesEXT(reinterpret_cast<const VkVideoDecodeH265CapabilitiesEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoDecodeH265SessionParametersAddInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersAddInfoEXT(reinterpret_cast<const VkVideoDecodeH265SessionParametersAddInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoDecodeH265SessionParametersCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265SessionParametersCreateInfoEXT(reinterpret_cast<const VkVideoDecodeH265SessionParametersCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265PictureInfoEXT(reinterpret_cast<const VkVideoDecodeH265PictureInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265PictureInfoEXT(reinterpret_cast<const VkVideoDecodeH265PictureInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_EXT:
-            safe_pNext = new safe_VkVideoDecodeH265DpbSlotInfoEXT(reinterpret_cast<const VkVideoDecodeH265DpbSlotInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkVideoDecodeH265DpbSlotInfoEXT(reinterpret_cast<const VkVideoDecodeH265DpbSlotInfoEXT *>(pNext));
             break;
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
         case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
-            safe_pNext = new safe_VkAndroidHardwareBufferUsageANDROID(reinterpret_cast<const VkAndroidHardwareBufferUsageANDROID *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAndroidHardwareBufferUsageANDROID(reinterpret_cast<const VkAndroidHardwareBufferUsageANDROID *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
-            safe_pNext = new safe_VkAndroidHardwareBufferFormatPropertiesANDROID(reinterpret_cast<const VkAndroidHardwareBufferFormatPropertiesANDROID *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAndroidHardwareBufferFormatPropertiesANDROID(reinterpret_cast<const VkAndroidHardwareBufferFormatPropertiesANDROID *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID:
-            safe_pNext = new safe_VkImportAndroidHardwareBufferInfoANDROID(reinterpret_cast<const VkImportAndroidHardwareBufferInfoANDROID *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportAndroidHardwareBufferInfoANDROID(reinterpret_cast<const VkImportAndroidHardwareBufferInfoANDROID *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
-            safe_pNext = new safe_VkExternalFormatANDROID(reinterpret_cast<const VkExternalFormatANDROID *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExternalFormatANDROID(reinterpret_cast<const VkExternalFormatANDROID *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID:
-            safe_pNext = new safe_VkAndroidHardwareBufferFormatProperties2ANDROID(reinterpret_cast<const VkAndroidHardwareBufferFormatProperties2ANDROID *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkAndroidHardwareBufferFormatProperties2ANDROID(reinterpret_cast<const VkAndroidHardwareBufferFormatProperties2ANDROID *>(pNext));
             break;
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #ifdef VK_USE_PLATFORM_FUCHSIA
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA:
-            safe_pNext = new safe_VkImportMemoryZirconHandleInfoFUCHSIA(reinterpret_cast<const VkImportMemoryZirconHandleInfoFUCHSIA *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryZirconHandleInfoFUCHSIA(reinterpret_cast<const VkImportMemoryZirconHandleInfoFUCHSIA *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA:
-            safe_pNext = new safe_VkImportMemoryBufferCollectionFUCHSIA(reinterpret_cast<const VkImportMemoryBufferCollectionFUCHSIA *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryBufferCollectionFUCHSIA(reinterpret_cast<const VkImportMemoryBufferCollectionFUCHSIA *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA:
-            safe_pNext = new safe_VkBufferCollectionImageCreateInfoFUCHSIA(reinterpret_cast<const VkBufferCollectionImageCreateInfoFUCHSIA *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBufferCollectionImageCreateInfoFUCHSIA(reinterpret_cast<const VkBufferCollectionImageCreateInfoFUCHSIA *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA:
-            safe_pNext = new safe_VkBufferCollectionBufferCreateInfoFUCHSIA(reinterpret_cast<const VkBufferCollectionBufferCreateInfoFUCHSIA *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkBufferCollectionBufferCreateInfoFUCHSIA(reinterpret_cast<const VkBufferCollectionBufferCreateInfoFUCHSIA *>(pNext));
             break;
 #endif // VK_USE_PLATFORM_FUCHSIA
 #ifdef VK_USE_PLATFORM_GGP
         case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP:
-            safe_pNext = new safe_VkPresentFrameTokenGGP(reinterpret_cast<const VkPresentFrameTokenGGP *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkPresentFrameTokenGGP(reinterpret_cast<const VkPresentFrameTokenGGP *>(pNext));
             break;
 #endif // VK_USE_PLATFORM_GGP
 #ifdef VK_USE_PLATFORM_METAL_EXT
         case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalObjectCreateInfoEXT(reinterpret_cast<const VkExportMetalObjectCreateInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalObjectCreateInfoEXT(reinterpret_cast<const VkExportMetalObjectCreateInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalDeviceInfoEXT(reinterpret_cast<const VkExportMetalDeviceInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalDeviceInfoEXT(reinterpret_cast<const VkExportMetalDeviceInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalCommandQueueInfoEXT(reinterpret_cast<const VkExportMetalCommandQueueInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalCommandQueueInfoEXT(reinterpret_cast<const VkExportMetalCommandQueueInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalBufferInfoEXT(reinterpret_cast<const VkExportMetalBufferInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalBufferInfoEXT(reinterpret_cast<const VkExportMetalBufferInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_METAL_BUFFER_INFO_EXT:
-            safe_pNext = new safe_VkImportMetalBufferInfoEXT(reinterpret_cast<const VkImportMetalBufferInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMetalBufferInfoEXT(reinterpret_cast<const VkImportMetalBufferInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalTextureInfoEXT(reinterpret_cast<const VkExportMetalTextureInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalTextureInfoEXT(reinterpret_cast<const VkExportMetalTextureInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_METAL_TEXTURE_INFO_EXT:
-            safe_pNext = new safe_VkImportMetalTextureInfoEXT(reinterpret_cast<const VkImportMetalTextureInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMetalTextureInfoEXT(reinterpret_cast<const VkImportMetalTextureInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalIOSurfaceInfoEXT(reinterpret_cast<const VkExportMetalIOSurfaceInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalIOSurfaceInfoEXT(reinterpret_cast<const VkExportMetalIOSurfaceInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_METAL_IO_SURFACE_INFO_EXT:
-            safe_pNext = new safe_VkImportMetalIOSurfaceInfoEXT(reinterpret_cast<const VkImportMetalIOSurfaceInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMetalIOSurfaceInfoEXT(reinterpret_cast<const VkImportMetalIOSurfaceInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT:
-            safe_pNext = new safe_VkExportMetalSharedEventInfoEXT(reinterpret_cast<const VkExportMetalSharedEventInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMetalSharedEventInfoEXT(reinterpret_cast<const VkExportMetalSharedEventInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_METAL_SHARED_EVENT_INFO_EXT:
-            safe_pNext = new safe_VkImportMetalSharedEventInfoEXT(reinterpret_cast<const VkImportMetalSharedEventInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMetalSharedEventInfoEXT(reinterpret_cast<const VkImportMetalSharedEventInfoEXT *>(pNext));
             break;
 #endif // VK_USE_PLATFORM_METAL_EXT
 #ifdef VK_USE_PLATFORM_WIN32_KHR
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
-            safe_pNext = new safe_VkImportMemoryWin32HandleInfoKHR(reinterpret_cast<const VkImportMemoryWin32HandleInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryWin32HandleInfoKHR(reinterpret_cast<const VkImportMemoryWin32HandleInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
-            safe_pNext = new safe_VkExportMemoryWin32HandleInfoKHR(reinterpret_cast<const VkExportMemoryWin32HandleInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMemoryWin32HandleInfoKHR(reinterpret_cast<const VkExportMemoryWin32HandleInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
-            safe_pNext = new safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR:
-            safe_pNext = new safe_VkExportSemaphoreWin32HandleInfoKHR(reinterpret_cast<const VkExportSemaphoreWin32HandleInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportSemaphoreWin32HandleInfoKHR(reinterpret_cast<const VkExportSemaphoreWin32HandleInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
-            safe_pNext = new safe_VkD3D12FenceSubmitInfoKHR(reinterpret_cast<const VkD3D12FenceSubmitInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkD3D12FenceSubmitInfoKHR(reinterpret_cast<const VkD3D12FenceSubmitInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR:
-            safe_pNext = new safe_VkExportFenceWin32HandleInfoKHR(reinterpret_cast<const VkExportFenceWin32HandleInfoKHR *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportFenceWin32HandleInfoKHR(reinterpret_cast<const VkExportFenceWin32HandleInfoKHR *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV:
-            safe_pNext = new safe_VkImportMemoryWin32HandleInfoNV(reinterpret_cast<const VkImportMemoryWin32HandleInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkImportMemoryWin32HandleInfoNV(reinterpret_cast<const VkImportMemoryWin32HandleInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV:
-            safe_pNext = new safe_VkExportMemoryWin32HandleInfoNV(reinterpret_cast<const VkExportMemoryWin32HandleInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkExportMemoryWin32HandleInfoNV(reinterpret_cast<const VkExportMemoryWin32HandleInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
-            safe_pNext = new safe_VkWin32KeyedMutexAcquireReleaseInfoNV(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkWin32KeyedMutexAcquireReleaseInfoNV(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT:
-            safe_pNext = new safe_VkSurfaceFullScreenExclusiveInfoEXT(reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSurfaceFullScreenExclusiveInfoEXT(reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT:
-            safe_pNext = new safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(reinterpret_cast<const VkSurfaceCapabilitiesFullScreenExclusiveEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(reinterpret_cast<const VkSurfaceCapabilitiesFullScreenExclusiveEXT *>(pNext));
             break;
         case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT:
-            safe_pNext = new safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(reinterpret_cast<const VkSurfaceFullScreenExclusiveWin32InfoEXT *>(pNext));
+            safe_pNext = new (kSafeStructAlloc) safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(reinterpret_cast<const VkSurfaceFullScreenExclusiveWin32InfoEXT *>(pNext));
             break;
 #endif // VK_USE_PLATFORM_WIN32_KHR
         default: // Encountered an unknown sType -- skip (do not copy) this entry in the chain
             // If sType is in custom list, construct blind copy
             for (auto item : custom_stype_info) {
                 if (item.first == header->sType) {
-                    safe_pNext = malloc(item.second);
+                    safe_pNext = new (kSafeStructAlloc) uint8_t[item.second];
                     memcpy(safe_pNext, header, item.second);
                     // Deep copy the rest of the pNext chain
                     VkBaseOutStructure *custom_struct = reinterpret_cast<VkBaseOutStructure *>(safe_pNext);
@@ -62479,7 +62585,7 @@ void FreePnextChain(const void *pNext) {
                     if (header->pNext) {
                         FreePnextChain(header->pNext);
                     }
-                    free(const_cast<void *>(pNext));
+                    delete[] reinterpret_cast<const uint8_t *>(pNext);
                     pNext = nullptr;
                     break;
                 }
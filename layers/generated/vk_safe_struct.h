@@ -34,11 +34,86 @@
 #pragma once
 #include <vulkan/vulkan.h>
 #include <stdlib.h>
+#include <cstddef>
+#include <new>
 
 void *SafePnextCopy(const void *pNext);
 void FreePnextChain(const void *pNext);
 char *SafeStringCopy(const char *in_string);
 
+// Safe struct deep copies allocate with new (kSafeStructAlloc) so that a SafeStructArena can take over their memory.
+// With no arena bound to the calling thread the global heap is used, and the result is released with a plain delete.
+struct SafeStructAllocTag {};
+constexpr SafeStructAllocTag kSafeStructAlloc{};
+void *operator new(std::size_t size, const SafeStructAllocTag &);
+void *operator new[](std::size_t size, const SafeStructAllocTag &);
+void operator delete(void *ptr, const SafeStructAllocTag &) noexcept;
+void operator delete[](void *ptr, const SafeStructAllocTag &) noexcept;
+
+// Backing store for a frozen safe struct, a deep copy whose arrays, strings, nested structs and pNext chain are all
+// laid out in one allocation. Freeze() runs the copy twice: once into per-thread scratch memory to measure it, and once
+// into a block of exactly that size. A frozen struct is immutable. It must not be assigned or re-initialized, and its
+// destructor must not run, since the arena releases all of its memory at once.
+class SafeStructArena {
+  public:
+    SafeStructArena() = default;
+    SafeStructArena(const SafeStructArena &) = delete;
+    SafeStructArena &operator=(const SafeStructArena &) = delete;
+    ~SafeStructArena() { ::operator delete(block_); }
+
+    // Constructs a T from args in place at dst
+    template <typename T, typename... Args>
+    void Freeze(T *dst, const Args &... args) {
+        BeginMeasure();
+        new (static_cast<void *>(dst)) T(args...);
+        BeginCopy();
+        new (static_cast<void *>(dst)) T(args...);
+        End();
+    }
+
+    std::size_t Size() const { return size_; }
+
+    // Returns nullptr if no arena is bound to the calling thread
+    static void *Allocate(std::size_t size);
+    static bool Bound();
+
+  private:
+    void BeginMeasure();
+    void BeginCopy();
+    void End();
+
+    unsigned char *block_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t used_ = 0;
+    SafeStructArena *prev_ = nullptr;
+    bool measuring_ = false;
+    bool frozen_ = false;
+};
+
+// A safe struct held as a frozen copy, see SafeStructArena
+template <typename T>
+class FrozenSafeStruct {
+  public:
+    template <typename... Args>
+    explicit FrozenSafeStruct(const Args &... args) {
+        arena_.Freeze(&storage_.value, args...);
+    }
+    FrozenSafeStruct(const FrozenSafeStruct &) = delete;
+    FrozenSafeStruct &operator=(const FrozenSafeStruct &) = delete;
+
+    const T &get() const { return storage_.value; }
+
+  private:
+    // The union keeps the destructor of value from running, its memory belongs to arena_
+    union Storage {
+        Storage() {}
+        ~Storage() {}
+        T value;
+    };
+    SafeStructArena arena_;
+    Storage storage_;
+};
+
 
 struct safe_VkBufferMemoryBarrier {
     VkStructureType sType;
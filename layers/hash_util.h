@@ -28,6 +28,7 @@
 #include <type_traits>
 #include <vector>
 #include "vk_layer_data.h"
+#include "vk_layer_utils.h"
 
 // Hash and equality utilities for supporting hashing containers (e.g. unordered_set, unordered_map)
 namespace hash_util {
@@ -122,41 +123,71 @@ struct IsOrderedContainer {
 //       execution.
 //
 // The entries of the dictionary are shared_pointers (the contents of
-// which are invariant with resize/insert), with the hash and equality
-// template arguments wrapped in a shared pointer dereferencing
-// function object
-template <typename T, typename Hasher = layer_data::hash<T>, typename KeyEqual = std::equal_to<T>>
+// which are invariant with resize/insert), keyed by a reference to
+// the shared contents together with their precomputed hash.
+//
+// The entries are split across 2^STRIPESLOG2 independently locked
+// stripes (selected by hash), each guarded by a reader/writer lock.
+// A look_up matching an extant entry takes only the read lock of one
+// stripe and does no allocation, so concurrent creation of identical
+// or unrelated definitions doesn't serialize.
+template <typename T, typename Hasher = layer_data::hash<T>, typename KeyEqual = std::equal_to<T>, int STRIPESLOG2 = 4>
 class Dictionary {
   public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
     // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
     template <typename U = T>
     Id look_up(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
+        static_assert(std::is_same<typename std::decay<U>::type, T>::value, "Dictionary::look_up requires a Def value");
+        const size_t hash = Hasher()(value);
+        Stripe &stripe = stripes_[StripeIndex(hash)];
+        {
+            ReadLockGuard guard(stripe.lock);
+            const auto found = stripe.dict.find(KeyRef{&value, hash});
+            if (found != stripe.dict.end()) return found->second;
+        }
 
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        // Only a miss creates an Id from the value, which will either be retained by dict (if new) or deleted on return (if
+        // another thread added a matching entry after the read lock was released).
+        Id from_input = std::make_shared<T>(std::forward<U>(value));
+        const KeyRef key{from_input.get(), hash};
+        WriteLockGuard guard(stripe.lock);
+        return stripe.dict.emplace(key, std::move(from_input)).first->second;
     }
 
   private:
-    struct HashKeyValue {
-        size_t operator()(const Id &value) const { return Hasher()(*value); }
+    static const int STRIPES = (1 << STRIPESLOG2);
+
+    // Refers to either a lookup argument or the contents of an entry's Id
+    struct KeyRef {
+        const Def *def;
+        size_t hash;
+    };
+    struct KeyRefHash {
+        size_t operator()(const KeyRef &key) const { return key.hash; }
     };
-    struct KeyValueEqual {
-        bool operator()(const Id &lhs, const Id &rhs) const { return KeyEqual()(*lhs, *rhs); }
+    struct KeyRefEqual {
+        bool operator()(const KeyRef &lhs, const KeyRef &rhs) const {
+            return (lhs.hash == rhs.hash) && KeyEqual()(*lhs.def, *rhs.def);
+        }
+    };
+    using Dict = layer_data::unordered_map<KeyRef, Id, KeyRefHash, KeyRefEqual>;
+
+    struct Stripe {
+        ReadWriteLock lock;
+        Dict dict;
     };
-    using Dict = layer_data::unordered_set<Id, HashKeyValue, KeyValueEqual>;
-    using Lock = std::mutex;
-    using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    static uint32_t StripeIndex(size_t hash) {
+        const uint64_t u64 = static_cast<uint64_t>(hash);
+        uint32_t index = static_cast<uint32_t>(u64 >> 32) + static_cast<uint32_t>(u64);
+        index ^= (index >> STRIPESLOG2) ^ (index >> (2 * STRIPESLOG2));
+        return index & (STRIPES - 1);
+    }
+
+    Stripe stripes_[STRIPES];
 };
 }  // namespace hash_util
 
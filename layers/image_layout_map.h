@@ -22,6 +22,7 @@
 #ifndef IMAGE_LAYOUT_MAP_H_
 #define IMAGE_LAYOUT_MAP_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -131,6 +132,11 @@ class ImageSubresourceLayoutMap {
     ~ImageSubresourceLayoutMap() {}
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
 
+    // Command buffers are often recorded once and submitted many times. The initial layouts only need to be validated against
+    // the global layouts again if those have changed since the last submit that validated them without error.
+    bool IsValidatedAgainst(uint64_t global_version) const { return validated_global_version_ == global_version; }
+    void SetValidatedAgainst(uint64_t global_version) const { validated_global_version_ = global_version; }
+
     // This looks a bit ponderous but kAspectCount is a compile time constant
     VkImageSubresource Decode(IndexType index) const {
         const auto subres = encoder_.Decode(index);
@@ -177,6 +183,7 @@ class ImageSubresourceLayoutMap {
     const Encoder& encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    mutable std::atomic<uint64_t> validated_global_version_{std::numeric_limits<uint64_t>::max()};
 };
 }  // namespace image_layout_map
 #endif
@@ -72,8 +72,13 @@ class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkIma
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // Changes every time layouts are written to the map. Must be accessed with the lock held.
+    uint64_t Version() const { return version_; }
+    void IncrementVersion() { ++version_; }
+
   private:
     mutable ReadWriteLock lock_;
+    uint64_t version_ = 0;
 };
 
 // State for VkImage objects.
@@ -192,19 +192,19 @@ void SetLocalEnableSetting(std::string list_of_enables, std::string delimiter, C
     while (list_of_enables.length() != 0) {
         token = GetNextToken(&list_of_enables, delimiter, &pos);
         if (token.find("VK_VALIDATION_FEATURE_ENABLE_") != std::string::npos) {
-            auto result = VkValFeatureEnableLookup.find(token);
-            if (result != VkValFeatureEnableLookup.end()) {
-                SetValidationFeatureEnable(enables, result->second);
+            auto result = FindSettingName(VkValFeatureEnableLookup, token);
+            if (result) {
+                SetValidationFeatureEnable(enables, result->value);
             } else {
-                auto result2 = VkValFeatureEnableLookup2.find(token);
-                if (result2 != VkValFeatureEnableLookup2.end()) {
-                    SetValidationFeatureEnable2(enables, result2->second);
+                auto result2 = FindSettingName(VkValFeatureEnableLookup2, token);
+                if (result2) {
+                    SetValidationFeatureEnable2(enables, result2->value);
                 }
             }
         } else if (token.find("VALIDATION_CHECK_ENABLE_") != std::string::npos) {
-            auto result = ValidationEnableLookup.find(token);
-            if (result != ValidationEnableLookup.end()) {
-                SetValidationEnable(enables, result->second);
+            auto result = FindSettingName(ValidationEnableLookup, token);
+            if (result) {
+                SetValidationEnable(enables, result->value);
             }
         }
     }
@@ -217,14 +217,14 @@ void SetLocalDisableSetting(std::string list_of_disables, std::string delimiter,
     while (list_of_disables.length() != 0) {
         token = GetNextToken(&list_of_disables, delimiter, &pos);
         if (token.find("VK_VALIDATION_FEATURE_DISABLE_") != std::string::npos) {
-            auto result = VkValFeatureDisableLookup.find(token);
-            if (result != VkValFeatureDisableLookup.end()) {
-                SetValidationFeatureDisable(disables, result->second);
+            auto result = FindSettingName(VkValFeatureDisableLookup, token);
+            if (result) {
+                SetValidationFeatureDisable(disables, result->value);
             }
         } else if (token.find("VALIDATION_CHECK_DISABLE_") != std::string::npos) {
-            auto result = ValidationDisableLookup.find(token);
-            if (result != ValidationDisableLookup.end()) {
-                SetValidationDisable(disables, result->second);
+            auto result = FindSettingName(ValidationDisableLookup, token);
+            if (result) {
+                SetValidationDisable(disables, result->value);
             }
         }
     }
@@ -331,6 +331,23 @@ static bool SetBool(std::string &config_string, std::string &env_string, bool de
     return result;
 }
 
+// Leaves value unchanged if neither string is set
+static void SetUint32(const std::string &config_string, const std::string &env_string, uint32_t *value) {
+    const std::string &setting = env_string.empty() ? config_string : env_string;
+    if (!setting.empty()) {
+        const int radix = ((setting.find("0x") == 0) ? 16 : 10);
+        *value = static_cast<uint32_t>(std::strtoul(setting.c_str(), nullptr, radix));
+    }
+}
+
+// Leaves value unchanged if neither string is set
+static void SetString(const std::string &config_string, const std::string &env_string, std::string *value) {
+    const std::string &setting = env_string.empty() ? config_string : env_string;
+    if (!setting.empty()) {
+        *value = setting;
+    }
+}
+
 // Process enables and disables set though the vk_layer_settings.txt config file or through an environment variable
 void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     // If not cleared, garbage has been seen in some Android run effecting the error message
@@ -352,6 +369,20 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == "duplicate_message_limit") {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == "profile_file") {
+                *settings_data->profile_file = cur_setting.data.arrayString.pCharArray;
+            } else if (name == "check_stats_file") {
+                *settings_data->check_stats_file = cur_setting.data.arrayString.pCharArray;
+            } else if (name == "draw_validation_sample_period") {
+                *settings_data->draw_validation_sample_period = cur_setting.data.value32;
+            } else if (name == "draw_validation_sample_random") {
+                *settings_data->draw_validation_sample_random = cur_setting.data.valueBool != VK_FALSE;
+            } else if (name == "validation_frame_budget") {
+                *settings_data->validation_frame_budget = cur_setting.data.value32;
+            } else if (name == "thread_pool_size") {
+                *settings_data->thread_pool_size = cur_setting.data.value32;
+            } else if (name == "thread_pool_affinity") {
+                *settings_data->thread_pool_affinity = cur_setting.data.valueBool != VK_FALSE;
             } else if (name == "custom_stype_list") {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -389,12 +420,26 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string filter_msg_key(settings_data->layer_description);
     std::string message_limit(settings_data->layer_description);
     std::string fine_grained_locking(settings_data->layer_description);
+    std::string profile_file(settings_data->layer_description);
+    std::string check_stats_file(settings_data->layer_description);
+    std::string draw_validation_sample_period(settings_data->layer_description);
+    std::string draw_validation_sample_random(settings_data->layer_description);
+    std::string validation_frame_budget(settings_data->layer_description);
+    std::string thread_pool_size(settings_data->layer_description);
+    std::string thread_pool_affinity(settings_data->layer_description);
     enable_key.append(".enables");
     disable_key.append(".disables");
     stypes_key.append(".custom_stype_list");
     filter_msg_key.append(".message_id_filter");
     message_limit.append(".duplicate_message_limit");
     fine_grained_locking.append(".fine_grained_locking");
+    profile_file.append(".profile_file");
+    check_stats_file.append(".check_stats_file");
+    draw_validation_sample_period.append(".draw_validation_sample_period");
+    draw_validation_sample_random.append(".draw_validation_sample_random");
+    validation_frame_budget.append(".validation_frame_budget");
+    thread_pool_size.append(".thread_pool_size");
+    thread_pool_affinity.append(".thread_pool_affinity");
     std::string list_of_config_enables = getLayerOption(enable_key.c_str());
     std::string list_of_env_enables = GetEnvironment("VK_LAYER_ENABLES");
     std::string list_of_config_disables = getLayerOption(disable_key.c_str());
@@ -407,6 +452,20 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     std::string env_message_limit = GetEnvironment("VK_LAYER_DUPLICATE_MESSAGE_LIMIT");
     std::string config_fine_grained_locking = getLayerOption(fine_grained_locking.c_str());
     std::string env_fine_grained_locking = GetEnvironment("VK_LAYER_FINE_GRAINED_LOCKING");
+    std::string config_profile_file = getLayerOption(profile_file.c_str());
+    std::string env_profile_file = GetEnvironment("VK_LAYER_PROFILE_FILE");
+    std::string config_check_stats_file = getLayerOption(check_stats_file.c_str());
+    std::string env_check_stats_file = GetEnvironment("VK_LAYER_CHECK_STATS_FILE");
+    std::string config_draw_validation_sample_period = getLayerOption(draw_validation_sample_period.c_str());
+    std::string env_draw_validation_sample_period = GetEnvironment("VK_LAYER_DRAW_VALIDATION_SAMPLE_PERIOD");
+    std::string config_draw_validation_sample_random = getLayerOption(draw_validation_sample_random.c_str());
+    std::string env_draw_validation_sample_random = GetEnvironment("VK_LAYER_DRAW_VALIDATION_SAMPLE_RANDOM");
+    std::string config_validation_frame_budget = getLayerOption(validation_frame_budget.c_str());
+    std::string env_validation_frame_budget = GetEnvironment("VK_LAYER_VALIDATION_FRAME_BUDGET");
+    std::string config_thread_pool_size = getLayerOption(thread_pool_size.c_str());
+    std::string env_thread_pool_size = GetEnvironment("VK_LAYER_THREAD_POOL_SIZE");
+    std::string config_thread_pool_affinity = getLayerOption(thread_pool_affinity.c_str());
+    std::string env_thread_pool_affinity = GetEnvironment("VK_LAYER_THREAD_POOL_AFFINITY");
 
 #if defined(_WIN32)
     std::string env_delimiter = ";";
@@ -430,4 +489,14 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
         *settings_data->duplicate_message_limit = config_limit_setting;
     }
     *settings_data->fine_grained_locking = SetBool(config_fine_grained_locking, env_fine_grained_locking, true);
+    SetUint32(config_draw_validation_sample_period, env_draw_validation_sample_period,
+              settings_data->draw_validation_sample_period);
+    *settings_data->draw_validation_sample_random = SetBool(
+        config_draw_validation_sample_random, env_draw_validation_sample_random, *settings_data->draw_validation_sample_random);
+    SetUint32(config_validation_frame_budget, env_validation_frame_budget, settings_data->validation_frame_budget);
+    SetUint32(config_thread_pool_size, env_thread_pool_size, settings_data->thread_pool_size);
+    *settings_data->thread_pool_affinity =
+        SetBool(config_thread_pool_affinity, env_thread_pool_affinity, *settings_data->thread_pool_affinity);
+    SetString(config_profile_file, env_profile_file, settings_data->profile_file);
+    SetString(config_check_stats_file, env_check_stats_file, settings_data->check_stats_file);
 }
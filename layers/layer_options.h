@@ -34,9 +34,35 @@ typedef struct {
     std::vector<uint32_t> &message_filter_list;
     int32_t *duplicate_message_limit;
     bool *fine_grained_locking;
+    std::string *profile_file;
+    std::string *check_stats_file;
+    uint32_t *draw_validation_sample_period;
+    bool *draw_validation_sample_random;
+    uint32_t *validation_frame_budget;
+    uint32_t *thread_pool_size;
+    bool *thread_pool_affinity;
 } ConfigAndEnvSettings;
 
-static const layer_data::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
+// The name tables below are constant-initialized arrays rather than maps so that loading the layer runs no constructors for
+// them. They are only consulted while parsing settings at instance creation, where a linear scan of a handful of entries is
+// cheaper than hashing the token.
+template <typename T>
+struct SettingName {
+    const char *name;
+    T value;
+};
+
+template <typename T, size_t N>
+const SettingName<T> *FindSettingName(const SettingName<T> (&table)[N], const std::string &token) {
+    for (const auto &entry : table) {
+        if (token == entry.name) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+static constexpr SettingName<VkValidationFeatureDisableEXT> VkValFeatureDisableLookup[] = {
     {"VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT", VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT},
     {"VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT", VK_VALIDATION_FEATURE_DISABLE_THREAD_SAFETY_EXT},
     {"VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT", VK_VALIDATION_FEATURE_DISABLE_API_PARAMETERS_EXT},
@@ -47,7 +73,7 @@ static const layer_data::unordered_map<std::string, VkValidationFeatureDisableEX
     {"VK_VALIDATION_FEATURE_DISABLE_ALL_EXT", VK_VALIDATION_FEATURE_DISABLE_ALL_EXT},
 };
 
-static const layer_data::unordered_map<std::string, VkValidationFeatureEnableEXT> VkValFeatureEnableLookup = {
+static constexpr SettingName<VkValidationFeatureEnableEXT> VkValFeatureEnableLookup[] = {
     {"VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT", VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT},
     {"VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT",
      VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT},
@@ -56,18 +82,18 @@ static const layer_data::unordered_map<std::string, VkValidationFeatureEnableEXT
     {"VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT", VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT},
 };
 
-static const layer_data::unordered_map<std::string, VkValidationFeatureEnable> VkValFeatureEnableLookup2 = {
+static constexpr SettingName<VkValidationFeatureEnable> VkValFeatureEnableLookup2[] = {
     {"VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION", VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION},
 };
 
-static const layer_data::unordered_map<std::string, ValidationCheckDisables> ValidationDisableLookup = {
+static constexpr SettingName<ValidationCheckDisables> ValidationDisableLookup[] = {
     {"VALIDATION_CHECK_DISABLE_COMMAND_BUFFER_STATE", VALIDATION_CHECK_DISABLE_COMMAND_BUFFER_STATE},
     {"VALIDATION_CHECK_DISABLE_OBJECT_IN_USE", VALIDATION_CHECK_DISABLE_OBJECT_IN_USE},
     {"VALIDATION_CHECK_DISABLE_QUERY_VALIDATION", VALIDATION_CHECK_DISABLE_QUERY_VALIDATION},
     {"VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION", VALIDATION_CHECK_DISABLE_IMAGE_LAYOUT_VALIDATION},
 };
 
-static const layer_data::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
+static constexpr SettingName<ValidationCheckEnables> ValidationEnableLookup[] = {
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_ARM},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_AMD", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_AMD},
     {"VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_IMG", VALIDATION_CHECK_ENABLE_VENDOR_SPECIFIC_IMG},
@@ -78,7 +104,7 @@ static const layer_data::unordered_map<std::string, ValidationCheckEnables> Vali
 };
 
 // This should mirror the 'DisableFlags' enumerated type
-static const std::vector<std::string> DisableFlagNameHelper = {
+static const char *const DisableFlagNameHelper[] = {
     "VALIDATION_CHECK_DISABLE_COMMAND_BUFFER_STATE",               // command_buffer_state,
     "VALIDATION_CHECK_DISABLE_OBJECT_IN_USE",                      // object_in_use,
     "VALIDATION_CHECK_DISABLE_QUERY_VALIDATION",                   // query_validation,
@@ -93,7 +119,7 @@ static const std::vector<std::string> DisableFlagNameHelper = {
 };
 
 // This should mirror the 'EnableFlags' enumerated type
-static const std::vector<std::string> EnableFlagNameHelper = {
+static const char *const EnableFlagNameHelper[] = {
     "VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT",                       // gpu_validation,
     "VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_RESERVE_BINDING_SLOT_EXT",  // gpu_validation_reserve_binding_slot,
     "VK_VALIDATION_FEATURE_ENABLE_BEST_PRACTICES_EXT",                     // best_practices,
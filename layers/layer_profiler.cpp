@@ -0,0 +1,441 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "layer_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "validation_governor.h"
+
+std::atomic<bool> LayerProfiler::enabled_{false};
+std::atomic<bool> LayerProfiler::tracing_{false};
+std::atomic<bool> LayerProfiler::check_stats_{false};
+std::atomic<bool> LayerProfiler::frame_timing_{false};
+
+namespace {
+
+const char kFrameEventName[] = "Frame";
+
+// Ring buffer slots are guarded by a sequence number (a seqlock), so that the trace can be written while threads are still
+// recording: the slot holding the scope of index i has sequence 2 * i + 2 once written, and an odd sequence while written.
+struct ProfileEvent {
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<uint64_t> begin{0};
+    std::atomic<uint64_t> end{0};
+};
+
+struct ThreadRing {
+    static constexpr uint64_t kMask = LayerProfiler::kRingSize - 1;
+
+    explicit ThreadRing(uint32_t index) : events(new ProfileEvent[LayerProfiler::kRingSize]), thread_index(index) {}
+
+    // Only called by the thread owning the ring
+    void Write(const char *name, uint64_t begin, uint64_t end) {
+        const uint64_t index = head.load(std::memory_order_relaxed);
+        auto &event = events[index & kMask];
+        event.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        event.name.store(name, std::memory_order_relaxed);
+        event.begin.store(begin, std::memory_order_relaxed);
+        event.end.store(end, std::memory_order_relaxed);
+        event.sequence.store(2 * index + 2, std::memory_order_release);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    // Returns false if the slot of the scope of the given index was overwritten, or is being overwritten
+    bool Read(uint64_t index, const char *&name, uint64_t &begin, uint64_t &end) const {
+        const auto &event = events[index & kMask];
+        const uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2) return false;
+        name = event.name.load(std::memory_order_relaxed);
+        begin = event.begin.load(std::memory_order_relaxed);
+        end = event.end.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return event.sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    std::unique_ptr<ProfileEvent[]> events;
+    std::atomic<uint64_t> head{0};
+    // Scopes before first are from a previous profiling session
+    uint64_t first = 0;
+    const uint32_t thread_index;
+};
+
+static_assert((LayerProfiler::kRingSize & (LayerProfiler::kRingSize - 1)) == 0, "The ring size must be a power of 2");
+
+void WriteJsonString(FILE *file, const char *string) {
+    fputc('"', file);
+    for (const char *c = string; *c; ++c) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+class Profiler {
+  public:
+    bool Start(const std::string &filename, uint64_t now, std::atomic<bool> &tracing) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (start_count_ > 0) {
+            // Profiles from several instances go to the file of the first one
+            ++start_count_;
+            return true;
+        }
+        file_ = fopen(filename.c_str(), "w");
+        if (!file_) {
+            return false;
+        }
+        ++start_count_;
+        start_time_ = now;
+        for (auto &ring : rings_) {
+            ring->first = ring->head.load(std::memory_order_acquire);
+        }
+        tracing.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void Stop(std::atomic<bool> &tracing) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (start_count_ > 0 && --start_count_ == 0) {
+            tracing.store(false);
+            WriteTrace();
+            fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    // Rings are kept until the layer is unloaded, since their threads may still hold them
+    ThreadRing *CreateThreadRing() {
+        std::lock_guard<std::mutex> guard(lock_);
+        rings_.emplace_back(new ThreadRing(static_cast<uint32_t>(rings_.size())));
+        return rings_.back().get();
+    }
+
+  private:
+    void WriteTrace() {
+        fprintf(file_, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+        bool first_event = true;
+        for (const auto &ring : rings_) {
+            const uint64_t head = ring->head.load(std::memory_order_acquire);
+            const uint64_t oldest = head > LayerProfiler::kRingSize ? head - LayerProfiler::kRingSize : 0;
+            if (head == ring->first) continue;
+
+            fprintf(file_, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+                    first_event ? "" : ",\n", ring->thread_index, ring->thread_index);
+            first_event = false;
+            for (uint64_t index = std::max(oldest, ring->first); index < head; ++index) {
+                const char *name;
+                uint64_t begin, end;
+                if (!ring->Read(index, name, begin, end) || begin < start_time_) continue;
+
+                fprintf(file_, ",\n{\"name\":");
+                WriteJsonString(file_, name);
+                if (name == kFrameEventName) {
+                    fprintf(file_, ",\"ph\":\"i\",\"s\":\"p\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", ring->thread_index,
+                            (begin - start_time_) / 1000.0);
+                } else {
+                    fprintf(file_, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", ring->thread_index,
+                            (begin - start_time_) / 1000.0, (end - begin) / 1000.0);
+                }
+            }
+        }
+        fprintf(file_, "\n]}\n");
+    }
+
+    std::mutex lock_;
+    FILE *file_ = nullptr;
+    uint32_t start_count_ = 0;
+    uint64_t start_time_ = 0;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+};
+
+Profiler &GetProfiler() {
+    static Profiler profiler;
+    return profiler;
+}
+
+struct FamilyStats {
+    uint64_t count = 0;
+    uint64_t total = 0;
+    uint64_t self = 0;
+};
+
+// Scopes only update the table of their thread, the lock is contended only while the statistics are written
+struct ThreadStats {
+    std::mutex lock;
+    std::unordered_map<const char *, FamilyStats> families;
+};
+
+void WriteCsvString(FILE *file, const std::string &string) {
+    fputc('"', file);
+    for (char c : string) {
+        if (c == '"') fputc('"', file);
+        fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+class CheckStats {
+  public:
+    bool Start(const std::string &filename, std::atomic<bool> &check_stats) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (start_count_ > 0) {
+            ++start_count_;
+            return true;
+        }
+        FILE *file = fopen(filename.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+        fclose(file);
+        filename_ = filename;
+        for (auto &thread : threads_) {
+            std::lock_guard<std::mutex> thread_guard(thread->lock);
+            thread->families.clear();
+        }
+        messages_.clear();
+        ++start_count_;
+        check_stats.store(true, std::memory_order_release);
+        return true;
+    }
+
+    bool Stop(std::atomic<bool> &check_stats) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (start_count_ > 0 && --start_count_ == 0) {
+            check_stats.store(false);
+            return Write();
+        }
+        return true;
+    }
+
+    bool WriteIfStarted() {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (start_count_ > 0) {
+            return Write();
+        }
+        return true;
+    }
+
+    // Tables are kept until the layer is unloaded, since their threads may still hold them
+    ThreadStats *CreateThreadStats() {
+        std::lock_guard<std::mutex> guard(lock_);
+        threads_.emplace_back(new ThreadStats);
+        return threads_.back().get();
+    }
+
+    void CountMessage(const std::string &vuid, const char *family) {
+        std::lock_guard<std::mutex> guard(messages_lock_);
+        ++messages_[vuid][family ? family : ""];
+    }
+
+  private:
+    // Writes the families sorted by self time, then the VUIDs sorted by message count, returns false if the file could not be
+    // opened
+    bool Write() {
+        std::unordered_map<std::string, FamilyStats> families;
+        for (auto &thread : threads_) {
+            std::lock_guard<std::mutex> thread_guard(thread->lock);
+            for (const auto &entry : thread->families) {
+                auto &stats = families[entry.first];
+                stats.count += entry.second.count;
+                stats.total += entry.second.total;
+                stats.self += entry.second.self;
+            }
+        }
+        std::vector<std::pair<std::string, FamilyStats>> family_rows(families.begin(), families.end());
+        std::sort(family_rows.begin(), family_rows.end(),
+                  [](const std::pair<std::string, FamilyStats> &a, const std::pair<std::string, FamilyStats> &b) {
+                      return a.second.self > b.second.self;
+                  });
+
+        struct MessageRow {
+            std::string vuid;
+            std::string family;
+            uint64_t count;
+        };
+        std::vector<MessageRow> message_rows;
+        {
+            std::lock_guard<std::mutex> messages_guard(messages_lock_);
+            for (const auto &vuid : messages_) {
+                for (const auto &family : vuid.second) {
+                    message_rows.push_back({vuid.first, family.first, family.second});
+                }
+            }
+        }
+        std::sort(message_rows.begin(), message_rows.end(),
+                  [](const MessageRow &a, const MessageRow &b) { return a.count > b.count; });
+
+        FILE *file = fopen(filename_.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+        fprintf(file, "kind,name,family,count,total_ns,self_ns,mean_ns\n");
+        for (const auto &row : family_rows) {
+            fprintf(file, "family,");
+            WriteCsvString(file, row.first);
+            fprintf(file, ",,%llu,%llu,%llu,%llu\n", static_cast<unsigned long long>(row.second.count),
+                    static_cast<unsigned long long>(row.second.total), static_cast<unsigned long long>(row.second.self),
+                    static_cast<unsigned long long>(row.second.total / row.second.count));
+        }
+        for (const auto &row : message_rows) {
+            fprintf(file, "vuid,");
+            WriteCsvString(file, row.vuid);
+            fputc(',', file);
+            WriteCsvString(file, row.family);
+            fprintf(file, ",%llu,,,\n", static_cast<unsigned long long>(row.count));
+        }
+        fclose(file);
+        return true;
+    }
+
+    std::mutex lock_;
+    std::string filename_;
+    uint32_t start_count_ = 0;
+    std::vector<std::unique_ptr<ThreadStats>> threads_;
+    // Messages are counted under their own lock, so that they are not held up while the statistics are written
+    std::mutex messages_lock_;
+    std::unordered_map<std::string, std::unordered_map<std::string, uint64_t>> messages_;
+};
+
+CheckStats &GetCheckStats() {
+    static CheckStats check_stats;
+    return check_stats;
+}
+
+thread_local ThreadRing *thread_ring = nullptr;
+thread_local ThreadStats *thread_stats = nullptr;
+// Innermost scope of the thread that began while profiling was enabled
+thread_local LayerProfiler::Scope *current_scope = nullptr;
+
+// Time spent in the layer since the last frame, excluding waiting down-chain calls
+std::atomic<uint64_t> frame_layer_time{0};
+
+void AccumulateCheckStats(const char *name, uint64_t total, uint64_t self) {
+    if (!thread_stats) {
+        thread_stats = GetCheckStats().CreateThreadStats();
+    }
+    std::lock_guard<std::mutex> guard(thread_stats->lock);
+    auto &stats = thread_stats->families[name];
+    ++stats.count;
+    stats.total += total;
+    stats.self += self;
+}
+
+}  // namespace
+
+bool LayerProfiler::Start(const std::string &filename) {
+    const bool started = GetProfiler().Start(filename, Now(), tracing_);
+    UpdateEnabled();
+    return started;
+}
+
+void LayerProfiler::Stop() {
+    GetProfiler().Stop(tracing_);
+    UpdateEnabled();
+}
+
+bool LayerProfiler::StartCheckStats(const std::string &filename) {
+    const bool started = GetCheckStats().Start(filename, check_stats_);
+    UpdateEnabled();
+    return started;
+}
+
+bool LayerProfiler::StopCheckStats() {
+    const bool written = GetCheckStats().Stop(check_stats_);
+    UpdateEnabled();
+    return written;
+}
+
+bool LayerProfiler::WriteCheckStats() {
+    if (check_stats_.load(std::memory_order_relaxed)) {
+        return GetCheckStats().WriteIfStarted();
+    }
+    return true;
+}
+
+void LayerProfiler::CountCheckStatsMessage(const std::string &vuid) {
+    GetCheckStats().CountMessage(vuid, current_scope ? current_scope->name_ : nullptr);
+}
+
+void LayerProfiler::SetFrameTiming(bool enabled) {
+    frame_layer_time.store(0);
+    frame_timing_.store(enabled);
+    UpdateEnabled();
+}
+
+void LayerProfiler::UpdateEnabled() {
+    static std::mutex lock;
+    std::lock_guard<std::mutex> guard(lock);
+    enabled_.store(tracing_.load() || check_stats_.load() || frame_timing_.load());
+}
+
+void LayerProfiler::AddDownChainTime(uint64_t duration) {
+    if (current_scope) {
+        current_scope->down_chain_ += duration;
+    }
+}
+
+void LayerProfiler::Frame() {
+    if (tracing_.load(std::memory_order_relaxed)) {
+        const uint64_t now = Now();
+        Record(kFrameEventName, now, now);
+    }
+    if (frame_timing_.load(std::memory_order_relaxed)) {
+        ValidationGovernor::EndFrame(frame_layer_time.exchange(0, std::memory_order_relaxed));
+    }
+}
+
+uint64_t LayerProfiler::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LayerProfiler::Record(const char *name, uint64_t begin, uint64_t end) {
+    if (!thread_ring) {
+        thread_ring = GetProfiler().CreateThreadRing();
+    }
+    thread_ring->Write(name, begin, end);
+}
+
+void LayerProfiler::Scope::Begin() {
+    parent_ = current_scope;
+    current_scope = this;
+    begin_ = Now();
+}
+
+void LayerProfiler::Scope::End() {
+    const uint64_t end = Now();
+    const uint64_t duration = end - begin_;
+    current_scope = parent_;
+    if (parent_) {
+        parent_->children_ += duration;
+        parent_->down_chain_ += down_chain_;
+    } else if (frame_timing_.load(std::memory_order_relaxed)) {
+        frame_layer_time.fetch_add(duration - std::min(down_chain_, duration), std::memory_order_relaxed);
+    }
+    if (tracing_.load(std::memory_order_relaxed)) {
+        Record(name_, begin_, end);
+    }
+    if (check_stats_.load(std::memory_order_relaxed)) {
+        AccumulateCheckStats(name_, duration, duration - std::min(children_, duration));
+    }
+}
@@ -0,0 +1,129 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Scoped timer profiler for the validation code. Every intercepted API call is a scope, and VVL_PROFILE_SCOPE adds nested
+// scopes anywhere in the validation objects. The profiler has two modes, which can be enabled together:
+//
+// - Tracing, enabled with the khronos_validation.profile_file setting (VK_LAYER_PROFILE_FILE), writes the scopes to that file
+//   in the Chrome trace event format, which chrome://tracing and https://ui.perfetto.dev show as a flame graph per thread, with
+//   a marker at each vkQueuePresentKHR. Each thread records its scopes into its own fixed size ring buffer, without locks, so
+//   only the most recent scopes of each thread are kept.
+// - Check statistics, enabled with the khronos_validation.check_stats_file setting (VK_LAYER_CHECK_STATS_FILE), accumulate the
+//   count, total time and self time (excluding nested scopes) of each scope name, which is the family of checks it runs, and
+//   count the messages logged for each VUID along with the scope they were logged from. The statistics are written to that
+//   file as CSV each time a device is destroyed.
+//
+// The profiler also measures the time spent in the layer per frame for the ValidationGovernor, when it is enabled.
+//
+// When no mode is enabled, the cost of a scope is a relaxed atomic load and a branch.
+class LayerProfiler {
+  public:
+    // Scopes kept per thread, about 2 MiB of events
+    static constexpr uint32_t kRingSize = 64 * 1024;
+
+    // Starts tracing, returns false if the file could not be created. Tracing is reference counted per instance, Stop() writes
+    // the trace once every instance that started it has been destroyed.
+    static bool Start(const std::string &filename);
+    static void Stop();
+
+    // Starts accumulating check statistics, reference counted like tracing. The statistics file is rewritten by
+    // WriteCheckStats() and by the last StopCheckStats(), which return false if it could not be opened.
+    static bool StartCheckStats(const std::string &filename);
+    static bool StopCheckStats();
+    // Writes the statistics accumulated so far, if enabled
+    static bool WriteCheckStats();
+    // Counts a message logged for vuid, from the innermost scope of the calling thread
+    static void CountMessage(const std::string &vuid) {
+        if (check_stats_.load(std::memory_order_relaxed)) {
+            CountCheckStatsMessage(vuid);
+        }
+    }
+
+    // Sums the time spent in the outermost scopes of all threads between frames, for the ValidationGovernor
+    static void SetFrameTiming(bool enabled);
+
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // Brackets a down-chain call that may wait for the GPU or the presentation engine, its time is not counted as time spent in
+    // the layer for the frame
+    static uint64_t DownChainBegin() { return IsEnabled() ? Now() : 0; }
+    static void DownChainEnd(uint64_t begin) {
+        if (begin != 0) {
+            AddDownChainTime(Now() - begin);
+        }
+    }
+
+    // Marks the end of a frame
+    static void Frame();
+
+    class Scope {
+      public:
+        // name must outlive the profiler, scopes are named with string literals
+        explicit Scope(const char *name) : name_(name) {
+            if (IsEnabled()) {
+                Begin();
+            }
+        }
+        ~Scope() {
+            if (begin_ != 0) {
+                End();
+            }
+        }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        friend class LayerProfiler;
+
+        void Begin();
+        void End();
+
+        const char *const name_;
+        uint64_t begin_ = 0;
+        // Time spent in the nested scopes and in waiting down-chain calls, and the enclosing scope
+        uint64_t children_ = 0;
+        uint64_t down_chain_ = 0;
+        Scope *parent_ = nullptr;
+    };
+
+  private:
+    static uint64_t Now();
+    static void Record(const char *name, uint64_t begin, uint64_t end);
+    static void CountCheckStatsMessage(const std::string &vuid);
+    static void AddDownChainTime(uint64_t duration);
+    static void UpdateEnabled();
+
+    // Any of tracing, check statistics or frame timing
+    static std::atomic<bool> enabled_;
+    static std::atomic<bool> tracing_;
+    static std::atomic<bool> check_stats_;
+    static std::atomic<bool> frame_timing_;
+};
+
+#define VVL_PROFILE_CONCAT_HELPER(a, b) a##b
+#define VVL_PROFILE_CONCAT(a, b) VVL_PROFILE_CONCAT_HELPER(a, b)
+
+// Times the rest of the enclosing block as a scope named name, when profiling is enabled
+#define VVL_PROFILE_SCOPE(name) LayerProfiler::Scope VVL_PROFILE_CONCAT(vvl_profile_scope_, __LINE__)(name)
+
+// Times an intercepted API call, as the outermost scope of the calling thread, when profiling is enabled
+#define VVL_PROFILE_API_CALL(name) LayerProfiler::Scope vvl_profile_api_call(name)
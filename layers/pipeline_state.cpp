@@ -64,8 +64,8 @@ PipelineStageState::PipelineStageState(const safe_VkPipelineShaderStageCreateInf
       create_info(stage),
       stage_flag(stage->stage),
       entrypoint(module_state->FindEntrypoint(stage->pName, stage->stage)),
-      accessible_ids(module_state->MarkAccessibleIds(entrypoint)),
-      descriptor_uses(module_state->CollectInterfaceByDescriptorSlot(accessible_ids)),
+      accessible_ids(module_state->GetAccessibleIds(entrypoint)),
+      descriptor_uses(module_state->GetDescriptorUses(entrypoint)),
       has_writable_descriptor(HasWriteableDescriptor(descriptor_uses)),
       has_atomic_descriptor(HasAtomicDescriptor(descriptor_uses)),
       wrote_primitive_shading_rate(WrotePrimitiveShadingRate(stage_flag, entrypoint, module_state.get())),
@@ -218,7 +218,7 @@ static layer_data::unordered_set<uint32_t> GetFSOutputLocations(const PIPELINE_S
             continue;
         }
         if (stage.stage_flag == VK_SHADER_STAGE_FRAGMENT_BIT) {
-            result = stage.module_state->CollectWritableOutputLocationinFS(*(stage.entrypoint));
+            result = stage.module_state->GetWritableOutputLocationsInFS(*(stage.entrypoint));
             break;
         }
     }
@@ -442,7 +442,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
                                std::shared_ptr<const PIPELINE_LAYOUT_STATE> &&layout)
     : BASE_NODE(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
       rp_state(rpstate),
-      create_info(pCreateInfo, rpstate),
+      create_info(create_info_arena, pCreateInfo, rpstate),
       graphics_lib_type(GetGraphicsLibType(create_info.graphics)),
       vertex_input_state(CreateVertexInputState(*this, *state_data, create_info.graphics)),
       pre_raster_state(CreatePreRasterState(*this, *state_data, create_info.graphics, rpstate)),
@@ -460,10 +460,10 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
     if (link_info) {
         // accumulate dynamic state
         // TODO is this correct?
-        auto *dyn_state_ci = const_cast<safe_VkPipelineDynamicStateCreateInfo *>(create_info.graphics.pDynamicState);
+        const auto *dyn_state_ci = create_info.graphics.pDynamicState;
         std::vector<VkDynamicState> dyn_states;
         VkPipelineDynamicStateCreateFlags dyn_flags = 0;
-        if (create_info.graphics.pDynamicState) {
+        if (dyn_state_ci) {
             std::copy(dyn_state_ci->pDynamicStates, dyn_state_ci->pDynamicStates + dyn_state_ci->dynamicStateCount,
                       std::back_inserter(dyn_states));
             dyn_flags = dyn_state_ci->flags;
@@ -475,19 +475,14 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
         if (dyn_states.size() > 0) {
             // We have dynamic state
             if (!dyn_state_ci || (dyn_state_ci->dynamicStateCount < dyn_states.size())) {
-                // There is dynamic state defined in libraries that the is not included in this pipeline's create info
-                if (!dyn_state_ci) {
-                    // *All* dynamic state defined is coming from graphics libraries
-                    // NOTE: heap allocation cleaned up in ~safe_VkGraphicsPipelineCreateInfo
-                    dyn_state_ci = new safe_VkPipelineDynamicStateCreateInfo;
-                    const_cast<safe_VkGraphicsPipelineCreateInfo *>(&create_info.graphics)->pDynamicState = dyn_state_ci;
-                }
-                dyn_state_ci->flags = dyn_flags;
-                dyn_state_ci->dynamicStateCount = static_cast<uint32_t>(dyn_states.size());
-                // NOTE: heap allocation cleaned up in ~safe_VkPipelineDynamicStateCreateInfo
-                dyn_state_ci->pDynamicStates = new VkDynamicState[dyn_states.size()];
-                std::copy(&dyn_states.front(), &dyn_states.front() + dyn_states.size(),
-                          const_cast<VkDynamicState *>(dyn_state_ci->pDynamicStates));
+                // There is dynamic state defined in libraries that the is not included in this pipeline's create info.
+                // The frozen create info cannot grow, so point it at a merged copy owned by this pipeline instead.
+                auto merged_ci = LvlInitStruct<VkPipelineDynamicStateCreateInfo>();
+                merged_ci.flags = dyn_flags;
+                merged_ci.dynamicStateCount = static_cast<uint32_t>(dyn_states.size());
+                merged_ci.pDynamicStates = dyn_states.data();
+                linked_dynamic_state = layer_data::make_unique<safe_VkPipelineDynamicStateCreateInfo>(&merged_ci);
+                const_cast<safe_VkGraphicsPipelineCreateInfo *>(&create_info.graphics)->pDynamicState = linked_dynamic_state.get();
             }
         }
 
@@ -518,7 +513,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
 PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const VkComputePipelineCreateInfo *pCreateInfo,
                                std::shared_ptr<const PIPELINE_LAYOUT_STATE> &&layout)
     : BASE_NODE(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
-      create_info(pCreateInfo),
+      create_info(create_info_arena, pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
       active_shaders(GetActiveShaders(stage_state)),
@@ -531,7 +526,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
 PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const VkRayTracingPipelineCreateInfoKHR *pCreateInfo,
                                std::shared_ptr<const PIPELINE_LAYOUT_STATE> &&layout)
     : BASE_NODE(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
-      create_info(pCreateInfo),
+      create_info(create_info_arena, pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
       active_shaders(GetActiveShaders(stage_state)),
@@ -546,7 +541,7 @@ PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const V
 PIPELINE_STATE::PIPELINE_STATE(const ValidationStateTracker *state_data, const VkRayTracingPipelineCreateInfoNV *pCreateInfo,
                                std::shared_ptr<const PIPELINE_LAYOUT_STATE> &&layout)
     : BASE_NODE(static_cast<VkPipeline>(VK_NULL_HANDLE), kVulkanObjectTypePipeline),
-      create_info(pCreateInfo),
+      create_info(create_info_arena, pCreateInfo),
       stage_state(GetStageStates(*state_data, *this)),
       active_slots(GetActiveSlots(stage_state)),
       active_shaders(GetActiveShaders(stage_state)),
@@ -580,4 +575,5 @@ void LAST_BOUND_STATE::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    draw_state_unvalidated = false;
 }
@@ -103,9 +103,10 @@ struct PipelineStageState {
     const safe_VkPipelineShaderStageCreateInfo *create_info;
     VkShaderStageFlagBits stage_flag;
     layer_data::optional<Instruction> entrypoint;
-    layer_data::unordered_set<uint32_t> accessible_ids;
+    // Cached in module_state, and shared by all pipelines using this entrypoint
+    const std::vector<uint32_t> &accessible_ids;  // sorted
     using DescriptorUse = std::pair<DescriptorSlot, interface_var>;
-    std::vector<DescriptorUse> descriptor_uses;
+    const std::vector<DescriptorUse> &descriptor_uses;
     bool has_writable_descriptor;
     bool has_atomic_descriptor;
     bool wrote_primitive_shading_rate;
@@ -117,11 +118,14 @@ struct PipelineStageState {
 
 class PIPELINE_STATE : public BASE_NODE {
   public:
+    // Graphics, compute and KHR ray tracing create infos are frozen into the arena given to the constructor, which owns
+    // all of their memory. The NV ray tracing conversion still builds an ordinary heap copy.
     union CreateInfo {
         template <typename CI>
         struct Traits {};
 
-        CreateInfo(const VkGraphicsPipelineCreateInfo *ci, std::shared_ptr<const RENDER_PASS_STATE> rpstate) : graphics() {
+        CreateInfo(SafeStructArena &arena, const VkGraphicsPipelineCreateInfo *ci,
+                   std::shared_ptr<const RENDER_PASS_STATE> rpstate) {
             bool use_color = false;
             bool use_depth_stencil = false;
 
@@ -137,27 +141,16 @@ class PIPELINE_STATE : public BASE_NODE {
                 use_depth_stencil = rpstate->UsesDepthStencilAttachment(ci->subpass);
             }
 
-            graphics.initialize(ci, use_color, use_depth_stencil);
+            arena.Freeze(&graphics, ci, use_color, use_depth_stencil);
         }
-        CreateInfo(const VkComputePipelineCreateInfo *ci) : compute(ci) {}
-        CreateInfo(const VkRayTracingPipelineCreateInfoKHR *ci) : raytracing(ci) {}
-        CreateInfo(const VkRayTracingPipelineCreateInfoNV *ci) : raytracing(ci) {}
+        CreateInfo(SafeStructArena &arena, const VkComputePipelineCreateInfo *ci) { arena.Freeze(&compute, ci); }
+        CreateInfo(SafeStructArena &arena, const VkRayTracingPipelineCreateInfoKHR *ci) { arena.Freeze(&raytracing, ci); }
+        // The NV conversion moves pointers out of a temporary copy, which a frozen copy cannot release
+        CreateInfo(SafeStructArena &, const VkRayTracingPipelineCreateInfoNV *ci) : raytracing(ci) {}
 
         ~CreateInfo() {
-            switch (graphics.sType) {
-                case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO:
-                    graphics.~safe_VkGraphicsPipelineCreateInfo();
-                    break;
-                case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO:
-                    compute.~safe_VkComputePipelineCreateInfo();
-                    break;
-                case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV:
-                case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR:
-                    raytracing.~safe_VkRayTracingPipelineCreateInfoCommon();
-                    break;
-                default:
-                    assert(false);
-                    break;
+            if (graphics.sType == VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV) {
+                raytracing.~safe_VkRayTracingPipelineCreateInfoCommon();
             }
         }
 
@@ -172,7 +165,10 @@ class PIPELINE_STATE : public BASE_NODE {
     // Render pass state for dynamic rendering, etc.
     std::shared_ptr<const RENDER_PASS_STATE> rp_state;
 
+    SafeStructArena create_info_arena;
     const CreateInfo create_info;
+    // Dynamic state merged from linked libraries, create_info.graphics.pDynamicState points here when it is set
+    std::unique_ptr<safe_VkPipelineDynamicStateCreateInfo> linked_dynamic_state;
 
   public:
     VkGraphicsPipelineLibraryFlagsEXT graphics_lib_type = static_cast<VkGraphicsPipelineLibraryFlagsEXT>(0);
@@ -224,6 +220,9 @@ class PIPELINE_STATE : public BASE_NODE {
 
     VkPipeline pipeline() const { return handle_.Cast<VkPipeline>(); }
 
+    std::shared_ptr<const PIPELINE_STATE> shared_from_this() const { return SharedFromThisImpl(this); }
+    std::shared_ptr<PIPELINE_STATE> shared_from_this() { return SharedFromThisImpl(this); }
+
     void SetHandle(VkPipeline p) { handle_.handle = CastToUint64(p); }
 
     inline VkPipelineBindPoint GetPipelineType() const {
@@ -644,6 +643,10 @@ struct LAST_BOUND_STATE {
 
     std::vector<PER_SET> per_set;
 
+    // Set when draw validation sampling skips a draw or dispatch of this bind point. Recording still updates the validated
+    // descriptor state in per_set, so the next validated command of this bind point ignores it.
+    mutable bool draw_state_unvalidated{false};
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<cvdescriptorset::DescriptorSet> &&ds);
@@ -202,3 +202,60 @@ struct FragmentOutputState {
     bool sample_location_enabled = false;
     bool dual_source_blending = false;
 };
+
+// Remembers pairs of graphics library state objects that have passed a link-time compatibility check. Applications commonly
+// link a handful of libraries into a large number of pipelines; checks whose outcome only depends on the pair can then be
+// skipped after the first success. Failures are never recorded so that their errors are reported for each pipeline.
+//
+// Entries only hold weak references. A pair is found while both objects are alive, and an object allocated at the address of a
+// destroyed one does not match the stale entry since ownership, not the address, is compared.
+template <typename First, typename Second>
+class LinkedStateCache {
+  public:
+    bool Contains(const std::shared_ptr<First> &first, const std::shared_ptr<Second> &second) const {
+        if (!first || !second) {
+            return false;
+        }
+        ReadLockGuard guard(lock_);
+        const auto it = entries_.find(Key(first.get(), second.get()));
+        return (it != entries_.end()) && SameOwner(it->second.first, first) && SameOwner(it->second.second, second);
+    }
+
+    void Insert(const std::shared_ptr<First> &first, const std::shared_ptr<Second> &second) {
+        if (!first || !second) {
+            return;
+        }
+        WriteLockGuard guard(lock_);
+        if (entries_.size() >= prune_size_) {
+            for (auto it = entries_.begin(); it != entries_.end();) {
+                if (it->second.first.expired() || it->second.second.expired()) {
+                    it = entries_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            prune_size_ = (entries_.size() * 2 > kMinPruneSize) ? entries_.size() * 2 : kMinPruneSize;
+        }
+        entries_[Key(first.get(), second.get())] = Entry(first, second);
+    }
+
+  private:
+    static constexpr size_t kMinPruneSize = 64;
+
+    using Key = std::pair<const First *, const Second *>;
+    using Entry = std::pair<std::weak_ptr<First>, std::weak_ptr<Second>>;
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return hash_util::HashCombiner().Combine(key.first).Combine(key.second).Value();
+        }
+    };
+
+    template <typename T>
+    static bool SameOwner(const std::weak_ptr<T> &weak, const std::shared_ptr<T> &shared) {
+        return !weak.owner_before(shared) && !shared.owner_before(weak);
+    }
+
+    mutable ReadWriteLock lock_;
+    layer_data::unordered_map<Key, Entry, KeyHash> entries_;
+    size_t prune_size_ = kMinPruneSize;
+};
@@ -47,30 +47,44 @@ class QUERY_POOL_STATE : public BASE_NODE {
           has_perf_scope_render_pass(has_rb),
           n_performance_passes(n_perf_pass),
           perf_counter_index_count(index_count),
-          query_states_(pCreateInfo->queryCount) {
-        for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-            auto perf_size = n_perf_pass > 0 ? n_perf_pass : 1;
-            query_states_[i].reserve(perf_size);
-            for (uint32_t p = 0; p < perf_size; p++) {
-                query_states_[i].emplace_back(QUERYSTATE_UNKNOWN);
-            }
-        }
-    }
+          query_states_(static_cast<size_t>(pCreateInfo->queryCount) * (n_perf_pass > 0 ? n_perf_pass : 1),
+                        QUERYSTATE_UNKNOWN) {}
 
     VkQueryPool pool() const { return handle_.Cast<VkQueryPool>(); }
 
     void SetQueryState(uint32_t query, uint32_t perf_pass, QueryState state) {
         auto guard = WriteLock();
-        assert(query < query_states_.size());
-        assert((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes));
-        query_states_[query][perf_pass] = state;
+        assert(query < createInfo.queryCount);
+        assert(IsValidPerfPass(perf_pass));
+        query_states_[StateIndex(query, perf_pass)] = state;
+    }
+    // Sets queries [first, first + count) of perf_pass to state, clamped to the pool size
+    void SetQueryStates(uint32_t first, uint32_t count, uint32_t perf_pass, QueryState state) {
+        auto guard = WriteLock();
+        assert(IsValidPerfPass(perf_pass));
+        if (first >= createInfo.queryCount) return;
+        count = std::min(count, createInfo.queryCount - first);
+        auto begin = query_states_.begin() + StateIndex(first, perf_pass);
+        std::fill(begin, begin + count, state);
+    }
+    // Applies states[i] to query first + i of perf_pass, leaving queries whose entry is QUERYSTATE_UNKNOWN untouched
+    void MergeQueryStates(uint32_t first, uint32_t perf_pass, const std::vector<QueryState> &states) {
+        auto guard = WriteLock();
+        assert(IsValidPerfPass(perf_pass));
+        if (first >= createInfo.queryCount) return;
+        const uint32_t count = static_cast<uint32_t>(std::min<size_t>(states.size(), createInfo.queryCount - first));
+        const size_t base = StateIndex(first, perf_pass);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (states[i] != QUERYSTATE_UNKNOWN) {
+                query_states_[base + i] = states[i];
+            }
+        }
     }
     QueryState GetQueryState(uint32_t query, uint32_t perf_pass) const {
         auto guard = ReadLock();
         // this method can get called with invalid arguments during validation
-        if (query < query_states_.size() &&
-            ((n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes))) {
-            return query_states_[query][perf_pass];
+        if (query < createInfo.queryCount && IsValidPerfPass(perf_pass)) {
+            return query_states_[StateIndex(query, perf_pass)];
         }
         return QUERYSTATE_UNKNOWN;
     }
@@ -86,7 +100,15 @@ class QUERY_POOL_STATE : public BASE_NODE {
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
-    std::vector<small_vector<QueryState, 1, uint32_t>> query_states_;
+    bool IsValidPerfPass(uint32_t perf_pass) const {
+        return (n_performance_passes == 0 && perf_pass == 0) || (perf_pass < n_performance_passes);
+    }
+    // States are stored pass major, so that a range of queries of one pass is contiguous
+    size_t StateIndex(uint32_t query, uint32_t perf_pass) const {
+        return static_cast<size_t>(perf_pass) * createInfo.queryCount + query;
+    }
+
+    std::vector<QueryState> query_states_;
     mutable ReadWriteLock lock_;
 };
 
@@ -129,7 +151,50 @@ inline bool operator==(const QueryObject &query1, const QueryObject &query2) {
     return ((query1.pool == query2.pool) && (query1.query == query2.query) && (query1.perf_pass == query2.perf_pass));
 }
 
-typedef std::map<QueryObject, QueryState> QueryMap;
+// Query states set by replaying the query updates of one or more command buffers, before they are applied to the
+// QUERY_POOL_STATEs. States are kept in a dense array per pool and perf pass, covering the span of queries touched so far,
+// so that ranges of queries are set in bulk. QUERYSTATE_UNKNOWN marks queries inside that span which were not set.
+class QueryMap {
+  public:
+    struct QueryStates {
+        uint32_t first = 0;
+        std::vector<QueryState> states;  // state of query first + i
+    };
+    using Key = std::pair<VkQueryPool, uint32_t>;  // pool, perf pass
+    using const_iterator = std::map<Key, QueryStates>::const_iterator;
+
+    // Sets queries [first, first + count) of pool to state, clamped to the query_count queries of the pool
+    void SetState(VkQueryPool pool, uint32_t perf_pass, uint32_t first, uint32_t count, uint32_t query_count, QueryState state) {
+        if (first >= query_count) return;
+        count = std::min(count, query_count - first);
+        if (count == 0) return;
+        auto &entry = map_[Key(pool, perf_pass)];
+        if (entry.states.empty()) {
+            entry.first = first;
+        } else if (first < entry.first) {
+            entry.states.insert(entry.states.begin(), entry.first - first, QUERYSTATE_UNKNOWN);
+            entry.first = first;
+        }
+        const size_t offset = first - entry.first;
+        if (entry.states.size() < offset + count) {
+            entry.states.resize(offset + count, QUERYSTATE_UNKNOWN);
+        }
+        std::fill_n(entry.states.begin() + offset, count, state);
+    }
+    QueryState GetState(VkQueryPool pool, uint32_t perf_pass, uint32_t query) const {
+        auto it = map_.find(Key(pool, perf_pass));
+        if (it != map_.end() && query >= it->second.first && (query - it->second.first) < it->second.states.size()) {
+            return it->second.states[query - it->second.first];
+        }
+        return QUERYSTATE_UNKNOWN;
+    }
+
+    const_iterator begin() const { return map_.begin(); }
+    const_iterator end() const { return map_.end(); }
+
+  private:
+    std::map<Key, QueryStates> map_;
+};
 
 enum QueryResultType {
     QUERYRESULT_UNKNOWN,
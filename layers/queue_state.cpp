@@ -27,6 +27,9 @@
 #include "queue_state.h"
 #include "cmd_buffer_state.h"
 #include "state_tracker.h"
+#include "thread_pool.h"
+
+#include <algorithm>
 
 using SemOp = SEMAPHORE_STATE::SemOp;
 
@@ -98,12 +101,15 @@ uint64_t QUEUE_STATE::Submit(CB_SUBMISSION &&submission) {
             retire_early = true;
         }
     }
+    bool queue_retire_task;
     {
         auto guard = Lock();
         submissions_.emplace_back(std::move(submission));
-        if (!thread_) {
-            thread_ = layer_data::make_unique<std::thread>(&QUEUE_STATE::ThreadFunc, this);
-        }
+        // A notification can be ahead of the submissions, for example from a timeline semaphore signaled on the host
+        queue_retire_task = QueueRetireTask();
+    }
+    if (queue_retire_task) {
+        ThreadPool::Submit([this]() { RetireSubmissions(); });
     }
     return retire_early ? submission.seq : 0;
 }
@@ -138,50 +144,85 @@ void QUEUE_STATE::NotifyAndWait(uint64_t until_seq) {
 }
 
 uint64_t QUEUE_STATE::Notify(uint64_t until_seq) {
-    auto guard = Lock();
-    if (until_seq == UINT64_MAX) {
-        until_seq = seq_;
+    bool queue_retire_task;
+    {
+        auto guard = Lock();
+        if (until_seq == UINT64_MAX) {
+            until_seq = seq_;
+        }
+        if (request_seq_ < until_seq) {
+            request_seq_ = until_seq;
+        }
+        queue_retire_task = QueueRetireTask();
     }
-    if (request_seq_ < until_seq) {
-        request_seq_ = until_seq;
+    if (queue_retire_task) {
+        ThreadPool::Submit([this]() { RetireSubmissions(); });
     }
-    cond_.notify_one();
     return until_seq;
 }
 
 void QUEUE_STATE::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
     {
         auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
-    }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
+        exiting_ = true;
+        // The retire task stops after the submission it is retiring
+        cond_.wait(guard, [this]() { return !retire_task_queued_; });
     }
     BASE_NODE::Destroy();
 }
 
+// Must be called with lock_ held, returns true if the caller must submit a retire task once it has released the lock
+bool QUEUE_STATE::QueueRetireTask() {
+    if (retire_task_queued_ || exiting_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        return false;
+    }
+    retire_task_queued_ = true;
+    return true;
+}
+
 CB_SUBMISSION *QUEUE_STATE::NextSubmission() {
     CB_SUBMISSION *result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
+    // Find if the next submission is ready so that the retire task doesn't need to worry
     // about locking.
     auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
-    }
-    if (!exit_thread_) {
+    if (exiting_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        // Nothing is ready, the next Notify() queues a new task. Pool workers must not wait for the GPU.
+        retire_task_queued_ = false;
+        cond_.notify_all();
+    } else {
         result = &submissions_.front();
+        resume_requested_ = false;
         // NOTE: the submission must remain on the dequeue until we're done processing it so that
         // anyone waiting for it can find the correct waiter
     }
     return result;
 }
 
-void QUEUE_STATE::ThreadFunc() {
+// Must be called by the retire task when a semaphore operation of another queue must be retired first. Returns true if the
+// task must stop, false if the queue was resumed meanwhile and the task must try again.
+bool QUEUE_STATE::Suspend() {
+    auto guard = Lock();
+    if (resume_requested_ && !exiting_) {
+        return false;
+    }
+    retire_task_queued_ = false;
+    cond_.notify_all();
+    return true;
+}
+
+void QUEUE_STATE::Resume() {
+    bool queue_retire_task;
+    {
+        auto guard = Lock();
+        resume_requested_ = true;
+        queue_retire_task = QueueRetireTask();
+    }
+    if (queue_retire_task) {
+        ThreadPool::Submit([this]() { RetireSubmissions(); });
+    }
+}
+
+void QUEUE_STATE::RetireSubmissions() {
     CB_SUBMISSION *submission = nullptr;
 
     auto is_query_updated_after = [this](const QueryObject &query_object) {
@@ -205,22 +246,41 @@ void QUEUE_STATE::ThreadFunc() {
         return false;
     };
 
+    auto retire_semaphores = [this](std::vector<CB_SUBMISSION::SemaphoreInfo> &semaphores) {
+        for (auto &semaphore_info : semaphores) {
+            if (!semaphore_info.semaphore->Retire(this, semaphore_info.payload)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
     // Roll this queue forward, one submission at a time.
     while ((submission = NextSubmission())) {
-        submission->EndUse();
-        for (auto &wait : submission->wait_semaphores) {
-            wait.semaphore->Retire(this, wait.payload);
+        // Retiring semaphores is idempotent, so a submission that waits for another queue starts over once it is resumed
+        if (!retire_semaphores(submission->wait_semaphores)) {
+            if (Suspend()) {
+                return;
+            }
+            continue;
         }
-        for (auto &cb_node : submission->cbs) {
-            auto cb_guard = cb_node->WriteLock();
-            for (auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
-                auto secondary_guard = secondary_cmd_buffer->WriteLock();
-                secondary_cmd_buffer->Retire(submission->perf_submit_pass, is_query_updated_after);
+        if (!submission->retired_cbs) {
+            submission->EndUse();
+            for (auto &cb_node : submission->cbs) {
+                auto cb_guard = cb_node->WriteLock();
+                for (auto *secondary_cmd_buffer : cb_node->linkedCommandBuffers) {
+                    auto secondary_guard = secondary_cmd_buffer->WriteLock();
+                    secondary_cmd_buffer->Retire(submission->perf_submit_pass, is_query_updated_after);
+                }
+                cb_node->Retire(submission->perf_submit_pass, is_query_updated_after);
             }
-            cb_node->Retire(submission->perf_submit_pass, is_query_updated_after);
+            submission->retired_cbs = true;
         }
-        for (auto &signal : submission->signal_semaphores) {
-            signal.semaphore->Retire(this, signal.payload);
+        if (!retire_semaphores(submission->signal_semaphores)) {
+            if (Suspend()) {
+                return;
+            }
+            continue;
         }
         if (submission->fence) {
             submission->fence->Retire();
@@ -416,12 +476,14 @@ void SEMAPHORE_STATE::Notify(uint64_t payload) {
     }
 }
 
-void SEMAPHORE_STATE::Retire(QUEUE_STATE *current_queue, uint64_t payload) {
+bool SEMAPHORE_STATE::Retire(QUEUE_STATE *current_queue, uint64_t payload) {
     auto guard = WriteLock();
+    bool retired_any = false;
+    bool result = true;
     // This loop tells all queues that use the semaphore that something has happened.
     // Operations that are on the current queue (or no queue), we clean them up
-    // immediately. For other queues, we must notify them and then wait for them to
-    // update state. This rather scary process ensures that all queues update their
+    // immediately. For other queues, we must notify them and let them update state
+    // first. This rather scary process ensures that all queues update their
     // state in the order that operations completed on the GPU.
     while (!operations_.empty() && operations_.begin()->second.payload <= payload) {
         auto &op = operations_.begin()->second;
@@ -435,12 +497,22 @@ void SEMAPHORE_STATE::Retire(QUEUE_STATE *current_queue, uint64_t payload) {
             }
             op.completed.set_value();
             operations_.erase(operations_.begin());
+            retired_any = true;
+        } else if (current_queue) {
+            // Retire tasks run on the ThreadPool, where waiting for the task of the other queue could wait for a task queued
+            // behind this one on the same worker. The task stops instead, and is resumed once the other queue has retired
+            // the operation.
+            if (std::find(blocked_queues_.begin(), blocked_queues_.end(), current_queue) == blocked_queues_.end()) {
+                blocked_queues_.emplace_back(current_queue);
+            }
+            result = false;
+            break;
         } else if (op.waiter.valid()) {
             // the current op should get destroyed while we're waiting, so copy out the waiter.
             auto waiter = op.waiter;
             guard.unlock();
-            auto result = waiter.wait_until(GetCondWaitTimeout());
-            if (result != std::future_status::ready) {
+            auto wait_result = waiter.wait_until(GetCondWaitTimeout());
+            if (wait_result != std::future_status::ready) {
                 dev_data_.LogError(Handle(), "UNASSIGNED-VkSemaphore-state-timeout",
                                    "Timeout waiting for timeline semaphore state to update. This is most likely a validation bug."
                                    " completed_.payload=%" PRIu64 " wait_payload=%" PRIu64,
@@ -449,6 +521,16 @@ void SEMAPHORE_STATE::Retire(QUEUE_STATE *current_queue, uint64_t payload) {
             guard.lock();
         }
     }
+    // The retire tasks of the other queues may have stopped on the operations retired here
+    std::vector<QUEUE_STATE *> blocked_queues;
+    if (retired_any) {
+        blocked_queues.swap(blocked_queues_);
+    }
+    guard.unlock();
+    for (auto *queue : blocked_queues) {
+        queue->Resume();
+    }
+    return result;
 }
 
 std::shared_future<void> SEMAPHORE_STATE::Wait(uint64_t payload) {
@@ -30,7 +30,6 @@
 #include <deque>
 #include <future>
 #include <set>
-#include <thread>
 #include <vector>
 #include "vk_layer_utils.h"
 
@@ -214,7 +213,9 @@ class SEMAPHORE_STATE : public REFCOUNTED_NODE {
     void NotifyAndWait(uint64_t payload);
 
     // Remove completed operations and signal any waiters. This should only be called by QUEUE_STATE
-    void Retire(QUEUE_STATE *current_queue, uint64_t payload);
+    // Returns false when current_queue must wait for an operation of another queue to be retired first, the retire task of
+    // current_queue is then resumed by that queue. With no current_queue, waits for the other queues instead.
+    bool Retire(QUEUE_STATE *current_queue, uint64_t payload);
 
     // For vkSignalSemaphores()
     void RetireTimeline(uint64_t payload);
@@ -252,6 +253,8 @@ class SEMAPHORE_STATE : public REFCOUNTED_NODE {
     // Timeline operations can be added in any order and multiple operations
     // can use the same payload value.
     std::multimap<uint64_t, SemOpEntry> operations_;
+    // Queues whose retire task stopped on an operation of another queue, resumed once operations are retired
+    std::vector<QUEUE_STATE *> blocked_queues_;
     mutable ReadWriteLock lock_;
     ValidationStateTracker &dev_data_;
 };
@@ -270,6 +273,8 @@ struct CB_SUBMISSION {
     std::shared_ptr<FENCE_STATE> fence;
     uint64_t seq{0};
     uint32_t perf_submit_pass{0};
+    // Set by the retire task once the command buffers are retired, in case it stops on a signal semaphore
+    bool retired_cbs{false};
     std::promise<void> completed;
     std::shared_future<void> waiter;
 
@@ -313,6 +318,9 @@ class QUEUE_STATE : public BASE_NODE {
     // UINT64_MAX means to finish all submissions.
     void NotifyAndWait(uint64_t until_seq = UINT64_MAX);
 
+    // Restarts a retire task that stopped on a semaphore operation of another queue, once that operation has been retired
+    void Resume();
+
     const uint32_t queueFamilyIndex;
     const VkDeviceQueueCreateFlags flags;
     const VkQueueFamilyProperties queueFamilyProperties;
@@ -320,20 +328,26 @@ class QUEUE_STATE : public BASE_NODE {
     std::shared_future<void> Wait(uint64_t until_seq = UINT64_MAX);
   private:
     using LockGuard = std::unique_lock<std::mutex>;
-    void ThreadFunc();
+    // Retires the submissions up to request_seq_, as a ThreadPool task
+    void RetireSubmissions();
     CB_SUBMISSION *NextSubmission();
+    bool QueueRetireTask();
+    bool Suspend();
     LockGuard Lock() const { return LockGuard(lock_); }
 
     ValidationStateTracker &dev_data_;
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
     std::deque<CB_SUBMISSION> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
-    bool exit_thread_{false};
+    // At most one retire task is queued or running per queue, so that submissions are retired in order
+    bool retire_task_queued_{false};
+    // Set by Resume(), so that a retire task about to stop on a semaphore tries again
+    bool resume_requested_{false};
+    bool exiting_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
+    // condition to wake up Destroy() when the retire task is done
     std::condition_variable cond_;
 };
@@ -251,10 +251,101 @@ RENDER_PASS_STATE::RENDER_PASS_STATE(VkRenderPass rp, VkRenderPassCreateInfo2 co
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      createInfo(pCreateInfo) {
+      frozen_create_info(pCreateInfo) {
     InitRenderPassState(this);
 }
 
+static RenderPassCompatDict render_pass_compat_dict;
+
+static bool IsAttachmentUsed(const safe_VkRenderPassCreateInfo2 &create_info, uint32_t attachment) {
+    return attachment < create_info.attachmentCount;
+}
+
+// Out of range references compare as VK_ATTACHMENT_UNUSED, used ones by format, samples and flags
+static void AddAttachmentCompatDef(const safe_VkRenderPassCreateInfo2 &create_info, uint32_t attachment, RenderPassCompatDef &def) {
+    if (!IsAttachmentUsed(create_info, attachment)) {
+        def.push_back(0);
+        return;
+    }
+    const auto &desc = create_info.pAttachments[attachment];
+    def.push_back(1);
+    def.push_back(desc.format);
+    def.push_back(desc.samples);
+    def.push_back(desc.flags);
+}
+
+RenderPassCompatId RENDER_PASS_STATE::GetCompatibilityId(const safe_VkRenderPassCreateInfo2 &create_info) {
+    RenderPassCompatDef def;
+    def.push_back(create_info.flags);
+    def.push_back(create_info.subpassCount);
+    for (uint32_t subpass = 0; subpass < create_info.subpassCount; ++subpass) {
+        const auto &desc = create_info.pSubpasses[subpass];
+
+        // Attachment lists of different lengths are compatible if the extra entries are unused
+        uint32_t input_count = desc.inputAttachmentCount;
+        while (input_count > 0 && !IsAttachmentUsed(create_info, desc.pInputAttachments[input_count - 1].attachment)) {
+            --input_count;
+        }
+        def.push_back(input_count);
+        for (uint32_t i = 0; i < input_count; ++i) {
+            AddAttachmentCompatDef(create_info, desc.pInputAttachments[i].attachment, def);
+        }
+
+        // Resolve attachments only take part in compatibility for render passes with more than one subpass
+        const bool resolves = (create_info.subpassCount > 1) && desc.pResolveAttachments;
+        uint32_t color_count = desc.colorAttachmentCount;
+        while (color_count > 0 && !IsAttachmentUsed(create_info, desc.pColorAttachments[color_count - 1].attachment) &&
+               !(resolves && IsAttachmentUsed(create_info, desc.pResolveAttachments[color_count - 1].attachment))) {
+            --color_count;
+        }
+        def.push_back(color_count);
+        for (uint32_t i = 0; i < color_count; ++i) {
+            AddAttachmentCompatDef(create_info, desc.pColorAttachments[i].attachment, def);
+            if (create_info.subpassCount > 1) {
+                AddAttachmentCompatDef(create_info, resolves ? desc.pResolveAttachments[i].attachment : VK_ATTACHMENT_UNUSED,
+                                       def);
+            }
+        }
+
+        AddAttachmentCompatDef(
+            create_info, desc.pDepthStencilAttachment ? desc.pDepthStencilAttachment->attachment : VK_ATTACHMENT_UNUSED, def);
+        def.push_back(desc.viewMask);
+
+        const auto fsr = LvlFindInChain<VkFragmentShadingRateAttachmentInfoKHR>(desc.pNext);
+        def.push_back(fsr ? 1 : 0);
+        if (fsr) {
+            def.push_back(fsr->shadingRateAttachmentTexelSize.width);
+            def.push_back(fsr->shadingRateAttachmentTexelSize.height);
+        }
+    }
+
+    def.push_back(create_info.dependencyCount);
+    for (uint32_t i = 0; i < create_info.dependencyCount; ++i) {
+        const auto &dep = create_info.pDependencies[i];
+        def.push_back(dep.srcSubpass);
+        def.push_back(dep.dstSubpass);
+        def.push_back(dep.srcStageMask);
+        def.push_back(dep.dstStageMask);
+        def.push_back(dep.srcAccessMask);
+        def.push_back(dep.dstAccessMask);
+        def.push_back(dep.dependencyFlags);
+        def.push_back(static_cast<uint32_t>(dep.viewOffset));
+    }
+
+    def.push_back(create_info.correlatedViewMaskCount);
+    for (uint32_t i = 0; i < create_info.correlatedViewMaskCount; ++i) {
+        def.push_back(create_info.pCorrelatedViewMasks[i]);
+    }
+
+    const auto fdm = LvlFindInChain<VkRenderPassFragmentDensityMapCreateInfoEXT>(create_info.pNext);
+    def.push_back(fdm ? 1 : 0);
+    if (fdm) {
+        AddAttachmentCompatDef(create_info, fdm->fragmentDensityMapAttachment.attachment, def);
+    }
+
+    return render_pass_compat_dict.look_up(std::move(def));
+}
+
 static safe_VkRenderPassCreateInfo2 ConvertCreateInfo(const VkRenderPassCreateInfo &create_info) {
     safe_VkRenderPassCreateInfo2 create_info_2;
     ConvertVkRenderPassCreateInfoToV2KHR(create_info, &create_info_2);
@@ -266,7 +357,7 @@ RENDER_PASS_STATE::RENDER_PASS_STATE(VkRenderPass rp, VkRenderPassCreateInfo con
       use_dynamic_rendering(false),
       use_dynamic_rendering_inherited(false),
       has_multiview_enabled(false),
-      createInfo(ConvertCreateInfo(*pCreateInfo)) {
+      frozen_create_info(ConvertCreateInfo(*pCreateInfo)) {
     InitRenderPassState(this);
 }
 
@@ -27,6 +27,7 @@
  */
 #pragma once
 #include "base_node.h"
+#include "hash_util.h"
 
 class IMAGE_VIEW_STATE;
 
@@ -78,6 +79,13 @@ struct SubpassLayout {
     VkImageLayout layout;
 };
 
+// Canonical dictionary of render pass compatibility definitions: everything render pass compatibility compares (flags,
+// the format, samples and flags of each attachment reference, view masks, dependencies...) flattened into a sequence,
+// with trailing unused attachment references dropped. Render passes with the same id are compatible.
+using RenderPassCompatDef = std::vector<uint32_t>;
+using RenderPassCompatDict = hash_util::Dictionary<RenderPassCompatDef, hash_util::IsOrderedContainer<RenderPassCompatDef>>;
+using RenderPassCompatId = RenderPassCompatDict::Id;
+
 class RENDER_PASS_STATE : public BASE_NODE {
   public:
     struct AttachmentTransition {
@@ -94,7 +102,12 @@ class RENDER_PASS_STATE : public BASE_NODE {
     const safe_VkRenderingInfo dynamic_rendering_begin_rendering_info;
     const safe_VkPipelineRenderingCreateInfo dynamic_rendering_pipeline_create_info;
     const safe_VkCommandBufferInheritanceRenderingInfo inheritance_rendering_info;
-    const safe_VkRenderPassCreateInfo2 createInfo;
+
+  private:
+    const FrozenSafeStruct<safe_VkRenderPassCreateInfo2> frozen_create_info;
+
+  public:
+    const safe_VkRenderPassCreateInfo2 &createInfo = frozen_create_info.get();
     using SubpassVec = std::vector<uint32_t>;
     using SelfDepVec = std::vector<SubpassVec>;
     const std::vector<SubpassVec> self_dependencies;
@@ -110,6 +123,7 @@ class RENDER_PASS_STATE : public BASE_NODE {
     const SubpassGraphVec subpass_dependencies;
     using TransitionVec = std::vector<std::vector<AttachmentTransition>>;
     const TransitionVec subpass_transitions;
+    const RenderPassCompatId compatibility_id = GetCompatibilityId(createInfo);
 
     RENDER_PASS_STATE(VkRenderPass rp, VkRenderPassCreateInfo2 const *pCreateInfo);
     RENDER_PASS_STATE(VkRenderPass rp, VkRenderPassCreateInfo const *pCreateInfo);
@@ -127,6 +141,9 @@ class RENDER_PASS_STATE : public BASE_NODE {
     uint32_t GetDynamicRenderingColorAttachmentCount() const;
     uint32_t GetDynamicRenderingViewMask() const;
     uint32_t GetViewMaskBits(uint32_t subpass) const;
+
+  private:
+    static RenderPassCompatId GetCompatibilityId(const safe_VkRenderPassCreateInfo2 &create_info);
 };
 
 class FRAMEBUFFER_STATE : public BASE_NODE {
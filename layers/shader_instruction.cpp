@@ -19,13 +19,7 @@
 #include "shader_module.h"
 #include "spirv_grammar_helper.h"
 
-Instruction::Instruction(std::vector<uint32_t>::const_iterator it) : result_id_(0), type_id_(0) {
-    words_.emplace_back(*it++);
-    words_.reserve(Length());
-    for (uint32_t i = 1; i < Length(); i++) {
-        words_.emplace_back(*it++);
-    }
-
+Instruction::Instruction(const uint32_t* words) : words_(words), result_id_(0), type_id_(0) {
     const bool has_result = OpcodeHasResult(Opcode());
     if (OpcodeHasType(Opcode())) {
         type_id_ = 1;
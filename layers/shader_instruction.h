@@ -22,6 +22,7 @@
 #include <stddef.h>  // size_t for gcc
 #include <stdint.h>
 #include <vector>
+#include <algorithm>
 #include <assert.h>
 #include "vk_layer_data.h"
 #include <spirv/unified1/spirv.hpp>
@@ -37,15 +38,21 @@ struct AtomicInstructionInfo {
 // Holds information about a single SPIR-V instruction
 // Provides easy access to len, opcode, and content words without the caller needing to care too much about the physical SPIRV module layout.
 //
+// An Instruction is a view of the words in the SPIR-V module it was parsed from, so it must not outlive that module's word buffer
+// (for SHADER_MODULE_STATE, the words_ member).
+//
 // For more information of the physical module layout to help understand this struct:
 // https://github.com/KhronosGroup/SPIRV-Guide/blob/master/chapters/parsing_instructions.md
 class Instruction {
     public:
-    Instruction(std::vector<uint32_t>::const_iterator it);
+    Instruction(const uint32_t* words);
     ~Instruction() = default;
 
     // The word used to define the Instruction
-    uint32_t Word(uint32_t index) const { return words_[index]; }
+    uint32_t Word(uint32_t index) const {
+        assert(index < Length());
+        return words_[index];
+    }
 
     uint32_t Length() const { return words_[0] >> 16; }
 
@@ -67,21 +74,17 @@ class Instruction {
     AtomicInstructionInfo GetAtomicInfo(const SHADER_MODULE_STATE& module_state) const;
     spv::BuiltIn GetBuiltIn() const;
 
-    bool operator==(Instruction const& other) const { return words_ == other.words_; }
-    bool operator!=(Instruction const& other) const { return words_ != other.words_; }
+    bool operator==(Instruction const& other) const {
+        return (words_ == other.words_) || ((Length() == other.Length()) && std::equal(words_, words_ + Length(), other.words_));
+    }
+    bool operator!=(Instruction const& other) const { return !(*this == other); }
 
   private:
-    // When this class was created, for SPIR-V Instructions that could be used in Vulkan,
-    //   414 of 423 had 6 or less operands
-    //   361 of 423 had 5 or less operands
-    //   287 of 423 had 4 or less operands
-    // An extra word is still needed because each insturction has one word prior to the operands
-    static constexpr uint32_t word_vector_length = 7;
-
-    // Max capacity needs to be uint32_t because an instruction can have a string operand that is (2^16)-1 bytes long
-    small_vector<uint32_t, word_vector_length, uint32_t> words_;
-    uint32_t result_id_;
-    uint32_t type_id_;
+    // First word of the instruction in the module's word buffer
+    const uint32_t* words_;
+    // Operand indices are at most 2, so these pack with the pointer
+    uint8_t result_id_;
+    uint8_t type_id_;
 };
 
 #endif  // VULKAN_SHADER_INSTRUCTION_H
\ No newline at end of file
@@ -166,11 +166,11 @@ static uint32_t ExecutionModelToShaderStageFlagBits(uint32_t mode) {
 //
 // TODO: The set of interesting opcodes here was determined by eyeballing the SPIRV spec. It might be worth
 // converting parts of this to be generated from the machine-readable spec instead.
-layer_data::unordered_set<uint32_t> SHADER_MODULE_STATE::MarkAccessibleIds(layer_data::optional<Instruction> entrypoint) const {
-    layer_data::unordered_set<uint32_t> ids;
+std::vector<uint32_t> SHADER_MODULE_STATE::MarkAccessibleIds(layer_data::optional<Instruction> entrypoint) const {
     if (!entrypoint || !has_valid_spirv) {
-        return ids;
+        return {};
     }
+    layer_data::unordered_set<uint32_t> ids;
     layer_data::unordered_set<uint32_t> worklist;
     worklist.insert((*entrypoint).Word(2));
 
@@ -272,7 +272,9 @@ layer_data::unordered_set<uint32_t> SHADER_MODULE_STATE::MarkAccessibleIds(layer
         }
     }
 
-    return ids;
+    std::vector<uint32_t> sorted_ids(ids.begin(), ids.end());
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    return sorted_ids;
 }
 
 layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const Instruction& entrypoint) const {
@@ -326,24 +328,32 @@ layer_data::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology() con
 }
 
 SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_state) {
+    // The id bound is the fourth header word, and every id is less than it
+    uint32_t id_bound = 0;
+    // Ids up to the module size are indexed directly, the header's bound is not trusted to size the table
+    size_t dense_id_bound = 0;
     // Parse the words first so we have instruction class objects to use
-    {
-        std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
+    if (module_state.words_.size() > 5) {
+        const uint32_t *it = module_state.words_.data();
+        const uint32_t *const words_end = it + module_state.words_.size();
+        id_bound = it[3];
+        dense_id_bound = std::min<size_t>(id_bound, module_state.words_.size());
+        definitions.reserve(dense_id_bound);
         it += 5;  // skip first 5 word of header
-        while (it != module_state.words_.cend()) {
+        while (it < words_end) {
             Instruction insn(it);
             const uint32_t opcode = insn.Opcode();
 
-            // Check for opcodes that would require reparsing of the words
             if (opcode == spv::OpGroupDecorate || opcode == spv::OpDecorationGroup || opcode == spv::OpGroupMemberDecorate) {
-                assert(has_group_decoration == false);  // if assert, spirv-opt didn't flatten it
                 has_group_decoration = true;
-                break;  // no need to continue parsing
             }
 
             instructions.push_back(insn);
             it += insn.Length();
         }
+        if (has_group_decoration) {
+            FlattenGroupDecorations();
+        }
         instructions.shrink_to_fit();
     }
 
@@ -356,7 +366,17 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
     for (const Instruction& insn : instructions) {
         // Build definition list
         if (insn.ResultId() != 0) {
-            definitions[insn.Word(insn.ResultId())] = &insn;
+            const uint32_t result_id = insn.Word(insn.ResultId());
+            // Ids out of the bound make the module invalid, which spirv-val reports. They are not indexed, so that a malformed
+            // id cannot make the table arbitrarily large.
+            if (result_id < dense_id_bound) {
+                if (result_id >= definitions.size()) {
+                    definitions.resize(result_id + 1, nullptr);
+                }
+                definitions[result_id] = &insn;
+            } else if (result_id < id_bound) {
+                sparse_definitions[result_id] = &insn;
+            }
         }
 
         if (first_function_found) {
@@ -458,26 +478,118 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
     multiple_entry_points = entry_points.size() > 1;
 }
 
-void SHADER_MODULE_STATE::PreprocessShaderBinary(const spv_target_env env) {
-    if (static_data_.has_group_decoration) {
-        spvtools::Optimizer optimizer(env);
-        optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
-        std::vector<uint32_t> optimized_binary;
-        // Run optimizer to flatten decorations only, set skip_validation so as to not re-run validator
-        auto result = optimizer.Run(words_.data(), words_.size(), &optimized_binary, spvtools::ValidatorOptions(), true);
-
-        if (result) {
-            // NOTE: We need to update words with the result from the spirv-tools optimizer.
-            // **THIS ONLY HAPPENS ON INITIALIZATION**. words should remain const for the lifetime
-            // of the SHADER_MODULE_STATE instance.
-            *const_cast<std::vector<uint32_t>*>(&words_) = std::move(optimized_binary);
-            // Will need to update static data now the words have changed or else the def_index will not align
-            // It is really rare this will get here as Group Decorations have been deprecated and before this was added no one ever
-            // raised an issue for a bug that would crash the layers that was around for many releases
-            StaticData new_static_data(*this);
-            *const_cast<StaticData*>(&static_data_) = std::move(new_static_data);
+// Group decorations are deprecated, but older offline compiled content still uses them. Instead of running the spirv-opt
+// flatten decoration pass and parsing the module a second time, each OpGroupDecorate/OpGroupMemberDecorate is expanded in
+// place into the OpDecorate/OpMemberDecorate instructions it stands for. The generated words live in
+// flattened_decoration_words, and the OpDecorationGroup instructions along with the decorations targeting them are dropped,
+// which leaves the same instruction list the flatten pass would have produced.
+void SHADER_MODULE_STATE::StaticData::FlattenGroupDecorations() {
+    // <OpDecorationGroup id> : [decorations applied to the group]
+    layer_data::unordered_map<uint32_t, std::vector<const Instruction *>> group_decorations;
+    for (const Instruction &insn : instructions) {
+        if (insn.Opcode() == spv::OpDecorationGroup) {
+            group_decorations[insn.Word(1)];
+        }
+    }
+    for (const Instruction &insn : instructions) {
+        const uint32_t opcode = insn.Opcode();
+        if (opcode == spv::OpDecorate || opcode == spv::OpDecorateId || opcode == spv::OpDecorateString) {
+            auto group = group_decorations.find(insn.Word(1));
+            if (group != group_decorations.end()) {
+                group->second.push_back(&insn);
+            }
+        }
+    }
+    const auto find_group = [&group_decorations](uint32_t group_id) -> const std::vector<const Instruction *> * {
+        auto group = group_decorations.find(group_id);
+        return (group != group_decorations.end()) ? &group->second : nullptr;
+    };
+
+    // Size the storage up front so the new instructions can view into it while it is being filled
+    size_t flattened_size = 0;
+    for (const Instruction &insn : instructions) {
+        if (insn.Opcode() == spv::OpGroupDecorate) {
+            const auto *decorations = find_group(insn.Word(1));
+            if (decorations) {
+                for (const Instruction *decoration : *decorations) {
+                    flattened_size += (insn.Length() - 2) * decoration->Length();
+                }
+            }
+        } else if (insn.Opcode() == spv::OpGroupMemberDecorate) {
+            const auto *decorations = find_group(insn.Word(1));
+            if (decorations) {
+                for (const Instruction *decoration : *decorations) {
+                    // There is no member form of OpDecorateId
+                    if (decoration->Opcode() != spv::OpDecorateId) {
+                        flattened_size += ((insn.Length() - 2) / 2) * (decoration->Length() + 1);
+                    }
+                }
+            }
+        }
+    }
+    flattened_decoration_words.reserve(flattened_size);
+
+    std::vector<Instruction> flattened_instructions;
+    flattened_instructions.reserve(instructions.size());
+    for (const Instruction &insn : instructions) {
+        switch (insn.Opcode()) {
+            case spv::OpDecorationGroup:
+                break;
+
+            case spv::OpDecorate:
+            case spv::OpDecorateId:
+            case spv::OpDecorateString:
+                if (!find_group(insn.Word(1))) {
+                    flattened_instructions.push_back(insn);
+                }
+                break;
+
+            // OpGroupDecorate <group> <target>...
+            case spv::OpGroupDecorate: {
+                const auto *decorations = find_group(insn.Word(1));
+                if (!decorations) break;
+                for (uint32_t i = 2; i < insn.Length(); ++i) {
+                    for (const Instruction *decoration : *decorations) {
+                        const size_t offset = flattened_decoration_words.size();
+                        flattened_decoration_words.push_back(decoration->Word(0));
+                        flattened_decoration_words.push_back(insn.Word(i));
+                        for (uint32_t j = 2; j < decoration->Length(); ++j) {
+                            flattened_decoration_words.push_back(decoration->Word(j));
+                        }
+                        flattened_instructions.emplace_back(flattened_decoration_words.data() + offset);
+                    }
+                }
+            } break;
+
+            // OpGroupMemberDecorate <group> (<struct type> <member>)...
+            case spv::OpGroupMemberDecorate: {
+                const auto *decorations = find_group(insn.Word(1));
+                if (!decorations) break;
+                for (uint32_t i = 2; i + 1 < insn.Length(); i += 2) {
+                    for (const Instruction *decoration : *decorations) {
+                        if (decoration->Opcode() == spv::OpDecorateId) continue;
+                        const uint32_t opcode =
+                            (decoration->Opcode() == spv::OpDecorateString) ? spv::OpMemberDecorateString : spv::OpMemberDecorate;
+                        const size_t offset = flattened_decoration_words.size();
+                        flattened_decoration_words.push_back(((decoration->Length() + 1) << 16) | opcode);
+                        flattened_decoration_words.push_back(insn.Word(i));
+                        flattened_decoration_words.push_back(insn.Word(i + 1));
+                        for (uint32_t j = 2; j < decoration->Length(); ++j) {
+                            flattened_decoration_words.push_back(decoration->Word(j));
+                        }
+                        flattened_instructions.emplace_back(flattened_decoration_words.data() + offset);
+                    }
+                }
+            } break;
+
+            default:
+                flattened_instructions.push_back(insn);
+                break;
         }
     }
+    assert(flattened_decoration_words.size() == flattened_size);  // a reallocation would invalidate the views
+
+    instructions = std::move(flattened_instructions);
 }
 
 void SHADER_MODULE_STATE::DescribeTypeInner(std::ostringstream &ss, uint32_t type) const {
@@ -1511,7 +1623,7 @@ void SHADER_MODULE_STATE::IsSpecificDescriptorType(const Instruction* insn, bool
 }
 
 std::vector<std::pair<DescriptorSlot, interface_var>> SHADER_MODULE_STATE::CollectInterfaceByDescriptorSlot(
-    layer_data::unordered_set<uint32_t> const &accessible_ids) const {
+    std::vector<uint32_t> const &accessible_ids) const {
     std::vector<std::pair<DescriptorSlot, interface_var>> out;
 
     for (auto id : accessible_ids) {
@@ -1541,7 +1653,7 @@ std::vector<std::pair<DescriptorSlot, interface_var>> SHADER_MODULE_STATE::Colle
 
 layer_data::unordered_set<uint32_t> SHADER_MODULE_STATE::CollectWritableOutputLocationinFS(const Instruction& entrypoint) const {
     layer_data::unordered_set<uint32_t> location_list;
-    const auto outputs = CollectInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
+    const auto &outputs = GetInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
     layer_data::unordered_set<uint32_t> store_pointer_ids;
     layer_data::unordered_map<uint32_t, uint32_t> accesschain_members;
 
@@ -1749,7 +1861,7 @@ std::vector<uint32_t> SHADER_MODULE_STATE::CollectBuiltinBlockMembers(const Inst
 }
 
 std::vector<std::pair<uint32_t, interface_var>> SHADER_MODULE_STATE::CollectInterfaceByInputAttachmentIndex(
-    layer_data::unordered_set<uint32_t> const &accessible_ids) const {
+    std::vector<uint32_t> const &accessible_ids) const {
     std::vector<std::pair<uint32_t, interface_var>> out;
 
     for (const Instruction* insn : GetDecorationInstructions()) {
@@ -1757,7 +1869,7 @@ std::vector<std::pair<uint32_t, interface_var>> SHADER_MODULE_STATE::CollectInte
             auto attachment_index = insn->Word(3);
             auto id = insn->Word(1);
 
-            if (accessible_ids.count(id)) {
+            if (std::binary_search(accessible_ids.begin(), accessible_ids.end(), id)) {
                 const Instruction* def = FindDef(id);
                 if (def->Opcode() == spv::OpVariable && def->Word(3) == spv::StorageClassUniformConstant) {
                     auto num_locations = GetLocationsConsumedByType(def->Word(1), false);
@@ -1776,6 +1888,56 @@ std::vector<std::pair<uint32_t, interface_var>> SHADER_MODULE_STATE::CollectInte
     return out;
 }
 
+SHADER_MODULE_STATE::EntryPointCache& SHADER_MODULE_STATE::GetEntryPointCache(const Instruction& entrypoint) const {
+    std::lock_guard<std::mutex> guard(entry_point_cache_lock_);
+    for (const auto& cache : entry_point_cache_) {
+        if (cache->entrypoint == entrypoint) return *cache;
+    }
+    entry_point_cache_.emplace_back(layer_data::make_unique<EntryPointCache>(entrypoint));
+    return *entry_point_cache_.back();
+}
+
+const std::vector<uint32_t>& SHADER_MODULE_STATE::GetAccessibleIds(const layer_data::optional<Instruction>& entrypoint) const {
+    static const std::vector<uint32_t> no_ids;
+    if (!entrypoint) return no_ids;
+    auto& cache = GetEntryPointCache(*entrypoint);
+    std::call_once(cache.accessible_ids_once, [this, &cache]() {
+        cache.accessible_ids = MarkAccessibleIds(cache.entrypoint);
+        cache.descriptor_uses = CollectInterfaceByDescriptorSlot(cache.accessible_ids);
+    });
+    return cache.accessible_ids;
+}
+
+const std::vector<std::pair<DescriptorSlot, interface_var>>& SHADER_MODULE_STATE::GetDescriptorUses(
+    const layer_data::optional<Instruction>& entrypoint) const {
+    static const std::vector<std::pair<DescriptorSlot, interface_var>> no_uses;
+    if (!entrypoint) return no_uses;
+    // Descriptor uses are collected along with the accessible ids they are derived from
+    GetAccessibleIds(entrypoint);
+    return GetEntryPointCache(*entrypoint).descriptor_uses;
+}
+
+const std::map<location_t, interface_var>& SHADER_MODULE_STATE::GetInterfaceByLocation(const Instruction& entrypoint,
+                                                                                      spv::StorageClass sinterface,
+                                                                                      bool is_array_of_verts) const {
+    assert(sinterface == spv::StorageClassInput || sinterface == spv::StorageClassOutput);
+    auto& cache = GetEntryPointCache(entrypoint);
+    const uint32_t is_output = (sinterface == spv::StorageClassOutput) ? 1 : 0;
+    const uint32_t is_arrayed = is_array_of_verts ? 1 : 0;
+    std::call_once(cache.interface_by_location_once[is_output][is_arrayed], [&]() {
+        cache.interface_by_location[is_output][is_arrayed] =
+            CollectInterfaceByLocation(cache.entrypoint, sinterface, is_array_of_verts);
+    });
+    return cache.interface_by_location[is_output][is_arrayed];
+}
+
+const layer_data::unordered_set<uint32_t>& SHADER_MODULE_STATE::GetWritableOutputLocationsInFS(const Instruction& entrypoint) const {
+    auto& cache = GetEntryPointCache(entrypoint);
+    std::call_once(cache.writable_output_locations_once,
+                   [this, &cache]() { cache.writable_output_locations = CollectWritableOutputLocationinFS(cache.entrypoint); });
+    return cache.writable_output_locations;
+}
+
 uint32_t SHADER_MODULE_STATE::GetNumComponentsInBaseType(const Instruction* insn) const {
     const uint32_t opcode = insn->Opcode();
     if (opcode == spv::OpTypeFloat || opcode == spv::OpTypeInt) {
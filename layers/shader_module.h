@@ -22,6 +22,8 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -220,12 +222,14 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
-        // List of all instructions in the order they appear in the binary
+        // List of all instructions in the order they appear in the binary, as views into the module's words_
         std::vector<Instruction> instructions;
-        // Instructions that can be referenced by Ids
-        // A mapping of <id> to the first word of its def. this is useful because walking type
-        // trees, constant expressions, etc requires jumping all over the instruction stream.
-        layer_data::unordered_map<uint32_t, const Instruction *> definitions;
+        // Instructions that can be referenced by Ids, indexed by <id> (nullptr if the id has no definition).
+        // This is useful because walking type trees, constant expressions, etc requires jumping all over the instruction stream.
+        // Ids are dense, bounded by the module header's id bound, so a vector is both smaller and faster than a map. The vector
+        // is also bounded by the module size, as the header is not trusted; the rare ids above that are kept in sparse_definitions.
+        std::vector<const Instruction *> definitions;
+        layer_data::unordered_map<uint32_t, const Instruction *> sparse_definitions;
 
         layer_data::unordered_map<uint32_t, decoration_set> decorations;
         // <Specialization constant ID -> target ID> mapping
@@ -251,6 +255,11 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         bool multiple_entry_points{false};
 
         bool has_group_decoration{false};
+        // Storage for the decorations expanded from OpGroupDecorate/OpGroupMemberDecorate, viewed by instructions
+        std::vector<uint32_t> flattened_decoration_words;
+
+      private:
+        void FlattenGroupDecorations();
     };
 
     // This is the SPIR-V module data content
@@ -261,33 +270,29 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     const bool has_valid_spirv{false};
     const uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
 
-    SHADER_MODULE_STATE(const uint32_t *code, std::size_t count, spv_target_env env = SPV_ENV_VULKAN_1_0)
+    SHADER_MODULE_STATE(const uint32_t *code, std::size_t count)
         : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
           words_(code, code + (count / sizeof(uint32_t))),
-          static_data_(*this) {
-        PreprocessShaderBinary(env);
-    }
+          static_data_(*this) {}
 
     template <typename SpirvContainer>
     SHADER_MODULE_STATE(const SpirvContainer &spirv)
         : SHADER_MODULE_STATE(spirv.data(), spirv.size() * sizeof(typename SpirvContainer::value_type)) {}
 
-    SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, spv_target_env env,
-                        uint32_t unique_shader_id)
+    SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
           words_(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
           static_data_(*this),
           has_valid_spirv(true),
-          gpu_validation_shader_id(unique_shader_id) {
-        PreprocessShaderBinary(env);
-    }
+          gpu_validation_shader_id(unique_shader_id) {}
 
     SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
+        if (id < static_data_.definitions.size()) return static_data_.definitions[id];
+        if (static_data_.sparse_definitions.empty()) return nullptr;
+        auto it = static_data_.sparse_definitions.find(id);
+        return (it == static_data_.sparse_definitions.end()) ? nullptr : it->second;
     }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
@@ -320,7 +325,9 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         return decoration_set();
     }
 
-    // Expose begin() / end() to enable range-based for
+    // Expose begin() / end() to enable range-based for over the module as the application created it. Unlike GetInstructions(),
+    // group decorations are not flattened, so the instruction offsets and indices match the ones GPU-AV and debug printf
+    // instrument and report.
     spirv_inst_iter begin() const { return spirv_inst_iter(words_.begin(), words_.begin() + 5); }  // First insn
     spirv_inst_iter end() const { return spirv_inst_iter(words_.begin(), words_.end()); }          // Just past last insn
 
@@ -329,7 +336,8 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     std::string DescribeType(uint32_t type) const;
     std::string DescribeInstruction(const Instruction *insn) const;
 
-    layer_data::unordered_set<uint32_t> MarkAccessibleIds(layer_data::optional<Instruction> entrypoint) const;
+    // Returns the ids reachable from the entrypoint, sorted
+    std::vector<uint32_t> MarkAccessibleIds(layer_data::optional<Instruction> entrypoint) const;
     layer_data::optional<VkPrimitiveTopology> GetTopology(const Instruction &entrypoint) const;
     // TODO (https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/2450)
     // Since we currently don't support multiple entry points, this is a helper to return the topology
@@ -357,7 +365,7 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     void IsSpecificDescriptorType(const Instruction *insn, bool is_storage_buffer, bool is_check_writable,
                                   interface_var &out_interface_var) const;
     std::vector<std::pair<DescriptorSlot, interface_var>> CollectInterfaceByDescriptorSlot(
-        layer_data::unordered_set<uint32_t> const &accessible_ids) const;
+        std::vector<uint32_t> const &accessible_ids) const;
     layer_data::unordered_set<uint32_t> CollectWritableOutputLocationinFS(const Instruction &entrypoint) const;
     bool CollectInterfaceBlockMembers(std::map<location_t, interface_var> *out, bool is_array_of_verts, uint32_t id,
                                       uint32_t type_id, bool is_patch, uint32_t first_location) const;
@@ -365,7 +373,16 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                                                                    bool is_array_of_verts) const;
     std::vector<uint32_t> CollectBuiltinBlockMembers(const Instruction &entrypoint, uint32_t storageClass) const;
     std::vector<std::pair<uint32_t, interface_var>> CollectInterfaceByInputAttachmentIndex(
-        layer_data::unordered_set<uint32_t> const &accessible_ids) const;
+        std::vector<uint32_t> const &accessible_ids) const;
+
+    // Memoized versions of the entrypoint analyses above. Each result is computed once per entrypoint, on first use, and the
+    // returned reference is valid for the lifetime of the module. Safe to call concurrently.
+    const std::vector<uint32_t> &GetAccessibleIds(const layer_data::optional<Instruction> &entrypoint) const;
+    const std::vector<std::pair<DescriptorSlot, interface_var>> &GetDescriptorUses(
+        const layer_data::optional<Instruction> &entrypoint) const;
+    const std::map<location_t, interface_var> &GetInterfaceByLocation(const Instruction &entrypoint, spv::StorageClass sinterface,
+                                                                      bool is_array_of_verts) const;
+    const layer_data::unordered_set<uint32_t> &GetWritableOutputLocationsInFS(const Instruction &entrypoint) const;
 
     uint32_t GetNumComponentsInBaseType(const Instruction *insn) const;
     uint32_t GetTypeBitsSize(const Instruction *insn) const;
@@ -388,9 +405,27 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
                                             std::unordered_multimap<std::string, SHADER_MODULE_STATE::EntryPoint> &entry_points);
 
   private:
-    // Functions used for initialization only
-    // Used to populate the shader module object
-    void PreprocessShaderBinary(spv_target_env env);
+    // Lazily computed analysis results for one entrypoint, shared by all pipelines using it
+    struct EntryPointCache {
+        explicit EntryPointCache(const Instruction &insn) : entrypoint(insn) {}
+        const Instruction entrypoint;
+
+        std::once_flag accessible_ids_once;
+        std::vector<uint32_t> accessible_ids;
+        std::vector<std::pair<DescriptorSlot, interface_var>> descriptor_uses;
+
+        // Indexed by [sinterface == StorageClassOutput][is_array_of_verts]
+        std::once_flag interface_by_location_once[2][2];
+        std::map<location_t, interface_var> interface_by_location[2][2];
+
+        std::once_flag writable_output_locations_once;
+        layer_data::unordered_set<uint32_t> writable_output_locations;
+    };
+    EntryPointCache &GetEntryPointCache(const Instruction &entrypoint) const;
+
+    // Entries are never removed, so references to them remain valid after the lock is released
+    mutable std::mutex entry_point_cache_lock_;
+    mutable std::vector<std::unique_ptr<EntryPointCache>> entry_point_cache_;
 
     // The following are all helper functions to set the push constants values by tracking if the values are accessed in the entry
     // point functions and which offset in the structs are used
@@ -36,6 +36,7 @@
 #include "vk_layer_utils.h"
 #include "chassis.h"
 #include "core_validation.h"
+#include "layer_profiler.h"
 #include "spirv_grammar_helper.h"
 #include "xxhash.h"
 
@@ -151,7 +152,7 @@ bool CoreChecks::ValidateViAgainstVsInputs(safe_VkPipelineVertexInputStateCreate
                                            const SHADER_MODULE_STATE &module_state, const Instruction &entrypoint) const {
     bool skip = false;
 
-    const auto inputs = module_state.CollectInterfaceByLocation(entrypoint, spv::StorageClassInput, false);
+    const auto &inputs = module_state.GetInterfaceByLocation(entrypoint, spv::StorageClassInput, false);
 
     // Build index by location
     std::map<uint32_t, const VkVertexInputAttributeDescription *> attribs;
@@ -212,7 +213,7 @@ bool CoreChecks::ValidateFsOutputsAgainstDynamicRenderingRenderPass(const SHADER
     std::map<uint32_t, Attachment> location_map;
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
-    const auto outputs = module_state.CollectInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
+    const auto &outputs = module_state.GetInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
     for (const auto& output_it : outputs) {
         auto const location = output_it.first.first;
         location_map[location].output = &output_it.second;
@@ -284,7 +285,7 @@ bool CoreChecks::ValidateFsOutputsAgainstRenderPass(const SHADER_MODULE_STATE &m
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    const auto outputs = module_state.CollectInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
+    const auto &outputs = module_state.GetInterfaceByLocation(entrypoint, spv::StorageClassOutput, false);
     for (const auto &output_it : outputs) {
         auto const location = output_it.first.first;
         location_map[location].output = &output_it.second;
@@ -850,14 +851,14 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(const SHADER_MODULE_STATE
     uint32_t num_comp_in = 0, num_comp_out = 0;
     int max_comp_in = 0, max_comp_out = 0;
 
-    auto inputs = module_state.CollectInterfaceByLocation(entrypoint, spv::StorageClassInput, strip_input_array_level);
-    auto outputs = module_state.CollectInterfaceByLocation(entrypoint, spv::StorageClassOutput, strip_output_array_level);
+    const auto &inputs = module_state.GetInterfaceByLocation(entrypoint, spv::StorageClassInput, strip_input_array_level);
+    const auto &outputs = module_state.GetInterfaceByLocation(entrypoint, spv::StorageClassOutput, strip_output_array_level);
 
     // Find max component location used for input variables.
-    for (auto &var : inputs) {
+    for (const auto &var : inputs) {
         int location = var.first.first;
         int component = var.first.second;
-        interface_var &iv = var.second;
+        const interface_var &iv = var.second;
 
         // Only need to look at the first location, since we use the type's whole size
         if (iv.offset != 0) {
@@ -873,10 +874,10 @@ bool CoreChecks::ValidateShaderStageInputOutputLimits(const SHADER_MODULE_STATE
     }
 
     // Find max component location used for output variables.
-    for (auto &var : outputs) {
+    for (const auto &var : outputs) {
         int location = var.first.first;
         int component = var.first.second;
-        interface_var &iv = var.second;
+        const interface_var &iv = var.second;
 
         // Only need to look at the first location, since we use the type's whole size
         if (iv.offset != 0) {
@@ -2885,6 +2886,7 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
         auto const optimized =
             optimizer.Run(module_state.words_.data(), module_state.words_.size(), &specialized_spirv, options, true);
         if (optimized) {
+            VVL_PROFILE_SCOPE("spirv-val (specialized)");
             spv_context ctx = spvContextCreate(spirv_environment);
             spv_const_binary_t binary{specialized_spirv.data(), specialized_spirv.size()};
             spv_diagnostic diag = nullptr;
@@ -3138,12 +3140,14 @@ bool CoreChecks::ValidatePipelineShaderStage(const PIPELINE_STATE *pipeline, con
 bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &producer, const Instruction &producer_entrypoint,
                                                 shader_stage_attributes const *producer_stage, const SHADER_MODULE_STATE &consumer,
                                                 const Instruction &consumer_entrypoint,
-                                                shader_stage_attributes const *consumer_stage) const {
+                                                shader_stage_attributes const *consumer_stage, bool &mismatch) const {
+    // mismatch is set for every message, including those that the debug callbacks do not ask to skip the call
     bool skip = false;
 
-    auto outputs =
-        producer.CollectInterfaceByLocation(producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs = consumer.CollectInterfaceByLocation(consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    const auto &outputs =
+        producer.GetInterfaceByLocation(producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
+    const auto &inputs =
+        consumer.GetInterfaceByLocation(consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
 
     auto output_it = outputs.begin();
     auto input_it = inputs.begin();
@@ -3177,6 +3181,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                                         "Enable VK_KHR_maintenance4 device extension to allow relaxed interface matching between "
                                         "input and output vectors.";
                 // It is not an error if a stage does not consume all outputs from the previous stage
+                mismatch = true;
                 skip |= LogPerformanceWarning(producer.vk_shader_module(), kVUID_Core_Shader_OutputNotConsumed, "%s", msg.c_str());
             }
             if ((input_first.first > output_first.first) || input_at_end || (output_component + 1 == output_length)) {
@@ -3186,6 +3191,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                 output_component++;
             }
         } else if (output_at_end || output_first > input_first) {
+            mismatch = true;
             skip |= LogError(consumer.vk_shader_module(), kVUID_Core_Shader_InputNotProduced,
                              "%s consumes input location %" PRIu32 ".%" PRIu32 " which is not written by %s", consumer_stage->name,
                              input_first.first, input_first.second, producer_stage->name);
@@ -3201,6 +3207,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
             // - if is_block_member, then the extra array level of an arrayed interface is not
             //   expressed in the member type -- it's expressed in the block type.
             if (!TypesMatch(producer, consumer, output_it->second.type_id, input_it->second.type_id)) {
+                mismatch = true;
                 skip |= LogError(producer.vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Type mismatch on location %" PRIu32 ".%" PRIu32 ", between %s and %s: '%s' vs '%s'",
                                  output_first.first, output_first.second, producer_stage->name, consumer_stage->name,
@@ -3211,6 +3218,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                 continue;
             }
             if (output_it->second.is_patch != input_it->second.is_patch) {
+                mismatch = true;
                 skip |= LogError(producer.vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Decoration mismatch on location %" PRIu32 ".%" PRIu32
                                  ": is per-%s in %s stage but per-%s in %s stage",
@@ -3250,6 +3258,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
 
         if (!builtins_producer.empty() && !builtins_consumer.empty()) {
             if (builtins_producer.size() != builtins_consumer.size()) {
+                mismatch = true;
                 skip |= LogError(producer.vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                  "Number of elements inside builtin block differ between stages (%s %d vs %s %d).",
                                  producer_stage->name, static_cast<int>(builtins_producer.size()), consumer_stage->name,
@@ -3259,6 +3268,7 @@ bool CoreChecks::ValidateInterfaceBetweenStages(const SHADER_MODULE_STATE &produ
                 auto it_consumer = builtins_consumer.begin();
                 while (it_producer != builtins_producer.end() && it_consumer != builtins_consumer.end()) {
                     if (*it_producer != *it_consumer) {
+                        mismatch = true;
                         skip |= LogError(producer.vk_shader_module(), kVUID_Core_Shader_InterfaceTypeMismatch,
                                          "Builtin variable inside block doesn't match between %s and %s.", producer_stage->name,
                                          consumer_stage->name);
@@ -3330,22 +3340,37 @@ bool CoreChecks::ValidateGraphicsPipelineShaderState(const PIPELINE_STATE *pipel
         skip |= ValidateViAgainstVsInputs(vi_state, *vertex_stage->module_state.get(), *(vertex_stage->entrypoint));
     }
 
-    for (size_t i = 1; i < pipeline->stage_state.size(); i++) {
-        const auto &producer = pipeline->stage_state[i - 1];
-        const auto &consumer = pipeline->stage_state[i];
-        assert(producer.module_state);
-        if (&producer == fragment_stage) {
-            break;
-        }
-        if (consumer.module_state) {
-            if (consumer.module_state->has_valid_spirv && producer.module_state->has_valid_spirv && consumer.entrypoint &&
-                producer.entrypoint) {
-                auto producer_id = GetShaderStageId(producer.stage_flag);
-                auto consumer_id = GetShaderStageId(consumer.stage_flag);
-                skip |= ValidateInterfaceBetweenStages(*producer.module_state.get(), *(producer.entrypoint),
-                                                       &shader_stage_attribs[producer_id], *consumer.module_state.get(),
-                                                       *(consumer.entrypoint), &shader_stage_attribs[consumer_id]);
+    // When every stage comes from linked libraries, the interfaces between stages only depend on the pre-raster and fragment
+    // shader libraries, and a pair that was already found compatible does not need to be walked again.
+    const bool stages_from_libraries = pipeline->pre_raster_state && pipeline->fragment_shader_state &&
+                                       (&pipeline->pre_raster_state->parent != pipeline) &&
+                                       (&pipeline->fragment_shader_state->parent != pipeline) &&
+                                       (pipeline->GetShaderStages().size() == 0);
+    if (!stages_from_libraries ||
+        !linked_shader_interface_cache.Contains(pipeline->pre_raster_state, pipeline->fragment_shader_state)) {
+        bool interface_mismatch = false;
+        for (size_t i = 1; i < pipeline->stage_state.size(); i++) {
+            const auto &producer = pipeline->stage_state[i - 1];
+            const auto &consumer = pipeline->stage_state[i];
+            assert(producer.module_state);
+            if (&producer == fragment_stage) {
+                break;
             }
+            if (consumer.module_state) {
+                if (consumer.module_state->has_valid_spirv && producer.module_state->has_valid_spirv && consumer.entrypoint &&
+                    producer.entrypoint) {
+                    auto producer_id = GetShaderStageId(producer.stage_flag);
+                    auto consumer_id = GetShaderStageId(consumer.stage_flag);
+                    skip |= ValidateInterfaceBetweenStages(*producer.module_state.get(), *(producer.entrypoint),
+                                                           &shader_stage_attribs[producer_id], *consumer.module_state.get(),
+                                                           *(consumer.entrypoint), &shader_stage_attribs[consumer_id],
+                                                           interface_mismatch);
+                }
+            }
+        }
+        // The pair is not cached when a message was logged, even if the debug callbacks did not ask to skip the call
+        if (stages_from_libraries && !interface_mismatch) {
+            linked_shader_interface_cache.Insert(pipeline->pre_raster_state, pipeline->fragment_shader_state);
         }
     }
 
@@ -3606,6 +3631,7 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
 
         // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
         // the default values will be used during validation.
+        VVL_PROFILE_SCOPE("spirv-val");
         spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spv_context ctx = spvContextCreate(spirv_environment);
         spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
@@ -4292,14 +4292,10 @@ void ValidationStateTracker::RecordResetQueryPool(VkDevice device, VkQueryPool q
     if (!query_pool_state) return;
 
     // Reset the state of existing entries.
-    const uint32_t max_query_count = std::min(queryCount, query_pool_state->createInfo.queryCount - firstQuery);
-    for (uint32_t i = 0; i < max_query_count; ++i) {
-        auto query_index = firstQuery + i;
-        query_pool_state->SetQueryState(query_index, 0, QUERYSTATE_RESET);
-        if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
-            for (uint32_t pass_index = 0; pass_index < query_pool_state->n_performance_passes; pass_index++) {
-                query_pool_state->SetQueryState(query_index, pass_index, QUERYSTATE_RESET);
-            }
+    query_pool_state->SetQueryStates(firstQuery, queryCount, 0, QUERYSTATE_RESET);
+    if (query_pool_state->createInfo.queryType == VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR) {
+        for (uint32_t pass_index = 1; pass_index < query_pool_state->n_performance_passes; pass_index++) {
+            query_pool_state->SetQueryStates(firstQuery, queryCount, pass_index, QUERYSTATE_RESET);
         }
     }
 }
@@ -4541,9 +4537,8 @@ void ValidationStateTracker::PostCallRecordCmdTraceRaysIndirectKHR(VkCommandBuff
 std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleState(const VkShaderModuleCreateInfo &create_info,
                                                                                      uint32_t unique_shader_id,
                                                                                      VkShaderModule handle) const {
-    spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
     bool is_spirv = (create_info.pCode[0] == spv::MagicNumber);
-    return is_spirv ? std::make_shared<SHADER_MODULE_STATE>(create_info, handle, spirv_environment, unique_shader_id)
+    return is_spirv ? std::make_shared<SHADER_MODULE_STATE>(create_info, handle, unique_shader_id)
                     : std::make_shared<SHADER_MODULE_STATE>();
 }
 
@@ -53,26 +53,23 @@ extern const VkGeometryFlagsKHR AllVkGeometryFlagBitsKHR;
 extern const VkPipelineColorBlendStateCreateFlags AllVkPipelineColorBlendStateCreateFlagBits;
 extern const VkPipelineDepthStencilStateCreateFlags AllVkPipelineDepthStencilStateCreateFlagBits;
 
-extern const std::vector<VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
-extern const std::vector<VkCompareOp> AllVkCompareOpEnums;
-extern const std::vector<VkStencilOp> AllVkStencilOpEnums;
-extern const std::vector<VkBlendFactor> AllVkBlendFactorEnums;
-extern const std::vector<VkBlendOp> AllVkBlendOpEnums;
-extern const std::vector<VkLogicOp> AllVkLogicOpEnums;
-extern const std::vector<VkBorderColor> AllVkBorderColorEnums;
-extern const std::vector<VkImageLayout> AllVkImageLayoutEnums;
-extern const std::vector<VkFormat> AllVkFormatEnums;
-extern const std::vector<VkVertexInputRate> AllVkVertexInputRateEnums;
-extern const std::vector<VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
-extern const std::vector<VkIndexType> AllVkIndexTypeEnums;
+extern const layer_data::span<const VkGeometryTypeKHR> AllVkGeometryTypeKHREnums;
+extern const layer_data::span<const VkCompareOp> AllVkCompareOpEnums;
+extern const layer_data::span<const VkStencilOp> AllVkStencilOpEnums;
+extern const layer_data::span<const VkBlendFactor> AllVkBlendFactorEnums;
+extern const layer_data::span<const VkBlendOp> AllVkBlendOpEnums;
+extern const layer_data::span<const VkLogicOp> AllVkLogicOpEnums;
+extern const layer_data::span<const VkBorderColor> AllVkBorderColorEnums;
+extern const layer_data::span<const VkImageLayout> AllVkImageLayoutEnums;
+extern const layer_data::span<const VkFormat> AllVkFormatEnums;
+extern const layer_data::span<const VkVertexInputRate> AllVkVertexInputRateEnums;
+extern const layer_data::span<const VkPrimitiveTopology> AllVkPrimitiveTopologyEnums;
+extern const layer_data::span<const VkIndexType> AllVkIndexTypeEnums;
 
 extern std::vector<std::pair<uint32_t, uint32_t>> custom_stype_info;
 
 // String returned by string_VkStructureType for an unrecognized type.
-const std::string UnsupportedStructureTypeString = "Unhandled VkStructureType";
-
-// String returned by string_VkResult for an unrecognized type.
-const std::string UnsupportedResultString = "Unhandled VkResult";
+static constexpr const char *UnsupportedStructureTypeString = "Unhandled VkStructureType";
 
 // The base value used when computing the offset for an enumeration token value that is added by an extension.
 // When validating enumeration tokens, any value >= to this value is considered to be provided by an extension.
@@ -553,9 +550,6 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != nullptr) {
-            layer_data::unordered_set<const void *> cycle_check;
-            layer_data::unordered_set<VkStructureType, layer_data::hash<int>> unique_stype_check;
-
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
@@ -571,39 +565,50 @@ class StatelessValidation : public ValidationObject {
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
+                // Chains are short, so duplicates are found with a 64 bit filter over the sTypes seen so far and only confirmed
+                // by scanning them when the filter hits. Nothing is allocated unless a chain holds more than kPnextInlineCount
+                // structures.
+                static constexpr uint32_t kPnextInlineCount = 16;
+                small_vector<VkStructureType, kPnextInlineCount, uint32_t> seen_stypes;
+                uint64_t seen_filter = 0;
+
                 while (current != nullptr) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end() &&
-                            !IsDuplicatePnext(current->sType)) {
+                    const VkStructureType stype = current->sType;
+                    // The loader chains its own structures into the instance and device create infos
+                    if (((stype != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO) || (strcmp(api_name, "vkCreateInstance") != 0)) &&
+                        ((stype != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO) || (strcmp(api_name, "vkCreateDevice") != 0))) {
+                        const uint64_t filter_bit = uint64_t(1) << ((static_cast<uint64_t>(stype) * 0x9E3779B97F4A7C15ull) >> 58);
+                        const bool duplicate = ((seen_filter & filter_bit) != 0) &&
+                                               (std::find(seen_stypes.begin(), seen_stypes.end(), stype) != seen_stypes.end());
+                        if (duplicate && !IsDuplicatePnext(stype)) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
-                            std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
-                            skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                            skip_call |=
+                                LogError(device, stype_vuid,
+                                         "%s: %s chain contains duplicate structure types: %s appears multiple times.", api_name,
+                                         parameter_name.get_name().c_str(), string_VkStructureType(stype));
+                        } else if (!duplicate) {
+                            seen_filter |= filter_bit;
+                            seen_stypes.emplace_back(stype);
                         }
 
                         // Search custom stype list -- if sType found, skip this entirely
                         bool custom = false;
                         for (const auto &item : custom_stype_info) {
-                            if (item.first == current->sType) {
+                            if (item.first == stype) {
                                 custom = true;
                                 break;
                             }
                         }
                         if (!custom) {
-                            if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                            if (std::find(start, end, stype) == end) {
+                                const char *type_name = string_VkStructureType(stype);
+                                if (strcmp(UnsupportedStructureTypeString, type_name) == 0) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), current->sType, allowed_struct_names,
+                                                          parameter_name.get_name().c_str(), stype, allowed_struct_names,
                                                           header_version, parameter_name.get_name().c_str());
                                 } else {
                                     std::string message =
@@ -611,8 +616,8 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid, is_physdev_api,
@@ -703,7 +708,7 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
-                              const std::vector<T> &valid_values, T value, const char *vuid) const {
+                              layer_data::span<const T> valid_values, T value, const char *vuid) const {
         bool skip = false;
 
         if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
@@ -740,7 +745,7 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const ParameterName &countName, const ParameterName &arrayName,
-                                    const char *enumName, const std::vector<T> &valid_values, uint32_t count, const T *array,
+                                    const char *enumName, layer_data::span<const T> valid_values, uint32_t count, const T *array,
                                     bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -763,7 +768,7 @@ class StatelessValidation : public ValidationObject {
 
     template <typename T>
     bool validate_ranged_enum_array(const char *apiName, const char *vuid, const ParameterName &countName,
-                                    const ParameterName &arrayName, const char *enumName, const std::vector<T> &valid_values,
+                                    const ParameterName &arrayName, const char *enumName, layer_data::span<const T> valid_values,
                                     uint32_t count, const T *array, bool countRequired, bool arrayRequired) const {
         bool skip_call = false;
 
@@ -692,6 +692,36 @@ ImageRangeGenerator& ImageRangeGenerator::operator++() {
     return *this;
 }
 
+// Advance to the last row of the current layer or slice, extending pos_ over the rows skipped. Only valid when the rows are
+// adjacent in memory.
+void ImageRangeGenerator::SkipContiguousRows() {
+    const uint32_t rows_left = (incr_state_.y_count - incr_state_.y_index - 1) / incr_state_.y_step;
+    if (rows_left > 0) {
+        incr_state_.y_index += rows_left * incr_state_.y_step;
+        incr_state_.y_base += rows_left * incr_state_.incr_y;
+        pos_.end = incr_state_.y_base.end;
+    }
+}
+
+uint32_t ImageRangeGenerator::Fill(IndexRange* ranges, uint32_t max_count) {
+    uint32_t count = 0;
+    while (pos_.non_empty()) {
+        if (!single_full_size_range_ && (incr_state_.y_index < incr_state_.y_count) &&
+            (incr_state_.incr_y == incr_state_.y_base.distance())) {
+            SkipContiguousRows();
+        }
+        if ((count > 0) && (ranges[count - 1].end == pos_.begin)) {
+            ranges[count - 1].end = pos_.end;
+        } else if (count < max_count) {
+            ranges[count++] = pos_;
+        } else {
+            break;
+        }
+        ++(*this);
+    }
+    return count;
+}
+
 template <typename AspectTraits>
 class AspectParametersImpl : public AspectParameters {
   public:
@@ -422,7 +422,15 @@ class ImageRangeGenerator {
     ImageRangeGenerator& operator++();
     ImageRangeGenerator& operator=(const ImageRangeGenerator&) = default;
 
+    // Bulk alternative to operator++ for full resource operations that produce many small ranges (e.g. layered or 3D images).
+    // Writes up to max_count ranges to ranges and advances past them. Ranges contiguous in the address space (rows without
+    // padding, layers or slices packed back to back, adjacent mips) are merged into one. Returns the number of ranges written,
+    // which is zero only at end.
+    uint32_t Fill(IndexRange* ranges, uint32_t max_count);
+    static constexpr uint32_t kFillBatchSize = 32;
+
   private:
+    void SkipContiguousRows();
     bool Convert2DCompatibleTo3D();
     void SetUpSubresInfo();
     void SetUpIncrementerDefaults();
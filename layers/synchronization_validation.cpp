@@ -27,6 +27,7 @@
 
 #include "synchronization_validation.h"
 #include "sync_utils.h"
+#include "layer_profiler.h"
 
 // Utilities to DRY up Get... calls
 template <typename Map, typename Key = typename Map::key_type, typename RetVal = layer_data::optional<typename Map::mapped_type>>
@@ -909,6 +910,7 @@ void AccessContext::EraseIf(Predicate &&pred) {
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range,
                                          DetectOptions options) const {
+    VVL_PROFILE_SCOPE("AccessContext::DetectHazard");
     HazardResult hazard;
 
     if (static_cast<uint32_t>(options) & DetectOptions::kDetectAsync) {
@@ -1450,6 +1452,21 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const AttachmentVie
     return HazardResult();
 }
 
+template <typename Detector>
+HazardResult AccessContext::DetectImageRangesHazard(AccessAddressType type, Detector &detector,
+                                                    subresource_adapter::ImageRangeGenerator *range_gen,
+                                                    DetectOptions options) const {
+    std::array<ResourceAccessRange, subresource_adapter::ImageRangeGenerator::kFillBatchSize> ranges;
+    for (uint32_t count = range_gen->Fill(ranges.data(), static_cast<uint32_t>(ranges.size())); count > 0;
+         count = range_gen->Fill(ranges.data(), static_cast<uint32_t>(ranges.size()))) {
+        for (uint32_t i = 0; i < count; ++i) {
+            HazardResult hazard = DetectHazard(type, detector, ranges[i], options);
+            if (hazard.hazard) return hazard;
+        }
+    }
+    return HazardResult();
+}
+
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(Detector &detector, const IMAGE_STATE &image,
                                          const VkImageSubresourceRange &subresource_range, const VkOffset3D &offset,
@@ -1459,11 +1476,7 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const IMAGE_STATE &
     subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, offset, extent,
                                                        base_address, is_depth_sliced);
     const auto address_type = ImageAddressType(image);
-    for (; range_gen->non_empty(); ++range_gen) {
-        HazardResult hazard = DetectHazard(address_type, detector, *range_gen, options);
-        if (hazard.hazard) return hazard;
-    }
-    return HazardResult();
+    return DetectImageRangesHazard(address_type, detector, &range_gen, options);
 }
 template <typename Detector>
 HazardResult AccessContext::DetectHazard(Detector &detector, const IMAGE_STATE &image,
@@ -1474,11 +1487,7 @@ HazardResult AccessContext::DetectHazard(Detector &detector, const IMAGE_STATE &
     subresource_adapter::ImageRangeGenerator range_gen(*image.fragment_encoder.get(), subresource_range, base_address,
                                                        is_depth_sliced);
     const auto address_type = ImageAddressType(image);
-    for (; range_gen->non_empty(); ++range_gen) {
-        HazardResult hazard = DetectHazard(address_type, detector, *range_gen, options);
-        if (hazard.hazard) return hazard;
-    }
-    return HazardResult();
+    return DetectImageRangesHazard(address_type, detector, &range_gen, options);
 }
 
 HazardResult AccessContext::DetectHazard(const IMAGE_STATE &image, SyncStageAccessIndex current_usage,
@@ -1739,6 +1748,27 @@ void UpdateMemoryAccessState(ResourceAccessRangeMap *accesses, const Action &act
         UpdateMemoryAccessState(accesses, *range_gen, action);
     }
 }
+
+// Image range generators can produce many small ranges for a single operation, pull them in coalesced batches instead
+template <typename Action>
+void UpdateMemoryAccessState(ResourceAccessRangeMap *accesses, const Action &action,
+                             subresource_adapter::ImageRangeGenerator *range_gen) {
+    assert(range_gen);
+    std::array<ResourceAccessRange, subresource_adapter::ImageRangeGenerator::kFillBatchSize> ranges;
+    for (uint32_t count = range_gen->Fill(ranges.data(), static_cast<uint32_t>(ranges.size())); count > 0;
+         count = range_gen->Fill(ranges.data(), static_cast<uint32_t>(ranges.size()))) {
+        for (uint32_t i = 0; i < count; ++i) {
+            UpdateMemoryAccessState(accesses, ranges[i], action);
+        }
+    }
+}
+
+template <typename Action>
+void UpdateMemoryAccessState(ResourceAccessRangeMap *accesses, const Action &action,
+                             const subresource_adapter::ImageRangeGenerator &range_gen_prebuilt) {
+    subresource_adapter::ImageRangeGenerator range_gen(range_gen_prebuilt);
+    UpdateMemoryAccessState(accesses, action, &range_gen);
+}
 struct UpdateMemoryAccessStateFunctor {
     using Iterator = ResourceAccessRangeMap::iterator;
     Iterator Infill(ResourceAccessRangeMap *accesses, Iterator pos, ResourceAccessRange range) const {
@@ -2047,6 +2077,7 @@ void AccessContext::RecordLayoutTransitions(const RENDER_PASS_STATE &rp_state, u
 }
 
 bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBindPoint pipelineBindPoint, CMD_TYPE cmd_type) const {
+    VVL_PROFILE_SCOPE("CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet");
     bool skip = false;
     const PIPELINE_STATE *pipe = nullptr;
     const std::vector<LAST_BOUND_STATE::PER_SET> *per_sets = nullptr;
@@ -6367,6 +6398,7 @@ SyncOpPipelineBarrier::SyncOpPipelineBarrier(CMD_TYPE cmd_type, const SyncValida
     : SyncOpBarriers(cmd_type, sync_state, queue_flags, 1, &dep_info) {}
 
 bool SyncOpPipelineBarrier::Validate(const CommandBufferAccessContext &cb_context) const {
+    VVL_PROFILE_SCOPE("SyncOpPipelineBarrier::Validate");
     bool skip = false;
     const auto *context = cb_context.GetCurrentAccessContext();
     assert(context);
@@ -7435,6 +7467,7 @@ bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCou
 
 bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                                         const char *func_name) const {
+    VVL_PROFILE_SCOPE("SyncValidator::ValidateQueueSubmit");
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
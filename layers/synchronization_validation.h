@@ -1028,6 +1028,9 @@ class AccessContext {
     HazardResult DetectHazard(AccessAddressType type, Detector &detector, const ResourceAccessRange &range,
                               DetectOptions options) const;
     template <typename Detector>
+    HazardResult DetectImageRangesHazard(AccessAddressType type, Detector &detector,
+                                         subresource_adapter::ImageRangeGenerator *range_gen, DetectOptions options) const;
+    template <typename Detector>
     HazardResult DetectAsyncHazard(AccessAddressType type, const Detector &detector, const ResourceAccessRange &range,
                                    ResourceUsageTag async_tag) const;
     template <typename Detector>
@@ -0,0 +1,260 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "thread_pool.h"
+
+#include <deque>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__) || defined(__ANDROID__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+constexpr uint32_t ThreadPool::kMaxThreads;
+
+namespace {
+
+struct Worker {
+    std::mutex lock;
+    std::deque<ThreadPool::Task> tasks;
+    std::thread thread;
+};
+
+struct PoolState {
+    // Guards the settings, the start count and the creation and destruction of the workers
+    std::mutex lock;
+    uint32_t start_count = 0;
+    bool pin_threads = false;
+    // Read without the lock, since tasks can call ThreadCount() while Stop() joins the workers
+    std::atomic<uint32_t> thread_count{0};
+
+    // The deques of all thread_count workers are created with the first thread. Threads are started one at a time, when
+    // tasks are queued faster than the running workers take them, and only workers below started are used.
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<uint32_t> started{0};
+    std::atomic<uint32_t> next_worker{0};
+
+    // Tasks queued and not yet taken by a worker. Idle workers sleep on wake until there is one, or the pool stops.
+    std::atomic<uint32_t> pending{0};
+    std::atomic<uint32_t> idle{0};
+    std::mutex sleep_lock;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+// Never destroyed: an application can exit without destroying its instances, and the workers are then still waiting on wake
+// when static destructors run. The threads end with the process instead of being joined.
+PoolState &GetPoolState() {
+    static PoolState *state = new PoolState;
+    return *state;
+}
+
+// Index of the worker running on this thread, -1 on the other threads
+thread_local int32_t worker_index = -1;
+
+void SetWorkerName(uint32_t index) {
+    const std::string name = "vvl-worker-" + std::to_string(index);
+#if defined(_WIN32)
+    // SetThreadDescription is only available from Windows 10 1607
+    using SetThreadDescriptionFn = HRESULT(WINAPI *)(HANDLE, PCWSTR);
+    auto set_thread_description = reinterpret_cast<SetThreadDescriptionFn>(
+        reinterpret_cast<void (*)()>(GetProcAddress(GetModuleHandleW(L"kernel32.dll"), "SetThreadDescription")));
+    if (set_thread_description) {
+        const std::wstring wide_name(name.begin(), name.end());
+        set_thread_description(GetCurrentThread(), wide_name.c_str());
+    }
+#elif defined(__APPLE__)
+    pthread_setname_np(name.c_str());
+#elif defined(__linux__) || defined(__ANDROID__)
+    // Linux limits thread names to 15 characters
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#else
+    (void)name;
+#endif
+}
+
+void PinWorker(uint32_t index) {
+    const uint32_t cpu = index % std::max(1u, std::thread::hardware_concurrency());
+#if defined(_WIN32)
+    if (cpu < sizeof(DWORD_PTR) * 8) {
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu);
+    }
+#elif defined(__linux__) || defined(__ANDROID__)
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#else
+    // macOS has no API to pin a thread to a CPU
+    (void)cpu;
+#endif
+}
+
+// Pops from the back of the worker's own deque, then steals from the front of the others
+bool TakeTask(PoolState &state, uint32_t index, ThreadPool::Task &task) {
+    const uint32_t count = state.started.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+        auto &worker = *state.workers[(index + i) % count];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        if (!worker.tasks.empty()) {
+            if (i == 0) {
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+            } else {
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop_front();
+            }
+            state.pending.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkerThread(PoolState &state, uint32_t index, bool pin_thread) {
+    worker_index = static_cast<int32_t>(index);
+    SetWorkerName(index);
+    if (pin_thread) {
+        PinWorker(index);
+    }
+    ThreadPool::Task task;
+    while (true) {
+        if (TakeTask(state, index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(state.sleep_lock);
+        state.idle.fetch_add(1);
+        state.wake.wait(guard, [&state]() { return state.stopping || state.pending.load() > 0; });
+        state.idle.fetch_sub(1);
+        // Tasks queued by the tasks that ran during Stop() still run before the workers exit
+        if (state.stopping && state.pending.load() == 0) {
+            return;
+        }
+    }
+}
+
+// Starts the thread of the next worker. Called with state.lock held.
+void StartWorker(PoolState &state) {
+    const uint32_t index = state.started.load();
+    if (state.workers.empty()) {
+        const uint32_t thread_count = state.thread_count.load();
+        state.workers.reserve(thread_count);
+        for (uint32_t i = 0; i < thread_count; ++i) {
+            state.workers.emplace_back(new Worker);
+        }
+    }
+    state.workers[index]->thread = std::thread(WorkerThread, std::ref(state), index, state.pin_threads);
+    state.started.store(index + 1, std::memory_order_release);
+}
+
+}  // namespace
+
+void ThreadPool::Start(uint32_t thread_count, bool pin_threads) {
+    auto &state = GetPoolState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.start_count++ > 0) {
+        return;
+    }
+    if (thread_count == 0) {
+        thread_count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+    state.thread_count.store(std::min(std::max<uint32_t>(thread_count, 1), kMaxThreads));
+    state.pin_threads = pin_threads;
+}
+
+void ThreadPool::Stop() {
+    auto &state = GetPoolState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.start_count == 0 || --state.start_count > 0) {
+        return;
+    }
+    const uint32_t started = state.started.load();
+    if (started > 0) {
+        {
+            std::lock_guard<std::mutex> sleep_guard(state.sleep_lock);
+            state.stopping = true;
+        }
+        state.wake.notify_all();
+        for (uint32_t index = 0; index < started; ++index) {
+            state.workers[index]->thread.join();
+        }
+        state.started.store(0);
+        state.workers.clear();
+        state.stopping = false;
+    }
+    state.thread_count.store(0);
+}
+
+uint32_t ThreadPool::ThreadCount() {
+    return GetPoolState().thread_count.load();
+}
+
+uint32_t ThreadPool::StartedThreadCount() {
+    return GetPoolState().started.load();
+}
+
+void ThreadPool::Submit(Task &&task) {
+    auto &state = GetPoolState();
+    uint32_t started = state.started.load(std::memory_order_acquire);
+    // The worker started for the first task is not idle yet, and must not count as busy
+    bool first_worker = false;
+    if (started == 0) {
+        std::unique_lock<std::mutex> guard(state.lock);
+        if (state.start_count == 0) {
+            guard.unlock();
+            task();
+            return;
+        }
+        if (state.started.load() == 0) {
+            StartWorker(state);
+            first_worker = true;
+        }
+        started = state.started.load();
+    }
+
+    const uint32_t index =
+        worker_index >= 0 ? static_cast<uint32_t>(worker_index) : state.next_worker.fetch_add(1) % started;
+    // pending is raised first so that it never drops below the number of tasks in the deques
+    state.pending.fetch_add(1);
+    {
+        auto &worker = *state.workers[index];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.tasks.emplace_back(std::move(task));
+    }
+    {
+        // Taking the lock orders the notification after the check of a worker that is about to sleep
+        std::lock_guard<std::mutex> guard(state.sleep_lock);
+    }
+    state.wake.notify_one();
+
+    // Start one more worker when the queued tasks outnumber the idle workers, so that an application with a single queue keeps
+    // a single thread busy rather than one per CPU
+    if (!first_worker && started < state.thread_count.load() && state.pending.load() > state.idle.load()) {
+        std::lock_guard<std::mutex> guard(state.lock);
+        if (state.start_count > 0 && state.started.load() > 0 && state.started.load() < state.thread_count.load()) {
+            StartWorker(state);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Worker threads shared by all the validation objects of the layer, for the queue retire work and for validation that can be
+// split in independent parts, such as the create infos of a large vkCreateGraphicsPipelines call.
+//
+// Each worker has its own deque of tasks. A task submitted from a worker goes to the back of that worker's deque, which the
+// worker pops from, and other tasks are distributed round-robin. Workers with nothing to do steal from the front of the
+// other deques before sleeping. The workers are named vvl-worker-<index>, and can be pinned to one CPU each.
+//
+// The maximum size is set with the khronos_validation.thread_pool_size setting (VK_LAYER_THREAD_POOL_SIZE), 0 uses one thread
+// less than the number of CPUs. The first task submitted starts one worker, and another one is started whenever tasks are
+// queued while no worker is idle, so instances that never create a device start no thread.
+//
+// Tasks must not block waiting for other tasks, except through ParallelFor() and ParallelMap(), whose calling thread runs
+// the parts that no worker has started.
+class ThreadPool {
+  public:
+    static constexpr uint32_t kMaxThreads = 64;
+
+    using Task = std::function<void()>;
+
+    // Enables the pool, reference counted per instance. The settings of the first instance are used.
+    static void Start(uint32_t thread_count, bool pin_threads);
+    // Once every instance that started the pool has been destroyed, runs the remaining tasks and joins the workers
+    static void Stop();
+
+    // Queues task on a worker. When the pool has not been started, task runs on the calling thread before Submit() returns.
+    static void Submit(Task &&task);
+
+    // Number of workers that Submit() can use, 0 if the pool has not been started
+    static uint32_t ThreadCount();
+    // Number of workers whose thread has been started, at most ThreadCount()
+    static uint32_t StartedThreadCount();
+
+    // Calls fn(index) once for each index in [0, count), in batches of at least min_batch consecutive indices, on the workers
+    // and on the calling thread, and returns once every call has returned.
+    template <typename Fn>
+    static void ParallelFor(uint32_t count, uint32_t min_batch, Fn &&fn) {
+        min_batch = std::max<uint32_t>(min_batch, 1);
+        const uint32_t batches = (count + min_batch - 1) / min_batch;
+        const uint32_t helpers = std::min(ThreadCount(), batches > 0 ? batches - 1 : 0);
+        if (helpers == 0) {
+            for (uint32_t index = 0; index < count; ++index) {
+                fn(index);
+            }
+            return;
+        }
+
+        // Split the range in about 4 batches per thread, so that threads that finish early take over the work of the others
+        const uint32_t batch = std::max(min_batch, count / ((helpers + 1) * 4));
+        auto state = std::make_shared<ParallelForState>(count, batch, [&fn](uint32_t index) { fn(index); });
+        for (uint32_t i = 0; i < helpers; ++i) {
+            Submit([state]() { state->Run(); });
+        }
+        state->Run();
+        state->Wait();
+    }
+
+    // Returns the results of fn(index) for each index in [0, count), in index order whichever thread computed them
+    template <typename T, typename Fn>
+    static std::vector<T> ParallelMap(uint32_t count, uint32_t min_batch, Fn &&fn) {
+        static_assert(!std::is_same<T, bool>::value, "std::vector<bool> elements cannot be written concurrently");
+        std::vector<T> results(count);
+        ParallelFor(count, min_batch, [&results, &fn](uint32_t index) { results[index] = fn(index); });
+        return results;
+    }
+
+  private:
+    // The indices of a ParallelFor() call, claimed in batches by the calling thread and the workers. Workers that start after
+    // every index was claimed return without calling fn, which may no longer exist.
+    class ParallelForState {
+      public:
+        ParallelForState(uint32_t count, uint32_t batch, std::function<void(uint32_t)> &&fn)
+            : count_(count), batch_(batch), fn_(std::move(fn)) {}
+
+        void Run() {
+            uint64_t claimed;
+            while ((claimed = next_.fetch_add(batch_)) < count_) {
+                const uint32_t first = static_cast<uint32_t>(claimed);
+                const uint32_t last = static_cast<uint32_t>(std::min<uint64_t>(count_, claimed + batch_));
+                for (uint32_t index = first; index < last; ++index) {
+                    fn_(index);
+                }
+                if (done_.fetch_add(last - first) + (last - first) == count_) {
+                    std::lock_guard<std::mutex> guard(lock_);
+                    finished_.notify_all();
+                }
+            }
+        }
+
+        void Wait() {
+            std::unique_lock<std::mutex> guard(lock_);
+            finished_.wait(guard, [this]() { return done_.load() == count_; });
+        }
+
+      private:
+        const uint32_t count_;
+        const uint32_t batch_;
+        const std::function<void(uint32_t)> fn_;
+        // next_ goes past count_ by up to one batch per thread, so it is 64 bits to not wrap around
+        std::atomic<uint64_t> next_{0};
+        std::atomic<uint32_t> done_{0};
+        std::mutex lock_;
+        std::condition_variable finished_;
+    };
+};
@@ -0,0 +1,100 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "validation_governor.h"
+
+#include <mutex>
+
+#include "layer_profiler.h"
+
+constexpr uint32_t ValidationGovernor::kBestPracticesLevel;
+constexpr uint32_t ValidationGovernor::kMaxLevel;
+constexpr uint32_t ValidationGovernor::kRecoveryFrames;
+std::atomic<uint32_t> ValidationGovernor::level_{0};
+
+namespace {
+
+// Frames can end on several queues, and instances can start and stop the governor on any thread
+struct GovernorState {
+    std::mutex lock;
+    uint32_t start_count = 0;
+    uint64_t budget = 0;
+    uint32_t frames_under_budget = 0;
+    ValidationGovernor::Stats stats = {};
+};
+
+GovernorState &GetGovernorState() {
+    static GovernorState state;
+    return state;
+}
+
+}  // namespace
+
+void ValidationGovernor::Start(uint64_t budget_ns) {
+    auto &state = GetGovernorState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.start_count++ > 0) {
+        return;
+    }
+    state.budget = budget_ns;
+    state.frames_under_budget = 0;
+    state.stats = {};
+    level_.store(0);
+    LayerProfiler::SetFrameTiming(true);
+}
+
+void ValidationGovernor::Stop() {
+    auto &state = GetGovernorState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.start_count > 0 && --state.start_count == 0) {
+        LayerProfiler::SetFrameTiming(false);
+        level_.store(0);
+    }
+}
+
+void ValidationGovernor::EndFrame(uint64_t layer_time_ns) {
+    auto &state = GetGovernorState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    if (state.start_count == 0) {
+        return;
+    }
+    uint32_t level = level_.load(std::memory_order_relaxed);
+    ++state.stats.frames;
+    if (layer_time_ns > state.budget) {
+        ++state.stats.frames_over_budget;
+        state.frames_under_budget = 0;
+        if (level < kMaxLevel) {
+            ++level;
+        }
+    } else if (layer_time_ns < state.budget - state.budget / 4) {
+        if (level > 0 && ++state.frames_under_budget >= kRecoveryFrames) {
+            state.frames_under_budget = 0;
+            --level;
+        }
+    } else {
+        state.frames_under_budget = 0;
+    }
+    if (level > state.stats.max_level) {
+        state.stats.max_level = level;
+    }
+    level_.store(level, std::memory_order_relaxed);
+}
+
+ValidationGovernor::Stats ValidationGovernor::GetStats() {
+    auto &state = GetGovernorState();
+    std::lock_guard<std::mutex> guard(state.lock);
+    return state.stats;
+}
@@ -0,0 +1,67 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Keeps the time spent in the layer per frame under the budget set with the khronos_validation.validation_frame_budget
+// setting (VK_LAYER_VALIDATION_FRAME_BUDGET), in microseconds.
+//
+// The layer profiler measures the time spent in the layer on all threads between two vkQueuePresentKHR calls, excluding the
+// time spent in the driver by the calls that can wait for the GPU or the presentation engine. Each frame over budget raises the
+// throttle level by one. Once the time has stayed under 3/4 of the budget for kRecoveryFrames frames, the level is lowered by
+// one. The optional checks are throttled progressively as the level rises:
+//
+// - from kBestPracticesLevel, best practices validation is skipped (best practices still records state),
+// - above it, each level doubles the draw validation sample period, up to 64 times the configured period at kMaxLevel.
+//
+// Only validation is throttled, state recording always stays complete.
+class ValidationGovernor {
+  public:
+    static constexpr uint32_t kBestPracticesLevel = 1;
+    static constexpr uint32_t kMaxLevel = 7;
+    static constexpr uint32_t kRecoveryFrames = 30;
+
+    // Starts governing, reference counted per instance. The budget of the first instance is used.
+    static void Start(uint64_t budget_ns);
+    static void Stop();
+
+    // Called by the profiler at each frame with the time spent in the layer during the frame
+    static void EndFrame(uint64_t layer_time_ns);
+
+    static uint32_t Level() { return level_.load(std::memory_order_relaxed); }
+
+    static uint32_t DrawValidationSamplePeriod(uint32_t period) {
+        const uint32_t level = Level();
+        if (level <= kBestPracticesLevel) {
+            return period;
+        }
+        const uint64_t throttled_period = static_cast<uint64_t>(period) << (level - kBestPracticesLevel);
+        return throttled_period > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(throttled_period);
+    }
+
+    struct Stats {
+        uint64_t frames;
+        uint64_t frames_over_budget;
+        uint32_t max_level;
+    };
+    static Stats GetStats();
+
+  private:
+    static std::atomic<uint32_t> level_;
+};
@@ -139,7 +139,7 @@ VK_LAYER_EXPORT FILE *getLayerLogOutput(const char *option, const char *layer_na
 }
 
 // Map option strings to flag enum values
-VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(string option, layer_data::unordered_map<string, VkFlags> const &enum_data,
+VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(string option, layer_data::span<const LayerOptionFlagName> enum_data,
                                             uint32_t option_default) {
     VkDebugReportFlagsEXT flags = option_default;
     string option_list = layer_config.GetOption(option.c_str());
@@ -154,9 +154,11 @@ VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(string option, layer_data::unordered
         // Get first option item in list
         const string option_item = option_list.substr(0, option_length);
 
-        auto enum_value = enum_data.find(option_item);
-        if (enum_value != enum_data.end()) {
-            flags |= enum_value->second;
+        for (const auto &entry : enum_data) {
+            if (option_item == entry.name) {
+                flags |= entry.flags;
+                break;
+            }
         }
 
         // Remove first option from option_list
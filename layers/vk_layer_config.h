@@ -71,35 +71,42 @@ typedef enum VkLayerDbgActionBits {
 } VkLayerDbgActionBits;
 typedef VkFlags VkLayerDbgActionFlags;
 
-const layer_data::unordered_map<std::string, VkFlags> debug_actions_option_definitions = {
-    {std::string("VK_DBG_LAYER_ACTION_IGNORE"), VK_DBG_LAYER_ACTION_IGNORE},
-    {std::string("VK_DBG_LAYER_ACTION_CALLBACK"), VK_DBG_LAYER_ACTION_CALLBACK},
-    {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
-    {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
+// Maps a token accepted in a layer setting to the flag bits it enables. The tables below are constant-initialized, so they
+// do not add work to layer load in every translation unit that includes this header.
+struct LayerOptionFlagName {
+    const char *name;
+    VkFlags flags;
+};
+
+static constexpr LayerOptionFlagName debug_actions_option_definitions[] = {
+    {"VK_DBG_LAYER_ACTION_IGNORE", VK_DBG_LAYER_ACTION_IGNORE},
+    {"VK_DBG_LAYER_ACTION_CALLBACK", VK_DBG_LAYER_ACTION_CALLBACK},
+    {"VK_DBG_LAYER_ACTION_LOG_MSG", VK_DBG_LAYER_ACTION_LOG_MSG},
+    {"VK_DBG_LAYER_ACTION_BREAK", VK_DBG_LAYER_ACTION_BREAK},
 #if defined(WIN32)
-    {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
+    {"VK_DBG_LAYER_ACTION_DEBUG_OUTPUT", VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
 #endif
-    {std::string("VK_DBG_LAYER_ACTION_DEFAULT"), VK_DBG_LAYER_ACTION_DEFAULT}};
+    {"VK_DBG_LAYER_ACTION_DEFAULT", VK_DBG_LAYER_ACTION_DEFAULT}};
 
-const layer_data::unordered_map<std::string, VkFlags> report_flags_option_definitions = {
-    {std::string("warn"), VK_DEBUG_REPORT_WARNING_BIT_EXT},
-    {std::string("info"), VK_DEBUG_REPORT_INFORMATION_BIT_EXT},
-    {std::string("perf"), VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT},
-    {std::string("error"), VK_DEBUG_REPORT_ERROR_BIT_EXT},
-    {std::string("debug"), VK_DEBUG_REPORT_DEBUG_BIT_EXT}};
+static constexpr LayerOptionFlagName report_flags_option_definitions[] = {
+    {"warn", VK_DEBUG_REPORT_WARNING_BIT_EXT},
+    {"info", VK_DEBUG_REPORT_INFORMATION_BIT_EXT},
+    {"perf", VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT},
+    {"error", VK_DEBUG_REPORT_ERROR_BIT_EXT},
+    {"debug", VK_DEBUG_REPORT_DEBUG_BIT_EXT}};
 
-const layer_data::unordered_map<std::string, VkFlags> log_msg_type_option_definitions = {{std::string("warn"), kWarningBit},
-                                                                                  {std::string("info"), kInformationBit},
-                                                                                  {std::string("perf"), kPerformanceWarningBit},
-                                                                                  {std::string("error"), kErrorBit},
-                                                                                  {std::string("debug"), kDebugBit}};
+static constexpr LayerOptionFlagName log_msg_type_option_definitions[] = {{"warn", kWarningBit},
+                                                                          {"info", kInformationBit},
+                                                                          {"perf", kPerformanceWarningBit},
+                                                                          {"error", kErrorBit},
+                                                                          {"debug", kDebugBit}};
 
 VK_LAYER_EXPORT const char *getLayerOption(const char *option);
 VK_LAYER_EXPORT const char *GetLayerEnvVar(const char *option);
 VK_LAYER_EXPORT const SettingsFileInfo *GetLayerSettingsFileInfo();
 
 VK_LAYER_EXPORT FILE *getLayerLogOutput(const char *option, const char *layer_name);
-VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(std::string option, layer_data::unordered_map<std::string, VkFlags> const &enum_data,
+VK_LAYER_EXPORT VkFlags GetLayerOptionFlags(std::string option, layer_data::span<const LayerOptionFlagName> enum_data,
                                             uint32_t option_default);
 
 VK_LAYER_EXPORT void setLayerOption(const char *option, const char *val);
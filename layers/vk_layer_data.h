@@ -873,9 +873,11 @@ class span {
     using const_iterator = T const *;
 
     span() = default;
-    span(pointer start, size_t n) : data_(start), count_(n) {}
+    constexpr span(pointer start, size_t n) : data_(start), count_(n) {}
     template <typename Iterator>
-    span(Iterator start, Iterator end) : data_(&(*start)), count_(end - start) {}
+    constexpr span(Iterator start, Iterator end) : data_(&(*start)), count_(end - start) {}
+    template <size_t N>
+    constexpr span(T (&array)[N]) : data_(array), count_(N) {}
     template <typename Container>
     span(const Container &c) : data_(c.data()), count_(c.size()) {}
 
@@ -894,7 +896,7 @@ class span {
     T &back() { return *(data_ + (count_ - 1)); }
     const T &back() const { return *(data_ + (count_ - 1)); }
 
-    size_t size() const { return count_; }
+    constexpr size_t size() const { return count_; }
 
     pointer data() { return data_; }
 
@@ -70,7 +70,7 @@ def CheckVVLCodegenConsistency():
 
 #
 # Prepare the Validation Layers for testing
-def BuildVVL(args, build_tests=False):
+def BuildVVL(args, build_tests=False, build_benchmarks=False):
 
     print("Log CMake version")
     cmake_ver_cmd = 'cmake --version'
@@ -81,6 +81,7 @@ def BuildVVL(args, build_tests=False):
     cmake_cmd = f'cmake -DUPDATE_DEPS=ON -DUPDATE_DEPS_SKIP_EXISTING_INSTALL=ON -DCMAKE_BUILD_TYPE={args.configuration.capitalize()} {args.cmake} ..'
     if IsWindows(): cmake_cmd = cmake_cmd + f' -A {args.arch}'
     if build_tests: cmake_cmd = cmake_cmd + ' -DBUILD_TESTS=ON'
+    if build_benchmarks: cmake_cmd = cmake_cmd + ' -DBUILD_BENCHMARKS=ON'
     RunShellCmd(cmake_cmd, VVL_BUILD_DIR)
 
     print("Build Validation Layers and Tests")
@@ -144,20 +145,15 @@ def BuildMockICD(args):
     RunShellCmd(build_cmd, ICD_BUILD_DIR)
 
 #
-# Run the Layer Validation Tests
-def RunVVLTests(args):
-    print("Run Vulkan-ValidationLayer Tests using Mock ICD")
-    lvt_cmd = os.path.join(PROJECT_ROOT, BUILD_DIR_NAME, 'tests')
-    if IsWindows(): lvt_cmd = os.path.join(lvt_cmd, args.configuration.capitalize())
-    lvt_cmd = os.path.join(lvt_cmd, 'vk_layer_validation_tests')
-
+# Environment running an executable from the build directory against the built layers, Loader and Mock ICD
+def GetMockICDEnv(args, exe_dir):
     lvt_env = dict(os.environ)
 
     if not IsWindows():
         lvt_env['LD_LIBRARY_PATH'] = os.path.join(EXTERNAL_DIR, 'Vulkan-Loader', BUILD_DIR_NAME, 'loader')
     else:
         loader_dll = os.path.join(EXTERNAL_DIR, 'Vulkan-Loader', BUILD_DIR_NAME, 'loader', args.configuration.capitalize(), 'vulkan-1.dll')
-        loader_dll_dst = os.path.join(os.path.dirname(lvt_cmd), 'vulkan-1.dll')
+        loader_dll_dst = os.path.join(exe_dir, 'vulkan-1.dll')
         shutil.copyfile(loader_dll, loader_dll_dst)
 
     layer_path = os.path.join(PROJECT_ROOT, BUILD_DIR_NAME, 'layers')
@@ -172,12 +168,35 @@ def RunVVLTests(args):
     if not os.path.isfile(icd_filenames):
         raise Exception(f'VK_ICD_FILENAMES "{icd_filenames}" does not exist')
     lvt_env['VK_ICD_FILENAMES'] = icd_filenames
+    return lvt_env
+
+#
+# Run the Layer Validation Tests
+def RunVVLTests(args):
+    print("Run Vulkan-ValidationLayer Tests using Mock ICD")
+    lvt_cmd = os.path.join(PROJECT_ROOT, BUILD_DIR_NAME, 'tests')
+    if IsWindows(): lvt_cmd = os.path.join(lvt_cmd, args.configuration.capitalize())
+    lvt_cmd = os.path.join(lvt_cmd, 'vk_layer_validation_tests')
+
+    lvt_env = GetMockICDEnv(args, os.path.dirname(lvt_cmd))
 
     RunShellCmd(lvt_cmd, env=lvt_env)
     print("Re-Running multithreaded tests with VK_LAYER_FINE_GRAINED_LOCKING=1:")
     lvt_env['VK_LAYER_FINE_GRAINED_LOCKING'] = '1'
     RunShellCmd(lvt_cmd + ' --gtest_filter=*Thread*', env=lvt_env)
 
+#
+# Run the layer benchmarks, writing the results as JSON to args.benchmark_out
+def RunVVLBenchmarks(args):
+    print("Run Vulkan-ValidationLayer Benchmarks using Mock ICD")
+    bench_cmd = os.path.join(PROJECT_ROOT, BUILD_DIR_NAME, 'benchmarks')
+    if IsWindows(): bench_cmd = os.path.join(bench_cmd, args.configuration.capitalize())
+    bench_cmd = os.path.join(bench_cmd, 'vk_layer_benchmarks')
+
+    bench_env = GetMockICDEnv(args, os.path.dirname(bench_cmd))
+
+    RunShellCmd(f'{bench_cmd} --benchmark_out={os.path.abspath(args.benchmark_out)} --benchmark_out_format=json', env=bench_env)
+
 
 def GetArgParser():
     parser = argparse.ArgumentParser()
@@ -196,4 +215,8 @@ def GetArgParser():
         '--cmake', dest='cmake',
         metavar='CMAKE', type=str,
         default='', help='Additional args to pass to cmake')
+    parser.add_argument(
+        '--benchmark-out', dest='benchmark_out',
+        metavar='FILE', type=str, default=None,
+        help='Build and run the layer benchmarks, writing the JSON results to FILE')
     return parser
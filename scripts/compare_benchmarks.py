@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+# Copyright (c) 2022 Valve Corporation
+# Copyright (c) 2022 LunarG, Inc.
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compares two vk_layer_benchmarks JSON result files (--benchmark_out_format=json) and exits with a non-zero status
+# if any benchmark got slower than the threshold.
+
+import argparse
+import json
+import sys
+
+def LoadResults(path, metric):
+    with open(path, 'r') as result_file:
+        results = json.load(result_file)
+    times = {}
+    for benchmark in results['benchmarks']:
+        # Skip the mean/median/stddev rows of repeated runs, and the benchmarks that failed
+        if benchmark.get('run_type', 'iteration') != 'iteration' or benchmark.get('error_occurred', False):
+            continue
+        times[benchmark['name']] = (benchmark[metric], benchmark['time_unit'])
+    return times
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two vk_layer_benchmarks JSON result files.')
+    parser.add_argument('baseline', help='Results of the reference build')
+    parser.add_argument('contender', help='Results of the build being evaluated')
+    parser.add_argument('--metric', choices=['cpu_time', 'real_time'], default='cpu_time',
+                        help='Time to compare (default: cpu_time)')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Slowdown, in percent, reported as a regression (default: 10)')
+    args = parser.parse_args()
+
+    baseline = LoadResults(args.baseline, args.metric)
+    contender = LoadResults(args.contender, args.metric)
+
+    regressions = 0
+    print(f'{"Benchmark":<56} {"Baseline":>14} {"Contender":>14} {"Change":>9}')
+    for name, (base_time, unit) in baseline.items():
+        if name not in contender:
+            print(f'{name:<56} {base_time:>11.1f} {unit:<2} {"missing":>14}')
+            continue
+        time, contender_unit = contender[name]
+        if contender_unit != unit:
+            print(f'{name:<56} time units differ ({unit} and {contender_unit}), skipped')
+            continue
+        change = (time - base_time) / base_time * 100.0 if base_time > 0 else 0.0
+        regressed = change > args.threshold
+        regressions += regressed
+        print(f'{name:<56} {base_time:>11.1f} {unit:<2} {time:>11.1f} {unit:<2} {change:>+8.1f}%{" <--" if regressed else ""}')
+    for name in contender.keys() - baseline.keys():
+        print(f'{name:<56} {"new":>14}')
+
+    if regressions:
+        print(f'{regressions} benchmark(s) regressed by more than {args.threshold}%')
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -100,16 +100,6 @@ class FormatUtilsOutputGenerator(OutputGenerator):
         self.ycbcrFormats = dict()
         self.planarFormats = dict()
 
-        # Lots of switch statements share same ending
-        self.commonBoolSwitch  = '''        found = true;
-            break;
-        default:
-            break;
-    }
-    return found;
-}
-'''
-
     #
     # Called at beginning of processing as file is opened
     def beginFile(self, genOpts):
@@ -280,7 +270,7 @@ extern "C" {
         output = '\n'
         if self.sourceFile:
             output += '''
-enum class COMPONENT_TYPE {
+enum class COMPONENT_TYPE : uint8_t {
     NONE,
     R,
     G,
@@ -291,52 +281,46 @@ enum class COMPONENT_TYPE {
 };
 
 // Compressed formats don't have a defined component size
-const uint32_t COMPRESSED_COMPONENT = 0xFFFFFFFF;
+const uint8_t COMPRESSED_COMPONENT = 0xFF;
 
 struct COMPONENT_INFO {
     COMPONENT_TYPE type;
-    uint32_t size; // bits
-
-    COMPONENT_INFO() : type(COMPONENT_TYPE::NONE), size(0) {};
-    COMPONENT_INFO(COMPONENT_TYPE type, uint32_t size) : type(type), size(size) {};
+    uint8_t size; // bits
 };
 
+enum class COMPRESSED_TYPE : uint8_t {
+    NONE = 0,
+'''
+            for index, key in enumerate(sorted(self.compressedFormats.keys()), start=1):
+                output += '    {}'.format(key)
+                output += ',\n' if (index != len(self.compressedFormats.keys())) else '\n'
+            output += '''};
+
+// Bits of FORMAT_INFO::traits
+static constexpr uint16_t FORMAT_TRAIT_DEPTH = 1 << 0;
+static constexpr uint16_t FORMAT_TRAIT_STENCIL = 1 << 1;
+static constexpr uint16_t FORMAT_TRAIT_PACKED = 1 << 2;
+static constexpr uint16_t FORMAT_TRAIT_YCBCR_CONVERSION = 1 << 3;
+static constexpr uint16_t FORMAT_TRAIT_X_CHROMA_SUBSAMPLED = 1 << 4;
+static constexpr uint16_t FORMAT_TRAIT_Y_CHROMA_SUBSAMPLED = 1 << 5;
+static constexpr uint16_t FORMAT_TRAIT_SINGLE_PLANE_422 = 1 << 6;
+
 // Generic information for all formats
+// Everything known about a format is packed in a single small record so each query is one table lookup
 struct FORMAT_INFO {
+    uint16_t traits; // FORMAT_TRAIT_*
     FORMAT_COMPATIBILITY_CLASS compatibility;
-    uint32_t block_size; // bytes
-    uint32_t texel_per_block;
-    VkExtent3D block_extent;
-    uint32_t component_count;
+    FORMAT_NUMERICAL_TYPE numeric; // NONE if the components don't share one numeric type
+    COMPRESSED_TYPE compressed;
+    uint8_t block_size; // bytes
+    uint8_t texel_per_block;
+    uint8_t block_extent[3];
+    uint8_t component_count;
+    uint8_t plane_count;
+    uint8_t multiplane_index; // into kVkMultiplaneCompatibility
     COMPONENT_INFO components[FORMAT_MAX_COMPONENTS];
 };
 
-namespace std {
-template <>
-struct hash<VkFormat> {
-    size_t operator()(VkFormat fmt) const noexcept {
-        return hash<uint32_t>()(static_cast<uint32_t>(fmt));
-    }
-};
-}
-
-// clang-format off
-static const layer_data::unordered_map<VkFormat, FORMAT_INFO> kVkFormatTable = {
-'''
-            for f, info in sorted(self.allFormats.items()):
-                output += '    {{{},\n'.format(f)
-                output += '        {{FORMAT_COMPATIBILITY_CLASS::{}, {}, {}, {{{}}}, {},\n        {{'.format(
-                    info['class'], info['blockSize'], info['texelsPerBlock'], info['blockExtent'].replace(',', ', '), len(info['components']))
-                for index, component in enumerate(info['components']):
-                    output += '{{COMPONENT_TYPE::{}, {}}}'.format(component['type'], component['bits'])
-                    output += ', ' if (index + 1 != len(info['components'])) else ''
-                output += '} }},\n'
-
-            output += '    {VK_FORMAT_UNDEFINED, {FORMAT_COMPATIBILITY_CLASS::NONE, 0, 0, {0, 0, 0}, 0, {}}}'
-            output += '};\n'
-            output += '// clang-format on\n'
-
-            output += '''
 struct PER_PLANE_COMPATIBILITY {
     uint32_t width_divisor;
     uint32_t height_divisor;
@@ -345,8 +329,8 @@ struct PER_PLANE_COMPATIBILITY {
     // Need default otherwise if app tries to grab a plane that doesn't exist it will crash
     // if returned the value of 0 in IMAGE_STATE::GetSubresourceExtent()
     // This is ok, because there are VUs later that will catch the bad app behaviour
-    PER_PLANE_COMPATIBILITY() : width_divisor(1), height_divisor(1), compatible_format(VK_FORMAT_UNDEFINED) {}
-    PER_PLANE_COMPATIBILITY(uint32_t width_divisor, uint32_t height_divisor, VkFormat compatible_format) :
+    constexpr PER_PLANE_COMPATIBILITY() : width_divisor(1), height_divisor(1), compatible_format(VK_FORMAT_UNDEFINED) {}
+    constexpr PER_PLANE_COMPATIBILITY(uint32_t width_divisor, uint32_t height_divisor, VkFormat compatible_format) :
         width_divisor(width_divisor), height_divisor(height_divisor), compatible_format(compatible_format) {}
 };
 
@@ -356,25 +340,126 @@ struct MULTIPLANE_COMPATIBILITY {
 };
 
 // Source: Vulkan spec Table 47. Plane Format Compatibility Table
+// The first entry is used by all formats that are not multiplanar
 // clang-format off
-static const layer_data::unordered_map<VkFormat, MULTIPLANE_COMPATIBILITY> kVkMultiplaneCompatibilityMap {
+static constexpr MULTIPLANE_COMPATIBILITY kVkMultiplaneCompatibility[] = {
+    {{}},
 '''
-
-            for f in sorted(self.planarFormats.keys()):
-                output += '    {{ {}, {{{{\n'.format(f)
-                for index, plane in enumerate(self.planarFormats[f]):
-                    if (index != plane['index']):
+            multiplaneIndex = dict()
+            for index, f in enumerate(sorted(self.planarFormats.keys()), start=1):
+                multiplaneIndex[f] = index
+                output += '    // {}\n'.format(f)
+                output += '    {{\n'
+                for plane_index, plane in enumerate(self.planarFormats[f]):
+                    if (plane_index != plane['index']):
                         self.logMsg('error', 'index of planes were not added in order')
                     output += '        {{ {}, {}, {} }}'.format(plane['widthDivisor'], plane['heightDivisor'], plane['compatible'])
-                    output += ',\n' if (index + 1 != len(self.planarFormats[f])) else '\n    }}},\n'
+                    output += ',\n' if (plane_index + 1 != len(self.planarFormats[f])) else '\n    }},\n'
             output += '};\n'
             output += '// clang-format on\n'
 
+            # VkFormat values are not contiguous, the core formats start at zero and each extension adds its formats in its own
+            # block of enum values. The table is split in segments of contiguous values and holes are filled with unknown records.
+            formatValues = {0 : 'VK_FORMAT_UNDEFINED'}
+            for f in self.allFormats.keys():
+                formatValues[self.enumToValue(self.registry.enumdict[f].elem, True)[0]] = f
+            segments = []
+            for value in sorted(formatValues.keys()):
+                if segments and (value // 1000 == segments[-1][0] // 1000):
+                    segments[-1].extend(range(segments[-1][-1] + 1, value + 1))
+                else:
+                    segments.append([value])
+
+            unknownRecord = '{0, FORMAT_COMPATIBILITY_CLASS::NONE, FORMAT_NUMERICAL_TYPE::NONE, COMPRESSED_TYPE::NONE, 0, 0, {1, 1, 1}, 0, 1, 0, {}}'
+            output += '''
+// clang-format off
+static constexpr FORMAT_INFO kVkFormatTable[] = {
+'''
+            tableSize = 0
+            for segment in segments:
+                for value in segment:
+                    tableSize += 1
+                    if value not in formatValues:
+                        output += '    // <unused>\n'
+                        output += '    {},\n'.format(unknownRecord)
+                        continue
+                    f = formatValues[value]
+                    output += '    // {}\n'.format(f)
+                    if f == 'VK_FORMAT_UNDEFINED':
+                        output += '    {0, FORMAT_COMPATIBILITY_CLASS::NONE, FORMAT_NUMERICAL_TYPE::NONE, COMPRESSED_TYPE::NONE, 0, 0, {0, 0, 0}, 0, 1, 0, {}},\n'
+                        continue
+                    info = self.allFormats[f]
+                    traits = []
+                    if f in self.depthFormats:
+                        traits.append('FORMAT_TRAIT_DEPTH')
+                    if f in self.stencilFormats:
+                        traits.append('FORMAT_TRAIT_STENCIL')
+                    if f in self.packedFormats:
+                        traits.append('FORMAT_TRAIT_PACKED')
+                    if f in self.ycbcrFormats:
+                        traits.append('FORMAT_TRAIT_YCBCR_CONVERSION')
+                        if self.ycbcrFormats[f] == '420' or self.ycbcrFormats[f] == '422':
+                            traits.append('FORMAT_TRAIT_X_CHROMA_SUBSAMPLED')
+                        if self.ycbcrFormats[f] == '420':
+                            traits.append('FORMAT_TRAIT_Y_CHROMA_SUBSAMPLED')
+                        if self.ycbcrFormats[f] == '422' and f not in self.planarFormats:
+                            traits.append('FORMAT_TRAIT_SINGLE_PLANE_422')
+                    numeric = 'NONE'
+                    for key, formats in self.numericFormats.items():
+                        if f in formats:
+                            numeric = key
+                    compressed = 'NONE'
+                    for key, formats in self.compressedFormats.items():
+                        if f in formats:
+                            compressed = key
+                    planeCount = len(self.planarFormats[f]) if f in self.planarFormats else 1
+                    output += '    {{{}, FORMAT_COMPATIBILITY_CLASS::{}, FORMAT_NUMERICAL_TYPE::{}, COMPRESSED_TYPE::{}, {}, {}, {{{}}}, {}, {}, {},\n        {{'.format(
+                        ' | '.join(traits) if traits else '0', info['class'], numeric, compressed, info['blockSize'], info['texelsPerBlock'],
+                        info['blockExtent'].replace(',', ', '), len(info['components']), planeCount, multiplaneIndex.get(f, 0))
+                    for index, component in enumerate(info['components']):
+                        output += '{{COMPONENT_TYPE::{}, {}}}'.format(component['type'], component['bits'])
+                        output += ', ' if (index + 1 != len(info['components'])) else ''
+                    output += '}},\n'
+            output += '    // Any value that is not a known format\n'
+            output += '    {}\n'.format(unknownRecord)
+            output += '};\n'
+            output += '// clang-format on\n'
+            output += 'static constexpr uint32_t kUnknownFormatIndex = {};\n'.format(tableSize)
+
+            output += '''
+struct FORMAT_SEGMENT {
+    uint32_t first_value;
+    uint32_t count;
+    uint32_t table_index;
+};
+
+// Contiguous ranges of VkFormat values in kVkFormatTable, with the core formats first
+static constexpr FORMAT_SEGMENT kVkFormatSegments[] = {
+'''
+            tableIndex = 0
+            for segment in segments:
+                output += '    {{{}, {}, {}}},\n'.format(formatValues[segment[0]], len(segment), tableIndex)
+                tableIndex += len(segment)
+            output += '''};
+
+static const FORMAT_INFO &GetFormatInfo(VkFormat format) {
+    const uint32_t value = static_cast<uint32_t>(format);
+    for (const FORMAT_SEGMENT &segment : kVkFormatSegments) {
+        // Values below the start of the segment wrap around and fail the range check
+        const uint32_t offset = value - segment.first_value;
+        if (offset < segment.count) {
+            return kVkFormatTable[segment.table_index + offset];
+        }
+    }
+    return kVkFormatTable[kUnknownFormatIndex];
+}
+'''
+
         elif self.headerFile:
             output += 'static constexpr uint32_t FORMAT_MAX_PLANES = {};\n'.format(self.maxPlaneCount)
             output += 'static constexpr uint32_t FORMAT_MAX_COMPONENTS = {};\n'.format(self.maxComponentCount)
             output += '\n'
-            output += 'enum class FORMAT_NUMERICAL_TYPE {\n'
+            output += 'enum class FORMAT_NUMERICAL_TYPE : uint8_t {\n'
             output += '    NONE = 0,\n'
             for index, numericFormat in enumerate(sorted(self.numericFormats.keys()), start=1):
                 output += '    {}'.format(numericFormat)
@@ -382,7 +467,7 @@ static const layer_data::unordered_map<VkFormat, MULTIPLANE_COMPATIBILITY> kVkMu
             output += '};\n'
             output += '\n'
             count = 0
-            output += 'enum class FORMAT_COMPATIBILITY_CLASS {\n'
+            output += 'enum class FORMAT_COMPATIBILITY_CLASS : uint8_t {\n'
             output += '    NONE = 0,\n'
             for name, classBit in sorted(self.classes.items()):
                 count += 1
@@ -414,11 +499,8 @@ static inline bool FormatIsSampledFloat(VkFormat format) {
             for key in self.numericFormats.keys():
                 output += '\n// Return true if all components in the format are an {}\n'.format(key)
                 output += 'bool FormatIs{}(VkFormat format) {{\n'.format(key)
-                output += '    bool found = false;\n'
-                output += '    switch (format) {\n'
-                for f in self.numericFormats[key]:
-                    output += '        case {}:\n'.format(f)
-                output += self.commonBoolSwitch
+                output += '    return GetFormatInfo(format).numeric == FORMAT_NUMERICAL_TYPE::{};\n'.format(key)
+                output += '}\n'
 
         return output;
     #
@@ -435,18 +517,12 @@ static inline bool FormatIsSampledFloat(VkFormat format) {
             for key in sorted(self.compressedFormats.keys()):
                 output += '\n// Return true if the format is a {} compressed image format\n'.format(key)
                 output += 'bool FormatIsCompressed_{}(VkFormat format) {{\n'.format(key)
-                output += '    bool found = false;\n'
-                output += '    switch (format) {\n'
-                for f in sorted(self.compressedFormats[key]):
-                    output += '        case {}:\n'.format(f)
-                output += self.commonBoolSwitch
+                output += '    return GetFormatInfo(format).compressed == COMPRESSED_TYPE::{};\n'.format(key)
+                output += '}\n'
 
             output += '\n// Return true if the format is any compressed image format\n'
             output += 'bool FormatIsCompressed(VkFormat format) {\n'
-            output += '    return (\n'
-            for index, key in enumerate(sorted(self.compressedFormats.keys()), start=1):
-                output += '      FormatIsCompressed_{}(format)'.format(key)
-                output += ' ||\n' if (index != len(self.compressedFormats.keys())) else ');\n'
+            output += '    return GetFormatInfo(format).compressed != COMPRESSED_TYPE::NONE;\n'
             output += '}\n'
 
         return output;
@@ -468,41 +544,27 @@ VK_LAYER_EXPORT FORMAT_NUMERICAL_TYPE FormatDepthNumericalType(VkFormat format);
 VK_LAYER_EXPORT FORMAT_NUMERICAL_TYPE FormatStencilNumericalType(VkFormat format);
 '''
         elif self.sourceFile:
-            output += '\n// Return true if format is a depth OR stencil format\n'
-            output += 'bool FormatIsDepthOrStencil(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.allFormats.keys()):
-                if f in self.depthFormats.keys() or f in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a depth AND stencil format\n'
-            output += 'bool FormatIsDepthAndStencil(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.depthFormats.keys()):
-                if f in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a depth ONLY format\n'
-            output += 'bool FormatIsDepthOnly(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.depthFormats.keys()):
-                if f not in self.stencilFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
-
-            output += '\n// Return true if format is a stencil ONLY format\n'
-            output += 'bool FormatIsStencilOnly(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.stencilFormats.keys()):
-                if f not in self.depthFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '''
+// Return true if format is a depth OR stencil format
+bool FormatIsDepthOrStencil(VkFormat format) {
+    return (GetFormatInfo(format).traits & (FORMAT_TRAIT_DEPTH | FORMAT_TRAIT_STENCIL)) != 0;
+}
+
+// Return true if format is a depth AND stencil format
+bool FormatIsDepthAndStencil(VkFormat format) {
+    return (GetFormatInfo(format).traits & (FORMAT_TRAIT_DEPTH | FORMAT_TRAIT_STENCIL)) == (FORMAT_TRAIT_DEPTH | FORMAT_TRAIT_STENCIL);
+}
+
+// Return true if format is a depth ONLY format
+bool FormatIsDepthOnly(VkFormat format) {
+    return (GetFormatInfo(format).traits & (FORMAT_TRAIT_DEPTH | FORMAT_TRAIT_STENCIL)) == FORMAT_TRAIT_DEPTH;
+}
+
+// Return true if format is a stencil ONLY format
+bool FormatIsStencilOnly(VkFormat format) {
+    return (GetFormatInfo(format).traits & (FORMAT_TRAIT_DEPTH | FORMAT_TRAIT_STENCIL)) == FORMAT_TRAIT_STENCIL;
+}
+'''
 
             output += '\n// Returns size of depth component in bits'
             output += '\n// Returns zero if no depth component\n'
@@ -586,11 +648,8 @@ VK_LAYER_EXPORT bool FormatIsPacked(VkFormat format);
         elif self.sourceFile:
             output += '\n// Return true if format is a packed format\n'
             output += 'bool FormatIsPacked(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in self.packedFormats:
-                output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '    return (GetFormatInfo(format).traits & FORMAT_TRAIT_PACKED) != 0;\n'
+            output += '}\n'
 
         return output;
     #
@@ -607,28 +666,18 @@ VK_LAYER_EXPORT bool FormatIsYChromaSubsampled(VkFormat format);
             output += '\n// Return true if format requires sampler YCBCR conversion\n'
             output += '// for VK_IMAGE_ASPECT_COLOR_BIT image views\n'
             output += '// Table found in spec\n'
-            output += 'bool FormatRequiresYcbcrConversion(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '''bool FormatRequiresYcbcrConversion(VkFormat format) {
+    return (GetFormatInfo(format).traits & FORMAT_TRAIT_YCBCR_CONVERSION) != 0;
+}
 
-            output += '\nbool FormatIsXChromaSubsampled(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '420' or self.ycbcrFormats[f] == '422':
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+bool FormatIsXChromaSubsampled(VkFormat format) {
+    return (GetFormatInfo(format).traits & FORMAT_TRAIT_X_CHROMA_SUBSAMPLED) != 0;
+}
 
-            output += '\nbool FormatIsYChromaSubsampled(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '420':
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+bool FormatIsYChromaSubsampled(VkFormat format) {
+    return (GetFormatInfo(format).traits & FORMAT_TRAIT_Y_CHROMA_SUBSAMPLED) != 0;
+}
+'''
 
         return output;
     #
@@ -645,50 +694,38 @@ VK_LAYER_EXPORT VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImage
 '''
         elif self.sourceFile:
             output += '\n// Single-plane "_422" formats are treated as 2x1 compressed (for copies)\n'
-            output += '\nbool FormatIsSinglePlane_422(VkFormat format) {\n'
-            output += '    bool found = false;\n'
-            output += '    switch (format) {\n'
-            for f in sorted(self.ycbcrFormats.keys()):
-                if self.ycbcrFormats[f] == '422' and f not in self.planarFormats.keys():
-                    output += '        case {}:\n'.format(f)
-            output += self.commonBoolSwitch
+            output += '''
+bool FormatIsSinglePlane_422(VkFormat format) {
+    return (GetFormatInfo(format).traits & FORMAT_TRAIT_SINGLE_PLANE_422) != 0;
+}
 
-            output += '\n// Returns number of planes in format (which is 1 by default)\n'
-            output += 'uint32_t FormatPlaneCount(VkFormat format) {\n'
-            output += '    switch (format) {\n'
-            for i in range(2, self.maxPlaneCount + 1):
-                for f in sorted(self.planarFormats.keys()):
-                    if len(self.planarFormats[f]) == i:
-                        output += '        case {}:\n'.format(f)
-                output += '            return {};\n'.format(i)
-            output += '        default:\n'
-            output += '            return 1;\n'
-            output += '     }\n'
-            output += '}\n'
+// Returns number of planes in format (which is 1 by default)
+uint32_t FormatPlaneCount(VkFormat format) {
+    return GetFormatInfo(format).plane_count;
+}
 
-            output += '''
 // Will return VK_FORMAT_UNDEFINED if given a plane aspect that doesn't exist for the format
 VkFormat FindMultiplaneCompatibleFormat(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    if (plane_idx >= FORMAT_MAX_PLANES) {
         return VK_FORMAT_UNDEFINED;
     }
 
-    return it->second.per_plane[plane_idx].compatible_format;
+    const MULTIPLANE_COMPATIBILITY &compatibility = kVkMultiplaneCompatibility[GetFormatInfo(mp_fmt).multiplane_index];
+    return compatibility.per_plane[plane_idx].compatible_format;
 }
 
 // Will return {1, 1} if given a plane aspect that doesn't exist for the format
 VkExtent2D FindMultiplaneExtentDivisors(VkFormat mp_fmt, VkImageAspectFlags plane_aspect) {
     VkExtent2D divisors = {1, 1};
     const uint32_t plane_idx = GetPlaneIndex(plane_aspect);
-    auto it = kVkMultiplaneCompatibilityMap.find(mp_fmt);
-    if ((it == kVkMultiplaneCompatibilityMap.end()) || (plane_idx >= FORMAT_MAX_PLANES)) {
+    if (plane_idx >= FORMAT_MAX_PLANES) {
         return divisors;
     }
 
-    divisors.width = it->second.per_plane[plane_idx].width_divisor;
-    divisors.height = it->second.per_plane[plane_idx].height_divisor;
+    const MULTIPLANE_COMPATIBILITY &compatibility = kVkMultiplaneCompatibility[GetFormatInfo(mp_fmt).multiplane_index];
+    divisors.width = compatibility.per_plane[plane_idx].width_divisor;
+    divisors.height = compatibility.per_plane[plane_idx].height_divisor;
     return divisors;
 }
 '''
@@ -715,36 +752,23 @@ VK_LAYER_EXPORT bool FormatHasAlpha(VkFormat format);
         elif self.sourceFile:
             output += '''
 uint32_t FormatComponentCount(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.component_count;
-    }
-    return 0;
+    return GetFormatInfo(format).component_count;
 }
 
 VkExtent3D FormatTexelBlockExtent(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.block_extent;
-    }
-    return {1, 1, 1};
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    return {info.block_extent[0], info.block_extent[1], info.block_extent[2]};
 }
 
 FORMAT_COMPATIBILITY_CLASS FormatCompatibilityClass(VkFormat format) {
-    auto format_info = kVkFormatTable.find(format);
-    if (format_info != kVkFormatTable.end()) {
-        return format_info->second.compatibility;
-    }
-    return FORMAT_COMPATIBILITY_CLASS::NONE;
+    return GetFormatInfo(format).compatibility;
 }
 
 // Return true if format is 'normal', with one texel per format element
 bool FormatElementIsTexel(VkFormat format) {
-    if (FormatIsPacked(format) || FormatIsCompressed(format) || FormatIsSinglePlane_422(format) || FormatIsMultiplane(format)) {
-        return false;
-    } else {
-        return true;
-    }
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    const uint16_t not_texel_traits = FORMAT_TRAIT_PACKED | FORMAT_TRAIT_SINGLE_PLANE_422;
+    return ((info.traits & not_texel_traits) == 0) && (info.compressed == COMPRESSED_TYPE::NONE) && (info.plane_count == 1);
 }
 
 // Return size, in bytes, of one element of the specified format
@@ -761,11 +785,7 @@ uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags aspectMask) {
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = kVkFormatTable.find(format);
-    if (item != kVkFormatTable.end()) {
-        return item->second.block_size;
-    }
-    return 0;
+    return GetFormatInfo(format).block_size;
 }
 
 // Return the size in bytes of one texel of given foramt
@@ -781,12 +801,9 @@ double FormatTexelSize(VkFormat format, VkImageAspectFlags aspectMask) {
 }
 
 static bool FormatHasComponent(VkFormat format, COMPONENT_TYPE component) {
-    auto item = kVkFormatTable.find(format);
-    if (item == kVkFormatTable.end()) {
-        return false;
-    }
-    const COMPONENT_INFO* begin = item->second.components;
-    const COMPONENT_INFO* end = item->second.components + FORMAT_MAX_COMPONENTS;
+    const FORMAT_INFO &info = GetFormatInfo(format);
+    const COMPONENT_INFO* begin = info.components;
+    const COMPONENT_INFO* end = info.components + FORMAT_MAX_COMPONENTS;
     return std::find_if(begin, end, [component](const COMPONENT_INFO& info) { return info.type == component; }) != end;
 }
 
@@ -32,10 +32,11 @@ def main():
     args = parser.parse_args()
 
     try:
-        common_ci.BuildVVL(args, True)
+        common_ci.BuildVVL(args, True, args.benchmark_out is not None)
         common_ci.BuildLoader(args)
         common_ci.BuildMockICD(args)
         common_ci.RunVVLTests(args)
+        if args.benchmark_out: common_ci.RunVVLBenchmarks(args)
         common_ci.CheckVVLCodegenConsistency()
 
     except subprocess.CalledProcessError as proc_error:
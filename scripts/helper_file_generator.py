@@ -679,11 +679,86 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         safe_struct_helper_header += '#pragma once\n'
         safe_struct_helper_header += '#include <vulkan/vulkan.h>\n'
         safe_struct_helper_header += '#include <stdlib.h>\n'
+        safe_struct_helper_header += '#include <cstddef>\n'
+        safe_struct_helper_header += '#include <new>\n'
         safe_struct_helper_header += '\n'
         safe_struct_helper_header += 'void *SafePnextCopy(const void *pNext);\n'
         safe_struct_helper_header += 'void FreePnextChain(const void *pNext);\n'
         safe_struct_helper_header += 'char *SafeStringCopy(const char *in_string);\n'
         safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '// Safe struct deep copies allocate with new (kSafeStructAlloc) so that a SafeStructArena can take over their memory.\n'
+        safe_struct_helper_header += '// With no arena bound to the calling thread the global heap is used, and the result is released with a plain delete.\n'
+        safe_struct_helper_header += 'struct SafeStructAllocTag {};\n'
+        safe_struct_helper_header += 'constexpr SafeStructAllocTag kSafeStructAlloc{};\n'
+        safe_struct_helper_header += 'void *operator new(std::size_t size, const SafeStructAllocTag &);\n'
+        safe_struct_helper_header += 'void *operator new[](std::size_t size, const SafeStructAllocTag &);\n'
+        safe_struct_helper_header += 'void operator delete(void *ptr, const SafeStructAllocTag &) noexcept;\n'
+        safe_struct_helper_header += 'void operator delete[](void *ptr, const SafeStructAllocTag &) noexcept;\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '// Backing store for a frozen safe struct, a deep copy whose arrays, strings, nested structs and pNext chain are all\n'
+        safe_struct_helper_header += '// laid out in one allocation. Freeze() runs the copy twice: once into per-thread scratch memory to measure it, and once\n'
+        safe_struct_helper_header += '// into a block of exactly that size. A frozen struct is immutable. It must not be assigned or re-initialized, and its\n'
+        safe_struct_helper_header += '// destructor must not run, since the arena releases all of its memory at once.\n'
+        safe_struct_helper_header += 'class SafeStructArena {\n'
+        safe_struct_helper_header += '  public:\n'
+        safe_struct_helper_header += '    SafeStructArena() = default;\n'
+        safe_struct_helper_header += '    SafeStructArena(const SafeStructArena &) = delete;\n'
+        safe_struct_helper_header += '    SafeStructArena &operator=(const SafeStructArena &) = delete;\n'
+        safe_struct_helper_header += '    ~SafeStructArena() { ::operator delete(block_); }\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '    // Constructs a T from args in place at dst\n'
+        safe_struct_helper_header += '    template <typename T, typename... Args>\n'
+        safe_struct_helper_header += '    void Freeze(T *dst, const Args &... args) {\n'
+        safe_struct_helper_header += '        BeginMeasure();\n'
+        safe_struct_helper_header += '        new (static_cast<void *>(dst)) T(args...);\n'
+        safe_struct_helper_header += '        BeginCopy();\n'
+        safe_struct_helper_header += '        new (static_cast<void *>(dst)) T(args...);\n'
+        safe_struct_helper_header += '        End();\n'
+        safe_struct_helper_header += '    }\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '    std::size_t Size() const { return size_; }\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '    // Returns nullptr if no arena is bound to the calling thread\n'
+        safe_struct_helper_header += '    static void *Allocate(std::size_t size);\n'
+        safe_struct_helper_header += '    static bool Bound();\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '  private:\n'
+        safe_struct_helper_header += '    void BeginMeasure();\n'
+        safe_struct_helper_header += '    void BeginCopy();\n'
+        safe_struct_helper_header += '    void End();\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '    unsigned char *block_ = nullptr;\n'
+        safe_struct_helper_header += '    std::size_t size_ = 0;\n'
+        safe_struct_helper_header += '    std::size_t used_ = 0;\n'
+        safe_struct_helper_header += '    SafeStructArena *prev_ = nullptr;\n'
+        safe_struct_helper_header += '    bool measuring_ = false;\n'
+        safe_struct_helper_header += '    bool frozen_ = false;\n'
+        safe_struct_helper_header += '};\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '// A safe struct held as a frozen copy, see SafeStructArena\n'
+        safe_struct_helper_header += 'template <typename T>\n'
+        safe_struct_helper_header += 'class FrozenSafeStruct {\n'
+        safe_struct_helper_header += '  public:\n'
+        safe_struct_helper_header += '    template <typename... Args>\n'
+        safe_struct_helper_header += '    explicit FrozenSafeStruct(const Args &... args) {\n'
+        safe_struct_helper_header += '        arena_.Freeze(&storage_.value, args...);\n'
+        safe_struct_helper_header += '    }\n'
+        safe_struct_helper_header += '    FrozenSafeStruct(const FrozenSafeStruct &) = delete;\n'
+        safe_struct_helper_header += '    FrozenSafeStruct &operator=(const FrozenSafeStruct &) = delete;\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '    const T &get() const { return storage_.value; }\n'
+        safe_struct_helper_header += '\n'
+        safe_struct_helper_header += '  private:\n'
+        safe_struct_helper_header += '    // The union keeps the destructor of value from running, its memory belongs to arena_\n'
+        safe_struct_helper_header += '    union Storage {\n'
+        safe_struct_helper_header += '        Storage() {}\n'
+        safe_struct_helper_header += '        ~Storage() {}\n'
+        safe_struct_helper_header += '        T value;\n'
+        safe_struct_helper_header += '    };\n'
+        safe_struct_helper_header += '    SafeStructArena arena_;\n'
+        safe_struct_helper_header += '    Storage storage_;\n'
+        safe_struct_helper_header += '};\n'
+        safe_struct_helper_header += '\n'
         safe_struct_helper_header += self.GenerateSafeStructHeader()
         return safe_struct_helper_header
     #
@@ -1291,7 +1366,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         string_copy_proc = '\n\n'
         string_copy_proc += 'char *SafeStringCopy(const char *in_string) {\n'
         string_copy_proc += '    if (nullptr == in_string) return nullptr;\n'
-        string_copy_proc += '    char* dest = new char[std::strlen(in_string) + 1];\n'
+        string_copy_proc += '    char* dest = new (kSafeStructAlloc) char[std::strlen(in_string) + 1];\n'
         string_copy_proc += '    return std::strcpy(dest, in_string);\n'
         string_copy_proc += '}\n'
 
@@ -1306,7 +1381,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         # Add special-case code to copy beloved secret loader structs
         build_pnext_proc += '        // Special-case Loader Instance Struct passed to/from layer in pNext chain\n'
         build_pnext_proc += '        case VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO: {\n'
-        build_pnext_proc += '            VkLayerInstanceCreateInfo *struct_copy = new VkLayerInstanceCreateInfo;\n'
+        build_pnext_proc += '            VkLayerInstanceCreateInfo *struct_copy = new (kSafeStructAlloc) VkLayerInstanceCreateInfo;\n'
         build_pnext_proc += '            // TODO: Uses original VkLayerInstanceLink* chain, which should be okay for our uses\n'
         build_pnext_proc += '            memcpy(struct_copy, pNext, sizeof(VkLayerInstanceCreateInfo));\n'
         build_pnext_proc += '            struct_copy->pNext = SafePnextCopy(header->pNext);\n'
@@ -1315,7 +1390,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         build_pnext_proc += '        }\n'
         build_pnext_proc += '        // Special-case Loader Device Struct passed to/from layer in pNext chain\n'
         build_pnext_proc += '        case VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO: {\n'
-        build_pnext_proc += '            VkLayerDeviceCreateInfo *struct_copy = new VkLayerDeviceCreateInfo;\n'
+        build_pnext_proc += '            VkLayerDeviceCreateInfo *struct_copy = new (kSafeStructAlloc) VkLayerDeviceCreateInfo;\n'
         build_pnext_proc += '            // TODO: Uses original VkLayerDeviceLink*, which should be okay for our uses\n'
         build_pnext_proc += '            memcpy(struct_copy, pNext, sizeof(VkLayerDeviceCreateInfo));\n'
         build_pnext_proc += '            struct_copy->pNext = SafePnextCopy(header->pNext);\n'
@@ -1351,7 +1426,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
             assorted_chain_structs = tuple(s for s in chain_structs if s.ifdef_protect == ifdef)
             for struct in assorted_chain_structs:
                 build_pnext_proc += '        case %s:\n' % self.structTypes[struct.name].value
-                build_pnext_proc += '            safe_pNext = new safe_%s(reinterpret_cast<const %s *>(pNext));\n' % (struct.name, struct.name)
+                build_pnext_proc += '            safe_pNext = new (kSafeStructAlloc) safe_%s(reinterpret_cast<const %s *>(pNext));\n' % (struct.name, struct.name)
                 build_pnext_proc += '            break;\n'
 
                 free_pnext_proc += '        case %s:\n' % self.structTypes[struct.name].value
@@ -1366,7 +1441,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         build_pnext_proc += '            // If sType is in custom list, construct blind copy\n'
         build_pnext_proc += '            for (auto item : custom_stype_info) {\n'
         build_pnext_proc += '                if (item.first == header->sType) {\n'
-        build_pnext_proc += '                    safe_pNext = malloc(item.second);\n'
+        build_pnext_proc += '                    safe_pNext = new (kSafeStructAlloc) uint8_t[item.second];\n'
         build_pnext_proc += '                    memcpy(safe_pNext, header, item.second);\n'
         build_pnext_proc += '                    // Deep copy the rest of the pNext chain\n'
         build_pnext_proc += '                    VkBaseOutStructure *custom_struct = reinterpret_cast<VkBaseOutStructure *>(safe_pNext);\n'
@@ -1391,7 +1466,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         free_pnext_proc += '                    if (header->pNext) {\n'
         free_pnext_proc += '                        FreePnextChain(header->pNext);\n'
         free_pnext_proc += '                    }\n'
-        free_pnext_proc += '                    free(const_cast<void *>(pNext));\n'
+        free_pnext_proc += '                    delete[] reinterpret_cast<const uint8_t *>(pNext);\n'
         free_pnext_proc += '                    pNext = nullptr;\n'
         free_pnext_proc += '                    break;\n'
         free_pnext_proc += '                }\n'
@@ -1426,8 +1501,10 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         safe_struct_helper_source += '#include "vk_layer_utils.h"\n'
         safe_struct_helper_source += '\n'
         safe_struct_helper_source += '#include <string.h>\n'
+        safe_struct_helper_source += '#include <algorithm>\n'
         safe_struct_helper_source += '#include <cassert>\n'
         safe_struct_helper_source += '#include <cstring>\n'
+        safe_struct_helper_source += '#include <memory>\n'
         safe_struct_helper_source += '#include <vector>\n'
         safe_struct_helper_source += '\n'
         safe_struct_helper_source += '#include <vulkan/vk_layer.h>\n'
@@ -1449,6 +1526,110 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
         safe_struct_helper_source += '};\n'
         safe_struct_helper_source += 'vl_concurrent_unordered_map<const safe_VkAccelerationStructureGeometryKHR*, ASGeomKHRExtraData*, 4> as_geom_khr_host_alloc;\n'
         safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'namespace {\n'
+        safe_struct_helper_source += 'constexpr std::size_t kSafeStructAlignment = alignof(std::max_align_t);\n'
+        safe_struct_helper_source += 'constexpr std::size_t kMinScratchChunkSize = 16 * 1024;\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += '// Memory that the measuring pass of SafeStructArena::Freeze() copies into. Chunks are kept and reused, so a thread\n'
+        safe_struct_helper_source += '// only allocates scratch space while the largest struct it has frozen keeps growing.\n'
+        safe_struct_helper_source += 'class SafeStructScratch {\n'
+        safe_struct_helper_source += '  public:\n'
+        safe_struct_helper_source += '    void Reset() {\n'
+        safe_struct_helper_source += '        chunk_ = 0;\n'
+        safe_struct_helper_source += '        offset_ = 0;\n'
+        safe_struct_helper_source += '    }\n'
+        safe_struct_helper_source += '    void *Allocate(std::size_t size) {\n'
+        safe_struct_helper_source += '        while (chunk_ < chunks_.size() && chunks_[chunk_].size - offset_ < size) {\n'
+        safe_struct_helper_source += '            ++chunk_;\n'
+        safe_struct_helper_source += '            offset_ = 0;\n'
+        safe_struct_helper_source += '        }\n'
+        safe_struct_helper_source += '        if (chunk_ == chunks_.size()) {\n'
+        safe_struct_helper_source += '            chunks_.emplace_back(std::max(size, chunks_.empty() ? kMinScratchChunkSize : 2 * chunks_.back().size));\n'
+        safe_struct_helper_source += '        }\n'
+        safe_struct_helper_source += '        void *ptr = chunks_[chunk_].data.get() + offset_;\n'
+        safe_struct_helper_source += '        offset_ += size;\n'
+        safe_struct_helper_source += '        return ptr;\n'
+        safe_struct_helper_source += '    }\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += '  private:\n'
+        safe_struct_helper_source += '    struct Chunk {\n'
+        safe_struct_helper_source += '        explicit Chunk(std::size_t bytes) : data(new unsigned char[bytes]), size(bytes) {}\n'
+        safe_struct_helper_source += '        std::unique_ptr<unsigned char[]> data;\n'
+        safe_struct_helper_source += '        std::size_t size;\n'
+        safe_struct_helper_source += '    };\n'
+        safe_struct_helper_source += '    std::vector<Chunk> chunks_;\n'
+        safe_struct_helper_source += '    std::size_t chunk_ = 0;\n'
+        safe_struct_helper_source += '    std::size_t offset_ = 0;\n'
+        safe_struct_helper_source += '};\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'thread_local SafeStructScratch safe_struct_scratch;\n'
+        safe_struct_helper_source += 'thread_local SafeStructArena *bound_safe_struct_arena = nullptr;\n'
+        safe_struct_helper_source += '}  // namespace\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void SafeStructArena::BeginMeasure() {\n'
+        safe_struct_helper_source += '    assert(!frozen_ && !block_);\n'
+        safe_struct_helper_source += '    prev_ = bound_safe_struct_arena;\n'
+        safe_struct_helper_source += '    bound_safe_struct_arena = this;\n'
+        safe_struct_helper_source += '    measuring_ = true;\n'
+        safe_struct_helper_source += '    size_ = 0;\n'
+        safe_struct_helper_source += '    safe_struct_scratch.Reset();\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void SafeStructArena::BeginCopy() {\n'
+        safe_struct_helper_source += '    measuring_ = false;\n'
+        safe_struct_helper_source += '    used_ = 0;\n'
+        safe_struct_helper_source += '    if (size_) {\n'
+        safe_struct_helper_source += '        block_ = static_cast<unsigned char *>(::operator new(size_));\n'
+        safe_struct_helper_source += '    }\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void SafeStructArena::End() {\n'
+        safe_struct_helper_source += '    assert(used_ == size_);\n'
+        safe_struct_helper_source += '    bound_safe_struct_arena = prev_;\n'
+        safe_struct_helper_source += '    prev_ = nullptr;\n'
+        safe_struct_helper_source += '    frozen_ = true;\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'bool SafeStructArena::Bound() { return bound_safe_struct_arena != nullptr; }\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void *SafeStructArena::Allocate(std::size_t size) {\n'
+        safe_struct_helper_source += '    SafeStructArena *arena = bound_safe_struct_arena;\n'
+        safe_struct_helper_source += '    if (!arena) return nullptr;\n'
+        safe_struct_helper_source += '    // Zero sized requests still need a distinct address\n'
+        safe_struct_helper_source += '    size = (std::max<std::size_t>(size, 1) + kSafeStructAlignment - 1) & ~(kSafeStructAlignment - 1);\n'
+        safe_struct_helper_source += '    if (arena->measuring_) {\n'
+        safe_struct_helper_source += '        arena->size_ += size;\n'
+        safe_struct_helper_source += '        return safe_struct_scratch.Allocate(size);\n'
+        safe_struct_helper_source += '    }\n'
+        safe_struct_helper_source += '    if (arena->used_ + size > arena->size_) {\n'
+        safe_struct_helper_source += '        // The copy did not repeat the allocations seen while measuring, use the heap rather than overrun the block\n'
+        safe_struct_helper_source += '        assert(false);\n'
+        safe_struct_helper_source += '        return nullptr;\n'
+        safe_struct_helper_source += '    }\n'
+        safe_struct_helper_source += '    void *ptr = arena->block_ + arena->used_;\n'
+        safe_struct_helper_source += '    arena->used_ += size;\n'
+        safe_struct_helper_source += '    return ptr;\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void *operator new(std::size_t size, const SafeStructAllocTag &) {\n'
+        safe_struct_helper_source += '    void *ptr = SafeStructArena::Allocate(size);\n'
+        safe_struct_helper_source += '    return ptr ? ptr : ::operator new(size);\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void *operator new[](std::size_t size, const SafeStructAllocTag &) {\n'
+        safe_struct_helper_source += '    void *ptr = SafeStructArena::Allocate(size);\n'
+        safe_struct_helper_source += '    return ptr ? ptr : ::operator new[](size);\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += '// Only used when a constructor throws, arena memory is released with the arena\n'
+        safe_struct_helper_source += 'void operator delete(void *ptr, const SafeStructAllocTag &) noexcept {\n'
+        safe_struct_helper_source += '    if (!SafeStructArena::Bound()) ::operator delete(ptr);\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
+        safe_struct_helper_source += 'void operator delete[](void *ptr, const SafeStructAllocTag &) noexcept {\n'
+        safe_struct_helper_source += '    if (!SafeStructArena::Bound()) ::operator delete[](ptr);\n'
+        safe_struct_helper_source += '}\n'
+        safe_struct_helper_source += '\n'
         safe_struct_helper_source += self.GenerateSafeStructSource()
         safe_struct_helper_source += self.build_safe_struct_utility_funcs()
 
@@ -1515,7 +1696,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:\n'
                     '        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:\n'
                     '        if (descriptorCount && in_struct->pImageInfo) {\n'
-                    '            pImageInfo = new VkDescriptorImageInfo[descriptorCount];\n'
+                    '            pImageInfo = new (kSafeStructAlloc) VkDescriptorImageInfo[descriptorCount];\n'
                     '            for (uint32_t i = 0; i < descriptorCount; ++i) {\n'
                     '                pImageInfo[i] = in_struct->pImageInfo[i];\n'
                     '            }\n'
@@ -1526,7 +1707,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:\n'
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:\n'
                     '        if (descriptorCount && in_struct->pBufferInfo) {\n'
-                    '            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];\n'
+                    '            pBufferInfo = new (kSafeStructAlloc) VkDescriptorBufferInfo[descriptorCount];\n'
                     '            for (uint32_t i = 0; i < descriptorCount; ++i) {\n'
                     '                pBufferInfo[i] = in_struct->pBufferInfo[i];\n'
                     '            }\n'
@@ -1535,7 +1716,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:\n'
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:\n'
                     '        if (descriptorCount && in_struct->pTexelBufferView) {\n'
-                    '            pTexelBufferView = new VkBufferView[descriptorCount];\n'
+                    '            pTexelBufferView = new (kSafeStructAlloc) VkBufferView[descriptorCount];\n'
                     '            for (uint32_t i = 0; i < descriptorCount; ++i) {\n'
                     '                pTexelBufferView[i] = in_struct->pTexelBufferView[i];\n'
                     '            }\n'
@@ -1546,24 +1727,24 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '    }\n',
                 'VkShaderModuleCreateInfo' :
                     '    if (in_struct->pCode) {\n'
-                    '        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);\n'
+                    '        pCode = reinterpret_cast<uint32_t *>(new (kSafeStructAlloc) uint8_t[codeSize]);\n'
                     '        memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);\n'
                     '    }\n',
                 # VkGraphicsPipelineCreateInfo is special case because its pointers may be non-null but ignored
                 'VkGraphicsPipelineCreateInfo' :
                     '    bool is_graphics_library = LvlFindInChain<VkGraphicsPipelineLibraryCreateInfoEXT>(in_struct->pNext) != nullptr;\n'
                     '    if (stageCount && in_struct->pStages) {\n'
-                    '        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
+                    '        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
                     '        for (uint32_t i = 0; i < stageCount; ++i) {\n'
                     '            pStages[i].initialize(&in_struct->pStages[i]);\n'
                     '        }\n'
                     '    }\n'
                     '    if (in_struct->pVertexInputState)\n'
-                    '        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);\n'
+                    '        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);\n'
                     '    else\n'
                     '        pVertexInputState = NULL;\n'
                     '    if (in_struct->pInputAssemblyState)\n'
-                    '        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);\n'
+                    '        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);\n'
                     '    else\n'
                     '        pInputAssemblyState = NULL;\n'
                     '    bool has_tessellation_stage = false;\n'
@@ -1572,7 +1753,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '            if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)\n'
                     '                has_tessellation_stage = true;\n'
                     '    if (in_struct->pTessellationState && has_tessellation_stage)\n'
-                    '        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);\n'
+                    '        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);\n'
                     '    else\n'
                     '        pTessellationState = NULL; // original pTessellationState pointer ignored\n'
                     '    bool is_dynamic_has_rasterization = false;\n'
@@ -1593,41 +1774,41 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '                if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)\n'
                     '                    is_dynamic_scissors = true;\n'
                     '        }\n'
-                    '        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);\n'
+                    '        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);\n'
                     '    } else\n'
                     '        pViewportState = NULL; // original pViewportState pointer ignored\n'
                     '    if (in_struct->pRasterizationState)\n'
-                    '        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);\n'
+                    '        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);\n'
                     '    else\n'
                     '        pRasterizationState = NULL;\n'
                     '    if (in_struct->pMultisampleState && (renderPass != VK_NULL_HANDLE || has_rasterization || is_graphics_library))\n'
-                    '        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);\n'
+                    '        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);\n'
                     '    else\n'
                     '        pMultisampleState = NULL; // original pMultisampleState pointer ignored\n'
                     '    // needs a tracked subpass state uses_depthstencil_attachment\n'
                     '    if (in_struct->pDepthStencilState && ((has_rasterization && uses_depthstencil_attachment) || is_graphics_library))\n'
-                    '        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);\n'
+                    '        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);\n'
                     '    else\n'
                     '        pDepthStencilState = NULL; // original pDepthStencilState pointer ignored\n'
                     '    // needs a tracked subpass state usesColorAttachment\n'
                     '    if (in_struct->pColorBlendState && ((has_rasterization && uses_color_attachment) || is_graphics_library))\n'
-                    '        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);\n'
+                    '        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);\n'
                     '    else\n'
                     '        pColorBlendState = NULL; // original pColorBlendState pointer ignored\n'
                     '    if (in_struct->pDynamicState)\n'
-                    '        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);\n'
+                    '        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);\n'
                     '    else\n'
                     '        pDynamicState = NULL;\n',
                  # VkPipelineViewportStateCreateInfo is special case because its pointers may be non-null but ignored
                 'VkPipelineViewportStateCreateInfo' :
                     '    if (in_struct->pViewports && !is_dynamic_viewports) {\n'
-                    '        pViewports = new VkViewport[in_struct->viewportCount];\n'
+                    '        pViewports = new (kSafeStructAlloc) VkViewport[in_struct->viewportCount];\n'
                     '        memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);\n'
                     '    }\n'
                     '    else\n'
                     '        pViewports = NULL;\n'
                     '    if (in_struct->pScissors && !is_dynamic_scissors) {\n'
-                    '        pScissors = new VkRect2D[in_struct->scissorCount];\n'
+                    '        pScissors = new (kSafeStructAlloc) VkRect2D[in_struct->scissorCount];\n'
                     '        memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);\n'
                     '    }\n'
                     '    else\n'
@@ -1635,7 +1816,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 # VkFrameBufferCreateInfo is special case because its pAttachments pointer may be non-null but ignored
                 'VkFramebufferCreateInfo' :
                     '    if (attachmentCount && in_struct->pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {\n'
-                    '        pAttachments = new VkImageView[attachmentCount];\n'
+                    '        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];\n'
                     '        for (uint32_t i = 0; i < attachmentCount; ++i) {\n'
                     '            pAttachments[i] = in_struct->pAttachments[i];\n'
                     '        }\n'
@@ -1644,7 +1825,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkDescriptorSetLayoutBinding' :
                     '    const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;\n'
                     '    if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {\n'
-                    '        pImmutableSamplers = new VkSampler[descriptorCount];\n'
+                    '        pImmutableSamplers = new (kSafeStructAlloc) VkSampler[descriptorCount];\n'
                     '        for (uint32_t i = 0; i < descriptorCount; ++i) {\n'
                     '            pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];\n'
                     '        }\n'
@@ -1652,12 +1833,12 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkAccelerationStructureBuildGeometryInfoKHR':
                     '    if (geometryCount) {\n'
                     '        if ( in_struct->ppGeometries) {\n'
-                    '            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];\n'
+                    '            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];\n'
                     '            for (uint32_t i = 0; i < geometryCount; ++i) {\n'
-                    '                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);\n'
+                    '                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(in_struct->ppGeometries[i], is_host, &build_range_infos[i]);\n'
                     '            }\n'
                     '        } else {\n'
-                    '            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];\n'
+                    '            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];\n'
                     '            for (uint32_t i = 0; i < geometryCount; ++i) {\n'
                     '                (pGeometries)[i] = safe_VkAccelerationStructureGeometryKHR(&(in_struct->pGeometries)[i], is_host, &build_range_infos[i]);\n'
                     '            }\n'
@@ -1666,24 +1847,24 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkAccelerationStructureTrianglesOpacityMicromapEXT':
                     '    if (usageCountsCount) {\n'
                     '        if ( in_struct->ppUsageCounts) {\n'
-                    '            ppUsageCounts = new VkMicromapUsageEXT *[usageCountsCount];\n'
+                    '            ppUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT *[usageCountsCount];\n'
                     '            for (uint32_t i = 0; i < usageCountsCount; ++i) {\n'
                     '                memcpy ((void *)ppUsageCounts[i], (void *)in_struct->ppUsageCounts[i], sizeof(VkMicromapUsageEXT));'
                     '            }\n'
                     '        } else {\n'
-                    '            pUsageCounts = new VkMicromapUsageEXT[usageCountsCount];\n'
+                    '            pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[usageCountsCount];\n'
                     '            memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*usageCountsCount);'
                     '        }\n'
                     '    }\n',
                 'VkMicromapBuildInfoEXT':
                     '    if (usageCountsCount) {\n'
                     '        if ( in_struct->ppUsageCounts) {\n'
-                    '            ppUsageCounts = new VkMicromapUsageEXT *[usageCountsCount];\n'
+                    '            ppUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT *[usageCountsCount];\n'
                     '            for (uint32_t i = 0; i < usageCountsCount; ++i) {\n'
                     '                memcpy ((void *)ppUsageCounts[i], (void *)in_struct->ppUsageCounts[i], sizeof(VkMicromapUsageEXT));'
                     '            }\n'
                     '        } else {\n'
-                    '            pUsageCounts = new VkMicromapUsageEXT[usageCountsCount];\n'
+                    '            pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[usageCountsCount];\n'
                     '            memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*usageCountsCount);'
                     '        }\n'
                     '    }\n',
@@ -1714,26 +1895,26 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkMicromapBuildInfoEXT':
                     '   pNext = SafePnextCopy(in_struct->pNext);\n'
                     '   if (in_struct->pUsageCounts) {\n'
-                    '       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];\n'
+                    '       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];\n'
                     '       memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);\n'
                     '   }\n'
                     '   if (in_struct->ppUsageCounts) {\n'
-                    '       VkMicromapUsageEXT** pointer_array  = new VkMicromapUsageEXT*[in_struct->usageCountsCount];\n'
+                    '       VkMicromapUsageEXT** pointer_array  = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];\n'
                     '       for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {\n'
-                    '           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);\n'
+                    '           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);\n'
                     '       }\n'
                     '       ppUsageCounts = pointer_array;\n'
                     '   }\n',
                 'VkAccelerationStructureTrianglesOpacityMicromapEXT':
                     '   pNext = SafePnextCopy(in_struct->pNext);\n'
                     '   if (in_struct->pUsageCounts) {\n'
-                    '       pUsageCounts = new VkMicromapUsageEXT[in_struct->usageCountsCount];\n'
+                    '       pUsageCounts = new (kSafeStructAlloc) VkMicromapUsageEXT[in_struct->usageCountsCount];\n'
                     '       memcpy ((void *)pUsageCounts, (void *)in_struct->pUsageCounts, sizeof(VkMicromapUsageEXT)*in_struct->usageCountsCount);\n'
                     '   }\n'
                     '   if (in_struct->ppUsageCounts) {\n'
-                    '       VkMicromapUsageEXT** pointer_array = new VkMicromapUsageEXT*[in_struct->usageCountsCount];\n'
+                    '       VkMicromapUsageEXT** pointer_array = new (kSafeStructAlloc) VkMicromapUsageEXT*[in_struct->usageCountsCount];\n'
                     '       for (uint32_t i = 0; i < in_struct->usageCountsCount; ++i) {\n'
-                    '           pointer_array[i] = new VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);\n'
+                    '           pointer_array[i] = new (kSafeStructAlloc) VkMicromapUsageEXT(*in_struct->ppUsageCounts[i]);\n'
                     '       }\n'
                     '       ppUsageCounts = pointer_array;\n'
                     '   }\n'
@@ -1744,17 +1925,17 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkGraphicsPipelineCreateInfo' :
                     '    pNext = SafePnextCopy(copy_src.pNext);\n'
                     '    if (stageCount && copy_src.pStages) {\n'
-                    '        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
+                    '        pStages = new (kSafeStructAlloc) safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
                     '        for (uint32_t i = 0; i < stageCount; ++i) {\n'
                     '            pStages[i].initialize(&copy_src.pStages[i]);\n'
                     '        }\n'
                     '    }\n'
                     '    if (copy_src.pVertexInputState)\n'
-                    '        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);\n'
+                    '        pVertexInputState = new (kSafeStructAlloc) safe_VkPipelineVertexInputStateCreateInfo(*copy_src.pVertexInputState);\n'
                     '    else\n'
                     '        pVertexInputState = NULL;\n'
                     '    if (copy_src.pInputAssemblyState)\n'
-                    '        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);\n'
+                    '        pInputAssemblyState = new (kSafeStructAlloc) safe_VkPipelineInputAssemblyStateCreateInfo(*copy_src.pInputAssemblyState);\n'
                     '    else\n'
                     '        pInputAssemblyState = NULL;\n'
                     '    bool has_tessellation_stage = false;\n'
@@ -1763,7 +1944,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '            if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)\n'
                     '                has_tessellation_stage = true;\n'
                     '    if (copy_src.pTessellationState && has_tessellation_stage)\n'
-                    '        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);\n'
+                    '        pTessellationState = new (kSafeStructAlloc) safe_VkPipelineTessellationStateCreateInfo(*copy_src.pTessellationState);\n'
                     '    else\n'
                     '        pTessellationState = NULL; // original pTessellationState pointer ignored\n'
                     '    bool is_dynamic_has_rasterization = false;\n'
@@ -1774,40 +1955,40 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     '    }\n'
                     '    bool has_rasterization = copy_src.pRasterizationState ? (is_dynamic_has_rasterization || !copy_src.pRasterizationState->rasterizerDiscardEnable) : false;\n'
                     '    if (copy_src.pViewportState && has_rasterization) {\n'
-                    '        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);\n'
+                    '        pViewportState = new (kSafeStructAlloc) safe_VkPipelineViewportStateCreateInfo(*copy_src.pViewportState);\n'
                     '    } else\n'
                     '        pViewportState = NULL; // original pViewportState pointer ignored\n'
                     '    if (copy_src.pRasterizationState)\n'
-                    '        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);\n'
+                    '        pRasterizationState = new (kSafeStructAlloc) safe_VkPipelineRasterizationStateCreateInfo(*copy_src.pRasterizationState);\n'
                     '    else\n'
                     '        pRasterizationState = NULL;\n'
                     '    if (copy_src.pMultisampleState && has_rasterization)\n'
-                    '        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);\n'
+                    '        pMultisampleState = new (kSafeStructAlloc) safe_VkPipelineMultisampleStateCreateInfo(*copy_src.pMultisampleState);\n'
                     '    else\n'
                     '        pMultisampleState = NULL; // original pMultisampleState pointer ignored\n'
                     '    if (copy_src.pDepthStencilState && has_rasterization)\n'
-                    '        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);\n'
+                    '        pDepthStencilState = new (kSafeStructAlloc) safe_VkPipelineDepthStencilStateCreateInfo(*copy_src.pDepthStencilState);\n'
                     '    else\n'
                     '        pDepthStencilState = NULL; // original pDepthStencilState pointer ignored\n'
                     '    if (copy_src.pColorBlendState && has_rasterization)\n'
-                    '        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);\n'
+                    '        pColorBlendState = new (kSafeStructAlloc) safe_VkPipelineColorBlendStateCreateInfo(*copy_src.pColorBlendState);\n'
                     '    else\n'
                     '        pColorBlendState = NULL; // original pColorBlendState pointer ignored\n'
                     '    if (copy_src.pDynamicState)\n'
-                    '        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);\n'
+                    '        pDynamicState = new (kSafeStructAlloc) safe_VkPipelineDynamicStateCreateInfo(*copy_src.pDynamicState);\n'
                     '    else\n'
                     '        pDynamicState = NULL;\n',
                  # VkPipelineViewportStateCreateInfo is special case because it has custom construct parameters
                 'VkPipelineViewportStateCreateInfo' :
                     '    pNext = SafePnextCopy(copy_src.pNext);\n'
                     '    if (copy_src.pViewports) {\n'
-                    '        pViewports = new VkViewport[copy_src.viewportCount];\n'
+                    '        pViewports = new (kSafeStructAlloc) VkViewport[copy_src.viewportCount];\n'
                     '        memcpy ((void *)pViewports, (void *)copy_src.pViewports, sizeof(VkViewport)*copy_src.viewportCount);\n'
                     '    }\n'
                     '    else\n'
                     '        pViewports = NULL;\n'
                     '    if (copy_src.pScissors) {\n'
-                    '        pScissors = new VkRect2D[copy_src.scissorCount];\n'
+                    '        pScissors = new (kSafeStructAlloc) VkRect2D[copy_src.scissorCount];\n'
                     '        memcpy ((void *)pScissors, (void *)copy_src.pScissors, sizeof(VkRect2D)*copy_src.scissorCount);\n'
                     '    }\n'
                     '    else\n'
@@ -1815,7 +1996,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkFramebufferCreateInfo' :
                     '    pNext = SafePnextCopy(copy_src.pNext);\n'
                     '    if (attachmentCount && copy_src.pAttachments && !(flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT)) {\n'
-                    '        pAttachments = new VkImageView[attachmentCount];\n'
+                    '        pAttachments = new (kSafeStructAlloc) VkImageView[attachmentCount];\n'
                     '        for (uint32_t i = 0; i < attachmentCount; ++i) {\n'
                     '            pAttachments[i] = copy_src.pAttachments[i];\n'
                     '        }\n'
@@ -1823,12 +2004,12 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                 'VkAccelerationStructureBuildGeometryInfoKHR':
                     '    if (geometryCount) {\n'
                     '        if ( copy_src.ppGeometries) {\n'
-                    '            ppGeometries = new safe_VkAccelerationStructureGeometryKHR *[geometryCount];\n'
+                    '            ppGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR *[geometryCount];\n'
                     '            for (uint32_t i = 0; i < geometryCount; ++i) {\n'
-                    '                ppGeometries[i] = new safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);\n'
+                    '                ppGeometries[i] = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR(*copy_src.ppGeometries[i]);\n'
                     '            }\n'
                     '        } else {\n'
-                    '            pGeometries = new safe_VkAccelerationStructureGeometryKHR[geometryCount];\n'
+                    '            pGeometries = new (kSafeStructAlloc) safe_VkAccelerationStructureGeometryKHR[geometryCount];\n'
                     '            for (uint32_t i = 0; i < geometryCount; ++i) {\n'
                     '                pGeometries[i] = safe_VkAccelerationStructureGeometryKHR(copy_src.pGeometries[i]);\n'
                     '            }\n'
@@ -1920,7 +2101,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                             if m_type == 'char':
                                 # Create deep copies of strings
                                 if member.len:
-                                    copy_strings += '    char **tmp_%s = new char *[in_struct->%s];\n' % (member.name, member.len)
+                                    copy_strings += '    char **tmp_%s = new (kSafeStructAlloc) char *[in_struct->%s];\n' % (member.name, member.len)
                                     copy_strings += '    for (uint32_t i = 0; i < %s; ++i) {\n' % member.len
                                     copy_strings += '        tmp_%s[i] = SafeStringCopy(in_struct->%s[i]);\n' % (member.name, member.name)
                                     copy_strings += '    }\n'
@@ -1949,7 +2130,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                             init_func_txt += '    %s = nullptr;\n' % (member.name)
                             if not member.isstaticarray and (member.len is None or '/' in member.len):
                                 construct_txt += '    if (in_struct->%s) {\n' % member.name
-                                construct_txt += '        %s = new %s(*in_struct->%s);\n' % (member.name, m_type, member.name)
+                                construct_txt += '        %s = new (kSafeStructAlloc) %s(*in_struct->%s);\n' % (member.name, m_type, member.name)
                                 construct_txt += '    }\n'
                                 destruct_txt += '    if (%s)\n' % member.name
                                 destruct_txt += '        delete %s;\n' % member.name
@@ -1963,7 +2144,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                                 except:
                                     concurrent_clause = (f'in_struct->{member.name}', lambda x: '')
                                 construct_txt += f'    if ({concurrent_clause[0]}) {{' + '\n'
-                                construct_txt += '        %s = new %s[%s];\n' % (member.name, m_type, decorated_length)
+                                construct_txt += '        %s = new (kSafeStructAlloc) %s[%s];\n' % (member.name, m_type, decorated_length)
                                 construct_txt += '        memcpy ((void *)%s, (void *)in_struct->%s, sizeof(%s)*%s);\n' % (member.name, member.name, m_type, decorated_length)
                                 construct_txt += concurrent_clause[1]('        ')
                                 if len(concurrent_clause) > 2:
@@ -1990,7 +2171,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                             if member_index is not None and self.NeedSafeStruct(self.structMembers[member_index]) == True:
                                 array_element = '%s(&in_struct->safe_%s[i])' % (member.type, member.name)
                         construct_txt += '    if (%s && in_struct->%s) {\n' % (member.len, member.name)
-                        construct_txt += '        %s = new %s[%s];\n' % (member.name, m_type, member.len)
+                        construct_txt += '        %s = new (kSafeStructAlloc) %s[%s];\n' % (member.name, m_type, member.len)
                         destruct_txt += '    if (%s)\n' % member.name
                         destruct_txt += '        delete[] %s;\n' % member.name
                         construct_txt += '        for (uint32_t i = 0; i < %s; ++i) {\n' % (member.len)
@@ -2005,7 +2186,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
                     init_list += '\n    %s(nullptr),' % (member.name)
                     init_func_txt += '    %s = nullptr;\n' % (member.name)
                     construct_txt += '    if (in_struct->%s)\n' % member.name
-                    construct_txt += '        %s = new %s(in_struct->%s);\n' % (member.name, m_type, member.name)
+                    construct_txt += '        %s = new (kSafeStructAlloc) %s(in_struct->%s);\n' % (member.name, m_type, member.name)
                     destruct_txt += '    if (%s)\n' % member.name
                     destruct_txt += '        delete %s;\n' % member.name
                 elif 'safe_' in m_type:
@@ -2048,7 +2229,7 @@ void CoreChecksOptickInstrumented::PreCallRecordQueuePresentKHR(VkQueue queue, c
             safe_struct_body.append("\n%s::%s()%s\n{}" % (ss_name, ss_name, default_init_list))
             # Create slight variation of init and construct txt for copy constructor that takes a copy_src object reference vs. struct ptr
             copy_construct_init = init_func_txt.replace('in_struct->', 'copy_src.')
-            copy_construct_txt = re.sub('(new \\w+)\\(in_struct->', '\\1(*copy_src.', construct_txt) # Pass object to copy constructors
+            copy_construct_txt = re.sub('(new \\(kSafeStructAlloc\\) \\w+)\\(in_struct->', '\\1(*copy_src.', construct_txt) # Pass object to copy constructors
             copy_construct_txt = copy_construct_txt.replace('in_struct->', 'copy_src.')              # Modify remaining struct refs for copy_src object
             if item.name in custom_copy_txt:
                 copy_construct_txt = custom_copy_txt[item.name]
@@ -199,6 +199,25 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkQueueInsertDebugUtilsLabelEXT' : 'InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);',
         }
 
+    # Functions whose down-chain call may wait for the GPU or the presentation engine. The time spent in it is not counted as
+    # time spent in the layer by the validation governor.
+    waiting_functions = [
+        'vkQueuePresentKHR',
+        'vkQueueSubmit',
+        'vkQueueSubmit2',
+        'vkQueueSubmit2KHR',
+        'vkQueueWaitIdle',
+        'vkDeviceWaitIdle',
+        'vkWaitForFences',
+        'vkWaitSemaphores',
+        'vkWaitSemaphoresKHR',
+        'vkAcquireNextImageKHR',
+        'vkAcquireNextImage2KHR',
+        'vkGetQueryPoolResults',
+        'vkWaitForPresentKHR',
+        'vkQueueBindSparse',
+        ]
+
     post_dispatch_debug_utils_functions = {
         'vkQueueEndDebugUtilsLabelEXT' : 'EndQueueDebugUtilsLabel(layer_data->report_data, queue);',
         'vkCreateDebugReportCallbackEXT' : 'layer_create_report_callback(layer_data->report_data, false, pCreateInfo, pAllocator, pCallback);',
@@ -236,6 +255,8 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
+#include "layer_profiler.h"
+#include "validation_governor.h"
 
 
 extern std::atomic<uint64_t> global_unique_id;
@@ -370,6 +391,19 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        bool profiling{false};
+        bool check_stats{false};
+        // Per-draw state validation runs on one in draw_validation_sample_period draws and dispatches of each command buffer
+        uint32_t draw_validation_sample_period{1};
+        bool draw_validation_sample_random{false};
+        bool validation_governor{false};
+        // Validation of this object is skipped from this ValidationGovernor level, 0 if it is never skipped. The intercepts whose
+        // validation step also prepares state for the record step still call it, and the object checks ValidationThrottled().
+        uint32_t validation_throttle_level{0};
+
+        bool ValidationThrottled() const {
+            return validation_throttle_level != 0 && ValidationGovernor::Level() >= validation_throttle_level;
+        }
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -414,6 +448,9 @@ class ValidationObject {
             enabled = framework->enabled;
             disabled = framework->disabled;
             fine_grained_locking = framework->fine_grained_locking;
+            draw_validation_sample_period = framework->draw_validation_sample_period;
+            draw_validation_sample_random = framework->draw_validation_sample_random;
+            validation_governor = framework->validation_governor;
             instance = inst;
         }
 
@@ -429,6 +466,9 @@ class ValidationObject {
                 disabled = inst_obj->disabled;
                 enabled = inst_obj->enabled;
                 fine_grained_locking = inst_obj->fine_grained_locking;
+                draw_validation_sample_period = inst_obj->draw_validation_sample_period;
+                draw_validation_sample_random = inst_obj->draw_validation_sample_random;
+                validation_governor = inst_obj->validation_governor;
                 instance_dispatch_table = inst_obj->instance_dispatch_table;
                 instance_extensions = inst_obj->instance_extensions;
                 device_extensions = dev_obj->device_extensions;
@@ -446,6 +486,7 @@ class ValidationObject {
 
         // Debug Logging Helpers
         bool DECORATE_PRINTF(4, 5) LogError(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
@@ -464,6 +505,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogError(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
@@ -483,6 +525,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -501,6 +544,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -519,6 +563,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -537,6 +582,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogPerformanceWarning(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT,
@@ -555,6 +601,7 @@ class ValidationObject {
         };
 
         bool DECORATE_PRINTF(4, 5) LogInfo(const LogObjectList &objects, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
@@ -573,6 +620,7 @@ class ValidationObject {
 
         template <typename HANDLE_T>
         bool DECORATE_PRINTF(4, 5) LogInfo(HANDLE_T src_object, const std::string &vuid_text, const char *format, ...) const {
+            LayerProfiler::CountMessage(vuid_text);
             std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
             // Avoid logging cost if msg is to be ignored
             if (!LogMsgEnabled(report_data, vuid_text, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT,
@@ -680,6 +728,7 @@ class ValidationObject {
 
 #include "chassis.h"
 #include "layer_options.h"
+#include "thread_pool.h"
 #include "layer_chassis_dispatch.h"
 
 small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
@@ -837,6 +886,13 @@ void OutputLayerStatusInfo(ValidationObject *context) {
         context->LogPerformanceWarning(context->instance, kVUID_Core_CreateInstance_Locking_Warning,
                                        "Fine-grained locking is disabled, this will adversely affect performance of multithreaded applications.");
     }
+    if (context->draw_validation_sample_period > 1) {
+        context->LogWarning(context->instance, kVUID_Core_CreateInstance_Sampling_Warning,
+                            "Draw validation sampling is enabled, the state of only 1 in %" PRIu32 " draws and dispatches of "
+                            "each command buffer is validated%s. Errors in the other draws and dispatches are not reported.",
+                            context->draw_validation_sample_period,
+                            context->draw_validation_sample_random ? ", chosen at random" : "");
+    }
 }
 
 // Non-code-generated chassis API functions
@@ -930,8 +986,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
     bool lock_setting;
+    std::string profile_file;
+    std::string check_stats_file;
+    uint32_t draw_validation_sample_period = 1;
+    bool draw_validation_sample_random = false;
+    uint32_t validation_frame_budget = 0;
+    uint32_t thread_pool_size = 0;
+    bool thread_pool_affinity = false;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting, &profile_file,
+        &check_stats_file, &draw_validation_sample_period, &draw_validation_sample_random, &validation_frame_budget,
+        &thread_pool_size, &thread_pool_affinity};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, pAllocator, OBJECT_LAYER_DESCRIPTION);
 
@@ -990,6 +1055,15 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    framework->draw_validation_sample_period = std::max<uint32_t>(draw_validation_sample_period, 1);
+    framework->draw_validation_sample_random = draw_validation_sample_random;
+    if (validation_frame_budget != 0) {
+        ValidationGovernor::Start(static_cast<uint64_t>(validation_frame_budget) * 1000);
+        framework->validation_governor = true;
+    }
+    ThreadPool::Start(thread_pool_size, thread_pool_affinity);
+    framework->profiling = !profile_file.empty() && LayerProfiler::Start(profile_file);
+    framework->check_stats = !check_stats_file.empty() && LayerProfiler::StartCheckStats(check_stats_file);
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -998,6 +1072,15 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->instance_extensions.InitFromInstanceCreateInfo(specified_version, pCreateInfo);
 
     OutputLayerStatusInfo(framework);
+    if (!profile_file.empty() && !framework->profiling) {
+        framework->LogWarning(framework->instance, kVUID_Core_CreateInstance_Profiler_Warning,
+                              "The profile file %s could not be created, API calls are not traced.", profile_file.c_str());
+    }
+    if (!check_stats_file.empty() && !framework->check_stats) {
+        framework->LogWarning(framework->instance, kVUID_Core_CreateInstance_Profiler_Warning,
+                              "The check statistics file %s could not be created, check statistics are not collected.",
+                              check_stats_file.c_str());
+    }
 
     thread_checker_obj->FinalizeInstanceValidationObject(framework, *pInstance);
     object_tracker_obj->FinalizeInstanceValidationObject(framework, *pInstance);
@@ -1051,15 +1134,27 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
 
+    if (layer_data->profiling) {
+        LayerProfiler::Stop();
+    }
+    // Stopped while the debug callbacks can still report that the statistics could not be written
+    if (layer_data->check_stats && !LayerProfiler::StopCheckStats()) {
+        layer_data->LogWarning(instance, kVUID_Core_CreateInstance_Profiler_Warning,
+                               "The check statistics file could not be written.");
+    }
+
     DeactivateInstanceDebugCallbacks(layer_data->report_data);
     FreePnextChain(layer_data->report_data->instance_pnext_chain);
 
     layer_debug_utils_destroy_instance(layer_data->report_data);
-
+    if (layer_data->validation_governor) {
+        ValidationGovernor::Stop();
+    }
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
     FreeLayerDataPtr(key, layer_data_map);
+    ThreadPool::Stop();
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
@@ -1200,6 +1295,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (!LayerProfiler::WriteCheckStats()) {
+        layer_data->LogWarning(device, kVUID_Core_CreateInstance_Profiler_Warning,
+                               "The check statistics file could not be written.");
+    }
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -1217,6 +1317,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateGraphicsPipelines");
     bool skip = false;
 
     create_graphics_pipeline_api_state cgpl_state[LayerObjectTypeMaxEnum]{};
@@ -1253,6 +1354,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateComputePipelines");
     bool skip = false;
 
     create_compute_pipeline_api_state ccpl_state[LayerObjectTypeMaxEnum]{};
@@ -1288,6 +1390,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateRayTracingPipelinesNV");
     bool skip = false;
 
     create_ray_tracing_pipeline_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
@@ -1324,6 +1427,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     const VkAllocationCallbacks*                pAllocator,
     VkPipeline*                                 pPipelines) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateRayTracingPipelinesKHR");
     bool skip = false;
 
     create_ray_tracing_pipeline_khr_api_state crtpl_state[LayerObjectTypeMaxEnum]{};
@@ -1358,12 +1462,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     const VkAllocationCallbacks*                pAllocator,
     VkPipelineLayout*                           pPipelineLayout) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreatePipelineLayout");
     bool skip = false;
 
     create_pipeline_layout_api_state cpl_state{};
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        if (intercept->ValidationThrottled()) continue;
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1387,12 +1493,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     const VkAllocationCallbacks*                pAllocator,
     VkShaderModule*                             pShaderModule) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateShaderModule");
     bool skip = false;
 
     create_shader_module_api_state csm_state{};
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        if (intercept->ValidationThrottled()) continue;
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1414,6 +1522,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     const VkDescriptorSetAllocateInfo*          pAllocateInfo,
     VkDescriptorSet*                            pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkAllocateDescriptorSets");
     bool skip = false;
 
     cvdescriptorset::AllocateDescriptorSetsData ads_state[LayerObjectTypeMaxEnum];
@@ -1445,12 +1554,14 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     const VkAllocationCallbacks*                pAllocator,
     VkBuffer*                                   pBuffer) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VVL_PROFILE_API_CALL("vkCreateBuffer");
     bool skip = false;
 
     create_buffer_api_state cb_state{};
     cb_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        if (intercept->ValidationThrottled()) continue;
         auto lock = intercept->ReadLock();
         skip |= (const_cast<const ValidationObject*>(intercept))->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -2051,6 +2162,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             # Setup common to call wrappers. First parameter is always dispatchable
             dispatchable_name = cmdinfo.elem.find('param/name').text
             self.appendSection('command', '    auto layer_data = GetLayerDataPtr(get_dispatch_key(%s), layer_data_map);' % (dispatchable_name))
+            self.appendSection('command', '    VVL_PROFILE_API_CALL("%s");' % (name))
             api_function_name = cmdinfo.elem.attrib.get('name')
             params = cmdinfo.elem.findall('param/name')
             paramstext = ', '.join([str(param.text) for param in params])
@@ -2078,6 +2190,7 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             # Generate pre-call validation source code
             if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
                 self.appendSection('command', '    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
+                self.appendSection('command', '        if (intercept->ValidationThrottled()) continue;')
             else:
                 self.appendSection('command', '    for (auto intercept : layer_data->object_dispatch) {')
             self.appendSection('command', '        auto lock = intercept->ReadLock();')
@@ -2099,7 +2212,15 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.appendSection('command', '    %s' % self.pre_dispatch_debug_utils_functions[name])
 
             # Output dispatch (down-chain) function call
+            if name in self.waiting_functions:
+                self.appendSection('command', '    const auto down_chain_begin = LayerProfiler::DownChainBegin();')
             self.appendSection('command', '    ' + assignresult + API + paramstext + ');')
+            if name in self.waiting_functions:
+                self.appendSection('command', '    LayerProfiler::DownChainEnd(down_chain_begin);')
+
+            # Mark the end of the frame for the profiler
+            if name == 'vkQueuePresentKHR':
+                self.appendSection('command', '    LayerProfiler::Frame();')
 
             # Insert post-dispatch debug utils function call
             if name in self.post_dispatch_debug_utils_functions:
@@ -864,12 +864,16 @@ class ParameterValidationOutputGenerator(OutputGenerator):
                     enum_entry = '#ifdef %s\n' % self.featureExtraProtect
                 else:
                     enum_entry = ''
-                enum_entry += 'const std::vector<%s> All%sEnums = {' % (groupName, groupName)
-                for enum in groupElem:
-                    name = enum.get('name')
-                    if name is not None and enum.get('supported') != 'disabled':
-                        enum_entry += '%s, ' % name
-                enum_entry += '};'
+                # A plain array viewed through a span is constant-initialized, so no code runs at library load
+                values = [enum.get('name') for enum in groupElem
+                          if enum.get('name') is not None and enum.get('supported') != 'disabled']
+                if values:
+                    enum_entry += 'static const %s All%sEnumValues[] = {' % (groupName, groupName)
+                    enum_entry += ''.join('%s, ' % name for name in values)
+                    enum_entry += '};\n'
+                    enum_entry += 'const layer_data::span<const %s> All%sEnums(All%sEnumValues);' % (groupName, groupName, groupName)
+                else:
+                    enum_entry += 'const layer_data::span<const %s> All%sEnums;' % (groupName, groupName)
                 if self.featureExtraProtect is not None:
                     enum_entry += '\n#endif // %s' % self.featureExtraProtect
                 self.enum_values_definitions[groupName] = enum_entry
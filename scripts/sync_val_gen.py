@@ -643,16 +643,6 @@ def StageAccessEnums(stage_accesses, config):
         output.extend([ '{}static const {} {} = ({}(1) << {});'.format('', sync_mask_name, e['stage_access_bit'], sync_mask_name, e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
     output.append('')
 
-    map_name = var_prefix + 'StageAccessIndexByStageAccessBit'
-    output.append('// Map of the StageAccessIndices from the StageAccess Bit')
-    if config['is_source']:
-        output.append('const layer_data::unordered_map<{}, {}> {}  = {{'.format(sync_mask_name, ordinal_name, map_name))
-        output.extend([ '{}{{ {}, {} }},'.format(indent, e['stage_access_bit'], e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
-        output.append('};')
-    else:
-        output.append('extern const layer_data::unordered_map<{}, {}> {};'.format(sync_mask_name, ordinal_name, map_name))
-    output.append('')
-
     # stage/access debug information based on ordinal enum
     sa_info_type = '{}StageAccessInfoType'.format(type_prefix)
     if not config['is_source']:
@@ -714,29 +704,6 @@ def CrossReferenceTable(table_name, table_desc, key_type, mapped_type, key_vec,
 
     return table
 
-def DoubleCrossReferenceTable(table_name, table_desc, stage_keys, access_keys, stage_access_stage_access_map, config):
-    indent = config['indent']
-    ordinal_name = config['ordinal_name']
-
-    table = ['// ' + table_desc]
-    if config['is_source']:
-        table.append('const std::map<{vk_stage_flags}, std::map<{vk_access_flags}, {ordinal_name}>> {var_prefix}{} {{'.format(table_name, **config))
-        sep = ' },\n' + indent * 2 + '{ '
-
-        # Because stage_access_stage_access_map's elements order might be different sometimes.
-        # It causes the generator creates different code. It needs to be sorted.
-        for i in sorted(stage_access_stage_access_map):
-            if len(stage_access_stage_access_map[i].keys()) == 0: continue
-            accesses = [ '{}, {}'.format(access, index) for access, index in sorted(stage_access_stage_access_map[i].items()) ]
-            entry_format = '{tab}{{ {key}, {{\n{tab}{tab}{{ {val} }}\n{tab}}} }},'
-            table.append( entry_format.format(key=i, val=sep.join(accesses), tab=indent))
-        table.append('};')
-    else:
-        table.append('extern const std::map<{vk_stage_flags}, std::map<{vk_access_flags}, {ordinal_name}>> {var_prefix}{};'.format(table_name, **config))
-    table.append('')
-
-    return table
-
 def StageAccessCrossReference(sync_enum, stage_access_combinations, config):
     output = []
     # Setup the cross reference tables
@@ -749,7 +716,6 @@ def StageAccessCrossReference(sync_enum, stage_access_combinations, config):
     stage_access_mask_stage_map = { e['name']: [] for e in stages_in_bit_order }
     #stage_access_mask_stage_map[none_stage] = [] # Support for N/A
     stage_access_mask_access_map = { e['name']: [] for e in access_in_bit_order }
-    stage_access_stage_access_map = {  e['name']: dict() for e in stages_in_bit_order }
     direct_stage_to_access_map = {  e['name']: [] for e in stages_in_bit_order }
 
     for stage_access_combo in stage_access_combinations:
@@ -760,7 +726,6 @@ def StageAccessCrossReference(sync_enum, stage_access_combinations, config):
         if access == 'VK_ACCESS_2_FLAG_NONE_KHR' : continue
         stage_access_mask_stage_map[stage].append(combo_bit)
         stage_access_mask_access_map[access].append(combo_bit)
-        stage_access_stage_access_map[stage][access] = stage_access_combo['stage_access']
         direct_stage_to_access_map[stage].append(stage_access_combo['access'])
 
     # sas: stage_access masks by stage used to build up SyncMaskTypes from VkPipelineStageFlagBits
@@ -775,12 +740,6 @@ def StageAccessCrossReference(sync_enum, stage_access_combinations, config):
     output.extend(CrossReferenceTable(saa_name, saa_desc, 'VkAccessFlags2',  config['sync_mask_name'],
                                       UnpackField(access_in_bit_order), stage_access_mask_access_map, config))
 
-    #sasa -- stage access index by stage by access
-    sasa_name = 'StageAccessIndexByStageAndAccess'
-    sasa_desc = 'stage_access index for each stage and access'
-    output.extend(DoubleCrossReferenceTable(sasa_name, sasa_desc,stages_in_bit_order, access_in_bit_order, stage_access_stage_access_map, config))
-
-
     # direct VkPipelineStageFlags to valid VkAccessFlags lookup table
     direct_name = 'DirectStageToAccessMask'
     direct_desc = 'Direct VkPipelineStageFlags to valid VkAccessFlags lookup table'
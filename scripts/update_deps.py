@@ -680,7 +680,7 @@ def main():
         '--optional',
         dest='optional',
         type=lambda a: set(a.lower().split(',')),
-        help="Comma-separated list of 'optional' resources that may be skipped. Only 'tests' is currently supported as 'optional'",
+        help="Comma-separated list of 'optional' resources that may be skipped. 'tests' and 'benchmarks' are currently supported as 'optional'",
         default=set())
 
     args = parser.parse_args()
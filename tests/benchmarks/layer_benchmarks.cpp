@@ -0,0 +1,1050 @@
+/*
+ * Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks of the validation layer hot paths.
+//
+// The benchmarks are meant to run against the Mock ICD, so that the time measured is the time spent in the loader and the
+// layers rather than in a driver. Run them with the same environment as vk_layer_validation_tests:
+//
+//     export VK_LAYER_PATH=<build>/layers
+//     export VK_ICD_FILENAMES=<Vulkan-Tools build>/icd/VkICD_mock_icd.json
+//     ./vk_layer_benchmarks --benchmark_out=results.json --benchmark_out_format=json
+//
+// and compare two result files with scripts/compare_benchmarks.py.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cast_utils.h"
+#include "flat_hash_map.h"
+#include "gpu_as_inspection_comp.h"
+#include "gpu_pre_dispatch_comp.h"
+#include "gpu_pre_draw_vert.h"
+#include "lvt_function_pointers.h"
+#include "query_state.h"
+
+namespace {
+
+const char *kValidationLayerName = "VK_LAYER_KHRONOS_validation";
+
+std::atomic<uint32_t> validation_error_count{0};
+
+VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity, VkDebugUtilsMessageTypeFlagsEXT,
+                                             const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *) {
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+        // Only report the first few, a broken scenario would otherwise flood the output
+        if (validation_error_count++ < 8) {
+            fprintf(stderr, "Validation error: %s\n", callback_data->pMessage);
+        }
+    }
+    return VK_FALSE;
+}
+
+// Builds a vertex shader that sums a uniform buffer vec4 from each of `set_count` descriptor sets with a chain of
+// `additions` dependent float additions, and writes the result to gl_Position. The size of the module, and the work the
+// layer does when validating it, scales with `additions`.
+std::vector<uint32_t> BuildVertexShader(uint32_t set_count, uint32_t additions) {
+    enum : uint32_t {
+        kOpMemoryModel = 14,
+        kOpEntryPoint = 15,
+        kOpCapability = 17,
+        kOpTypeVoid = 19,
+        kOpTypeInt = 21,
+        kOpTypeFloat = 22,
+        kOpTypeVector = 23,
+        kOpTypeStruct = 30,
+        kOpTypePointer = 32,
+        kOpTypeFunction = 33,
+        kOpConstant = 43,
+        kOpFunction = 54,
+        kOpFunctionEnd = 56,
+        kOpVariable = 59,
+        kOpLoad = 61,
+        kOpStore = 62,
+        kOpAccessChain = 65,
+        kOpDecorate = 71,
+        kOpMemberDecorate = 72,
+        kOpCompositeConstruct = 80,
+        kOpFAdd = 129,
+        kOpLabel = 248,
+        kOpReturn = 253,
+    };
+    enum : uint32_t {
+        kDecorationBlock = 2,
+        kDecorationBuiltIn = 11,
+        kDecorationOffset = 35,
+        kDecorationBinding = 33,
+        kDecorationDescriptorSet = 34,
+        kStorageClassUniform = 2,
+        kStorageClassOutput = 3,
+    };
+
+    std::vector<uint32_t> code = {0x07230203, 0x00010000, 0, 0 /* bound */, 0};
+    auto op = [&code](uint32_t opcode, std::initializer_list<uint32_t> operands) {
+        code.push_back((static_cast<uint32_t>(operands.size() + 1) << 16) | opcode);
+        code.insert(code.end(), operands.begin(), operands.end());
+    };
+
+    uint32_t next_id = 1;
+    const uint32_t type_void = next_id++;
+    const uint32_t type_main = next_id++;
+    const uint32_t type_float = next_id++;
+    const uint32_t type_vec4 = next_id++;
+    const uint32_t type_int = next_id++;
+    const uint32_t type_block = next_id++;
+    const uint32_t type_out_vec4 = next_id++;
+    const uint32_t type_uniform_block = next_id++;
+    const uint32_t type_uniform_vec4 = next_id++;
+    const uint32_t position = next_id++;
+    const uint32_t float_one = next_id++;
+    const uint32_t int_zero = next_id++;
+    const uint32_t main = next_id++;
+    const uint32_t first_uniform = next_id;
+    next_id += set_count;
+
+    op(kOpCapability, {1 /* Shader */});
+    op(kOpMemoryModel, {0 /* Logical */, 1 /* GLSL450 */});
+    op(kOpEntryPoint, {0 /* Vertex */, main, 0x6e69616d /* "main" */, 0, position});
+    op(kOpDecorate, {position, kDecorationBuiltIn, 0 /* Position */});
+    op(kOpDecorate, {type_block, kDecorationBlock});
+    op(kOpMemberDecorate, {type_block, 0, kDecorationOffset, 0});
+    for (uint32_t set = 0; set < set_count; ++set) {
+        op(kOpDecorate, {first_uniform + set, kDecorationDescriptorSet, set});
+        op(kOpDecorate, {first_uniform + set, kDecorationBinding, 0});
+    }
+    op(kOpTypeVoid, {type_void});
+    op(kOpTypeFunction, {type_main, type_void});
+    op(kOpTypeFloat, {type_float, 32});
+    op(kOpTypeVector, {type_vec4, type_float, 4});
+    op(kOpTypeInt, {type_int, 32, 1});
+    op(kOpTypeStruct, {type_block, type_vec4});
+    op(kOpTypePointer, {type_out_vec4, kStorageClassOutput, type_vec4});
+    op(kOpTypePointer, {type_uniform_block, kStorageClassUniform, type_block});
+    op(kOpTypePointer, {type_uniform_vec4, kStorageClassUniform, type_vec4});
+    op(kOpVariable, {type_out_vec4, position, kStorageClassOutput});
+    for (uint32_t set = 0; set < set_count; ++set) {
+        op(kOpVariable, {type_uniform_block, first_uniform + set, kStorageClassUniform});
+    }
+    op(kOpConstant, {type_float, float_one, 0x3f800000 /* 1.0f */});
+    op(kOpConstant, {type_int, int_zero, 0});
+
+    op(kOpFunction, {type_void, main, 0 /* None */, type_main});
+    op(kOpLabel, {next_id++});
+    uint32_t scalar = float_one;
+    for (uint32_t i = 0; i < additions; ++i) {
+        const uint32_t sum = next_id++;
+        op(kOpFAdd, {type_float, sum, scalar, float_one});
+        scalar = sum;
+    }
+    uint32_t vector = next_id++;
+    op(kOpCompositeConstruct, {type_vec4, vector, scalar, scalar, scalar, float_one});
+    for (uint32_t set = 0; set < set_count; ++set) {
+        const uint32_t member = next_id++;
+        const uint32_t value = next_id++;
+        const uint32_t sum = next_id++;
+        op(kOpAccessChain, {type_uniform_vec4, member, first_uniform + set, int_zero});
+        op(kOpLoad, {type_vec4, value, member});
+        op(kOpFAdd, {type_vec4, sum, vector, value});
+        vector = sum;
+    }
+    op(kOpStore, {position, vector});
+    op(kOpReturn, {});
+    op(kOpFunctionEnd, {});
+
+    code[3] = next_id;
+    return code;
+}
+
+// Validation features set on a context, on top of the default settings of the layer
+enum class ContextConfig { kDefault, kSyncValidation, kNoShaderValidation, kCount };
+
+// A device created through the loader with the validation layer enabled, and the objects shared by the scenarios. Objects are
+// released in reverse order of creation when the context is destroyed.
+class BenchmarkContext {
+  public:
+    static constexpr uint32_t kUniformBufferSize = 256;
+
+    static std::unique_ptr<BenchmarkContext> Create(ContextConfig config) {
+        std::unique_ptr<BenchmarkContext> context(new BenchmarkContext());
+        if (!context->Init(config)) {
+            return nullptr;
+        }
+        return context;
+    }
+
+    ~BenchmarkContext() {
+        if (device != VK_NULL_HANDLE) {
+            vk::DeviceWaitIdle(device);
+        }
+        for (auto it = deleters_.rbegin(); it != deleters_.rend(); ++it) {
+            (*it)();
+        }
+    }
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queue_family = 0;
+    VkPhysicalDeviceLimits limits = {};
+
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkBuffer uniform_buffer = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+
+    VkBuffer CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+        VkBufferCreateInfo buffer_ci = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+        buffer_ci.size = size;
+        buffer_ci.usage = usage;
+        VkBuffer buffer = VK_NULL_HANDLE;
+        if (vk::CreateBuffer(device, &buffer_ci, nullptr, &buffer) != VK_SUCCESS) return VK_NULL_HANDLE;
+        OnDestroy([this, buffer]() { vk::DestroyBuffer(device, buffer, nullptr); });
+
+        VkMemoryRequirements requirements;
+        vk::GetBufferMemoryRequirements(device, buffer, &requirements);
+        VkDeviceMemory memory = AllocateMemory(requirements);
+        if (memory == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+        vk::BindBufferMemory(device, buffer, memory, 0);
+        return buffer;
+    }
+
+    // Color image with optimal tiling, usable as a transfer source and destination
+    VkImage CreateImage(VkImageType type, const VkExtent3D &extent, uint32_t mip_levels, uint32_t array_layers) {
+        VkImageCreateInfo image_ci = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+        image_ci.imageType = type;
+        image_ci.format = VK_FORMAT_R8G8B8A8_UNORM;
+        image_ci.extent = extent;
+        image_ci.mipLevels = mip_levels;
+        image_ci.arrayLayers = array_layers;
+        image_ci.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_ci.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_ci.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        VkImage image = VK_NULL_HANDLE;
+        if (vk::CreateImage(device, &image_ci, nullptr, &image) != VK_SUCCESS) return VK_NULL_HANDLE;
+        OnDestroy([this, image]() { vk::DestroyImage(device, image, nullptr); });
+
+        VkMemoryRequirements requirements;
+        vk::GetImageMemoryRequirements(device, image, &requirements);
+        VkDeviceMemory memory = AllocateMemory(requirements);
+        if (memory == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+        vk::BindImageMemory(device, image, memory, 0);
+        return image;
+    }
+
+    // Allocates count descriptor sets of set_layout, each pointing at uniform_buffer
+    std::vector<VkDescriptorSet> CreateDescriptorSets(uint32_t count) {
+        VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, count};
+        VkDescriptorPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+        pool_ci.maxSets = count;
+        pool_ci.poolSizeCount = 1;
+        pool_ci.pPoolSizes = &pool_size;
+        VkDescriptorPool pool = VK_NULL_HANDLE;
+        if (vk::CreateDescriptorPool(device, &pool_ci, nullptr, &pool) != VK_SUCCESS) return {};
+        OnDestroy([this, pool]() { vk::DestroyDescriptorPool(device, pool, nullptr); });
+
+        std::vector<VkDescriptorSetLayout> layouts(count, set_layout);
+        std::vector<VkDescriptorSet> sets(count);
+        VkDescriptorSetAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+        alloc_info.descriptorPool = pool;
+        alloc_info.descriptorSetCount = count;
+        alloc_info.pSetLayouts = layouts.data();
+        if (vk::AllocateDescriptorSets(device, &alloc_info, sets.data()) != VK_SUCCESS) return {};
+
+        std::vector<VkWriteDescriptorSet> writes;
+        const VkDescriptorBufferInfo buffer_info = {uniform_buffer, 0, kUniformBufferSize};
+        BuildDescriptorWrites(sets, buffer_info, writes);
+        vk::UpdateDescriptorSets(device, count, writes.data(), 0, nullptr);
+        return sets;
+    }
+
+    static void BuildDescriptorWrites(const std::vector<VkDescriptorSet> &sets, const VkDescriptorBufferInfo &buffer_info,
+                                      std::vector<VkWriteDescriptorSet> &writes) {
+        writes.resize(sets.size());
+        for (size_t i = 0; i < sets.size(); ++i) {
+            writes[i] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            writes[i].dstSet = sets[i];
+            writes[i].dstBinding = 0;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[i].pBufferInfo = &buffer_info;
+        }
+    }
+
+    VkPipelineLayout CreatePipelineLayout(uint32_t set_count) {
+        std::vector<VkDescriptorSetLayout> layouts(set_count, set_layout);
+        VkPipelineLayoutCreateInfo layout_ci = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+        layout_ci.setLayoutCount = set_count;
+        layout_ci.pSetLayouts = layouts.data();
+        VkPipelineLayout layout = VK_NULL_HANDLE;
+        if (vk::CreatePipelineLayout(device, &layout_ci, nullptr, &layout) != VK_SUCCESS) return VK_NULL_HANDLE;
+        OnDestroy([this, layout]() { vk::DestroyPipelineLayout(device, layout, nullptr); });
+        return layout;
+    }
+
+    VkShaderModule CreateShaderModule(const std::vector<uint32_t> &code) const {
+        VkShaderModuleCreateInfo module_ci = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+        module_ci.codeSize = code.size() * sizeof(uint32_t);
+        module_ci.pCode = code.data();
+        VkShaderModule module = VK_NULL_HANDLE;
+        vk::CreateShaderModule(device, &module_ci, nullptr, &module);
+        return module;
+    }
+
+    // Vertex only pipeline with rasterization disabled, so that it is usable in render_pass without any attachment
+    VkPipeline CreatePipeline(VkPipelineLayout layout, VkShaderModule module) const {
+        VkPipelineShaderStageCreateInfo stage = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+        stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stage.module = module;
+        stage.pName = "main";
+        VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+        VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+        rasterization.rasterizerDiscardEnable = VK_TRUE;
+        rasterization.lineWidth = 1.0f;
+
+        VkGraphicsPipelineCreateInfo pipeline_ci = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+        pipeline_ci.stageCount = 1;
+        pipeline_ci.pStages = &stage;
+        pipeline_ci.pVertexInputState = &vertex_input;
+        pipeline_ci.pInputAssemblyState = &input_assembly;
+        pipeline_ci.pRasterizationState = &rasterization;
+        pipeline_ci.layout = layout;
+        pipeline_ci.renderPass = render_pass;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_ci, nullptr, &pipeline);
+        return pipeline;
+    }
+
+    VkPipeline CreatePipeline(uint32_t set_count, uint32_t additions) {
+        VkPipelineLayout layout = CreatePipelineLayout(set_count);
+        VkShaderModule module = CreateShaderModule(BuildVertexShader(set_count, additions));
+        if (layout == VK_NULL_HANDLE || module == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+        OnDestroy([this, module]() { vk::DestroyShaderModule(device, module, nullptr); });
+        VkPipeline pipeline = CreatePipeline(layout, module);
+        if (pipeline != VK_NULL_HANDLE) {
+            OnDestroy([this, pipeline]() { vk::DestroyPipeline(device, pipeline, nullptr); });
+        }
+        return pipeline;
+    }
+
+    VkCommandPool CreateCommandPool() const {
+        VkCommandPoolCreateInfo pool_ci = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+        pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_ci.queueFamilyIndex = queue_family;
+        VkCommandPool pool = VK_NULL_HANDLE;
+        vk::CreateCommandPool(device, &pool_ci, nullptr, &pool);
+        return pool;
+    }
+
+    std::vector<VkCommandBuffer> AllocateCommandBuffers(VkCommandPool pool, uint32_t count) const {
+        std::vector<VkCommandBuffer> command_buffers(count);
+        VkCommandBufferAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = count;
+        if (vk::AllocateCommandBuffers(device, &alloc_info, command_buffers.data()) != VK_SUCCESS) return {};
+        return command_buffers;
+    }
+
+    void BeginRenderPass(VkCommandBuffer command_buffer) const {
+        VkRenderPassBeginInfo begin_info = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+        begin_info.renderPass = render_pass;
+        begin_info.framebuffer = framebuffer;
+        begin_info.renderArea = {{0, 0}, {kFramebufferSize, kFramebufferSize}};
+        vk::CmdBeginRenderPass(command_buffer, &begin_info, VK_SUBPASS_CONTENTS_INLINE);
+    }
+
+    void OnDestroy(std::function<void()> &&deleter) { deleters_.emplace_back(std::move(deleter)); }
+
+  private:
+    static constexpr uint32_t kFramebufferSize = 32;
+
+    BenchmarkContext() = default;
+
+    bool Init(ContextConfig config) {
+        VkApplicationInfo app_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+        app_info.pApplicationName = "vk_layer_benchmarks";
+        app_info.apiVersion = VK_API_VERSION_1_1;
+
+        const VkValidationFeatureEnableEXT sync_enable = VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT;
+        const VkValidationFeatureDisableEXT shaders_disable = VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT;
+        VkValidationFeaturesEXT validation_features = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT};
+        if (config == ContextConfig::kSyncValidation) {
+            validation_features.enabledValidationFeatureCount = 1;
+            validation_features.pEnabledValidationFeatures = &sync_enable;
+        } else if (config == ContextConfig::kNoShaderValidation) {
+            validation_features.disabledValidationFeatureCount = 1;
+            validation_features.pDisabledValidationFeatures = &shaders_disable;
+        }
+        const bool use_features = config != ContextConfig::kDefault;
+
+        const char *extensions[] = {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME};
+        VkInstanceCreateInfo instance_ci = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+        instance_ci.pNext = use_features ? &validation_features : nullptr;
+        instance_ci.pApplicationInfo = &app_info;
+        instance_ci.enabledLayerCount = 1;
+        instance_ci.ppEnabledLayerNames = &kValidationLayerName;
+        instance_ci.enabledExtensionCount = use_features ? 2 : 1;
+        instance_ci.ppEnabledExtensionNames = extensions;
+        if (vk::CreateInstance(&instance_ci, nullptr, &instance) != VK_SUCCESS) {
+            fprintf(stderr, "vkCreateInstance failed, check VK_LAYER_PATH and VK_ICD_FILENAMES\n");
+            return false;
+        }
+        OnDestroy([this]() { vk::DestroyInstance(instance, nullptr); });
+
+        auto create_messenger = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(
+            vk::GetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT"));
+        auto destroy_messenger = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(
+            vk::GetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT"));
+        VkDebugUtilsMessengerCreateInfoEXT messenger_ci = {VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messenger_ci.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        messenger_ci.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        messenger_ci.pfnUserCallback = DebugCallback;
+        VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+        if (!create_messenger || create_messenger(instance, &messenger_ci, nullptr, &messenger) != VK_SUCCESS) {
+            return false;
+        }
+        OnDestroy([this, destroy_messenger, messenger]() { destroy_messenger(instance, messenger, nullptr); });
+
+        uint32_t gpu_count = 1;
+        if (vk::EnumeratePhysicalDevices(instance, &gpu_count, &gpu) < VK_SUCCESS || gpu_count == 0) return false;
+        VkPhysicalDeviceProperties properties;
+        vk::GetPhysicalDeviceProperties(gpu, &properties);
+        limits = properties.limits;
+        vk::GetPhysicalDeviceMemoryProperties(gpu, &memory_properties_);
+
+        uint32_t family_count = 0;
+        vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vk::GetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, families.data());
+        auto graphics = std::find_if(families.begin(), families.end(), [](const VkQueueFamilyProperties &family) {
+            return (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        });
+        if (graphics == families.end()) return false;
+        queue_family = static_cast<uint32_t>(graphics - families.begin());
+
+        const float priority = 1.0f;
+        VkDeviceQueueCreateInfo queue_ci = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+        queue_ci.queueFamilyIndex = queue_family;
+        queue_ci.queueCount = 1;
+        queue_ci.pQueuePriorities = &priority;
+        VkDeviceCreateInfo device_ci = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+        device_ci.queueCreateInfoCount = 1;
+        device_ci.pQueueCreateInfos = &queue_ci;
+        if (vk::CreateDevice(gpu, &device_ci, nullptr, &device) != VK_SUCCESS) return false;
+        OnDestroy([this]() { vk::DestroyDevice(device, nullptr); });
+        vk::GetDeviceQueue(device, queue_family, 0, &queue);
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        VkRenderPassCreateInfo render_pass_ci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+        render_pass_ci.subpassCount = 1;
+        render_pass_ci.pSubpasses = &subpass;
+        if (vk::CreateRenderPass(device, &render_pass_ci, nullptr, &render_pass) != VK_SUCCESS) return false;
+        OnDestroy([this]() { vk::DestroyRenderPass(device, render_pass, nullptr); });
+
+        VkFramebufferCreateInfo framebuffer_ci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+        framebuffer_ci.renderPass = render_pass;
+        framebuffer_ci.width = kFramebufferSize;
+        framebuffer_ci.height = kFramebufferSize;
+        framebuffer_ci.layers = 1;
+        if (vk::CreateFramebuffer(device, &framebuffer_ci, nullptr, &framebuffer) != VK_SUCCESS) return false;
+        OnDestroy([this]() { vk::DestroyFramebuffer(device, framebuffer, nullptr); });
+
+        uniform_buffer = CreateBuffer(kUniformBufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+        if (uniform_buffer == VK_NULL_HANDLE) return false;
+
+        VkDescriptorSetLayoutBinding binding = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr};
+        VkDescriptorSetLayoutCreateInfo set_layout_ci = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+        set_layout_ci.bindingCount = 1;
+        set_layout_ci.pBindings = &binding;
+        if (vk::CreateDescriptorSetLayout(device, &set_layout_ci, nullptr, &set_layout) != VK_SUCCESS) return false;
+        OnDestroy([this]() { vk::DestroyDescriptorSetLayout(device, set_layout, nullptr); });
+
+        return true;
+    }
+
+    uint32_t MemoryTypeIndex(uint32_t type_bits) const {
+        for (uint32_t i = 0; i < memory_properties_.memoryTypeCount; ++i) {
+            if (type_bits & (1u << i)) return i;
+        }
+        return 0;
+    }
+
+    VkDeviceMemory AllocateMemory(const VkMemoryRequirements &requirements) {
+        VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+        alloc_info.allocationSize = requirements.size;
+        alloc_info.memoryTypeIndex = MemoryTypeIndex(requirements.memoryTypeBits);
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        if (vk::AllocateMemory(device, &alloc_info, nullptr, &memory) != VK_SUCCESS) return VK_NULL_HANDLE;
+        OnDestroy([this, memory]() { vk::FreeMemory(device, memory, nullptr); });
+        return memory;
+    }
+
+    VkPhysicalDeviceMemoryProperties memory_properties_ = {};
+    std::vector<std::function<void()>> deleters_;
+};
+
+std::mutex contexts_lock;
+std::unique_ptr<BenchmarkContext> contexts[static_cast<size_t>(ContextConfig::kCount)];
+
+// Contexts are created on first use and shared by all the benchmarks (and benchmark threads) using them
+BenchmarkContext *GetContext(ContextConfig config) {
+    std::lock_guard<std::mutex> lock(contexts_lock);
+    auto &context = contexts[static_cast<size_t>(config)];
+    if (!context) {
+        context = BenchmarkContext::Create(config);
+    }
+    return context.get();
+}
+
+// Fails the benchmark if the scenario produced validation errors, since it would then be timing the error reporting paths
+class ValidationErrorCheck {
+  public:
+    explicit ValidationErrorCheck(benchmark::State &state) : state_(state), start_count_(validation_error_count.load()) {}
+    ~ValidationErrorCheck() {
+        const uint32_t errors = validation_error_count.load() - start_count_;
+        if (errors > 0 && state_.thread_index() == 0) {
+            state_.SkipWithError("The benchmark scenario produced validation errors");
+        }
+    }
+
+  private:
+    benchmark::State &state_;
+    const uint32_t start_count_;
+};
+
+#define BENCHMARK_CONTEXT(context, state, config)                          \
+    BenchmarkContext *context = GetContext(config);                        \
+    if (!context) {                                                        \
+        state.SkipWithError("Could not create a device with the layer");   \
+        return;                                                            \
+    }                                                                      \
+    ValidationErrorCheck validation_error_check(state)
+
+// Layer start up cost: vkCreateInstance and vkCreateDevice, and their destruction
+void BM_CreateInstanceAndDevice(benchmark::State &state) {
+    ValidationErrorCheck validation_error_check(state);
+    for (auto _ : state) {
+        auto context = BenchmarkContext::Create(ContextConfig::kDefault);
+        if (!context) {
+            state.SkipWithError("Could not create a device with the layer");
+            return;
+        }
+    }
+}
+BENCHMARK(BM_CreateInstanceAndDevice)->Unit(benchmark::kMillisecond);
+
+// Recording draws with state.range(0) descriptor sets bound, read by the vertex shader
+void BM_RecordDrawsWithDescriptorSets(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const uint32_t set_count = static_cast<uint32_t>(state.range(0));
+    if (set_count > context->limits.maxBoundDescriptorSets) {
+        state.SkipWithError("Not enough bindable descriptor sets");
+        return;
+    }
+    const uint32_t draw_count = 64;
+
+    VkPipeline pipeline = context->CreatePipeline(set_count, 0);
+    VkPipelineLayout layout = context->CreatePipelineLayout(set_count);
+    const auto sets = context->CreateDescriptorSets(set_count);
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, 1);
+    if (pipeline == VK_NULL_HANDLE || layout == VK_NULL_HANDLE || sets.size() != set_count || command_buffers.empty()) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, pool]() { vk::DestroyCommandPool(context->device, pool, nullptr); });
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    for (auto _ : state) {
+        VkCommandBuffer command_buffer = command_buffers[0];
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        context->BeginRenderPass(command_buffer);
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        for (uint32_t draw = 0; draw < draw_count; ++draw) {
+            vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, set_count, sets.data(), 0,
+                                      nullptr);
+            vk::CmdDraw(command_buffer, 3, 1, 0, 0);
+        }
+        vk::CmdEndRenderPass(command_buffer);
+        vk::EndCommandBuffer(command_buffer);
+    }
+    state.SetItemsProcessed(state.iterations() * draw_count);
+}
+BENCHMARK(BM_RecordDrawsWithDescriptorSets)->Arg(1)->Arg(4)->Arg(8)->Arg(16);
+
+// A single vkUpdateDescriptorSets call writing state.range(0) descriptor sets
+void BM_UpdateDescriptorSets(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const uint32_t write_count = static_cast<uint32_t>(state.range(0));
+    const auto sets = context->CreateDescriptorSets(write_count);
+    if (sets.size() != write_count) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+
+    std::vector<VkWriteDescriptorSet> writes;
+    const VkDescriptorBufferInfo buffer_info = {context->uniform_buffer, 0, BenchmarkContext::kUniformBufferSize};
+    BenchmarkContext::BuildDescriptorWrites(sets, buffer_info, writes);
+    for (auto _ : state) {
+        vk::UpdateDescriptorSets(context->device, write_count, writes.data(), 0, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations() * write_count);
+}
+BENCHMARK(BM_UpdateDescriptorSets)->Arg(16)->Arg(256)->Arg(4096);
+
+// A vkQueueSubmit of state.range(0) pre-recorded command buffers, followed by vkQueueWaitIdle to retire them
+void BM_QueueSubmit(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const uint32_t command_buffer_count = static_cast<uint32_t>(state.range(0));
+    VkBuffer buffer = context->CreateBuffer(1024, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, command_buffer_count);
+    if (buffer == VK_NULL_HANDLE || command_buffers.size() != command_buffer_count) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, pool]() { vk::DestroyCommandPool(context->device, pool, nullptr); });
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    for (VkCommandBuffer command_buffer : command_buffers) {
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        vk::CmdFillBuffer(command_buffer, buffer, 0, VK_WHOLE_SIZE, 0);
+        vk::EndCommandBuffer(command_buffer);
+    }
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = command_buffer_count;
+    submit_info.pCommandBuffers = command_buffers.data();
+    for (auto _ : state) {
+        vk::QueueSubmit(context->queue, 1, &submit_info, VK_NULL_HANDLE);
+        vk::QueueWaitIdle(context->queue);
+    }
+    state.SetItemsProcessed(state.iterations() * command_buffer_count);
+}
+BENCHMARK(BM_QueueSubmit)->Arg(1)->Arg(16)->Arg(256);
+
+// A vkQueueSubmit of a pre-recorded command buffer transitioning every other mip level of state.range(0) images, followed by
+// vkQueueWaitIdle. When state.range(1) is 0, the command buffer transitions the images back to the layouts it found them in,
+// so the global layouts do not change and resubmitting it skips the validation of its initial layouts. Otherwise two command
+// buffers alternate between two layouts, and every submit has to validate them again.
+void BM_ResubmitImageLayouts(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const uint32_t image_count = static_cast<uint32_t>(state.range(0));
+    const bool alternate = state.range(1) != 0;
+    const uint32_t mip_levels = 5;
+    const uint32_t array_layers = 4;
+    std::vector<VkImage> images;
+    for (uint32_t i = 0; i < image_count; ++i) {
+        images.push_back(context->CreateImage(VK_IMAGE_TYPE_2D, {16, 16, 1}, mip_levels, array_layers));
+    }
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, 3);
+    if (std::count(images.begin(), images.end(), VK_NULL_HANDLE) > 0 || command_buffers.size() != 3) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, pool]() { vk::DestroyCommandPool(context->device, pool, nullptr); });
+
+    std::vector<VkImageMemoryBarrier> barriers;
+    const auto record_transitions = [&](VkCommandBuffer command_buffer, VkImageLayout old_layout, VkImageLayout new_layout,
+                                        uint32_t mip_step) {
+        barriers.clear();
+        for (VkImage image : images) {
+            for (uint32_t mip = 0; mip < mip_levels; mip += mip_step) {
+                VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.oldLayout = old_layout;
+                barrier.newLayout = new_layout;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.image = image;
+                barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, 0, array_layers};
+                barriers.push_back(barrier);
+            }
+        }
+        vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+    };
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    vk::BeginCommandBuffer(command_buffers[0], &begin_info);
+    record_transitions(command_buffers[0], VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_GENERAL, 1);
+    vk::EndCommandBuffer(command_buffers[0]);
+    vk::BeginCommandBuffer(command_buffers[1], &begin_info);
+    record_transitions(command_buffers[1], VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 2);
+    if (!alternate) {
+        record_transitions(command_buffers[1], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, 2);
+    }
+    vk::EndCommandBuffer(command_buffers[1]);
+    vk::BeginCommandBuffer(command_buffers[2], &begin_info);
+    record_transitions(command_buffers[2], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_GENERAL, 2);
+    vk::EndCommandBuffer(command_buffers[2]);
+
+    VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &command_buffers[0];
+    vk::QueueSubmit(context->queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(context->queue);
+
+    uint64_t submit_count = 0;
+    for (auto _ : state) {
+        const bool back = alternate && (submit_count++ % 2) != 0;
+        submit_info.pCommandBuffers = &command_buffers[back ? 2 : 1];
+        vk::QueueSubmit(context->queue, 1, &submit_info, VK_NULL_HANDLE);
+        vk::QueueWaitIdle(context->queue);
+    }
+    state.SetItemsProcessed(state.iterations() * image_count);
+}
+BENCHMARK(BM_ResubmitImageLayouts)->Args({1, 0})->Args({1, 1})->Args({16, 0})->Args({16, 1})->Args({256, 0})->Args({256, 1});
+
+// vkCreateShaderModule of a vertex shader with state.range(0) instructions in its body. Core validation caches the hashes of
+// the modules that passed spirv-val, so after the first iteration this times the hashing and parsing of the code rather than
+// spirv-val itself.
+void BM_CreateShaderModule(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const auto code = BuildVertexShader(1, static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        VkShaderModule module = context->CreateShaderModule(code);
+        vk::DestroyShaderModule(context->device, module, nullptr);
+    }
+    state.SetBytesProcessed(state.iterations() * code.size() * sizeof(uint32_t));
+}
+BENCHMARK(BM_CreateShaderModule)->Arg(256)->Arg(4096)->Arg(65536)->Unit(benchmark::kMicrosecond);
+
+// vkCreateShaderModule of the same shaders with shader validation disabled, where the time spent in the layer is the parsing
+// of the SPIR-V into the module state
+void BM_ParseShaderModule(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kNoShaderValidation);
+    const auto code = BuildVertexShader(1, static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        VkShaderModule module = context->CreateShaderModule(code);
+        vk::DestroyShaderModule(context->device, module, nullptr);
+    }
+    state.SetBytesProcessed(state.iterations() * code.size() * sizeof(uint32_t));
+}
+BENCHMARK(BM_ParseShaderModule)->Arg(256)->Arg(4096)->Arg(65536)->Unit(benchmark::kMicrosecond);
+
+// BM_ParseShaderModule of glslang compiled shaders instead of generated ones: the GPU-AV shaders the layer ships, in the
+// order gpu_pre_draw_vert, gpu_pre_dispatch_comp and gpu_as_inspection_comp
+void BM_ParseShaderModuleCorpus(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kNoShaderValidation);
+    static const std::vector<uint32_t> corpus[] = {
+        std::vector<uint32_t>(std::begin(gpu_pre_draw_vert), std::end(gpu_pre_draw_vert)),
+        std::vector<uint32_t>(std::begin(gpu_pre_dispatch_comp), std::end(gpu_pre_dispatch_comp)),
+        std::vector<uint32_t>(std::begin(gpu_as_inspection_comp), std::end(gpu_as_inspection_comp)),
+    };
+    const auto &code = corpus[state.range(0)];
+    for (auto _ : state) {
+        VkShaderModule module = context->CreateShaderModule(code);
+        vk::DestroyShaderModule(context->device, module, nullptr);
+    }
+    state.SetBytesProcessed(state.iterations() * code.size() * sizeof(uint32_t));
+}
+BENCHMARK(BM_ParseShaderModuleCorpus)->DenseRange(0, 2)->Unit(benchmark::kMicrosecond);
+
+// vkCreateGraphicsPipelines from a vertex shader with state.range(0) instructions in its body
+void BM_CreateGraphicsPipeline(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    VkPipelineLayout layout = context->CreatePipelineLayout(1);
+    VkShaderModule module = context->CreateShaderModule(BuildVertexShader(1, static_cast<uint32_t>(state.range(0))));
+    if (layout == VK_NULL_HANDLE || module == VK_NULL_HANDLE) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, module]() { vk::DestroyShaderModule(context->device, module, nullptr); });
+
+    for (auto _ : state) {
+        VkPipeline pipeline = context->CreatePipeline(layout, module);
+        vk::DestroyPipeline(context->device, pipeline, nullptr);
+    }
+}
+BENCHMARK(BM_CreateGraphicsPipeline)->Arg(256)->Arg(4096)->Arg(65536)->Unit(benchmark::kMicrosecond);
+
+// Recording state.range(0) rounds of buffer copies separated by barriers, with synchronization validation enabled
+void BM_SyncValBarriers(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kSyncValidation);
+    const uint32_t round_count = static_cast<uint32_t>(state.range(0));
+    const VkDeviceSize size = 4096;
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    VkBuffer buffers[2] = {context->CreateBuffer(size, usage), context->CreateBuffer(size, usage)};
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, 1);
+    if (buffers[0] == VK_NULL_HANDLE || buffers[1] == VK_NULL_HANDLE || command_buffers.empty()) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, pool]() { vk::DestroyCommandPool(context->device, pool, nullptr); });
+
+    // Copy back and forth in 16 interleaved slices, so the barriers have several ranges to resolve
+    const uint32_t slice_count = 16;
+    std::vector<VkBufferCopy> regions(slice_count / 2);
+    std::vector<VkBufferMemoryBarrier> barriers(slice_count / 2);
+    const VkDeviceSize slice_size = size / slice_count;
+    for (uint32_t i = 0; i < slice_count / 2; ++i) {
+        const VkDeviceSize offset = 2 * i * slice_size;
+        regions[i] = {offset, offset, slice_size};
+        barriers[i] = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER};
+        barriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[i].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].offset = offset;
+        barriers[i].size = slice_size;
+    }
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    for (auto _ : state) {
+        VkCommandBuffer command_buffer = command_buffers[0];
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        for (uint32_t round = 0; round < round_count; ++round) {
+            const VkBuffer src = buffers[round % 2];
+            const VkBuffer dst = buffers[(round + 1) % 2];
+            vk::CmdCopyBuffer(command_buffer, src, dst, static_cast<uint32_t>(regions.size()), regions.data());
+            for (auto &barrier : barriers) {
+                barrier.buffer = dst;
+            }
+            vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr,
+                                   static_cast<uint32_t>(barriers.size()), barriers.data(), 0, nullptr);
+        }
+        vk::EndCommandBuffer(command_buffer);
+    }
+    state.SetItemsProcessed(state.iterations() * round_count);
+}
+BENCHMARK(BM_SyncValBarriers)->Arg(16)->Arg(256)->Arg(1024);
+
+// Recording 16 rounds of whole image copies separated by barriers, with synchronization validation enabled. The images have
+// 4 mip levels, and state.range(0) array layers, or state.range(0) slices when state.range(1) is 1 and they are 3D.
+void BM_SyncValImageCopies(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kSyncValidation);
+    const uint32_t depth_or_layers = static_cast<uint32_t>(state.range(0));
+    const bool is_3d = state.range(1) != 0;
+    const uint32_t round_count = 16;
+    const uint32_t mip_levels = 4;
+    const uint32_t array_layers = is_3d ? 1 : depth_or_layers;
+    const VkExtent3D extent = {64, 64, is_3d ? depth_or_layers : 1};
+    const VkImageType type = is_3d ? VK_IMAGE_TYPE_3D : VK_IMAGE_TYPE_2D;
+    VkImage images[2] = {context->CreateImage(type, extent, mip_levels, array_layers),
+                         context->CreateImage(type, extent, mip_levels, array_layers)};
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, 1);
+    if (images[0] == VK_NULL_HANDLE || images[1] == VK_NULL_HANDLE || command_buffers.empty()) {
+        state.SkipWithError("Scenario setup failed");
+        return;
+    }
+    context->OnDestroy([context, pool]() { vk::DestroyCommandPool(context->device, pool, nullptr); });
+
+    std::vector<VkImageCopy> regions(mip_levels);
+    for (uint32_t mip = 0; mip < mip_levels; ++mip) {
+        const VkImageSubresourceLayers layers = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 0, array_layers};
+        const VkExtent3D mip_extent = {std::max(extent.width >> mip, 1u), std::max(extent.height >> mip, 1u),
+                                       std::max(extent.depth >> mip, 1u)};
+        regions[mip] = {layers, {0, 0, 0}, layers, {0, 0, 0}, mip_extent};
+    }
+    VkImageMemoryBarrier barrier = {VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, mip_levels, 0, array_layers};
+    VkImageMemoryBarrier transitions[2] = {barrier, barrier};
+    for (uint32_t i = 0; i < 2; ++i) {
+        transitions[i].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+        transitions[i].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        transitions[i].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+        transitions[i].image = images[i];
+    }
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    for (auto _ : state) {
+        VkCommandBuffer command_buffer = command_buffers[0];
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                               nullptr, 2, transitions);
+        for (uint32_t round = 0; round < round_count; ++round) {
+            const VkImage src = images[round % 2];
+            const VkImage dst = images[(round + 1) % 2];
+            vk::CmdCopyImage(command_buffer, src, VK_IMAGE_LAYOUT_GENERAL, dst, VK_IMAGE_LAYOUT_GENERAL,
+                             static_cast<uint32_t>(regions.size()), regions.data());
+            barrier.image = dst;
+            vk::CmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0,
+                                   nullptr, 1, &barrier);
+        }
+        vk::EndCommandBuffer(command_buffer);
+    }
+    state.SetItemsProcessed(state.iterations() * round_count);
+}
+BENCHMARK(BM_SyncValImageCopies)->Args({1, 0})->Args({16, 0})->Args({64, 0})->Args({16, 1})->Args({64, 1});
+
+// Each thread records draws into a command buffer of its own command pool, sharing the pipeline and descriptor sets
+void BM_MultithreadedRecording(benchmark::State &state) {
+    BENCHMARK_CONTEXT(context, state, ContextConfig::kDefault);
+    const uint32_t set_count = 4;
+    const uint32_t draw_count = 64;
+
+    // Shared objects are created by the first thread while the others wait at the start of the timed loop
+    static VkPipeline pipeline = VK_NULL_HANDLE;
+    static VkPipelineLayout layout = VK_NULL_HANDLE;
+    static std::vector<VkDescriptorSet> sets;
+    if (state.thread_index() == 0 && pipeline == VK_NULL_HANDLE) {
+        pipeline = context->CreatePipeline(set_count, 0);
+        layout = context->CreatePipelineLayout(set_count);
+        sets = context->CreateDescriptorSets(set_count);
+    }
+    VkCommandPool pool = context->CreateCommandPool();
+    const auto command_buffers = context->AllocateCommandBuffers(pool, 1);
+
+    const VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    for (auto _ : state) {
+        if (pipeline == VK_NULL_HANDLE || sets.size() != set_count || command_buffers.empty()) {
+            state.SkipWithError("Scenario setup failed");
+            break;
+        }
+        VkCommandBuffer command_buffer = command_buffers[0];
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        context->BeginRenderPass(command_buffer);
+        vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        for (uint32_t draw = 0; draw < draw_count; ++draw) {
+            vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, set_count, sets.data(), 0,
+                                      nullptr);
+            vk::CmdDraw(command_buffer, 3, 1, 0, 0);
+        }
+        vk::CmdEndRenderPass(command_buffer);
+        vk::EndCommandBuffer(command_buffer);
+    }
+    state.SetItemsProcessed(state.iterations() * draw_count);
+
+    vk::DestroyCommandPool(context->device, pool, nullptr);
+}
+BENCHMARK(BM_MultithreadedRecording)->ThreadRange(1, 8)->UseRealTime();
+
+// Keys like the ones of the command buffer sets: non-dispatchable handles, which hash to themselves and have their low bits
+// clear, typed handles of bound objects, and the queries of activeQueries and startedQueries
+template <typename Key>
+std::vector<Key> MakeKeys(uint32_t count);
+
+template <>
+std::vector<VkEvent> MakeKeys<VkEvent>(uint32_t count) {
+    std::vector<VkEvent> keys;
+    for (uint64_t i = 1; i <= count; ++i) {
+        keys.push_back(CastFromUint64<VkEvent>(i << 12));
+    }
+    return keys;
+}
+
+template <>
+std::vector<VulkanTypedHandle> MakeKeys<VulkanTypedHandle>(uint32_t count) {
+    std::vector<VulkanTypedHandle> keys;
+    for (uint64_t i = 1; i <= count; ++i) {
+        if (i % 2) {
+            keys.emplace_back(CastFromUint64<VkBuffer>(i << 12), kVulkanObjectTypeBuffer);
+        } else {
+            keys.emplace_back(CastFromUint64<VkImage>(i << 12), kVulkanObjectTypeImage);
+        }
+    }
+    return keys;
+}
+
+template <>
+std::vector<QueryObject> MakeKeys<QueryObject>(uint32_t count) {
+    std::vector<QueryObject> keys;
+    const VkQueryPool pool = CastFromUint64<VkQueryPool>(1 << 12);
+    for (uint32_t i = 0; i < count; ++i) {
+        keys.emplace_back(pool, i);
+    }
+    return keys;
+}
+
+// The life of a command buffer set: state.range(0) keys inserted while recording, each looked up twice, then cleared on
+// reset. The same container is reused, as command buffers are.
+template <typename Set>
+void BM_HashSetRecordReset(benchmark::State &state) {
+    const auto keys = MakeKeys<typename Set::key_type>(static_cast<uint32_t>(state.range(0)));
+    Set set;
+    for (auto _ : state) {
+        for (const auto &key : keys) {
+            set.insert(key);
+        }
+        size_t found = 0;
+        for (const auto &key : keys) {
+            found += set.count(key);
+            found += set.count(key);
+        }
+        benchmark::DoNotOptimize(found);
+        set.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::unordered_set<VkEvent>)->Arg(4)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::flat_unordered_set<VkEvent>)->Arg(4)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::unordered_set<VulkanTypedHandle>)->Arg(4)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::flat_unordered_set<VulkanTypedHandle>)->Arg(4)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::unordered_set<QueryObject>)->Arg(4)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_HashSetRecordReset, layer_data::flat_unordered_set<QueryObject>)->Arg(4)->Arg(16)->Arg(256);
+
+// A command buffer that is reused for a small recording after a large one, where clear() of the set that grew for the large
+// recording is paid by every later reset
+template <typename Set>
+void BM_HashSetClearAfterPeak(benchmark::State &state) {
+    const auto keys = MakeKeys<typename Set::key_type>(4096);
+    Set set;
+    for (const auto &key : keys) {
+        set.insert(key);
+    }
+    set.clear();
+    const size_t count = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; ++i) {
+            set.insert(keys[i]);
+        }
+        set.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK_TEMPLATE(BM_HashSetClearAfterPeak, layer_data::unordered_set<VkEvent>)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_HashSetClearAfterPeak, layer_data::flat_unordered_set<VkEvent>)->Arg(4)->Arg(16);
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    vk::InitDispatchTable();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    for (auto &context : contexts) {
+        context.reset();
+    }
+    return 0;
+}
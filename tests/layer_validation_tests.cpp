@@ -1252,6 +1252,61 @@ void SetImageLayout(VkDeviceObj *device, VkImageAspectFlags aspect, VkImage imag
     cmd_buf.QueueCommandBuffer();
 }
 
+void VkGraphicsLibraryLayerTest::CreateShaderLibraries(CreatePipelineHelper &pre_raster_lib, CreatePipelineHelper &frag_shader_lib,
+                                                       VkPipelineLayout pre_raster_layout, VkPipelineLayout frag_shader_layout,
+                                                       const VkPipelineDynamicStateCreateInfo *pre_raster_dynamic_state) {
+    const auto vs_spv = GLSLToSPV(VK_SHADER_STAGE_VERTEX_BIT, bindStateVertShaderText);
+    auto vs_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+    vs_ci.codeSize = vs_spv.size() * sizeof(decltype(vs_spv)::value_type);
+    vs_ci.pCode = vs_spv.data();
+
+    auto vs_stage_ci = LvlInitStruct<VkPipelineShaderStageCreateInfo>(&vs_ci);
+    vs_stage_ci.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    vs_stage_ci.module = VK_NULL_HANDLE;
+    vs_stage_ci.pName = "main";
+
+    pre_raster_lib.InitPreRasterLibInfo(1, &vs_stage_ci);
+    pre_raster_lib.InitState();
+    if (pre_raster_dynamic_state) {
+        pre_raster_lib.dyn_state_ci_ = *pre_raster_dynamic_state;
+    }
+    pre_raster_lib.LateBindPipelineInfo();
+    if (pre_raster_layout != VK_NULL_HANDLE) {
+        pre_raster_lib.gp_ci_.layout = pre_raster_layout;
+    }
+    ASSERT_VK_SUCCESS(pre_raster_lib.CreateGraphicsPipeline(true, false));
+
+    const auto fs_spv = GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, bindStateFragShaderText);
+    auto fs_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+    fs_ci.codeSize = fs_spv.size() * sizeof(decltype(fs_spv)::value_type);
+    fs_ci.pCode = fs_spv.data();
+
+    auto fs_stage_ci = LvlInitStruct<VkPipelineShaderStageCreateInfo>(&fs_ci);
+    fs_stage_ci.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    fs_stage_ci.module = VK_NULL_HANDLE;
+    fs_stage_ci.pName = "main";
+
+    // Layout, renderPass, and subpass all need to be shared across libraries in the same executable pipeline
+    frag_shader_lib.InitFragmentLibInfo(1, &fs_stage_ci);
+    frag_shader_lib.gp_ci_.layout = (frag_shader_layout != VK_NULL_HANDLE) ? frag_shader_layout : pre_raster_lib.gp_ci_.layout;
+    frag_shader_lib.gp_ci_.renderPass = pre_raster_lib.gp_ci_.renderPass;
+    frag_shader_lib.gp_ci_.subpass = pre_raster_lib.gp_ci_.subpass;
+    ASSERT_VK_SUCCESS(frag_shader_lib.CreateGraphicsPipeline(true, false));
+}
+
+void VkGraphicsLibraryLayerTest::CreateInterfaceLibraries(CreatePipelineHelper &vertex_input_lib,
+                                                          CreatePipelineHelper &frag_out_lib,
+                                                          const CreatePipelineHelper &pre_raster_lib) {
+    vertex_input_lib.InitVertexInputLibInfo();
+    vertex_input_lib.InitState();
+    ASSERT_VK_SUCCESS(vertex_input_lib.CreateGraphicsPipeline(true, false));
+
+    frag_out_lib.InitFragmentOutputLibInfo();
+    frag_out_lib.gp_ci_.renderPass = pre_raster_lib.gp_ci_.renderPass;
+    frag_out_lib.gp_ci_.subpass = pre_raster_lib.gp_ci_.subpass;
+    ASSERT_VK_SUCCESS(frag_out_lib.CreateGraphicsPipeline(true, false));
+}
+
 std::unique_ptr<VkImageObj> VkArmBestPracticesLayerTest::CreateImage(VkFormat format, const uint32_t width,
                                                                      const uint32_t height,
                                                                      VkImageUsageFlags attachment_usage) {
@@ -371,6 +371,22 @@ class VkSyncValTest : public VkLayerTest {
     VkValidationFeaturesEXT features_ = {VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT, nullptr, 1, enables_, 4, disables_};
 };
 
+struct CreatePipelineHelper;
+class VkGraphicsLibraryLayerTest : public VkLayerTest {
+  public:
+    // Creates pre-rasterization and fragment shader libraries of bindStateVertShaderText and bindStateFragShaderText. The
+    // fragment shader library uses the render pass and subpass of the pre-rasterization library, and also its layout if
+    // frag_shader_layout is VK_NULL_HANDLE. pre_raster_dynamic_state, if not null, is the dynamic state of the pre-rasterization
+    // library.
+    void CreateShaderLibraries(CreatePipelineHelper &pre_raster_lib, CreatePipelineHelper &frag_shader_lib,
+                               VkPipelineLayout pre_raster_layout = VK_NULL_HANDLE,
+                               VkPipelineLayout frag_shader_layout = VK_NULL_HANDLE,
+                               const VkPipelineDynamicStateCreateInfo *pre_raster_dynamic_state = nullptr);
+    // Creates the vertex input and fragment output libraries that complete the shader libraries into an executable pipeline
+    void CreateInterfaceLibraries(CreatePipelineHelper &vertex_input_lib, CreatePipelineHelper &frag_out_lib,
+                                  const CreatePipelineHelper &pre_raster_lib);
+};
+
 class VkBufferTest {
   public:
     enum eTestEnFlags {
@@ -404,7 +420,6 @@ class VkBufferTest {
     VkDeviceMemory VulkanMemory;
 };
 
-struct CreatePipelineHelper;
 class VkVerticesObj {
   public:
     VkVerticesObj(VkDeviceObj *aVulkanDevice, unsigned aAttributeCount, unsigned aBindingCount, unsigned aByteStride,
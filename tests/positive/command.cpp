@@ -1037,6 +1037,50 @@ TEST_F(VkPositiveLayerTest, DestroyQueryPoolAfterGetQueryPoolResults) {
     vk::QueueWaitIdle(m_device->m_queue);
 }
 
+TEST_F(VkPositiveLayerTest, DestroyQueryPoolAfterGetQueryPoolResultsRange) {
+    TEST_DESCRIPTION("Destroy a query pool in use once vkGetQueryPoolResults() has returned all of its queries, with an offset");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    uint32_t queue_count;
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu(), &queue_count, NULL);
+    std::vector<VkQueueFamilyProperties> queue_props(queue_count);
+    vk::GetPhysicalDeviceQueueFamilyProperties(gpu(), &queue_count, queue_props.data());
+    if (queue_props[m_device->graphics_queue_node_index_].timestampValidBits == 0) {
+        GTEST_SKIP() << "Device graphic queue has timestampValidBits of 0";
+    }
+
+    VkQueryPoolCreateInfo query_pool_create_info = LvlInitStruct<VkQueryPoolCreateInfo>();
+    query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_pool_create_info.queryCount = 4;
+
+    VkQueryPool query_pool;
+    ASSERT_VK_SUCCESS(vk::CreateQueryPool(m_device->device(), &query_pool_create_info, nullptr, &query_pool));
+
+    m_commandBuffer->begin();
+    vk::CmdResetQueryPool(m_commandBuffer->handle(), query_pool, 0, 4);
+    for (uint32_t query = 0; query < 4; ++query) {
+        vk::CmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, query);
+    }
+    m_commandBuffer->end();
+
+    VkSubmitInfo submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    // The second call makes queries [1, 4) available. Query 3 used to be left out, as if the range were [1, 3), so the
+    // pool was still reported in use.
+    uint64_t data[4];
+    ASSERT_VK_SUCCESS(vk::GetQueryPoolResults(m_device->device(), query_pool, 0, 1, sizeof(uint64_t), data, sizeof(uint64_t),
+                                              VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+    ASSERT_VK_SUCCESS(vk::GetQueryPoolResults(m_device->device(), query_pool, 1, 3, 3 * sizeof(uint64_t), data,
+                                              sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT));
+    vk::DestroyQueryPool(m_device->device(), query_pool, nullptr);
+
+    vk::QueueWaitIdle(m_device->m_queue);
+}
+
 TEST_F(VkPositiveLayerTest, ClearRectWith2DArray) {
     TEST_DESCRIPTION("Test using VkClearRect with an image that is of a 2D array type.");
 
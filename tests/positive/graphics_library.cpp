@@ -25,7 +25,7 @@
 
 #include "cast_utils.h"
 
-class VkPositiveGraphicsLibraryLayerTest : public VkLayerTest {};
+class VkPositiveGraphicsLibraryLayerTest : public VkGraphicsLibraryLayerTest {};
 
 TEST_F(VkPositiveGraphicsLibraryLayerTest, VertexInputGraphicsPipelineLibrary) {
     TEST_DESCRIPTION("Create a vertex input graphics library");
@@ -266,6 +266,121 @@ TEST_F(VkPositiveGraphicsLibraryLayerTest, ExeLibrary) {
     ASSERT_TRUE(exe_pipe.initialized());
 }
 
+TEST_F(VkPositiveGraphicsLibraryLayerTest, ExeLibraryBatch) {
+    TEST_DESCRIPTION("Link the same graphics libraries into many executable pipelines with a single call");
+
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitFramework());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_2) {
+        GTEST_SKIP() << "At least Vulkan version 1.2 is required";
+    }
+
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+
+    auto gpl_features = LvlInitStruct<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>();
+    auto features2 = GetPhysicalDeviceFeatures2(gpl_features);
+    if (!gpl_features.graphicsPipelineLibrary) {
+        GTEST_SKIP() << "VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT::graphicsPipelineLibrary not supported";
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    CreatePipelineHelper pre_raster_lib(*this);
+    CreatePipelineHelper frag_shader_lib(*this);
+    CreatePipelineHelper vertex_input_lib(*this);
+    CreatePipelineHelper frag_out_lib(*this);
+    ASSERT_NO_FATAL_FAILURE(CreateShaderLibraries(pre_raster_lib, frag_shader_lib));
+    ASSERT_NO_FATAL_FAILURE(CreateInterfaceLibraries(vertex_input_lib, frag_out_lib, pre_raster_lib));
+
+    VkPipeline libraries[4] = {
+        vertex_input_lib.pipeline_,
+        pre_raster_lib.pipeline_,
+        frag_shader_lib.pipeline_,
+        frag_out_lib.pipeline_,
+    };
+    auto link_info = LvlInitStruct<VkPipelineLibraryCreateInfoKHR>();
+    link_info.libraryCount = size(libraries);
+    link_info.pLibraries = libraries;
+
+    // Enough create infos that validation of the batch is split across threads
+    constexpr uint32_t pipeline_count = 64;
+    const auto exe_pipe_ci = LvlInitStruct<VkGraphicsPipelineCreateInfo>(&link_info);
+    std::vector<VkGraphicsPipelineCreateInfo> exe_pipe_cis(pipeline_count, exe_pipe_ci);
+    std::vector<VkPipeline> exe_pipes(pipeline_count, VK_NULL_HANDLE);
+    ASSERT_VK_SUCCESS(vk::CreateGraphicsPipelines(m_device->device(), VK_NULL_HANDLE, pipeline_count, exe_pipe_cis.data(), nullptr,
+                                                  exe_pipes.data()));
+    for (auto pipe : exe_pipes) {
+        vk::DestroyPipeline(m_device->device(), pipe, nullptr);
+    }
+}
+
+TEST_F(VkPositiveGraphicsLibraryLayerTest, ExeLibraryDynamicState) {
+    TEST_DESCRIPTION("Draw with an executable pipeline whose only dynamic state comes from a linked library");
+
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitFramework());
+    if (DeviceValidationVersion() < VK_API_VERSION_1_2) {
+        GTEST_SKIP() << "At least Vulkan version 1.2 is required";
+    }
+
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+
+    auto gpl_features = LvlInitStruct<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>();
+    auto features2 = GetPhysicalDeviceFeatures2(gpl_features);
+    if (!gpl_features.graphicsPipelineLibrary) {
+        GTEST_SKIP() << "VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT::graphicsPipelineLibrary not supported";
+    }
+
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, &features2));
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    auto dyn_state_ci = LvlInitStruct<VkPipelineDynamicStateCreateInfo>();
+    const VkDynamicState dyn_states[] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    dyn_state_ci.dynamicStateCount = size(dyn_states);
+    dyn_state_ci.pDynamicStates = dyn_states;
+    CreatePipelineHelper pre_raster_lib(*this);
+    CreatePipelineHelper frag_shader_lib(*this);
+    CreatePipelineHelper vertex_input_lib(*this);
+    CreatePipelineHelper frag_out_lib(*this);
+    ASSERT_NO_FATAL_FAILURE(CreateShaderLibraries(pre_raster_lib, frag_shader_lib, VK_NULL_HANDLE, VK_NULL_HANDLE, &dyn_state_ci));
+    ASSERT_NO_FATAL_FAILURE(CreateInterfaceLibraries(vertex_input_lib, frag_out_lib, pre_raster_lib));
+
+    VkPipeline libraries[4] = {
+        vertex_input_lib.pipeline_,
+        pre_raster_lib.pipeline_,
+        frag_shader_lib.pipeline_,
+        frag_out_lib.pipeline_,
+    };
+    auto link_info = LvlInitStruct<VkPipelineLibraryCreateInfoKHR>();
+    link_info.libraryCount = size(libraries);
+    link_info.pLibraries = libraries;
+
+    // No pDynamicState here, all of it is merged in from pre_raster_lib
+    auto exe_pipe_ci = LvlInitStruct<VkGraphicsPipelineCreateInfo>(&link_info);
+    exe_pipe_ci.layout = pre_raster_lib.gp_ci_.layout;
+    vk_testing::Pipeline exe_pipe(*m_device, exe_pipe_ci);
+    ASSERT_TRUE(exe_pipe.initialized());
+
+    const VkViewport viewport = {0.0f, 0.0f, m_width, m_height, 0.0f, 1.0f};
+    const VkRect2D scissor = {{0, 0}, {static_cast<uint32_t>(m_width), static_cast<uint32_t>(m_height)}};
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, exe_pipe.handle());
+    vk::CmdSetViewport(m_commandBuffer->handle(), 0, 1, &viewport);
+    vk::CmdSetScissor(m_commandBuffer->handle(), 0, 1, &scissor);
+    vk::CmdDraw(m_commandBuffer->handle(), 3, 1, 0, 0);
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkPositiveGraphicsLibraryLayerTest, DrawWithNullDSLs) {
     TEST_DESCRIPTION("Make a draw with a pipeline layout derived from null DSLs");
 
@@ -281,6 +281,32 @@ TEST_F(VkPositiveLayerTest, RenderPassBeginTransitionsAttachmentUnused) {
     vk::DestroyRenderPass(m_device->device(), rp, nullptr);
 }
 
+TEST_F(VkPositiveLayerTest, RenderPassBeginCompatibleWithUnusedAttachments) {
+    TEST_DESCRIPTION("Begin a render pass with a framebuffer from a distinct render pass differing only by unused references.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkAttachmentReference att_refs[2] = {{VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL},
+                                         {VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_GENERAL}};
+    VkSubpassDescription subpass = {0, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, nullptr, 1, att_refs, nullptr, nullptr, 0, nullptr};
+    VkRenderPassCreateInfo rpci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 0, nullptr, 1, &subpass, 0, nullptr};
+    vk_testing::RenderPass rp_one(*m_device, rpci);
+
+    // Two unused color references are compatible with a single one
+    subpass.colorAttachmentCount = 2;
+    vk_testing::RenderPass rp_two(*m_device, rpci);
+
+    VkFramebufferCreateInfo fci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, rp_one.handle(), 0, nullptr, 32, 32, 1};
+    vk_testing::Framebuffer fb(*m_device, fci);
+
+    VkRenderPassBeginInfo rpbi = {
+        VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, rp_two.handle(), fb.handle(), {{0, 0}, {32, 32}}, 0, nullptr};
+    m_commandBuffer->begin();
+    vk::CmdBeginRenderPass(m_commandBuffer->handle(), &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+    vk::CmdEndRenderPass(m_commandBuffer->handle());
+    m_commandBuffer->end();
+}
+
 TEST_F(VkPositiveLayerTest, RenderPassBeginStencilLoadOp) {
     TEST_DESCRIPTION("Create a stencil-only attachment with a LOAD_OP set to CLEAR. stencil[Load|Store]Op used to be ignored.");
     VkResult result = VK_SUCCESS;
@@ -795,6 +795,83 @@ TEST_F(VkPositiveLayerTest, TwoQueuesEnsureCorrectRetirementWithWorkStolen) {
 }
 
 // This is a positive test.  No errors should be generated.
+class ThreadPoolSize {
+  public:
+    ThreadPoolSize(const uint32_t size) {
+        size_value.value32 = size;
+
+        strncpy(size_setting_val.name, "thread_pool_size", sizeof(size_setting_val.name));
+        size_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT;
+        size_setting_val.data = size_value;
+        size_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                        &size_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&size_setting};
+
+  private:
+    VkLayerSettingValueDataEXT size_value{};
+    VkLayerSettingValueEXT size_setting_val;
+    VkLayerSettingsEXT size_setting;
+};
+
+TEST_F(VkPositiveLayerTest, TwoQueueSemaphoreChainOneWorkerThread) {
+    TEST_DESCRIPTION(
+        "Submissions on two queues waiting for each other's semaphores, retired by a single worker thread. The retire task of "
+        "one queue must not wait for the task of the other queue, which is queued on the same worker.");
+
+    ThreadPoolSize thread_pool_size(1);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, thread_pool_size.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if ((m_device->queue_props.empty()) || (m_device->queue_props[0].queueCount < 2)) {
+        GTEST_SKIP() << "Queue family needs to have multiple queues to run this test";
+    }
+
+    VkQueue queues[2] = {m_device->m_queue, VK_NULL_HANDLE};
+    vk::GetDeviceQueue(m_device->device(), m_device->graphics_queue_node_index_, 1, &queues[1]);
+
+    VkCommandPoolObj pool(m_device, m_device->graphics_queue_node_index_);
+    VkCommandBufferObj cb0(m_device, &pool);
+    VkCommandBufferObj cb1(m_device, &pool);
+    auto begin_info = LvlInitStruct<VkCommandBufferBeginInfo>();
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+    for (auto *cb : {&cb0, &cb1}) {
+        cb->begin(&begin_info);
+        vk::CmdPipelineBarrier(cb->handle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 0,
+                               nullptr, 0, nullptr, 0, nullptr);
+        cb->end();
+    }
+    const VkCommandBuffer cbs[2] = {cb0.handle(), cb1.handle()};
+
+    constexpr uint32_t kIterations = 16;
+    std::vector<vk_testing::Semaphore> semaphores(kIterations * 2);
+    for (auto &semaphore : semaphores) {
+        semaphore.init(*m_device, LvlInitStruct<VkSemaphoreCreateInfo>());
+    }
+    vk_testing::Fence fence;
+    fence.init(*m_device, LvlInitStruct<VkFenceCreateInfo>());
+
+    // Each submission waits for the semaphore signaled by the previous one, on the other queue. Only the last queue is waited
+    // on, so that every retire task needs the other queue to be retired first.
+    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    for (uint32_t i = 0; i < semaphores.size(); ++i) {
+        auto submit_info = LvlInitStruct<VkSubmitInfo>();
+        if (i > 0) {
+            submit_info.waitSemaphoreCount = 1;
+            submit_info.pWaitSemaphores = &semaphores[i - 1].handle();
+            submit_info.pWaitDstStageMask = &wait_stage;
+        }
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &cbs[i % 2];
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &semaphores[i].handle();
+        const bool last = (i + 1 == semaphores.size());
+        vk::QueueSubmit(queues[i % 2], 1, &submit_info, last ? fence.handle() : VK_NULL_HANDLE);
+    }
+    // Used to log UNASSIGNED-VkSemaphore-state-timeout after 10 seconds
+    vk::WaitForFences(m_device->device(), 1, &fence.handle(), VK_TRUE, kWaitTimeout);
+    vk::DeviceWaitIdle(m_device->device());
+}
+
 TEST_F(VkPositiveLayerTest, TwoQueueSubmitsSeparateQueuesWithSemaphoreAndOneFence) {
     TEST_DESCRIPTION(
         "Two command buffers, each in a separate QueueSubmit call submitted on separate queues, the second having a fence, "
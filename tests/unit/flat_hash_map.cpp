@@ -0,0 +1,302 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_common.h"
+#include "flat_hash_map.h"
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Sends every key to the same probe start and control byte, so that lookups have to walk past full groups and tombstones
+struct CollidingHash {
+    size_t operator()(uint64_t) const { return 0; }
+};
+
+// Counts live instances, to check that erase, clear, rehashing and destruction destroy every element exactly once
+struct Tracked {
+    static int live;
+    uint64_t value;
+
+    explicit Tracked(uint64_t v = 0) : value(v) { ++live; }
+    Tracked(const Tracked &other) : value(other.value) { ++live; }
+    ~Tracked() { --live; }
+    Tracked &operator=(const Tracked &other) {
+        value = other.value;
+        return *this;
+    }
+};
+int Tracked::live = 0;
+
+struct PairKey {
+    uint64_t handle;
+    uint32_t index;
+    bool operator==(const PairKey &other) const { return handle == other.handle && index == other.index; }
+};
+
+struct PairKeyHash {
+    size_t operator()(const PairKey &key) const { return static_cast<size_t>(key.handle * 31 + key.index); }
+};
+
+template <typename Set>
+std::set<uint64_t> Contents(const Set &set) {
+    return std::set<uint64_t>(set.begin(), set.end());
+}
+
+}  // namespace
+
+TEST(FlatHashMap, InsertFindErase) {
+    layer_data::flat_unordered_set<uint64_t> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_TRUE(set.insert(1).second);
+    EXPECT_FALSE(set.insert(1).second);
+    EXPECT_TRUE(set.insert(2).second);
+    EXPECT_EQ(set.size(), 2u);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_EQ(set.count(3), 0u);
+    EXPECT_EQ(set.find(3), set.end());
+
+    EXPECT_EQ(set.erase(1), 1u);
+    EXPECT_EQ(set.erase(1), 0u);
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_EQ(set.size(), 1u);
+}
+
+TEST(FlatHashMap, StaysInlineUntilFull) {
+    layer_data::flat_unordered_set<uint64_t, 16> set;
+    const size_t inline_capacity = set.capacity();
+    // One slot in eight is kept free
+    for (uint64_t i = 0; i < 14; ++i) {
+        set.insert(i);
+    }
+    EXPECT_EQ(set.capacity(), inline_capacity);
+    set.insert(14);
+    EXPECT_GT(set.capacity(), inline_capacity);
+    EXPECT_EQ(Contents(set).size(), 15u);
+
+    // clear() keeps the allocated storage
+    const size_t capacity = set.capacity();
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.capacity(), capacity);
+    EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST(FlatHashMap, ClearShrinksOversizedStorage) {
+    layer_data::flat_unordered_set<uint64_t, 16> set;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        set.insert(i);
+    }
+    const size_t large_capacity = set.capacity();
+    // Storage that is mostly used is kept
+    set.clear();
+    EXPECT_EQ(set.capacity(), large_capacity);
+
+    // Storage much larger than the cleared elements is shrunk to fit them
+    for (uint64_t i = 0; i < 100; ++i) {
+        set.insert(i);
+    }
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_LT(set.capacity(), large_capacity);
+    EXPECT_GE(set.capacity() - set.capacity() / 8, 100u);
+    const size_t capacity = set.capacity();
+    for (uint64_t i = 0; i < 100; ++i) {
+        set.insert(i);
+    }
+    EXPECT_EQ(set.capacity(), capacity);
+    EXPECT_EQ(Contents(set).size(), 100u);
+
+    // Down to the inline storage
+    set.clear();
+    set.insert(1);
+    set.clear();
+    EXPECT_EQ(set.capacity(), 16u);
+    EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST(FlatHashMap, EraseLeavesTombstonesInFullGroups) {
+    // All keys probe the same groups, so the first group is full and erasing from it must not cut off the later keys
+    layer_data::flat_unordered_set<uint64_t, 64, CollidingHash> set;
+    for (uint64_t i = 0; i < 40; ++i) {
+        set.insert(i);
+    }
+    for (uint64_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(set.erase(i), 1u);
+    }
+    for (uint64_t i = 0; i < 40; ++i) {
+        EXPECT_EQ(set.contains(i), i >= 16) << "key " << i;
+    }
+
+    // Tombstones are reused by later inserts, without duplicating keys that are still present further along
+    for (uint64_t i = 0; i < 40; ++i) {
+        EXPECT_EQ(set.insert(i).second, i < 16) << "key " << i;
+    }
+    EXPECT_EQ(set.size(), 40u);
+    EXPECT_EQ(Contents(set).size(), 40u);
+}
+
+TEST(FlatHashMap, RehashReclaimsTombstones) {
+    layer_data::flat_unordered_set<uint64_t> set;
+    std::set<uint64_t> expected;
+    // Churn through many more keys than the table ever holds at once, so that growth is triggered by tombstones rather than
+    // by the element count
+    for (uint64_t i = 0; i < 10000; ++i) {
+        set.insert(i);
+        expected.insert(i);
+        if (i >= 20) {
+            set.erase(i - 20);
+            expected.erase(i - 20);
+        }
+        ASSERT_EQ(set.size(), expected.size());
+    }
+    EXPECT_EQ(Contents(set), expected);
+    EXPECT_LE(set.capacity(), 64u);
+}
+
+TEST(FlatHashMap, EraseWhileIterating) {
+    layer_data::flat_unordered_set<uint64_t> set;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        set.insert(i);
+    }
+    // erase() returns the next element, and the elements not erased are each visited once
+    std::multiset<uint64_t> visited;
+    for (auto it = set.begin(); it != set.end();) {
+        visited.insert(*it);
+        if (*it % 3 == 0) {
+            it = set.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(visited.size(), 1000u);
+    EXPECT_EQ(std::set<uint64_t>(visited.begin(), visited.end()).size(), 1000u);
+    EXPECT_EQ(set.size(), 666u);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(set.contains(i), i % 3 != 0);
+    }
+}
+
+TEST(FlatHashMap, GrowthBetweenIterations) {
+    // Insertion invalidates iterators, so code that adds elements found while iterating collects them first. Each pass
+    // doubles the set, and every pass over the rehashed table must see each element exactly once.
+    layer_data::flat_unordered_set<uint64_t> set = {1};
+    for (uint32_t pass = 1; pass <= 10; ++pass) {
+        std::vector<uint64_t> to_add;
+        for (const auto value : set) {
+            to_add.push_back(value * 2);
+            to_add.push_back(value * 2 + 1);
+        }
+        EXPECT_EQ(to_add.size(), set.size() * 2);
+        set.insert(to_add.begin(), to_add.end());
+
+        const uint64_t count = (UINT64_C(1) << (pass + 1)) - 1;
+        ASSERT_EQ(set.size(), count);
+        const auto contents = Contents(set);
+        EXPECT_EQ(contents.size(), count);
+        EXPECT_EQ(*contents.begin(), 1u);
+        EXPECT_EQ(*contents.rbegin(), count);
+    }
+}
+
+TEST(FlatHashMap, MatchesStdMap) {
+    layer_data::flat_unordered_map<uint32_t, uint32_t> map;
+    std::map<uint32_t, uint32_t> expected;
+    std::mt19937 random(1234);
+    for (uint32_t i = 0; i < 20000; ++i) {
+        const uint32_t key = random() % 512;
+        switch (random() % 4) {
+            case 0:
+            case 1:
+                map[key] = i;
+                expected[key] = i;
+                break;
+            case 2:
+                EXPECT_EQ(map.erase(key), expected.erase(key));
+                break;
+            default:
+                EXPECT_EQ(map.contains(key), expected.count(key) != 0);
+                break;
+        }
+        if (i % 5000 == 4999) {
+            map.clear();
+            expected.clear();
+        }
+    }
+    EXPECT_EQ(map.size(), expected.size());
+    for (const auto &entry : map) {
+        const auto it = expected.find(entry.first);
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(entry.second, it->second);
+    }
+}
+
+TEST(FlatHashMap, KeyTypes) {
+    layer_data::flat_unordered_map<std::string, uint32_t> strings;
+    for (uint32_t i = 0; i < 100; ++i) {
+        strings["key_" + std::to_string(i)] = i;
+    }
+    strings.erase("key_7");
+    EXPECT_EQ(strings.size(), 99u);
+    EXPECT_EQ(strings.at("key_42"), 42u);
+    EXPECT_EQ(strings.find("key_7"), strings.end());
+
+    int objects[4];
+    layer_data::flat_unordered_set<const int *> pointers = {&objects[0], &objects[1], &objects[2]};
+    EXPECT_TRUE(pointers.contains(&objects[1]));
+    EXPECT_FALSE(pointers.contains(&objects[3]));
+
+    layer_data::flat_unordered_map<PairKey, uint32_t, 16, PairKeyHash> pairs;
+    pairs[{1, 0}] = 10;
+    pairs[{1, 1}] = 11;
+    pairs[{2, 0}] = 20;
+    EXPECT_EQ(pairs.size(), 3u);
+    EXPECT_EQ(pairs.at({1, 1}), 11u);
+    EXPECT_FALSE(pairs.contains({2, 1}));
+}
+
+TEST(FlatHashMap, DestroysEveryElement) {
+    Tracked::live = 0;
+    {
+        layer_data::flat_unordered_map<uint64_t, Tracked> map;
+        for (uint64_t i = 0; i < 100; ++i) {
+            map.try_emplace(i, i);
+        }
+        EXPECT_EQ(Tracked::live, 100);
+        for (uint64_t i = 0; i < 50; ++i) {
+            map.erase(i);
+        }
+        EXPECT_EQ(Tracked::live, 50);
+
+        layer_data::flat_unordered_map<uint64_t, Tracked> copy(map);
+        EXPECT_EQ(Tracked::live, 100);
+        EXPECT_EQ(copy.at(75).value, 75u);
+        copy.clear();
+        EXPECT_EQ(Tracked::live, 50);
+
+        layer_data::flat_unordered_map<uint64_t, Tracked> moved(std::move(map));
+        EXPECT_EQ(Tracked::live, 50);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(moved.size(), 50u);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
@@ -0,0 +1,170 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_common.h"
+#include "query_state.h"
+#include "vk_typemap_helper.h"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace {
+
+const VkQueryPool kPool = CastFromUint64<VkQueryPool>(0x1000);
+const VkQueryPool kOtherPool = CastFromUint64<VkQueryPool>(0x2000);
+
+std::shared_ptr<QUERY_POOL_STATE> CreatePoolState(uint32_t query_count, uint32_t perf_passes = 0) {
+    VkQueryPoolCreateInfo create_info = LvlInitStruct<VkQueryPoolCreateInfo>();
+    create_info.queryType = perf_passes > 0 ? VK_QUERY_TYPE_PERFORMANCE_QUERY_KHR : VK_QUERY_TYPE_TIMESTAMP;
+    create_info.queryCount = query_count;
+    return std::make_shared<QUERY_POOL_STATE>(kPool, &create_info, 0, perf_passes, false, false);
+}
+
+std::vector<QueryState> GetStates(const QUERY_POOL_STATE &pool_state, uint32_t perf_pass) {
+    std::vector<QueryState> states;
+    for (uint32_t query = 0; query < pool_state.createInfo.queryCount; ++query) {
+        states.push_back(pool_state.GetQueryState(query, perf_pass));
+    }
+    return states;
+}
+
+}  // namespace
+
+TEST(QueryMap, SetStateRanges) {
+    QueryMap map;
+    map.SetState(kPool, 0, 4, 2, 16, QUERYSTATE_RESET);
+    EXPECT_EQ(map.GetState(kPool, 0, 3), QUERYSTATE_UNKNOWN);
+    EXPECT_EQ(map.GetState(kPool, 0, 4), QUERYSTATE_RESET);
+    EXPECT_EQ(map.GetState(kPool, 0, 5), QUERYSTATE_RESET);
+    EXPECT_EQ(map.GetState(kPool, 0, 6), QUERYSTATE_UNKNOWN);
+
+    // Growing the span at both ends keeps the states already set, and leaves the gaps unknown
+    map.SetState(kPool, 0, 1, 1, 16, QUERYSTATE_RUNNING);
+    map.SetState(kPool, 0, 9, 1, 16, QUERYSTATE_ENDED);
+    EXPECT_EQ(map.GetState(kPool, 0, 1), QUERYSTATE_RUNNING);
+    EXPECT_EQ(map.GetState(kPool, 0, 2), QUERYSTATE_UNKNOWN);
+    EXPECT_EQ(map.GetState(kPool, 0, 4), QUERYSTATE_RESET);
+    EXPECT_EQ(map.GetState(kPool, 0, 8), QUERYSTATE_UNKNOWN);
+    EXPECT_EQ(map.GetState(kPool, 0, 9), QUERYSTATE_ENDED);
+
+    // Later updates overwrite earlier ones
+    map.SetState(kPool, 0, 0, 5, 16, QUERYSTATE_ENDED);
+    for (uint32_t query = 0; query < 5; ++query) {
+        EXPECT_EQ(map.GetState(kPool, 0, query), QUERYSTATE_ENDED);
+    }
+    EXPECT_EQ(map.GetState(kPool, 0, 5), QUERYSTATE_RESET);
+
+    // Perf passes and pools are tracked separately
+    EXPECT_EQ(map.GetState(kPool, 1, 4), QUERYSTATE_UNKNOWN);
+    EXPECT_EQ(map.GetState(kOtherPool, 0, 4), QUERYSTATE_UNKNOWN);
+    map.SetState(kPool, 1, 4, 1, 16, QUERYSTATE_RUNNING);
+    EXPECT_EQ(map.GetState(kPool, 1, 4), QUERYSTATE_RUNNING);
+    EXPECT_EQ(map.GetState(kPool, 0, 4), QUERYSTATE_ENDED);
+    EXPECT_EQ(std::distance(map.begin(), map.end()), 2);
+}
+
+TEST(QueryMap, SetStateClampedToPool) {
+    QueryMap map;
+    // An invalid vkCmdResetQueryPool range must not grow the array past the pool
+    map.SetState(kPool, 0, 6, UINT32_MAX, 8, QUERYSTATE_RESET);
+    ASSERT_EQ(std::distance(map.begin(), map.end()), 1);
+    EXPECT_EQ(map.begin()->second.first, 6u);
+    EXPECT_EQ(map.begin()->second.states.size(), 2u);
+    EXPECT_EQ(map.GetState(kPool, 0, 7), QUERYSTATE_RESET);
+    EXPECT_EQ(map.GetState(kPool, 0, 8), QUERYSTATE_UNKNOWN);
+
+    // Ranges starting past the pool, and pools that no longer exist, add nothing
+    map.SetState(kOtherPool, 0, 8, 4, 8, QUERYSTATE_RESET);
+    map.SetState(kOtherPool, 0, 0, 4, 0, QUERYSTATE_RESET);
+    map.SetState(kPool, 0, 0, 0, 8, QUERYSTATE_RESET);
+    EXPECT_EQ(std::distance(map.begin(), map.end()), 1);
+    EXPECT_EQ(map.GetState(kPool, 0, 0), QUERYSTATE_UNKNOWN);
+}
+
+TEST(QueryPoolState, SetQueryStates) {
+    auto pool_state = CreatePoolState(8);
+    pool_state->SetQueryStates(2, 3, 0, QUERYSTATE_RESET);
+    const std::vector<QueryState> expected = {QUERYSTATE_UNKNOWN, QUERYSTATE_UNKNOWN, QUERYSTATE_RESET, QUERYSTATE_RESET,
+                                              QUERYSTATE_RESET,   QUERYSTATE_UNKNOWN, QUERYSTATE_UNKNOWN, QUERYSTATE_UNKNOWN};
+    EXPECT_EQ(GetStates(*pool_state, 0), expected);
+
+    // [first, first + count) is clamped to the pool, and out of range reads are unknown
+    pool_state->SetQueryStates(6, UINT32_MAX, 0, QUERYSTATE_AVAILABLE);
+    pool_state->SetQueryStates(8, 1, 0, QUERYSTATE_AVAILABLE);
+    EXPECT_EQ(pool_state->GetQueryState(5, 0), QUERYSTATE_UNKNOWN);
+    EXPECT_EQ(pool_state->GetQueryState(6, 0), QUERYSTATE_AVAILABLE);
+    EXPECT_EQ(pool_state->GetQueryState(7, 0), QUERYSTATE_AVAILABLE);
+    EXPECT_EQ(pool_state->GetQueryState(8, 0), QUERYSTATE_UNKNOWN);
+}
+
+TEST(QueryPoolState, SetQueryStatesPerfPasses) {
+    auto pool_state = CreatePoolState(4, 3);
+    pool_state->SetQueryStates(0, 4, 1, QUERYSTATE_RESET);
+    pool_state->SetQueryState(3, 2, QUERYSTATE_ENDED);
+    for (uint32_t query = 0; query < 4; ++query) {
+        EXPECT_EQ(pool_state->GetQueryState(query, 0), QUERYSTATE_UNKNOWN);
+        EXPECT_EQ(pool_state->GetQueryState(query, 1), QUERYSTATE_RESET);
+        EXPECT_EQ(pool_state->GetQueryState(query, 2), query == 3 ? QUERYSTATE_ENDED : QUERYSTATE_UNKNOWN);
+    }
+    EXPECT_EQ(pool_state->GetQueryState(0, 3), QUERYSTATE_UNKNOWN);
+}
+
+TEST(QueryPoolState, MergeQueryStates) {
+    auto pool_state = CreatePoolState(8);
+    pool_state->SetQueryStates(0, 8, 0, QUERYSTATE_AVAILABLE);
+
+    // Unknown entries leave the pool state as it is
+    pool_state->MergeQueryStates(2, 0, {QUERYSTATE_RESET, QUERYSTATE_UNKNOWN, QUERYSTATE_ENDED});
+    std::vector<QueryState> expected(8, QUERYSTATE_AVAILABLE);
+    expected[2] = QUERYSTATE_RESET;
+    expected[4] = QUERYSTATE_ENDED;
+    EXPECT_EQ(GetStates(*pool_state, 0), expected);
+
+    // States past the end of the pool are dropped
+    pool_state->MergeQueryStates(6, 0, {QUERYSTATE_RUNNING, QUERYSTATE_RUNNING, QUERYSTATE_RUNNING});
+    pool_state->MergeQueryStates(8, 0, {QUERYSTATE_RUNNING});
+    expected[6] = QUERYSTATE_RUNNING;
+    expected[7] = QUERYSTATE_RUNNING;
+    EXPECT_EQ(GetStates(*pool_state, 0), expected);
+}
+
+TEST(QueryPoolState, MergeReplayedQueryMap) {
+    // The submit path: replayed command buffer updates merged into the pool, one call per pool and perf pass
+    auto pool_state = CreatePoolState(16);
+    pool_state->SetQueryStates(0, 16, 0, QUERYSTATE_AVAILABLE);
+
+    QueryMap map;
+    map.SetState(kPool, 0, 8, 4, 16, QUERYSTATE_RESET);
+    map.SetState(kPool, 0, 9, 1, 16, QUERYSTATE_ENDED);
+    map.SetState(kPool, 0, 3, 1, 16, QUERYSTATE_RUNNING);
+    for (const auto &entry : map) {
+        pool_state->MergeQueryStates(entry.second.first, entry.first.second, entry.second.states);
+    }
+
+    for (uint32_t query = 0; query < 16; ++query) {
+        QueryState expected = QUERYSTATE_AVAILABLE;
+        if (query == 3) {
+            expected = QUERYSTATE_RUNNING;
+        } else if (query == 9) {
+            expected = QUERYSTATE_ENDED;
+        } else if (query >= 8 && query < 12) {
+            expected = QUERYSTATE_RESET;
+        }
+        EXPECT_EQ(pool_state->GetQueryState(query, 0), expected) << "query " << query;
+    }
+}
@@ -0,0 +1,191 @@
+/* Copyright (c) 2022 The Khronos Group Inc.
+ * Copyright (c) 2022 Valve Corporation
+ * Copyright (c) 2022 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_common.h"
+#include "thread_pool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Starts the pool for the duration of a test. The pool is shared by the whole process, so each test stops it again.
+class ScopedThreadPool {
+  public:
+    explicit ScopedThreadPool(uint32_t thread_count) : stopped_(false) { ThreadPool::Start(thread_count, false); }
+    ~ScopedThreadPool() { Stop(); }
+
+    void Stop() {
+        if (!stopped_) {
+            ThreadPool::Stop();
+            stopped_ = true;
+        }
+    }
+
+  private:
+    bool stopped_;
+};
+
+}  // namespace
+
+TEST(ThreadPool, SubmitRunsInlineWhenNotStarted) {
+    EXPECT_EQ(ThreadPool::ThreadCount(), 0u);
+    const auto caller = std::this_thread::get_id();
+    std::thread::id ran_on;
+    ThreadPool::Submit([&ran_on]() { ran_on = std::this_thread::get_id(); });
+    EXPECT_EQ(ran_on, caller);
+}
+
+TEST(ThreadPool, StartIsReferenceCounted) {
+    ThreadPool::Start(1000, false);
+    EXPECT_EQ(ThreadPool::ThreadCount(), ThreadPool::kMaxThreads);
+    // The settings of the first start are kept
+    ThreadPool::Start(2, false);
+    EXPECT_EQ(ThreadPool::ThreadCount(), ThreadPool::kMaxThreads);
+    ThreadPool::Stop();
+    EXPECT_EQ(ThreadPool::ThreadCount(), ThreadPool::kMaxThreads);
+    ThreadPool::Stop();
+    EXPECT_EQ(ThreadPool::ThreadCount(), 0u);
+    // Extra stops are ignored
+    ThreadPool::Stop();
+    EXPECT_EQ(ThreadPool::ThreadCount(), 0u);
+}
+
+TEST(ThreadPool, StartsWorkersOnDemand) {
+    ScopedThreadPool pool(8);
+    EXPECT_EQ(ThreadPool::StartedThreadCount(), 0u);
+    std::promise<void> first;
+    ThreadPool::Submit([&first]() { first.set_value(); });
+    first.get_future().get();
+    EXPECT_EQ(ThreadPool::StartedThreadCount(), 1u);
+
+    // Tasks that only finish once all of them run at the same time need one worker each
+    const uint32_t task_count = 3;
+    std::atomic<uint32_t> running{0};
+    std::atomic<uint32_t> finished{0};
+    for (uint32_t i = 0; i < task_count; ++i) {
+        ThreadPool::Submit([&running, &finished]() {
+            running.fetch_add(1);
+            while (running.load() < task_count) {
+                std::this_thread::yield();
+            }
+            finished.fetch_add(1);
+        });
+    }
+    while (finished.load() < task_count) {
+        std::this_thread::yield();
+    }
+    EXPECT_GE(ThreadPool::StartedThreadCount(), task_count);
+    EXPECT_LE(ThreadPool::StartedThreadCount(), 8u);
+}
+
+TEST(ThreadPool, ExitWithoutStop) {
+    // Applications often exit without destroying their instances, which must not wait for the workers
+    EXPECT_EXIT(
+        {
+            ThreadPool::Start(2, false);
+            std::promise<void> ran;
+            ThreadPool::Submit([&ran]() { ran.set_value(); });
+            ran.get_future().get();
+            std::exit(0);
+        },
+        ::testing::ExitedWithCode(0), "");
+}
+
+TEST(ThreadPool, ParallelForCallsEachIndexOnce) {
+    ScopedThreadPool pool(4);
+    for (const uint32_t count : {0u, 1u, 7u, 1000u, 100000u}) {
+        std::vector<std::atomic<uint32_t>> calls(count);
+        for (auto &call : calls) {
+            call.store(0);
+        }
+        ThreadPool::ParallelFor(count, 8, [&calls](uint32_t index) { calls[index].fetch_add(1); });
+        for (uint32_t index = 0; index < count; ++index) {
+            ASSERT_EQ(calls[index].load(), 1u) << "index " << index << " of " << count;
+        }
+    }
+}
+
+TEST(ThreadPool, ParallelMapKeepsIndexOrder) {
+    ScopedThreadPool pool(4);
+    const uint32_t count = 50000;
+    const auto results = ThreadPool::ParallelMap<uint64_t>(count, 16, [](uint32_t index) {
+        return static_cast<uint64_t>(index) * index;
+    });
+    ASSERT_EQ(results.size(), count);
+    for (uint32_t index = 0; index < count; ++index) {
+        ASSERT_EQ(results[index], static_cast<uint64_t>(index) * index) << "index " << index;
+    }
+}
+
+TEST(ThreadPool, NestedParallelFor) {
+    // ParallelFor() called from the workers, both from a submitted task and from the calls of another ParallelFor(), returns
+    // even when every worker is busy, since the calling thread runs the parts not started yet
+    ScopedThreadPool pool(2);
+    const uint32_t outer = 16;
+    const uint32_t inner = 256;
+    std::promise<std::vector<uint32_t>> promise;
+    auto future = promise.get_future();
+    ThreadPool::Submit([&promise]() {
+        const auto sums = ThreadPool::ParallelMap<uint32_t>(outer, 1, [](uint32_t i) {
+            std::atomic<uint32_t> sum{0};
+            ThreadPool::ParallelFor(inner, 1, [&sum, i](uint32_t j) { sum.fetch_add(i + j); });
+            return sum.load();
+        });
+        promise.set_value(sums);
+    });
+    const auto sums = future.get();
+    ASSERT_EQ(sums.size(), outer);
+    for (uint32_t i = 0; i < outer; ++i) {
+        EXPECT_EQ(sums[i], i * inner + inner * (inner - 1) / 2) << "outer index " << i;
+    }
+}
+
+TEST(ThreadPool, StopRunsQueuedTasks) {
+    ScopedThreadPool pool(2);
+    std::atomic<uint32_t> ran{0};
+    std::atomic<bool> release{false};
+    // Keep the workers busy so that the tasks below are still queued when Stop() is called
+    for (uint32_t i = 0; i < 2; ++i) {
+        ThreadPool::Submit([&release]() {
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+    // Each task also queues one more from the worker, which must run before the workers exit
+    for (uint32_t i = 0; i < 100; ++i) {
+        ThreadPool::Submit([&ran]() {
+            ran.fetch_add(1);
+            ThreadPool::Submit([&ran]() { ran.fetch_add(1); });
+        });
+    }
+    std::thread stopper([&pool]() { pool.Stop(); });
+    release.store(true);
+    stopper.join();
+    EXPECT_EQ(ran.load(), 200u);
+    EXPECT_EQ(ThreadPool::ThreadCount(), 0u);
+
+    // The pool starts new workers when it is used again
+    ScopedThreadPool restarted(2);
+    std::promise<std::thread::id> promise;
+    ThreadPool::Submit([&promise]() { promise.set_value(std::this_thread::get_id()); });
+    EXPECT_NE(promise.get_future().get(), std::this_thread::get_id());
+}
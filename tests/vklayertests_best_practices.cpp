@@ -2199,3 +2199,80 @@ TEST_F(VkBestPracticesLayerTest, ImageMemoryBarrierAccessLayoutCombinations) {
         m_commandBuffer->end();
     }
 }
+
+TEST_F(VkBestPracticesLayerTest, ValidationFrameBudget) {
+    TEST_DESCRIPTION("Validate that best practices validation stops once frames are over the validation frame budget");
+
+    AddSurfaceExtension();
+    // 1 microsecond, which every frame exceeds
+    VkLayerSettingValueDataEXT budget_value{};
+    budget_value.value32 = 1;
+    VkLayerSettingValueEXT budget_setting_val = {"validation_frame_budget", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT, budget_value};
+    VkLayerSettingsEXT budget_settings{static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                                       &budget_setting_val};
+    features_.pNext = &budget_settings;
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, &features_));
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported.";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    if (!InitSwapchain()) {
+        GTEST_SKIP() << "Cannot create surface or swapchain, skipping ValidationFrameBudget test";
+    }
+
+    VkShaderObj cs(this, bindStateMinimalShaderText, VK_SHADER_STAGE_COMPUTE_BIT);
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+    auto pipeline_ci = LvlInitStruct<VkComputePipelineCreateInfo>();
+    pipeline_ci.stage = cs.GetStageCreateInfo();
+    pipeline_ci.layout = pipeline_layout.handle();
+    const VkComputePipelineCreateInfo pipeline_cis[2] = {pipeline_ci, pipeline_ci};
+
+    auto pool_ci = LvlInitStruct<VkCommandPoolCreateInfo>();
+    pool_ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_ci.queueFamilyIndex = m_device->graphics_queue_node_index_;
+
+    // vkCreateCommandPool is a generated intercept, and vkCreateComputePipelines a manual one whose validation step also
+    // creates the pipeline state
+    const auto create_objects = [&](bool expect_warnings) {
+        if (expect_warnings) {
+            m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit,
+                                                 "UNASSIGNED-BestPractices-vkCreateCommandPool-command-buffer-reset");
+            m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit,
+                                                 "UNASSIGNED-BestPractices-vkCreatePipelines-multiple-pipelines-no-cache");
+        } else {
+            m_errorMonitor->ExpectSuccess(kPerformanceWarningBit);
+        }
+        VkCommandPool command_pool = VK_NULL_HANDLE;
+        vk::CreateCommandPool(device(), &pool_ci, nullptr, &command_pool);
+        VkPipeline pipelines[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+        vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 2, pipeline_cis, nullptr, pipelines);
+        if (expect_warnings) {
+            m_errorMonitor->VerifyFound();
+        } else {
+            m_errorMonitor->VerifyNotFound();
+        }
+        vk::DestroyCommandPool(device(), command_pool, nullptr);
+        vk::DestroyPipeline(device(), pipelines[0], nullptr);
+        vk::DestroyPipeline(device(), pipelines[1], nullptr);
+    };
+
+    // Nothing is throttled before the end of the first frame
+    create_objects(true);
+
+    vk_testing::Semaphore image_acquired(*m_device, LvlInitStruct<VkSemaphoreCreateInfo>());
+    ASSERT_TRUE(image_acquired.initialized());
+    for (uint32_t frame = 0; frame < 3; ++frame) {
+        uint32_t image_index = 0;
+        vk::AcquireNextImageKHR(device(), m_swapchain, kWaitTimeout, image_acquired.handle(), VK_NULL_HANDLE, &image_index);
+        auto present_info = LvlInitStruct<VkPresentInfoKHR>();
+        present_info.waitSemaphoreCount = 1;
+        present_info.pWaitSemaphores = &image_acquired.handle();
+        present_info.swapchainCount = 1;
+        present_info.pSwapchains = &m_swapchain;
+        present_info.pImageIndices = &image_index;
+        vk::QueuePresentKHR(m_device->GetDefaultQueue()->handle(), &present_info);
+
+        // Every frame is over budget, so best practices stays throttled
+        create_objects(false);
+    }
+}
@@ -3228,6 +3228,42 @@ TEST_F(VkLayerTest, BlitImageLayout) {
     ASSERT_VK_SUCCESS(err);
 }
 
+TEST_F(VkLayerTest, ResubmitAfterImageLayoutChange) {
+    TEST_DESCRIPTION("Resubmit a command buffer after its images were transitioned to a different layout by another submit");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkImageObj src_image(m_device);
+    VkImageObj dst_image(m_device);
+    src_image.Init(64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    dst_image.Init(64, 64, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(src_image.initialized());
+    ASSERT_TRUE(dst_image.initialized());
+    src_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    dst_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    VkImageCopy copy_region = {};
+    copy_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.extent = {64, 64, 1};
+
+    m_commandBuffer->begin();
+    vk::CmdCopyImage(m_commandBuffer->handle(), src_image.image(), VK_IMAGE_LAYOUT_GENERAL, dst_image.image(),
+                     VK_IMAGE_LAYOUT_GENERAL, 1, &copy_region);
+    m_commandBuffer->end();
+
+    // The layouts match, including when the command buffer is submitted again with nothing changed
+    m_commandBuffer->QueueCommandBuffer();
+    m_commandBuffer->QueueCommandBuffer();
+
+    // Another submission changes the layout of the source image, so the next submission must be validated again
+    src_image.SetLayout(VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "UNASSIGNED-CoreValidation-DrawState-InvalidImageLayout");
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, BlitImageOffsets) {
     ASSERT_NO_FATAL_FAILURE(Init());
 
@@ -15325,6 +15361,39 @@ TEST_F(VkLayerTest, TestCopyingInterleavedRegions) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkLayerTest, TestCopyingManyInterleavedRegions) {
+    TEST_DESCRIPTION("Test that a single overlap among many unsorted interleaved copy regions is reported once.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    constexpr uint32_t region_count = 256;
+    std::vector<VkBufferCopy> copy_infos(region_count);
+    // Regions are listed back to front so the overlap check cannot rely on them being sorted
+    for (uint32_t i = 0; i < region_count; ++i) {
+        const VkDeviceSize base = 8 * (region_count - 1 - i);
+        copy_infos[i].srcOffset = base;
+        copy_infos[i].dstOffset = base + 4;
+        copy_infos[i].size = 4;
+    }
+
+    VkBufferObj buffer;
+    VkMemoryPropertyFlags reqs = 0;
+    buffer.init_as_src_and_dst(*m_device, 8 * region_count, reqs);
+
+    m_commandBuffer->begin();
+
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), region_count, copy_infos.data());
+
+    // Shifting two destinations by a byte makes each of them overlap the source of the following region; the overlap is
+    // reported once per command
+    copy_infos[region_count / 2].dstOffset += 1;
+    copy_infos[region_count / 4].dstOffset += 1;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::CmdCopyBuffer(m_commandBuffer->handle(), buffer.handle(), buffer.handle(), region_count, copy_infos.data());
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkLayerTest, TestSamplerReductionMode) {
     TEST_DESCRIPTION("Test using VkSamplerReductionModeCreateInfo without required feature.");
 
@@ -30,6 +30,11 @@
 #include "layer_validation_tests.h"
 #include "core_validation_error_enums.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
 class MessageIdFilter {
   public:
     MessageIdFilter(const char *filter_string) {
@@ -106,6 +111,57 @@ class DuplicateMsgLimit {
     VkLayerSettingsEXT limit_setting;
 };
 
+class DrawValidationSamplePeriod {
+  public:
+    DrawValidationSamplePeriod(const uint32_t period) {
+        period_value.value32 = period;
+
+        strncpy(period_setting_val.name, "draw_validation_sample_period", sizeof(period_setting_val.name));
+        period_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT;
+        period_setting_val.data = period_value;
+        period_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                          &period_setting_val};
+    }
+    VkLayerSettingsEXT *pnext{&period_setting};
+
+  private:
+    VkLayerSettingValueDataEXT period_value{};
+    VkLayerSettingValueEXT period_setting_val;
+    VkLayerSettingsEXT period_setting;
+};
+
+// A file written by the layer, set with a string setting such as profile_file, and removed again by the destructor
+class LayerOutputFile {
+  public:
+    LayerOutputFile(const char *setting_name, const char *filename) : filename_(filename) {
+        std::remove(filename_.c_str());
+        file_value.arrayString.pCharArray = filename_.c_str();
+        file_value.arrayString.count = filename_.size();
+
+        strncpy(file_setting_val.name, setting_name, sizeof(file_setting_val.name));
+        file_setting_val.type = VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT;
+        file_setting_val.data = file_value;
+        file_setting = {static_cast<VkStructureType>(VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT), nullptr, 1,
+                        &file_setting_val};
+    }
+    ~LayerOutputFile() { std::remove(filename_.c_str()); }
+
+    std::string Read() const {
+        std::ifstream file(filename_);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+
+    VkLayerSettingsEXT *pnext{&file_setting};
+
+  private:
+    std::string filename_;
+    VkLayerSettingValueDataEXT file_value{};
+    VkLayerSettingValueEXT file_setting_val;
+    VkLayerSettingsEXT file_setting;
+};
+
 TEST_F(VkLayerTest, VersionCheckPromotedAPIs) {
     TEST_DESCRIPTION("Validate that promoted APIs are not valid in old versions.");
     SetTargetApiVersion(VK_API_VERSION_1_0);
@@ -391,6 +447,230 @@ TEST_F(VkLayerTest, DuplicateMessageLimit) {
     vkGetPhysicalDeviceProperties2KHR(gpu(), &properties2);
 }
 
+TEST_F(VkLayerTest, DrawValidationSampling) {
+    TEST_DESCRIPTION("Validate that draw validation sampling only validates the bound state of one in N draws");
+
+    auto sample_period = DrawValidationSamplePeriod(2);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, sample_period.pnext));
+    if (!IsPlatform(kMockICD)) {
+        GTEST_SKIP() << "Draws that are not validated are passed down the chain without their dynamic state set";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, bindStateFragShaderText, VK_SHADER_STAGE_FRAGMENT_BIT);
+    const VkPipelineLayoutObj pipeline_layout(m_device);
+    VkPipelineObj pipeline_dyn_vp(m_device);
+    pipeline_dyn_vp.AddShader(&vs);
+    pipeline_dyn_vp.AddShader(&fs);
+    pipeline_dyn_vp.AddDefaultColorAttachment();
+    pipeline_dyn_vp.MakeDynamic(VK_DYNAMIC_STATE_VIEWPORT);
+    pipeline_dyn_vp.SetScissor(m_scissors);
+    ASSERT_VK_SUCCESS(pipeline_dyn_vp.CreateVKPipeline(pipeline_layout.handle(), m_renderPass));
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    // The viewport is never set
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_dyn_vp.handle());
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i % 2 == 0) {
+            m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-commandBuffer-02701");
+            m_commandBuffer->Draw(1, 0, 0, 0);
+            m_errorMonitor->VerifyFound();
+        } else {
+            // Skipped by sampling, the missing dynamic state is not reported
+            m_commandBuffer->Draw(1, 0, 0, 0);
+        }
+    }
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, DrawValidationSamplingNoPipeline) {
+    TEST_DESCRIPTION("Validate that draws without a bound pipeline are reported even when draw validation sampling skips them");
+
+    auto sample_period = DrawValidationSamplePeriod(2);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, sample_period.pnext));
+    if (!IsPlatform(kMockICD)) {
+        GTEST_SKIP() << "Draws without a pipeline bound are passed down the chain";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr},
+                                                 });
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    // Binding a descriptor set sets the bound pipeline layout, but no pipeline is bound
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-02700");
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_errorMonitor->VerifyFound();
+    }
+
+    // When the application does not skip the call, the draws are recorded without a pipeline
+    m_errorMonitor->SetAllowedFailureMsg("VUID-vkCmdDraw-None-02700");
+    for (uint32_t i = 0; i < 2; ++i) {
+        m_commandBuffer->Draw(1, 0, 0, 0);
+    }
+    m_errorMonitor->Reset();
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, DrawValidationSamplingBindPoints) {
+    TEST_DESCRIPTION("Validate that skipped draws do not hide descriptor errors from the dispatches sampled between them");
+
+    auto sample_period = DrawValidationSamplePeriod(2);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, sample_period.pnext));
+    if (!IsPlatform(kMockICD)) {
+        GTEST_SKIP() << "Draws and dispatches that are not validated are passed down the chain with an unwritten descriptor";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    // More descriptors than the validated descriptor caches ignore, binding 0 is never written
+    OneOffDescriptorSet descriptor_set(m_device, {
+                                                     {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                     {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 64, VK_SHADER_STAGE_ALL, nullptr},
+                                                 });
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&descriptor_set.layout_});
+
+    char const *fs_source = R"glsl(
+        #version 450
+        layout(location=0) out vec4 color;
+        layout(set=0, binding=0) uniform foo { vec4 x; } bar;
+        void main(){
+           color = bar.x;
+        }
+    )glsl";
+    VkShaderObj vs(this, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT);
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    char const *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) uniform foo { vec4 x; } bar;
+        void main(){
+           vec4 v = 2.0 * bar.x;
+        }
+    )glsl";
+    CreateComputePipelineHelper compute_pipe(*this);
+    compute_pipe.InitInfo();
+    compute_pipe.cs_ = layer_data::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    compute_pipe.InitState();
+    compute_pipe.pipeline_layout_ = VkPipelineLayoutObj(m_device, {&descriptor_set.layout_});
+    compute_pipe.CreateComputePipeline();
+
+    m_commandBuffer->begin();
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_.handle(), 0, 1,
+                              &descriptor_set.set_, 0, nullptr);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipe.pipeline_);
+    vk::CmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_COMPUTE, compute_pipe.pipeline_layout_.handle(), 0,
+                              1, &descriptor_set.set_, 0, nullptr);
+
+    // Every second draw or dispatch of the command buffer is validated, whichever bind point it uses
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDispatch-None-02699");
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    // The skipped draw is recorded without validating the unwritten descriptor...
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_commandBuffer->EndRenderPass();
+
+    // ...so neither the dispatch using the same set nor the next validated draw may treat it as validated
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDispatch-None-02699");
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDraw-None-02699");
+    m_commandBuffer->Draw(1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->EndRenderPass();
+
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-vkCmdDispatch-None-02699");
+    vk::CmdDispatch(m_commandBuffer->handle(), 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+}
+
+TEST_F(VkLayerTest, ProfilerTraceFile) {
+    TEST_DESCRIPTION("Validate that the profile_file setting writes a Chrome trace of the API calls");
+
+    LayerOutputFile trace("profile_file", "vk_layer_validation_tests_trace.json");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, trace.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    {
+        VkBufferObj buffer;
+        buffer.init(*m_device, 256, 0, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        m_commandBuffer->begin();
+        vk::CmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+        m_commandBuffer->end();
+        m_commandBuffer->QueueCommandBuffer();
+    }
+
+    // The trace is written when the last instance that enabled it is destroyed
+    ShutdownFramework();
+    const std::string json = trace.Read();
+    if (json.empty()) {
+        GTEST_SKIP() << "The trace file could not be written in the working directory";
+    }
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+    EXPECT_EQ(json.rfind("\n]}\n"), json.size() - 4);
+    EXPECT_NE(json.find("\"name\":\"thread_name\",\"ph\":\"M\""), std::string::npos);
+    for (const char *api_call : {"vkCreateDevice", "vkCreateBuffer", "vkCmdFillBuffer", "vkQueueSubmit", "vkDestroyDevice"}) {
+        EXPECT_NE(json.find("{\"name\":\"" + std::string(api_call) + "\",\"ph\":\"X\""), std::string::npos) << api_call;
+    }
+}
+
+TEST_F(VkLayerTest, CheckStatsFile) {
+    TEST_DESCRIPTION("Validate that the check_stats_file setting counts the messages of each VUID per API call");
+
+    LayerOutputFile check_stats("check_stats_file", "vk_layer_validation_tests_check_stats.csv");
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor, check_stats.pnext));
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferCreateInfo buffer_ci = LvlInitStruct<VkBufferCreateInfo>();
+    buffer_ci.size = 0;
+    buffer_ci.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    for (uint32_t i = 0; i < 3; ++i) {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkBufferCreateInfo-size-00912");
+        vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+        m_errorMonitor->VerifyFound();
+    }
+
+    // The statistics are written when the device is destroyed
+    ShutdownFramework();
+    const std::string csv = check_stats.Read();
+    if (csv.empty()) {
+        GTEST_SKIP() << "The statistics file could not be written in the working directory";
+    }
+    EXPECT_EQ(csv.find("kind,name,family,count,total_ns,self_ns,mean_ns\n"), 0u);
+    EXPECT_NE(csv.find("\nfamily,\"vkCreateBuffer\",,"), std::string::npos) << csv;
+    EXPECT_NE(csv.find("\nvuid,\"VUID-VkBufferCreateInfo-size-00912\",\"vkCreateBuffer\",3,,,\n"), std::string::npos) << csv;
+}
+
 TEST_F(VkLayerTest, MessageIdFilterString) {
     TEST_DESCRIPTION("Validate that message id string filtering is working");
 
@@ -30,6 +30,8 @@
 #include "layer_validation_tests.h"
 #include "core_validation_error_enums.h"
 
+#include "spirv-tools/optimizer.hpp"
+
 TEST_F(VkLayerTest, PSOPolygonModeInvalid) {
     TEST_DESCRIPTION("Attempt to use invalid polygon fill modes.");
     VkPhysicalDeviceFeatures device_features = {};
@@ -6447,6 +6449,147 @@ TEST_F(VkLayerTest, CreateComputePipelineMissingDescriptor) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CreateComputePipelineMissingDescriptorGroupDecoration) {
+    TEST_DESCRIPTION("Test that descriptor slots applied through group decorations are checked against the pipeline layout");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    // Set and binding of %var only come from the flattened OpGroupDecorate
+    const std::string spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %group DescriptorSet 0
+               OpDecorate %group Binding 1
+               OpDecorate %block_group BufferBlock
+               OpDecorate %offset_group Offset 0
+      %group = OpDecorationGroup
+%block_group = OpDecorationGroup
+%offset_group = OpDecorationGroup
+               OpGroupDecorate %group %var
+               OpGroupDecorate %block_group %block
+               OpGroupMemberDecorate %offset_group %block 0
+       %void = OpTypeVoid
+       %func = OpTypeFunction %void
+      %float = OpTypeFloat 32
+      %block = OpTypeStruct %float
+    %ptr_block = OpTypePointer Uniform %block
+  %ptr_float = OpTypePointer Uniform %float
+        %int = OpTypeInt 32 1
+      %int_0 = OpConstant %int 0
+    %float_1 = OpConstant %float 1
+        %var = OpVariable %ptr_block Uniform
+       %main = OpFunction %void None %func
+      %label = OpLabel
+     %member = OpAccessChain %ptr_float %var %int_0
+               OpStore %member %float_1
+               OpReturn
+               OpFunctionEnd
+)";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.cs_.reset(new VkShaderObj(this, spv_source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM));
+    pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    pipe.InitState();
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "Shader uses descriptor slot 0.1");
+    pipe.CreateComputePipeline();
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, CreateComputePipelineGroupDecorationsMatchFlattenPass) {
+    TEST_DESCRIPTION("Test that a module using group decorations is validated like the spirv-opt flattened version of it");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    // One group applies the set to both variables, and the member offsets of both blocks come from shared groups
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+               OpDecorate %set_group DescriptorSet 0
+               OpDecorate %block_group BufferBlock
+               OpDecorate %offset0_group Offset 0
+               OpDecorate %offset4_group Offset 4
+               OpDecorate %var1 Binding 1
+               OpDecorate %var2 Binding 2
+  %set_group = OpDecorationGroup
+%block_group = OpDecorationGroup
+%offset0_group = OpDecorationGroup
+%offset4_group = OpDecorationGroup
+               OpGroupDecorate %set_group %var1 %var2
+               OpGroupDecorate %block_group %block1 %block2
+               OpGroupMemberDecorate %offset0_group %block1 0 %block2 0
+               OpGroupMemberDecorate %offset4_group %block1 1 %block2 1
+       %void = OpTypeVoid
+       %func = OpTypeFunction %void
+      %float = OpTypeFloat 32
+     %block1 = OpTypeStruct %float %float
+     %block2 = OpTypeStruct %float %float
+ %ptr_block1 = OpTypePointer Uniform %block1
+ %ptr_block2 = OpTypePointer Uniform %block2
+  %ptr_float = OpTypePointer Uniform %float
+        %int = OpTypeInt 32 1
+      %int_1 = OpConstant %int 1
+    %float_1 = OpConstant %float 1
+       %var1 = OpVariable %ptr_block1 Uniform
+       %var2 = OpVariable %ptr_block2 Uniform
+       %main = OpFunction %void None %func
+      %label = OpLabel
+    %member1 = OpAccessChain %ptr_float %var1 %int_1
+               OpStore %member1 %float_1
+    %member2 = OpAccessChain %ptr_float %var2 %int_1
+               OpStore %member2 %float_1
+               OpReturn
+               OpFunctionEnd
+)";
+
+    std::vector<uint32_t> grouped;
+    ASSERT_TRUE(ASMtoSPV(SPV_ENV_VULKAN_1_0, 0, spv_source, grouped));
+    std::vector<uint32_t> flattened;
+    spvtools::Optimizer optimizer(SPV_ENV_VULKAN_1_0);
+    optimizer.RegisterPass(spvtools::CreateFlattenDecorationPass());
+    ASSERT_TRUE(optimizer.Run(grouped.data(), grouped.size(), &flattened));
+    ASSERT_NE(grouped, flattened);
+
+    struct TestCase {
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+        const char *expected;
+    };
+    const std::vector<TestCase> test_cases = {
+        {{{1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+          {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}},
+         nullptr},
+        {{{1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}, "Shader uses descriptor slot 0.2"},
+        {{{1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+          {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}},
+         "but descriptor of type VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER"},
+    };
+
+    for (const auto &test_case : test_cases) {
+        for (const auto *spv : {&grouped, &flattened}) {
+            vk_testing::ShaderModule module;
+            module.init(*m_device, vk_testing::ShaderModule::create_info(spv->size() * sizeof(uint32_t), spv->data(), 0));
+
+            CreateComputePipelineHelper pipe(*this);
+            pipe.InitInfo();
+            pipe.dsl_bindings_ = test_case.bindings;
+            pipe.InitState();
+            pipe.LateBindPipelineInfo();
+            pipe.cp_ci_.stage.module = module.handle();
+            if (test_case.expected) {
+                m_errorMonitor->SetDesiredFailureMsg(kErrorBit, test_case.expected);
+            }
+            pipe.CreateComputePipeline(true, false);
+            if (test_case.expected) {
+                m_errorMonitor->VerifyFound();
+            }
+        }
+    }
+}
+
 TEST_F(VkLayerTest, CreateComputePipelineDescriptorTypeMismatch) {
     TEST_DESCRIPTION("Test that an error is produced for a pipeline consuming a descriptor-backed resource of a mismatched type");
 
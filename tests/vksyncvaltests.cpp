@@ -1107,6 +1107,97 @@ TEST_F(VkSyncValTest, SyncCopyBufferImageHazards) {
     m_commandBuffer->end();
 }
 
+TEST_F(VkSyncValTest, SyncCopyImagePartialRanges) {
+    // Accesses to parts of layered, mipmapped and 3D images, whose address ranges are batched and merged when the access
+    // state is updated and checked. Only the texels written may report a hazard.
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    VkBufferObj src_buffer, dst_buffer;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    src_buffer.init_as_src_and_dst(*m_device, 16384, mem_prop);
+    dst_buffer.init_as_src_and_dst(*m_device, 131072, mem_prop);
+
+    VkImageUsageFlags usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkImageObj image_2d(m_device), image_3d(m_device);
+    image_2d.Init(VkImageObj::ImageCreateInfo2D(64, 64, 3, 4, format, usage, VK_IMAGE_TILING_OPTIMAL));
+    ASSERT_TRUE(image_2d.initialized());
+    auto image_3d_ci = VkImageObj::ImageCreateInfo2D(32, 32, 2, 1, format, usage, VK_IMAGE_TILING_OPTIMAL);
+    image_3d_ci.imageType = VK_IMAGE_TYPE_3D;
+    image_3d_ci.extent.depth = 8;
+    image_3d.Init(image_3d_ci);
+    ASSERT_TRUE(image_3d.initialized());
+
+    m_commandBuffer->begin();
+    image_2d.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+    image_3d.SetLayout(m_commandBuffer, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_LAYOUT_GENERAL);
+
+    auto cb = m_commandBuffer->handle();
+    auto write = [&](VkImageObj &image, uint32_t mip, uint32_t base_layer, uint32_t layer_count, VkOffset3D offset,
+                     VkExtent3D extent) {
+        VkBufferImageCopy region = {0, 0, 0, {VK_IMAGE_ASPECT_COLOR_BIT, mip, base_layer, layer_count}, offset, extent};
+        vk::CmdCopyBufferToImage(cb, src_buffer.handle(), image.handle(), VK_IMAGE_LAYOUT_GENERAL, 1, &region);
+    };
+    // Each read goes to a part of dst_buffer not used before, so that only the image accesses can hazard
+    VkDeviceSize read_offset = 0;
+    auto read = [&](VkImageObj &image, uint32_t mip, uint32_t base_layer, uint32_t layer_count, VkOffset3D offset,
+                    VkExtent3D extent) {
+        VkBufferImageCopy region = {read_offset, 0, 0, {VK_IMAGE_ASPECT_COLOR_BIT, mip, base_layer, layer_count}, offset, extent};
+        read_offset += 4 * extent.width * extent.height * extent.depth * layer_count;
+        vk::CmdCopyImageToBuffer(cb, image.handle(), VK_IMAGE_LAYOUT_GENERAL, dst_buffer.handle(), 1, &region);
+    };
+
+    // Full width rows of a layer, the left half of another layer, a whole mip level and slices of the 3D image
+    write(image_2d, 0, 1, 1, {0, 16, 0}, {64, 16, 1});
+    write(image_2d, 0, 2, 1, {0, 0, 0}, {32, 64, 1});
+    write(image_2d, 1, 0, 4, {0, 0, 0}, {32, 32, 1});
+    write(image_3d, 0, 0, 1, {0, 0, 2}, {32, 32, 2});
+
+    m_errorMonitor->ExpectSuccess();
+    read(image_2d, 0, 1, 1, {0, 0, 0}, {64, 16, 1});
+    read(image_2d, 0, 1, 1, {0, 32, 0}, {64, 32, 1});
+    read(image_2d, 0, 0, 1, {0, 0, 0}, {64, 64, 1});
+    read(image_2d, 0, 3, 1, {0, 0, 0}, {64, 64, 1});
+    read(image_2d, 0, 2, 1, {32, 0, 0}, {32, 64, 1});
+    read(image_2d, 2, 0, 4, {0, 0, 0}, {16, 16, 1});
+    read(image_3d, 0, 0, 1, {0, 0, 0}, {32, 32, 2});
+    read(image_3d, 0, 0, 1, {0, 0, 4}, {32, 32, 4});
+    read(image_3d, 1, 0, 1, {0, 0, 0}, {16, 16, 4});
+    m_errorMonitor->VerifyNotFound();
+
+    // The first and last texels of each write
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_2d, 0, 1, 1, {0, 31, 0}, {64, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_2d, 0, 1, 1, {63, 16, 0}, {1, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_2d, 0, 2, 1, {31, 63, 0}, {1, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_2d, 1, 3, 1, {0, 31, 0}, {32, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_2d, 1, 0, 1, {0, 0, 0}, {1, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_3d, 0, 0, 1, {0, 31, 3}, {32, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-READ-AFTER-WRITE");
+    read(image_3d, 0, 0, 1, {0, 0, 2}, {1, 1, 1});
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->end();
+}
+
 TEST_F(VkSyncValTest, SyncBlitImageHazards) {
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
     ASSERT_NO_FATAL_FAILURE(InitState());